@@ -0,0 +1,232 @@
+/**
+ * @file allocator.h
+ * @brief Pluggable memory allocator
+ * @author XMD Team
+ *
+ * Every heap allocation made by the library goes through the xmd_malloc
+ * family, which forwards to the installed allocator or to libc when none
+ * is installed. The functions have the same contract as their libc
+ * counterparts, so memory from one must be released with xmd_free.
+ */
+
+#ifndef XMD_ALLOCATOR_H
+#define XMD_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform.h"
+
+/**
+ * @brief What an allocation is used for, for per-category statistics
+ */
+typedef enum {
+    XMD_ALLOC_GENERAL,      /**< Untagged allocations */
+    XMD_ALLOC_STRING,       /**< String copies */
+    XMD_ALLOC_VARIABLE,     /**< Variable values and their containers */
+    XMD_ALLOC_STORE,        /**< Variable store tables */
+    XMD_ALLOC_AST,          /**< Syntax tree nodes */
+    XMD_ALLOC_TOKEN,        /**< Lexer tokens */
+    XMD_ALLOC_CATEGORY_COUNT
+} xmd_alloc_category;
+
+/**
+ * @brief Allocator interface
+ *
+ * allocate and reallocate follow malloc/realloc semantics. deallocate is
+ * never called with NULL. Install an allocator before the library
+ * allocates anything, unless it can release libc memory (as the stats
+ * allocator can), and keep it installed while that memory is live.
+ *
+ * block_size is optional. Without it, heap budgets cannot credit released
+ * blocks and charge an allocator's blocks at their requested size.
+ */
+typedef struct xmd_allocator {
+    void* (*allocate)(void* user_data, size_t size, xmd_alloc_category category);
+    void* (*reallocate)(void* user_data, void* ptr, size_t size, xmd_alloc_category category);
+    void (*deallocate)(void* user_data, void* ptr);
+    void* user_data;
+    size_t (*block_size)(void* user_data, void* ptr);  /**< Usable size of a block (optional) */
+} xmd_allocator;
+
+/**
+ * @brief Allocation statistics collected by the stats allocator
+ *
+ * Sizes are usable block sizes as reported by the platform allocator,
+ * so blocks allocated before the stats allocator was installed are
+ * still accounted correctly when they are freed.
+ */
+typedef struct xmd_alloc_stats {
+    uint64_t allocations[XMD_ALLOC_CATEGORY_COUNT];  /**< Allocation calls per category */
+    uint64_t bytes[XMD_ALLOC_CATEGORY_COUNT];        /**< Bytes allocated per category */
+    uint64_t deallocations;
+    uint64_t live_bytes;
+    uint64_t peak_live_bytes;
+    xmd_mutex_t lock;
+} xmd_alloc_stats;
+
+/**
+ * @brief Live heap accounting for one render
+ *
+ * While attached to a thread, the budget is charged for every block the
+ * thread allocates and credited for every block it releases. Releasing a
+ * block from before the budget was attached never takes live_bytes below
+ * zero. An allocation that would take live_bytes past a nonzero limit
+ * fails instead and marks the budget exceeded.
+ */
+typedef struct xmd_heap_budget {
+    uint64_t limit_bytes;   /**< Live bytes allowed, 0 for no limit */
+    uint64_t live_bytes;    /**< Bytes currently allocated */
+    uint64_t peak_bytes;    /**< Highest live_bytes seen */
+    bool exceeded;          /**< An allocation was refused */
+} xmd_heap_budget;
+
+/**
+ * @brief Install the process-wide allocator
+ * @param allocator Allocator to copy, or NULL to restore libc
+ * @return 0 on success, -1 if the allocator is incomplete
+ */
+int xmd_allocator_set(const xmd_allocator* allocator);
+
+/**
+ * @brief Get the installed allocator
+ * @return Installed allocator, or NULL when libc is used
+ */
+const xmd_allocator* xmd_allocator_get(void);
+
+/**
+ * @brief Allocate memory (malloc contract)
+ * @param size Size in bytes
+ * @return Memory or NULL on failure
+ */
+void* xmd_malloc(size_t size);
+
+/**
+ * @brief Allocate zeroed memory (calloc contract)
+ * @param count Number of elements
+ * @param size Size of each element
+ * @return Memory or NULL on failure or overflow
+ */
+void* xmd_calloc(size_t count, size_t size);
+
+/**
+ * @brief Resize memory (realloc contract; size 0 frees and returns NULL)
+ * @param ptr Existing memory or NULL
+ * @param size New size
+ * @return Memory or NULL on failure
+ */
+void* xmd_realloc(void* ptr, size_t size);
+
+/**
+ * @brief Release memory from the xmd_malloc family
+ * @param ptr Memory or NULL
+ */
+void xmd_free(void* ptr);
+
+/**
+ * @brief Duplicate a string
+ * @param str String to duplicate
+ * @return Copy or NULL on failure or NULL input
+ */
+char* xmd_strdup(const char* str);
+
+/**
+ * @brief Duplicate at most n bytes of a string
+ * @param str String to duplicate
+ * @param n Maximum bytes to copy
+ * @return NUL-terminated copy or NULL on failure or NULL input
+ */
+char* xmd_strndup(const char* str, size_t n);
+
+/**
+ * @brief Allocate memory for a category
+ * @param size Size in bytes
+ * @param category Allocation category
+ * @return Memory or NULL on failure
+ */
+void* xmd_malloc_tagged(size_t size, xmd_alloc_category category);
+
+/**
+ * @brief Allocate zeroed memory for a category
+ * @param count Number of elements
+ * @param size Size of each element
+ * @param category Allocation category
+ * @return Memory or NULL on failure or overflow
+ */
+void* xmd_calloc_tagged(size_t count, size_t size, xmd_alloc_category category);
+
+/**
+ * @brief Resize memory for a category
+ * @param ptr Existing memory or NULL
+ * @param size New size
+ * @param category Allocation category
+ * @return Memory or NULL on failure
+ */
+void* xmd_realloc_tagged(void* ptr, size_t size, xmd_alloc_category category);
+
+/**
+ * @brief Initialize allocation statistics
+ * @param stats Statistics to initialize
+ * @return 0 on success, -1 on error
+ */
+int xmd_alloc_stats_init(xmd_alloc_stats* stats);
+
+/**
+ * @brief Release allocation statistics
+ * @param stats Statistics to release
+ */
+void xmd_alloc_stats_destroy(xmd_alloc_stats* stats);
+
+/**
+ * @brief Create a libc-backed allocator that records statistics
+ *
+ * Each allocation and release is also reported to the profiler attached
+ * to the calling thread, if any.
+ *
+ * @param stats Initialized statistics to update
+ * @return Allocator to pass to xmd_allocator_set
+ */
+xmd_allocator xmd_alloc_stats_allocator(xmd_alloc_stats* stats);
+
+/**
+ * @brief Initialize a heap budget
+ * @param budget Budget to initialize
+ * @param limit_bytes Live bytes allowed, 0 for no limit
+ */
+void xmd_heap_budget_init(xmd_heap_budget* budget, uint64_t limit_bytes);
+
+/**
+ * @brief Attach a heap budget to the calling thread
+ * @param budget Budget to attach, or NULL to detach
+ * @return Previously attached budget
+ */
+xmd_heap_budget* xmd_heap_budget_attach(xmd_heap_budget* budget);
+
+/**
+ * @brief Charge the calling thread's budget for a block allocated without it
+ *
+ * For blocks handed over from threads with no budget attached, so that
+ * releasing them later is balanced. A block that would take the budget
+ * past its limit is not charged and the budget is marked exceeded; the
+ * caller should release it with the budget detached.
+ *
+ * @param ptr Block from the xmd_malloc family, or NULL
+ * @param size Size of the block if the allocator cannot tell
+ * @return true if charged or no budget is attached, false if over the limit
+ */
+bool xmd_heap_budget_adopt(void* ptr, size_t size);
+
+/**
+ * @brief Check whether the calling thread's budget refused an allocation
+ * @return true if a budget is attached and exceeded
+ */
+bool xmd_heap_budget_exhausted(void);
+
+/**
+ * @brief Name of an allocation category
+ * @param category Allocation category
+ * @return Static name
+ */
+const char* xmd_alloc_category_name(xmd_alloc_category category);
+
+#endif /* XMD_ALLOCATOR_H */
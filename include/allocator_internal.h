@@ -0,0 +1,24 @@
+/**
+ * @file allocator_internal.h
+ * @brief Internal header for the pluggable allocator
+ * @author XMD Team
+ */
+
+#ifndef ALLOCATOR_INTERNAL_H
+#define ALLOCATOR_INTERNAL_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "allocator.h"
+
+/** Installed allocator, or NULL to use libc directly */
+extern const xmd_allocator* xmd_current_allocator;
+
+/** Heap budget attached to the calling thread, or NULL */
+extern XMD_THREAD_LOCAL xmd_heap_budget* xmd_active_heap_budget;
+
+size_t xmd_block_size(void* ptr, size_t fallback);
+bool xmd_heap_budget_admit(xmd_heap_budget* budget, size_t bytes);
+void xmd_heap_budget_account(xmd_heap_budget* budget, size_t allocated, size_t released);
+
+#endif /* ALLOCATOR_INTERNAL_H */
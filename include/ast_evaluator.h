@@ -84,6 +84,19 @@ ast_value* ast_evaluate_expression(ast_node* node, ast_evaluator* evaluator);
  */
 ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator);
 
+/**
+ * @brief Evaluate a range expression without materializing its items
+ *
+ * Bounds and step may be numbers or numeric strings. A range of more
+ * than max_loop_iterations items, when that limit is set, is an error:
+ * the evaluator's error_message says so and NULL is returned.
+ *
+ * @param node Range AST node
+ * @param evaluator Evaluator context
+ * @return Range array variable or NULL on error
+ */
+variable* ast_evaluate_range(ast_node* node, ast_evaluator* evaluator);
+
 /* Evaluator management */
 
 /**
@@ -39,7 +39,8 @@ typedef enum {
     AST_CONDITIONAL,       /**< if/elif/else blocks */
     AST_LOOP,              /**< for loops */
     AST_BLOCK,             /**< Statement blocks */
-    AST_IDENTIFIER         /**< Identifiers */
+    AST_IDENTIFIER,        /**< Identifiers */
+    AST_RANGE              /**< Numeric ranges start..end step n */
 } ast_node_type;
 
 /**
@@ -163,6 +164,13 @@ struct ast_node {
             ast_node* index_expr;    /**< Index expression */
         } array_access;
         
+        /**< Range */
+        struct {
+            ast_node* start;         /**< First item */
+            ast_node* end;           /**< Last item (inclusive) */
+            ast_node* step;          /**< Step, NULL for 1 or -1 */
+        } range;
+        
         /**< Conditional (if/elif/else) */
         struct {
             ast_node* condition;     /**< NULL for else */
@@ -204,6 +212,7 @@ ast_node* ast_create_number_literal(double value, source_location loc);
 ast_node* ast_create_boolean_literal(bool value, source_location loc);
 ast_node* ast_create_array_literal(source_location loc);
 ast_node* ast_create_array_access(ast_node* array_expr, ast_node* index_expr, source_location loc);
+ast_node* ast_create_range(ast_node* start, ast_node* end, ast_node* step, source_location loc);
 ast_node* ast_create_conditional(ast_node* condition, source_location loc);
 ast_node* ast_create_loop(const char* variable, ast_node* iterable, source_location loc);
 ast_node* ast_create_block(source_location loc);
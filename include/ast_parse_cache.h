@@ -0,0 +1,112 @@
+/**
+ * @file ast_parse_cache.h
+ * @brief Cache of parsed condition and expression programs
+ * @author XMD Team
+ *
+ * Conditions and {{expression}} placeholders are lexed and parsed once per
+ * distinct text and kept in a least-recently-used table, so an if or a
+ * placeholder inside a loop is parsed once rather than once per iteration.
+ * The cache also owns the evaluator and the temporary processor context
+ * they are evaluated with, so a cached text is evaluated without lexing,
+ * parsing or setup allocations.
+ */
+
+#ifndef AST_PARSE_CACHE_H
+#define AST_PARSE_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform.h"
+#include "ast_evaluator.h"
+
+/** Distinct texts kept parsed */
+#define AST_PARSE_CACHE_CAPACITY 128
+
+/** Hash buckets (power of two, larger than the capacity) */
+#define AST_PARSE_CACHE_BUCKETS 256
+
+/**
+ * @brief One parsed text
+ */
+typedef struct {
+    char* text;             /**< Source text (NULL if the slot is free) */
+    ast_node* program;      /**< Parsed program, NULL if the text does not parse */
+    int32_t chain;          /**< Next entry in the same bucket, -1 at the end */
+    int32_t newer;          /**< Next more recently used entry, -1 if newest */
+    int32_t older;          /**< Next less recently used entry, -1 if oldest */
+} ast_parse_cache_entry;
+
+/**
+ * @brief Parsed-program cache with its reusable evaluator
+ */
+typedef struct ast_parse_cache {
+    ast_parse_cache_entry entries[AST_PARSE_CACHE_CAPACITY];
+    int32_t buckets[AST_PARSE_CACHE_BUCKETS];  /**< First entry per bucket, -1 if empty */
+    size_t count;                   /**< Entries in use */
+    int32_t newest;                 /**< Most recently used entry, -1 if empty */
+    int32_t oldest;                 /**< Least recently used entry, -1 if empty */
+    processor_context context;      /**< Temporary context conditions see */
+    ast_evaluator evaluator;        /**< Evaluator reused by every evaluation */
+    bool evaluating;                /**< The evaluator is in use */
+    uint64_t hits;                  /**< Lookups served from the cache */
+    uint64_t misses;                /**< Lookups that parsed */
+} ast_parse_cache;
+
+/**
+ * @brief Cache attached to the calling thread, or NULL
+ */
+extern XMD_THREAD_LOCAL ast_parse_cache* xmd_active_parse_cache;
+
+/**
+ * @brief Create an empty cache
+ * @return Cache or NULL on allocation failure
+ */
+ast_parse_cache* ast_parse_cache_create(void);
+
+/**
+ * @brief Destroy a cache and every program it holds
+ * @param cache Cache to destroy
+ */
+void ast_parse_cache_destroy(ast_parse_cache* cache);
+
+/**
+ * @brief Attach a cache to the calling thread
+ * @param cache Cache to attach, or NULL to detach
+ * @return Previously attached cache
+ */
+ast_parse_cache* ast_parse_cache_attach(ast_parse_cache* cache);
+
+/**
+ * @brief Get the parsed program for a text, parsing it on a miss
+ *
+ * The program stays valid until the entry is evicted, that is until
+ * AST_PARSE_CACHE_CAPACITY other texts have been looked up. Texts that
+ * do not parse are cached too.
+ *
+ * @param cache Cache
+ * @param text Source text
+ * @return Parsed program (owned by the cache) or NULL if the text does not parse
+ */
+ast_node* ast_parse_cache_lookup(ast_parse_cache* cache, const char* text);
+
+/**
+ * @brief Take the cache's evaluator, reset for a new evaluation
+ *
+ * Returns NULL while the evaluator is taken: a condition evaluated while
+ * another is (through an import, say) uses its own evaluator and does not
+ * look up the cache, so it cannot evict the program still being
+ * evaluated. Release it with ast_parse_cache_release.
+ *
+ * @param cache Cache
+ * @param variables Variables the evaluation reads
+ * @return Evaluator or NULL if it is in use
+ */
+ast_evaluator* ast_parse_cache_take_evaluator(ast_parse_cache* cache, store* variables);
+
+/**
+ * @brief Give back the evaluator taken from a cache
+ * @param cache Cache
+ */
+void ast_parse_cache_release(ast_parse_cache* cache);
+
+#endif /* AST_PARSE_CACHE_H */
@@ -0,0 +1,80 @@
+/**
+ * @file bench_corpus.h
+ * @brief Reproducible macro-benchmark corpus
+ * @author XMD Team
+ *
+ * The corpus is generated deterministically from a scale factor, so two
+ * runs at the same scale process byte-identical inputs.
+ */
+
+#ifndef BENCH_CORPUS_H
+#define BENCH_CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "xmd.h"
+
+/** Number of cases in the corpus */
+#define BENCH_CORPUS_CASE_COUNT 6
+
+/**
+ * @brief What one iteration of a case does
+ */
+typedef enum {
+    BENCH_CASE_RENDER,          /**< Render the entry file as a template */
+    BENCH_CASE_DATA_IMPORT      /**< Import the entry file as structured data */
+} bench_case_kind;
+
+/**
+ * @brief One benchmark case
+ */
+typedef struct bench_case {
+    const char* name;           /**< Case name (static) */
+    bench_case_kind kind;       /**< Work done per iteration */
+    const char* path;           /**< Entry file (owned by the corpus) */
+    char* content;              /**< Entry file text (render cases) */
+    size_t content_length;      /**< Entry file length */
+    uint64_t bytes;             /**< Input bytes per iteration, imports included */
+    xmd_processor* processor;   /**< Processor reused across iterations */
+} bench_case;
+
+/**
+ * @brief Generated corpus on disk
+ */
+typedef struct bench_corpus {
+    char* dir;                  /**< Directory holding the files */
+    bool remove_dir;            /**< Directory is temporary and removed on destroy */
+    char** files;               /**< Every file written */
+    size_t file_count;
+    size_t file_capacity;
+    bench_case cases[BENCH_CORPUS_CASE_COUNT];
+    size_t case_count;
+} bench_corpus;
+
+/**
+ * @brief Generate the corpus
+ *
+ * Cases: prose, variables, nested_loops, import_fanout, json_import and
+ * exec_stub. Input sizes scale linearly with scale.
+ *
+ * @param dir Directory to write into, or NULL for a temporary directory
+ * @param scale Size multiplier (1.0 = default sizes)
+ * @return Corpus or NULL on error
+ */
+bench_corpus* bench_corpus_create(const char* dir, double scale);
+
+/**
+ * @brief Run one iteration of a case
+ * @param data bench_case to run
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_run_case(void* data);
+
+/**
+ * @brief Release the corpus and remove a temporary directory
+ * @param corpus Corpus (may be NULL)
+ */
+void bench_corpus_destroy(bench_corpus* corpus);
+
+#endif /* BENCH_CORPUS_H */
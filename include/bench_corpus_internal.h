@@ -0,0 +1,37 @@
+/**
+ * @file bench_corpus_internal.h
+ * @brief Internal corpus file writers
+ * @author XMD Team
+ */
+
+#ifndef BENCH_CORPUS_INTERNAL_H
+#define BENCH_CORPUS_INTERNAL_H
+
+#include <stdio.h>
+#include "bench_corpus.h"
+
+/**
+ * @brief Create a corpus file and record it for cleanup
+ * @param corpus Corpus
+ * @param name File name inside the corpus directory
+ * @param path Receives the full path (owned by the corpus, may be NULL)
+ * @return Open stream or NULL on error
+ */
+FILE* bench_corpus_open(bench_corpus* corpus, const char* name, const char** path);
+
+/**
+ * @brief Deterministic pseudo-random word for generated text
+ * @param state Generator state
+ * @return Static word
+ */
+const char* bench_corpus_word(uint32_t* state);
+
+/* Case writers: each fills path, kind and bytes of the case */
+int bench_corpus_write_prose(bench_corpus* corpus, bench_case* bench, double scale);
+int bench_corpus_write_variables(bench_corpus* corpus, bench_case* bench, double scale);
+int bench_corpus_write_loops(bench_corpus* corpus, bench_case* bench, double scale);
+int bench_corpus_write_imports(bench_corpus* corpus, bench_case* bench, double scale);
+int bench_corpus_write_json(bench_corpus* corpus, bench_case* bench, double scale);
+int bench_corpus_write_exec(bench_corpus* corpus, bench_case* bench, double scale);
+
+#endif /* BENCH_CORPUS_INTERNAL_H */
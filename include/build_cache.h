@@ -0,0 +1,227 @@
+/**
+ * @file build_cache.h
+ * @brief Persistent incremental build cache
+ * @author XMD Team
+ *
+ * For every rendered file the cache keeps an entry with the hash of its
+ * source, of each file it imported (including imports that were missing)
+ * and of the output it produced. A later build skips a file whose entry
+ * still matches: same source, same build options, same imported files
+ * and an untouched output. Documents that ran a command are never
+ * skipped, since their input cannot be observed.
+ */
+
+#ifndef BUILD_CACHE_H
+#define BUILD_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "platform.h"
+#include "store.h"
+
+/** Default cache directory, relative to the working directory */
+#define BUILD_CACHE_DEFAULT_DIR ".xmd-cache/build"
+
+/**
+ * @brief A file read by a render, identified by path and content hash
+ */
+typedef struct build_input {
+    char* path;         /**< Path as resolved by the import */
+    uint64_t hash;      /**< Content hash, 0 if the file was missing */
+} build_input;
+
+/**
+ * @brief Inputs consumed by one render
+ */
+typedef struct build_inputs {
+    build_input* files;     /**< Distinct files read, in first-read order */
+    size_t count;           /**< Number of files */
+    size_t capacity;        /**< Allocated entries */
+    bool ran_commands;      /**< An exec directive ran */
+} build_inputs;
+
+/**
+ * @brief Inputs recorder attached to the calling thread, or NULL
+ */
+extern XMD_THREAD_LOCAL build_inputs* xmd_active_build_inputs;
+
+/**
+ * @brief Directories written during one rebuild wave
+ *
+ * While a batch is attached to a thread, build_write_output flushes each
+ * file's data before renaming it into place and defers the directory
+ * flush, so a wave of writes costs one directory fsync per directory.
+ */
+typedef struct build_write_batch {
+    char** directories;     /**< Distinct directories with renamed files */
+    size_t count;           /**< Number of directories */
+    size_t capacity;        /**< Allocated entries */
+    size_t files_written;   /**< Files written since the last flush */
+} build_write_batch;
+
+/**
+ * @brief Write batch attached to the calling thread, or NULL
+ */
+extern XMD_THREAD_LOCAL build_write_batch* xmd_active_write_batch;
+
+/**
+ * @brief Outcome of building one file
+ */
+typedef enum {
+    BUILD_FILE_RENDERED,    /**< Rendered and written */
+    BUILD_FILE_UNCHANGED,   /**< Rendered to the bytes already on disk, not rewritten */
+    BUILD_FILE_CACHED,      /**< Inputs unchanged since the last build, not rendered */
+    BUILD_FILE_FAILED       /**< Could not be read, rendered or written */
+} build_file_status;
+
+/**
+ * @brief Open build cache directory
+ */
+typedef struct build_cache {
+    char* directory;        /**< Entry directory */
+    uint64_t options_hash;  /**< Hash of the options every entry was built with */
+} build_cache;
+
+/**
+ * @brief Attach an inputs recorder to the calling thread
+ * @param inputs Recorder to attach, or NULL to detach
+ * @return Previously attached recorder
+ */
+build_inputs* build_inputs_attach(build_inputs* inputs);
+
+/**
+ * @brief Record a file read by the current render
+ * @param path File path
+ * @param content File content, or NULL if the file was missing
+ * @param length Content length
+ */
+void build_inputs_record_file(const char* path, const void* content, size_t length);
+
+/**
+ * @brief Record a file the current render reads by path
+ *
+ * Hashes the file from disk; does nothing unless a recorder is attached.
+ *
+ * @param path File path
+ */
+void build_inputs_record_path(const char* path);
+
+/**
+ * @brief Record that the current render ran a command
+ * @param command Command text
+ */
+void build_inputs_record_command(const char* command);
+
+/**
+ * @brief Release the recorded inputs
+ * @param inputs Recorder to clear (remains usable)
+ */
+void build_inputs_clear(build_inputs* inputs);
+
+/**
+ * @brief Hash file or output content for the cache
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @return 64-bit content hash (never 0)
+ */
+uint64_t build_cache_hash(const void* data, size_t length);
+
+/**
+ * @brief Open a cache directory, creating it if needed
+ * @param directory Cache directory
+ * @param options_hash Hash of the options that affect rendering
+ * @return Cache or NULL on error
+ */
+build_cache* build_cache_open(const char* directory, uint64_t options_hash);
+
+/**
+ * @brief Close a cache
+ * @param cache Cache to close
+ */
+void build_cache_close(build_cache* cache);
+
+/**
+ * @brief Check whether a file's last build is still valid
+ * @param cache Cache
+ * @param input_path Source file
+ * @param source_hash Hash of the current source
+ * @param output_path Output file
+ * @return true if the source, options, imports and output all match
+ */
+bool build_cache_is_fresh(const build_cache* cache, const char* input_path,
+                          uint64_t source_hash, const char* output_path);
+
+/**
+ * @brief Store the entry for a file that was just built
+ * @param cache Cache
+ * @param input_path Source file
+ * @param source_hash Hash of the source that was rendered
+ * @param output_path Output file
+ * @param output_hash Hash of the output
+ * @param inputs Inputs the render consumed
+ * @return 0 on success, -1 on error
+ */
+int build_cache_store(const build_cache* cache, const char* input_path, uint64_t source_hash,
+                      const char* output_path, uint64_t output_hash, const build_inputs* inputs);
+
+/**
+ * @brief Remove a file's entry
+ * @param cache Cache
+ * @param input_path Source file
+ */
+void build_cache_forget(const build_cache* cache, const char* input_path);
+
+/**
+ * @brief Write content to a file unless it already holds exactly those bytes
+ *
+ * The existing file is compared by size, then byte for byte. A changed
+ * file is written to a temporary file and renamed over the old one, so
+ * readers never see a partial output. The replacement keeps the old
+ * file's permission bits but not its owner, and a symlinked output is
+ * written at the link's target.
+ *
+ * @param path Output file
+ * @param content Content
+ * @param length Content length
+ * @param written Receives whether the file was written (optional)
+ * @return 0 on success, -1 on error
+ */
+int build_write_output(const char* path, const char* content, size_t length, bool* written);
+
+/**
+ * @brief Initialize a write batch
+ * @param batch Batch to initialize
+ */
+void build_write_batch_init(build_write_batch* batch);
+
+/**
+ * @brief Attach a write batch to the calling thread
+ * @param batch Batch to attach, or NULL to detach
+ * @return Previously attached batch
+ */
+build_write_batch* build_write_batch_attach(build_write_batch* batch);
+
+/**
+ * @brief End a rebuild wave: flush every directory written to, once
+ * @param batch Batch to flush (emptied, and reusable for the next wave)
+ * @return 0 on success, -1 if a directory could not be flushed
+ */
+int build_write_batch_flush(build_write_batch* batch);
+
+/**
+ * @brief Build one file through the cache
+ *
+ * Each file renders in its own scope over variables, so assignments in
+ * one document never leak into the next.
+ *
+ * @param cache Cache, or NULL to always render
+ * @param variables Variables visible to the render
+ * @param input_path Source file
+ * @param output_path Output file
+ * @return Outcome
+ */
+build_file_status build_cache_build_file(const build_cache* cache, store* variables,
+                                         const char* input_path, const char* output_path);
+
+#endif /* BUILD_CACHE_H */
@@ -0,0 +1,26 @@
+/**
+ * @file build_cache_internal.h
+ * @brief Internal header for the incremental build cache
+ * @author XMD Team
+ */
+
+#ifndef BUILD_CACHE_INTERNAL_H
+#define BUILD_CACHE_INTERNAL_H
+
+#include "build_cache.h"
+
+/** First line of every entry file */
+#define BUILD_CACHE_MAGIC "xmd-build-cache 1"
+
+/** Seed separating build cache hashes from data snapshot keys */
+#define BUILD_CACHE_HASH_SEED 0x6275696c64ULL
+
+/** Longest path an entry records; longer paths are not cached */
+#define BUILD_CACHE_PATH_MAX 4096
+
+char* build_cache_read_file(const char* path, size_t* length);
+char* build_cache_entry_path(const build_cache* cache, const char* input_path);
+int build_cache_make_directory(const char* directory);
+int build_write_batch_add_directory(build_write_batch* batch, const char* file_path);
+
+#endif /* BUILD_CACHE_INTERNAL_H */
@@ -17,6 +17,8 @@
 #include "lexer.h"
 #include "token.h"
 #include "store.h"
+#include "performance.h"
+#include "platform.h"
 
 // Forward declarations for XMD directive processor
 int process_xmd_directive(const char* directive, store* var_store, char* output, size_t output_size);
@@ -29,12 +31,28 @@ int process_complete_if_statement(const char* content, size_t if_start, size_t a
 // Use xmd_result from cli.h
 
 // Internal XMD context structure
+//
+// A context is used by one thread at a time. Renders share its globals
+// by reference, and reading a variable can change it (refcounts, lazily
+// built members), so lock is held for each render and each change to the
+// globals: concurrent calls on one context run one after another, and
+// separate contexts render in parallel.
 typedef struct xmd_context_internal {
     xmd_config* config;
     bool initialized;
     store* global_variables;
+    perf_profiler* profiler;      // Attached to each render when profiling
+    char* profile_report;         // JSON report of the most recent render
+    xmd_mutex_t lock;             // Serializes renders and global updates
 } xmd_context_internal;
 
+// Processor behind the xmd_processor_* API
+struct xmd_processor {
+    store* variables;             // Variables shared by every render
+    uint64_t memory_limit_bytes;  // Live heap allowed per render, 0 for no limit
+    struct ast_parse_cache* expressions;  // Parsed conditions and placeholders kept across renders
+};
+
 // Function declarations
 bool c_api_evaluate_condition(const char* condition, store* var_store);
 void* c_api_xmd_init(const char* config_path);
@@ -51,6 +69,9 @@ void c_api_xmd_result_free(xmd_result* result);
 void c_api_xmd_cleanup(void* handle);
 const char* c_api_xmd_get_version(void);
 int c_api_xmd_set_variable(void* processor, const char* key, const char* value);
+int c_api_xmd_set_global(void* processor, const char* key, variable* value);
+int c_api_xmd_set_profiling(void* handle, bool enabled);
+const char* c_api_xmd_get_profile(void* handle);
 char* c_api_xmd_get_variable(void* processor, const char* key);
 
 #endif /* C_API_INTERNAL_H */
\ No newline at end of file
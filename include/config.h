@@ -21,6 +21,7 @@ typedef struct xmd_resource_limits {
     size_t max_output_size;          /**< Maximum output size in bytes */
     size_t max_recursion_depth;      /**< Maximum recursion depth */
     size_t max_loop_iterations;      /**< Maximum loop iterations */
+    size_t max_parallel_exec;        /**< Maximum exec commands run concurrently */
 } xmd_resource_limits;
 
 /**
@@ -40,6 +41,7 @@ typedef struct xmd_paths_config {
     char* proc_status_path;          /**< Path to process status (default: /proc/self/status) */
     char* proc_fd_path;              /**< Path to process file descriptors (default: /proc/self/fd) */
     char* temp_dir;                  /**< Temporary directory path */
+    char* data_cache_dir;            /**< Snapshot cache for data imports (NULL disables) */
     char** module_search_paths;      /**< Module search paths */
     size_t module_search_path_count; /**< Number of module search paths */
 } xmd_paths_config;
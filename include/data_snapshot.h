@@ -0,0 +1,113 @@
+/**
+ * @file data_snapshot.h
+ * @brief Persistent binary snapshots of imported data trees
+ * @author XMD Team
+ *
+ * A snapshot is a flat serialization of a variable tree in which every
+ * reference is a relative offset, so a mapped file can be navigated in
+ * place and only the members actually read are turned back into
+ * variables. Subtrees shared within the tree are stored and decoded once.
+ */
+
+#ifndef DATA_SNAPSHOT_H
+#define DATA_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "variable.h"
+
+typedef struct data_snapshot data_snapshot;
+
+/**
+ * @brief Identity of the source a snapshot was built from
+ *
+ * hash names the snapshot file; check and length are stored in it and
+ * compared on open, so a hash collision does not hand back another
+ * file's data.
+ */
+typedef struct {
+    uint64_t hash;              /**< data_snapshot_hash of the source */
+    uint64_t check;             /**< Independently seeded second hash */
+    uint64_t length;            /**< Source length in bytes */
+} data_snapshot_key;
+
+/**
+ * @brief Hash content to key a snapshot
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @param seed Seed distinguishing the source format
+ * @return 64-bit content hash
+ */
+uint64_t data_snapshot_hash(const void* data, size_t length, uint64_t seed);
+
+/**
+ * @brief Compute the snapshot key of source content
+ * @param data Source bytes
+ * @param length Number of bytes
+ * @param seed Seed distinguishing the source format
+ * @return Key
+ */
+data_snapshot_key data_snapshot_key_of(const void* data, size_t length, uint64_t seed);
+
+/**
+ * @brief Serialize a variable tree to a snapshot file
+ *
+ * The file is written under a temporary name and renamed into place, so
+ * concurrent readers never see a partial snapshot.
+ *
+ * @param value Tree to serialize
+ * @param key Key of the source the tree was parsed from
+ * @param path Destination file
+ * @return true on success
+ */
+bool data_snapshot_write(const variable* value, const data_snapshot_key* key, const char* path);
+
+/**
+ * @brief Map a snapshot file
+ * @param path Snapshot file
+ * @param key Expected source key (hash, check and length must all match)
+ * @return Snapshot handle, or NULL if missing, stale or corrupt
+ */
+data_snapshot* data_snapshot_open(const char* path, const data_snapshot_key* key);
+
+/**
+ * @brief View the value at a dotted path of a snapshot
+ *
+ * Segments are separated by '.' and array elements may be written as
+ * "items.0" or "items[0]". An object or array found is a lazy view:
+ * members are decoded from the mapping when first read, and the mapping
+ * stays open, even past data_snapshot_close, until the view is freed.
+ *
+ * @param snapshot Snapshot handle
+ * @param path Path to the value ("" for the root)
+ * @return New variable (caller unrefs), or NULL if absent
+ */
+variable* data_snapshot_find(data_snapshot* snapshot, const char* path);
+
+/**
+ * @brief Import a data file through the snapshot cache
+ *
+ * The file is keyed by its content; a matching snapshot in cache_dir is
+ * returned as a lazy view instead of parsing the file, otherwise the file
+ * is parsed and a snapshot is written for the next import. A stamp of
+ * the file's size, modification time and inode records the key last
+ * computed for it, so an unchanged file is not even read; files modified
+ * within a second of being stamped are always hashed.
+ *
+ * @param file_path JSON or YAML file
+ * @param is_yaml Parse as YAML rather than JSON
+ * @param cache_dir Snapshot directory (created if missing)
+ * @param error_message Pointer to store error message (optional, caller frees)
+ * @return Imported data or NULL on error
+ */
+variable* data_snapshot_import_file(const char* file_path, bool is_yaml,
+                                    const char* cache_dir, char** error_message);
+
+/**
+ * @brief Release a snapshot; the mapping goes with the last view on it
+ * @param snapshot Snapshot handle
+ */
+void data_snapshot_close(data_snapshot* snapshot);
+
+#endif /* DATA_SNAPSHOT_H */
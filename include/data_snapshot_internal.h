@@ -0,0 +1,127 @@
+/**
+ * @file data_snapshot_internal.h
+ * @brief On-disk layout of data snapshots
+ * @author XMD Team
+ *
+ * Every node starts on an 8-byte boundary with a {type, count} header:
+ *   null/boolean   count holds the boolean value
+ *   number         followed by a double
+ *   string         count is the byte length; bytes and a NUL follow
+ *   array          followed by count uint64 child offsets
+ *   object         followed by count {key, value} uint64 offset pairs,
+ *                  keys being string nodes
+ * Children are written before their parent, so offsets are relative to
+ * the referring node and always point backward, which rules out cycles
+ * in corrupted files. A value shared by several parents (a YAML alias)
+ * is written once and referenced by each of them, and its type carries
+ * DATA_SNAPSHOT_SHARED so readers decode it once too.
+ */
+
+#ifndef DATA_SNAPSHOT_INTERNAL_H
+#define DATA_SNAPSHOT_INTERNAL_H
+
+#include "data_snapshot.h"
+
+#define DATA_SNAPSHOT_MAGIC "XMDSNAP"
+#define DATA_SNAPSHOT_VERSION 3
+#define DATA_SNAPSHOT_MAX_DEPTH 1024
+#define DATA_SNAPSHOT_SHARED 0x80000000u
+
+/**
+ * @brief File header
+ */
+typedef struct {
+    char magic[8];              /**< DATA_SNAPSHOT_MAGIC, NUL padded */
+    uint32_t version;           /**< DATA_SNAPSHOT_VERSION */
+    uint32_t byte_order;        /**< 0x01020304 as written by the producer */
+    uint64_t content_hash;      /**< data_snapshot_key hash of the source file */
+    uint64_t content_check;     /**< data_snapshot_key check of the source file */
+    uint64_t content_length;    /**< Source file length in bytes */
+    uint64_t root_offset;       /**< Offset of the root node from file start */
+    uint64_t total_size;        /**< File size in bytes */
+} data_snapshot_header;
+
+/**
+ * @brief Node header
+ */
+typedef struct {
+    uint32_t type;              /**< variable_type of the node */
+    uint32_t count;             /**< Length, element count or boolean */
+} data_snapshot_node;
+
+/**
+ * @brief Mapped snapshot
+ */
+struct data_snapshot {
+    const unsigned char* data;  /**< Mapped file */
+    size_t size;                /**< Mapping size */
+    bool mapped;                /**< data is a file mapping, not heap */
+    size_t ref_count;           /**< Opener plus views still reading the file */
+};
+
+/**
+ * @brief A container node already decoded, by offset
+ */
+typedef struct {
+    uint64_t offset;            /**< Node offset (0 marks a free slot) */
+    variable* value;            /**< Reference held by the decoder */
+} data_snapshot_decoded;
+
+/**
+ * @brief Decoding state: the containers decoded so far, so shared ones
+ * are decoded once
+ */
+typedef struct {
+    const data_snapshot* snapshot;
+    data_snapshot_decoded* decoded; /**< Open-addressed table, by offset */
+    size_t decoded_count;
+    size_t decoded_capacity;    /**< Power of two, or 0 */
+} data_snapshot_decoder;
+
+/**
+ * @brief Read the node at an offset, checking that it lies inside the file
+ * @param snapshot Snapshot
+ * @param offset Node offset
+ * @param node Output header, its type without DATA_SNAPSHOT_SHARED
+ * @param shared Set to whether the writer shared the node (optional)
+ * @return false if the node or its fixed part is out of bounds
+ */
+bool data_snapshot_read_node(const data_snapshot* snapshot, uint64_t offset,
+                             data_snapshot_node* node, bool* shared);
+
+/**
+ * @brief Resolve the n-th relative offset slot of a container node
+ * @param snapshot Snapshot
+ * @param node Container offset, already read
+ * @param slot Slot index (8-byte units after the header)
+ * @param target Output absolute offset
+ * @return false if the offset does not point backward past the file header
+ */
+bool data_snapshot_read_slot(const data_snapshot* snapshot, uint64_t node, uint64_t slot,
+                             uint64_t* target);
+
+/**
+ * @brief Decode the node at an offset and everything below it
+ * @param decoder Decoding state
+ * @param offset Node offset
+ * @param depth Current nesting depth
+ * @return New variable (caller unrefs), or NULL if corrupt
+ */
+variable* data_snapshot_decode(data_snapshot_decoder* decoder, uint64_t offset, int depth);
+
+/**
+ * @brief Drop the decoder's references and free its table
+ * @param decoder Decoding state
+ */
+void data_snapshot_decoder_release(data_snapshot_decoder* decoder);
+
+/**
+ * @brief Split the next segment off a data path
+ * @param cursor Path cursor (advanced past the segment)
+ * @param segment Set to the segment start
+ * @param length Set to the segment length
+ * @return false when the path is exhausted
+ */
+bool data_path_next_segment(const char** cursor, const char** segment, size_t* length);
+
+#endif /* DATA_SNAPSHOT_INTERNAL_H */
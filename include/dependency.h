@@ -18,24 +18,45 @@ extern "C" {
 
 /**
  * @brief Dependency graph node
+ *
+ * Edges point from a dependency to the modules that depend on it.
  */
 typedef struct dependency_node {
     Module* module;                     /**< Module reference */
-    struct dependency_node** children; /**< Dependencies */
-    size_t child_count;                 /**< Number of dependencies */
-    size_t child_capacity;              /**< Capacity for dependencies */
+    struct dependency_node** children; /**< Dependents */
+    size_t child_count;                 /**< Number of dependents */
+    size_t child_capacity;              /**< Capacity for dependents */
     int visit_state;                    /**< For cycle detection (0=white, 1=gray, 2=black) */
+    size_t id;                          /**< Position in the graph's nodes array */
+    size_t order;                       /**< Position in the graph's topological order */
+    size_t mark;                        /**< Last order search that reached this node */
 } DependencyNode;
 
 /**
  * @brief Dependency graph
+ *
+ * Nodes are addressed by dense IDs (their position in nodes), found by
+ * module name through a hash index, so building, sorting and cycle
+ * checks take time linear in modules plus dependencies.
+ *
+ * A topological order is kept up to date as dependencies are added, so
+ * the graph knows at all times whether it is acyclic. An edge that agrees
+ * with the order costs constant time; one that does not only reorders the
+ * modules placed between its two ends. The edge that closes the first
+ * cycle records it in cycle, after which the order is no longer kept.
  */
 typedef struct dependency_graph {
-    DependencyNode** nodes;     /**< Array of nodes */
+    DependencyNode** nodes;     /**< Array of nodes, indexed by ID */
     size_t node_count;          /**< Number of nodes */
     size_t node_capacity;       /**< Capacity for nodes */
     char** load_order;          /**< Topologically sorted load order */
     size_t load_order_count;    /**< Number of modules in load order */
+    name_index index;           /**< Module name to node ID */
+    DependencyNode** order;     /**< Nodes in topological order, while acyclic */
+    bool order_valid;           /**< order is maintained (cleared if a reorder ran out of memory) */
+    size_t mark_epoch;          /**< Number of order searches run */
+    size_t* cycle;              /**< First cycle found, node IDs: each followed by its dependency, closed */
+    size_t cycle_length;        /**< Number of entries in cycle, 0 if acyclic */
 } DependencyGraph;
 
 /**
@@ -91,6 +112,10 @@ int dependency_graph_add_module(DependencyGraph* graph, Module* module);
 
 /**
  * @brief Add dependency relationship to graph
+ *
+ * Keeps the graph's topological order; if the edge closes the first
+ * cycle, the cycle is recorded in the graph right away.
+ *
  * @param graph Dependency graph
  * @param module_name Module name
  * @param dependency_name Dependency name
@@ -131,6 +156,14 @@ void dependency_detector_free(DependencyDetector* detector);
 
 /**
  * @brief Check for circular dependencies
+ *
+ * On MODULE_CIRCULAR_DEPENDENCY the detector's cycle path lists the
+ * modules of one cycle, each followed by a module it depends on, ending
+ * with the first module again. Answered from the cycle the graph recorded
+ * when the edge was added, without searching, unless the graph lost its
+ * order; edges added to nodes directly with dependency_node_add_child
+ * are not tracked.
+ *
  * @param detector Dependency detector
  * @return ModuleResult indicating success or circular dependency found
  */
@@ -171,6 +204,46 @@ int dependency_build_graph(ModuleRegistry* registry, DependencyGraph** graph);
  */
 int dependency_validate_all(ModuleRegistry* registry);
 
+/**
+ * @brief Per-module compile step run after a module's content is loaded
+ *
+ * Called once for each loaded module, after every one of its dependencies
+ * has been loaded and compiled, so it may read their exports. Calls for
+ * independent modules can run concurrently; a step should only write to
+ * the module it is given.
+ *
+ * @param module Loaded module
+ * @param user_data Caller data
+ * @return ModuleResult indicating success/failure
+ */
+typedef int (*dependency_compile_fn)(Module* module, void* user_data);
+
+/**
+ * @brief Load and compile a module and its dependencies, or every
+ *        registered module, in dependency order
+ *
+ * With a target, only the modules it depends on, directly or not, and
+ * the target itself are loaded; a cycle among other modules does not
+ * stop it. Modules are scheduled over the dependency graph: a module is read as
+ * soon as all of its dependencies are done, and independent modules are
+ * read and compiled on up to max_parallel threads at once. A module
+ * whose dependency failed is skipped. Modules already loaded are only
+ * compiled. Files read are recorded with the calling thread's build
+ * inputs recorder in module ID order, so the outcome does not depend on
+ * thread timing.
+ *
+ * @param registry Module registry
+ * @param target Module to load, or NULL for all
+ * @param max_parallel Maximum number of modules in flight (0 or 1 loads on this thread)
+ * @param compile Compile step, or NULL to only load
+ * @param user_data Passed to compile
+ * @return MODULE_SUCCESS, MODULE_NOT_FOUND for an unknown target,
+ *         MODULE_CIRCULAR_DEPENDENCY before anything is loaded, or the
+ *         first failure in module ID order
+ */
+int dependency_load_modules(ModuleRegistry* registry, const char* target, size_t max_parallel,
+                            dependency_compile_fn compile, void* user_data);
+
 /**
  * @brief Reset visit states for all nodes in dependency graph
  * @param graph Dependency graph
@@ -14,6 +14,8 @@
 
 // Internal function declarations
 int calculate_in_degrees(DependencyGraph* graph, size_t* in_degree);
+int dependency_graph_order_edge(DependencyGraph* graph, DependencyNode* dependency_node,
+                                DependencyNode* dependent_node);
 
 // Public function declarations
 DependencyNode* dependency_node_new(Module* module);
@@ -0,0 +1,62 @@
+/**
+ * @file json_parser.h
+ * @brief Native JSON parser producing XMD variables
+ * @author XMD Team
+ */
+
+#ifndef XMD_JSON_PARSER_H
+#define XMD_JSON_PARSER_H
+
+#include <stddef.h>
+#include "variable.h"
+
+/**
+ * @brief Parse a JSON buffer into an XMD variable
+ * @param data JSON text (need not be NUL-terminated)
+ * @param length Length of data in bytes
+ * @return Parsed variable or NULL on error (see json_parser_get_error)
+ */
+variable* json_parser_parse_buffer(const char* data, size_t length);
+
+/**
+ * @brief Parse a NUL-terminated JSON string into an XMD variable
+ * @param json_string JSON text
+ * @return Parsed variable or NULL on error
+ */
+variable* json_parser_parse_string(const char* json_string);
+
+/**
+ * @brief Parse a JSON file into an XMD variable
+ * @param file_path Path to JSON file
+ * @return Parsed variable or NULL on error
+ */
+variable* json_parser_parse_file(const char* file_path);
+
+/**
+ * @brief Load a JSON file whose objects and arrays are built as they are read
+ *
+ * The file is mapped and structurally indexed once. An object or array
+ * builds a member only when it is first accessed, so subtrees a template
+ * never touches never become variables. Brackets are checked up front;
+ * any other syntax error is found when the value holding it is first
+ * read, and that value then reads as absent.
+ *
+ * @param file_path Path to JSON file
+ * @return Root variable or NULL on error (see json_parser_get_error)
+ */
+variable* json_parser_parse_file_lazy(const char* file_path);
+
+/**
+ * @brief Convert XMD variable to JSON string
+ * @param var Variable to convert
+ * @return JSON string (caller must free) or NULL if unsupported
+ */
+char* json_parser_variable_to_string(variable* var);
+
+/**
+ * @brief Get the last JSON parse error on this thread
+ * @return Error message string
+ */
+const char* json_parser_get_error(void);
+
+#endif /* XMD_JSON_PARSER_H */
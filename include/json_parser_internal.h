@@ -0,0 +1,76 @@
+/**
+ * @file json_parser_internal.h
+ * @brief Internal interfaces of the two-stage JSON parser
+ * @author XMD Team
+ *
+ * Stage 1 indexes structural characters; stage 2 walks the index and
+ * builds variables directly, sizing containers from the element counts.
+ */
+
+#ifndef JSON_PARSER_INTERNAL_H
+#define JSON_PARSER_INTERNAL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "json_parser.h"
+
+#define JSON_MAX_DEPTH 1024
+
+/**
+ * @brief Structural index over a JSON buffer
+ *
+ * positions holds, in ascending order, every unescaped quote and every
+ * { } [ ] : , outside strings. counts[i] is the element-count hint for the
+ * container opened at positions[i] (0 for other entries).
+ */
+typedef struct {
+    uint32_t* positions;    /**< Offsets of structural characters */
+    uint32_t* counts;       /**< Element-count hints for open brackets */
+    size_t count;           /**< Number of indexed positions */
+} json_structural_index;
+
+/**
+ * @brief Stage 2 parser state
+ */
+typedef struct {
+    const char* data;                    /**< Input buffer */
+    size_t length;                       /**< Input length */
+    const json_structural_index* index;  /**< Structural index */
+    size_t cursor;                       /**< Next unconsumed index entry */
+    size_t offset;                       /**< Current byte offset */
+    int depth;                           /**< Current container depth */
+} json_parse_state;
+
+/**
+ * @brief JSON file whose containers build their members on access
+ *
+ * Positions handed to the variable_source are byte offsets of values.
+ */
+typedef struct {
+    variable_source base;           /**< Source callbacks and reference count */
+    const char* data;               /**< File contents */
+    size_t length;                  /**< Content length */
+    bool mapped;                    /**< data is a file mapping, not heap */
+    json_structural_index index;    /**< Structural index of data */
+    uint32_t* matches;              /**< Bracket partners from json_match_brackets */
+} json_lazy_source;
+
+/* Stage 1 */
+bool json_index_structurals(const char* data, size_t length, json_structural_index* index);
+void json_structural_index_free(json_structural_index* index);
+uint32_t* json_match_brackets(const char* data, const json_structural_index* index);
+
+/* Stage 2 */
+variable* json_build_value(json_parse_state* state);
+variable* json_build_object(json_parse_state* state);
+char* json_decode_string(json_parse_state* state);
+variable* json_build_lazy(variable_source* source, uint64_t position);
+bool json_parse_number(json_parse_state* state, double* out);
+
+/* Error reporting */
+void json_parser_set_error(const char* message, size_t offset);
+
+#endif /* JSON_PARSER_INTERNAL_H */
@@ -33,6 +33,10 @@ typedef struct {
     bool debug_mode;
     bool trace_execution;
     bool allow_exec;
+    bool profile;                 // Report per-stage timings after processing
+    const char* profile_output;   // Append the report here (NULL: stderr)
+    bool hotspots;                // Report per-directive costs after processing
+    const char* hotspots_output;  // Write collapsed stacks here (NULL: none)
 } cmd_process_options_t;
 
 // Function declarations
@@ -43,6 +47,8 @@ int format_output(const char* content, const char* format, char* formatted_outpu
 int cmd_process(int argc, char* argv[]);
 int cmd_validate(int argc, char* argv[]);
 int cmd_watch(int argc, char* argv[]);
+int cmd_bench(int argc, char* argv[]);
+int cmd_build(int argc, char* argv[]);
 int cmd_upgrade(int argc, char* argv[]);
 int cmd_uninstall(int argc, char* argv[]);
 bool looks_like_file_path(const char* arg);
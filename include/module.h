@@ -10,6 +10,7 @@
 
 #include <stddef.h>
 #include "store.h"
+#include "name_index.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,13 +32,17 @@ typedef struct xmd_module {
 
 /**
  * @brief Module registry
+ *
+ * A module's ID is its position in modules; IDs are dense and stable,
+ * since modules are never unregistered.
  */
 typedef struct module_registry {
-    Module** modules;           /**< Array of modules */
+    Module** modules;           /**< Array of modules, indexed by ID */
     size_t count;               /**< Number of modules */
     size_t capacity;            /**< Registry capacity */
     char** search_paths;        /**< Module search paths */
     size_t search_path_count;   /**< Number of search paths */
+    name_index index;           /**< Module name to ID */
 } ModuleRegistry;
 
 /**
@@ -135,7 +140,21 @@ int module_registry_register(ModuleRegistry* registry, Module* module);
 Module* module_registry_find(ModuleRegistry* registry, const char* name);
 
 /**
- * @brief Load module by name
+ * @brief Find a module's ID by name
+ * @param registry Module registry
+ * @param name Module name
+ * @return Position of the module in registry->modules, or NAME_INDEX_NONE
+ */
+size_t module_registry_find_id(const ModuleRegistry* registry, const char* name);
+
+/**
+ * @brief Load module by name, after the registered modules it depends on
+ *
+ * Dependencies are loaded over the dependency graph on up to one thread
+ * per CPU (see dependency_load_modules). Only reading the files runs in
+ * parallel: a module has no compiled form, and its exports are filled in
+ * by the caller afterwards.
+ *
  * @param registry Module registry
  * @param name Module name
  * @return ModuleResult indicating success/failure
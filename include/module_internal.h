@@ -26,6 +26,7 @@ void module_registry_free(ModuleRegistry* registry);
 int module_registry_add_search_path(ModuleRegistry* registry, const char* path);
 int module_registry_register(ModuleRegistry* registry, Module* module);
 Module* module_registry_find(ModuleRegistry* registry, const char* name);
+size_t module_registry_find_id(const ModuleRegistry* registry, const char* name);
 int module_registry_load(ModuleRegistry* registry, const char* name);
 bool file_exists(const char* path);
 int module_resolve_path(ModuleRegistry* registry, const char* name, char** resolved_path);
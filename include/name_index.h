@@ -0,0 +1,61 @@
+/**
+ * @file name_index.h
+ * @brief Hash index from names to dense integer IDs
+ * @author XMD Team
+ *
+ * Tables that keep their entries in an array (modules in a registry,
+ * nodes in a dependency graph) use a name index to find an entry's
+ * position without scanning. The index borrows the names, which must
+ * stay unchanged while they are indexed. A zeroed index is empty.
+ */
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/** ID returned for names that are not indexed */
+#define NAME_INDEX_NONE ((size_t)-1)
+
+/**
+ * @brief One slot of the open-addressing table
+ */
+typedef struct name_index_slot {
+    const char* name;   /**< Borrowed name, NULL if the slot is free */
+    size_t id;          /**< ID stored for the name */
+} name_index_slot;
+
+/**
+ * @brief Name to ID table
+ */
+typedef struct name_index {
+    name_index_slot* slots;     /**< Slots (power-of-two count) */
+    size_t capacity;            /**< Number of slots */
+    size_t count;               /**< Names indexed */
+} name_index;
+
+/**
+ * @brief Look up a name
+ * @param index Index
+ * @param name Name to find
+ * @return ID stored for the name, or NAME_INDEX_NONE
+ */
+size_t name_index_find(const name_index* index, const char* name);
+
+/**
+ * @brief Add a name that is not indexed yet
+ * @param index Index
+ * @param name Name to add (borrowed)
+ * @param id ID to store for it
+ * @return true on success, false on allocation failure
+ */
+bool name_index_insert(name_index* index, const char* name, size_t id);
+
+/**
+ * @brief Release an index's table
+ * @param index Index (left empty)
+ */
+void name_index_free(name_index* index);
+
+#endif /* NAME_INDEX_H */
@@ -12,6 +12,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "platform.h"
+#include "ast_node.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,6 +32,24 @@ typedef enum {
     PERF_OPT_MAXIMUM = 3
 } perf_optimization_level;
 
+/**
+ * @brief Render pipeline stages timed by the profiler
+ */
+typedef enum {
+    PERF_STAGE_PREPROCESS = 0,  ///< @-syntax rewriting and exec pre-scan
+    PERF_STAGE_SCAN,            ///< Locating directives and copying text
+    PERF_STAGE_LEX,             ///< Tokenizing directive text
+    PERF_STAGE_PARSE,           ///< Building ASTs
+    PERF_STAGE_EVALUATE,        ///< Evaluating directives and conditions
+    PERF_STAGE_IMPORT,          ///< Module and data imports
+    PERF_STAGE_EXEC,            ///< Running external commands
+    PERF_STAGE_FORMAT,          ///< Output formatting
+    PERF_STAGE_COUNT
+} perf_stage;
+
+/** Maximum nesting of stages tracked for exclusive timing */
+#define PERF_STAGE_MAX_DEPTH 64
+
 /**
  * @brief Performance metrics structure
  */
@@ -43,8 +62,39 @@ typedef struct perf_metrics {
     uint32_t cache_misses;          ///< Number of cache misses
     uint32_t allocations;           ///< Number of allocations
     uint32_t deallocations;         ///< Number of deallocations
+    uint64_t bytes_allocated;       ///< Total bytes recorded by allocations
+    uint64_t stage_time_ns[PERF_STAGE_COUNT];  ///< Exclusive time per stage
+    uint32_t stage_calls[PERF_STAGE_COUNT];    ///< Entries per stage
 } perf_metrics;
 
+/**
+ * @brief Aggregated cost of one directive reached through one call path
+ *
+ * Entries form a tree through their parent index; loop iterations and
+ * repeated imports of the same directive accumulate into one entry.
+ */
+typedef struct perf_hotspot {
+    size_t parent;                  ///< Index of the enclosing entry, or SIZE_MAX
+    source_location location;       ///< Directive position (filename owned)
+    char* label;                    ///< Directive keyword
+    uint32_t calls;                 ///< Times the directive ran
+    uint64_t total_ns;              ///< Wall time including nested directives
+    uint64_t self_ns;               ///< Wall time excluding nested directives
+    uint64_t allocations;           ///< Variable allocations excluding nested directives
+    uint64_t output_bytes;          ///< Bytes the directive wrote to the output
+} perf_hotspot;
+
+/**
+ * @brief Open directive frame
+ */
+typedef struct perf_hotspot_frame {
+    size_t entry;                   ///< Hotspot entry being charged
+    uint64_t start_ns;              ///< When the frame was entered
+    uint64_t child_ns;              ///< Time spent in nested frames
+    uint64_t start_allocations;     ///< Allocation count when entered
+    uint64_t child_allocations;     ///< Allocations made in nested frames
+} perf_hotspot_frame;
+
 /**
  * @brief Performance profiler structure
  */
@@ -55,8 +105,27 @@ typedef struct perf_profiler {
     bool is_active;
     char* profile_data;
     size_t profile_size;
+    uint64_t start_ns;              ///< Monotonic session start
+    perf_stage stage_stack[PERF_STAGE_MAX_DEPTH];  ///< Open stages, innermost last
+    size_t stage_depth;             ///< Number of open stages
+    uint64_t stage_mark_ns;         ///< When the innermost stage last resumed
+    bool hotspots_enabled;          ///< Attribute cost to individual directives
+    perf_hotspot* hotspots;         ///< Per-directive entries
+    size_t hotspot_count;
+    size_t hotspot_capacity;
+    perf_hotspot_frame hotspot_stack[PERF_STAGE_MAX_DEPTH];  ///< Open directive frames
+    size_t hotspot_depth;           ///< Number of open directive frames
+    source_location hotspot_origin; ///< Where the content being rendered starts
 } perf_profiler;
 
+/**
+ * @brief Profiler attached to the current thread, or NULL
+ *
+ * Set with perf_profiler_attach; the pipeline hooks below are no-ops
+ * while it is NULL.
+ */
+extern XMD_THREAD_LOCAL perf_profiler* xmd_active_profiler;
+
 /**
  * @brief AST optimization pass type
  */
@@ -78,8 +147,13 @@ typedef struct benchmark_result {
     uint64_t max_time_ns;
     uint64_t avg_time_ns;
     uint64_t median_time_ns;
+    uint64_t p90_time_ns;           /**< 90th percentile (nearest rank) */
+    uint64_t p99_time_ns;           /**< 99th percentile (nearest rank) */
     uint32_t iterations;
     double throughput_ops_per_sec;
+    uint64_t bytes_per_iteration;   /**< Input size per call, 0 if not a throughput test */
+    double throughput_mb_per_sec;
+    uint64_t* samples;              /**< Sorted per-iteration times (owned), NULL if unknown */
 } benchmark_result;
 
 /**
@@ -90,8 +164,32 @@ typedef struct benchmark_suite {
     size_t result_count;
     size_t result_capacity;
     char* suite_name;
+    uint32_t warmup_iterations;     /**< Untimed calls before each benchmark (default 1) */
 } benchmark_suite;
 
+/**
+ * @brief Outcome of comparing one benchmark against its baseline
+ */
+typedef enum {
+    BENCHMARK_UNCHANGED,            /**< No significant change beyond the threshold */
+    BENCHMARK_IMPROVED,             /**< Significantly faster than the baseline */
+    BENCHMARK_REGRESSED,            /**< Significantly slower than the baseline */
+    BENCHMARK_NEW,                  /**< Not present in the baseline */
+    BENCHMARK_INCONCLUSIVE          /**< Too few samples to test */
+} benchmark_verdict;
+
+/**
+ * @brief Comparison of one benchmark against its baseline
+ */
+typedef struct benchmark_comparison {
+    const char* test_name;          /**< Borrowed from the current suite */
+    uint64_t baseline_median_ns;
+    uint64_t current_median_ns;
+    double change;                  /**< Relative median change (+0.10 = 10% slower) */
+    double p_value;                 /**< Two-sided Mann-Whitney U p-value */
+    benchmark_verdict verdict;
+} benchmark_comparison;
+
 // =============================================================================
 // AST Optimizer Functions
 // =============================================================================
@@ -187,6 +285,125 @@ char* perf_profiler_generate_report(perf_profiler* profiler);
  */
 void perf_profiler_destroy(perf_profiler* profiler);
 
+/**
+ * @brief Attach a profiler to the calling thread
+ * @param profiler Profiler to attach, or NULL to detach
+ * @return Previously attached profiler
+ */
+perf_profiler* perf_profiler_attach(perf_profiler* profiler);
+
+/**
+ * @brief Enter a pipeline stage
+ *
+ * Time is charged exclusively: while a nested stage runs, the enclosing
+ * stage is paused.
+ *
+ * @param profiler Profiler instance
+ * @param stage Stage being entered
+ */
+void perf_profiler_stage_begin(perf_profiler* profiler, perf_stage stage);
+
+/**
+ * @brief Leave the innermost pipeline stage
+ * @param profiler Profiler instance
+ * @param stage Stage being left (must match the innermost open stage)
+ */
+void perf_profiler_stage_end(perf_profiler* profiler, perf_stage stage);
+
+/**
+ * @brief Name of a pipeline stage as used in reports
+ * @param stage Stage
+ * @return Static lowercase name
+ */
+const char* perf_stage_name(perf_stage stage);
+
+/**
+ * @brief Generate a machine-readable profiling report
+ * @param profiler Stopped profiler
+ * @param source Name of the processed input (may be NULL)
+ * @return JSON object text (must be freed) or NULL on error
+ */
+char* perf_profiler_report_json(const perf_profiler* profiler, const char* source);
+
+/**
+ * @brief Append the JSON report as one line to a file or stderr
+ * @param profiler Stopped profiler
+ * @param source Name of the processed input (may be NULL)
+ * @param path File to append to, or NULL for stderr
+ * @return 0 on success, -1 on error
+ */
+int perf_profiler_write_json(const perf_profiler* profiler, const char* source, const char* path);
+
+/**
+ * @brief Open a frame for a directive
+ *
+ * Only records while the profiler is active with hotspots enabled.
+ *
+ * @param profiler Profiler instance
+ * @param location Absolute directive position
+ * @param label Directive keyword
+ * @return true if a frame was opened and must be closed
+ */
+bool perf_hotspot_enter(perf_profiler* profiler, const source_location* location, const char* label);
+
+/**
+ * @brief Close the innermost directive frame
+ * @param profiler Profiler instance
+ * @param output_bytes Bytes the directive wrote
+ */
+void perf_hotspot_exit(perf_profiler* profiler, size_t output_bytes);
+
+/**
+ * @brief Set where the content about to be rendered starts
+ *
+ * Nested renders (loop bodies, imported files) see positions relative to
+ * their own text; the origin maps them back to the enclosing file.
+ *
+ * @param profiler Profiler instance (may be NULL)
+ * @param origin New origin (a zero line means "top of the input")
+ * @return Previous origin, to be restored afterwards
+ */
+source_location perf_hotspot_set_origin(perf_profiler* profiler, source_location origin);
+
+/**
+ * @brief Map a position in the current content to its absolute position
+ * @param profiler Profiler instance
+ * @param line Line within the current content (1-based)
+ * @param column Column within the current content (1-based)
+ * @param fallback_file File name to use at the top level (may be NULL)
+ * @return Absolute location (filename borrowed)
+ */
+source_location perf_hotspot_locate(const perf_profiler* profiler, size_t line, size_t column,
+                                    const char* fallback_file);
+
+/**
+ * @brief Drop all directive entries and open frames
+ * @param profiler Profiler instance
+ */
+void perf_hotspot_reset(perf_profiler* profiler);
+
+/**
+ * @brief Format directives as a table sorted by inclusive time
+ *
+ * Entries at the same location are merged across call paths.
+ *
+ * @param profiler Stopped profiler
+ * @return Table text (must be freed) or NULL on error
+ */
+char* perf_hotspot_report_table(const perf_profiler* profiler);
+
+/**
+ * @brief Write directive self times as collapsed stacks
+ *
+ * One "frame;frame;... nanoseconds" line per call path, as consumed by
+ * flamegraph.pl and compatible viewers.
+ *
+ * @param profiler Stopped profiler
+ * @param path Output file
+ * @return 0 on success, -1 on error
+ */
+int perf_hotspot_write_folded(const perf_profiler* profiler, const char* path);
+
 // =============================================================================
 // Benchmark Functions
 // =============================================================================
@@ -210,6 +427,20 @@ benchmark_suite* benchmark_suite_create(const char* name);
 int benchmark_run(benchmark_suite* suite, const char* test_name,
                   int (*test_func)(void*), void* test_data, uint32_t iterations);
 
+/**
+ * @brief Run benchmark function and report data throughput
+ * @param suite Benchmark suite
+ * @param test_name Test name
+ * @param test_func Function to benchmark
+ * @param test_data Data to pass to function
+ * @param iterations Number of iterations
+ * @param bytes_per_iteration Bytes processed by each call
+ * @return 0 on success, -1 on error
+ */
+int benchmark_run_throughput(benchmark_suite* suite, const char* test_name,
+                             int (*test_func)(void*), void* test_data,
+                             uint32_t iterations, uint64_t bytes_per_iteration);
+
 /**
  * @brief Generate benchmark report
  * @param suite Benchmark suite
@@ -217,6 +448,74 @@ int benchmark_run(benchmark_suite* suite, const char* test_name,
  */
 char* benchmark_generate_report(benchmark_suite* suite);
 
+/**
+ * @brief Generate machine-readable benchmark results
+ * @param suite Benchmark suite
+ * @return JSON object text (must be freed) or NULL on error
+ */
+char* benchmark_generate_json(benchmark_suite* suite);
+
+/**
+ * @brief Write machine-readable benchmark results to a file
+ * @param suite Benchmark suite
+ * @param path Output file path
+ * @return 0 on success, -1 on error
+ */
+int benchmark_save_json(benchmark_suite* suite, const char* path);
+
+/**
+ * @brief Load benchmark results written by benchmark_save_json
+ * @param path Results file path
+ * @return Suite instance or NULL on error
+ */
+benchmark_suite* benchmark_load_json(const char* path);
+
+/**
+ * @brief Add a result computed from raw timings
+ * @param suite Benchmark suite
+ * @param test_name Test name
+ * @param times Per-iteration times; ownership passes to the suite, even on error
+ * @param count Number of times
+ * @return 0 on success, -1 on error
+ */
+int benchmark_record(benchmark_suite* suite, const char* test_name,
+                     uint64_t* times, uint32_t count);
+
+/**
+ * @brief Two-sided Mann-Whitney U test on two sorted samples
+ * @param a First sample, ascending
+ * @param a_count First sample size
+ * @param b Second sample, ascending
+ * @param b_count Second sample size
+ * @return p-value in [0, 1] (normal approximation with tie correction)
+ */
+double benchmark_mann_whitney(const uint64_t* a, uint32_t a_count,
+                              const uint64_t* b, uint32_t b_count);
+
+/**
+ * @brief Compare a suite against a baseline
+ *
+ * A case regresses when its median is more than @p threshold slower and
+ * the difference is significant at level @p alpha.
+ *
+ * @param baseline Baseline suite
+ * @param current Current suite
+ * @param threshold Relative median change to ignore (0.05 = 5%)
+ * @param alpha Significance level
+ * @param comparisons Receives one entry per current result (must be freed)
+ * @return Number of entries, or 0 on error
+ */
+size_t benchmark_compare(const benchmark_suite* baseline, const benchmark_suite* current,
+                         double threshold, double alpha, benchmark_comparison** comparisons);
+
+/**
+ * @brief Format a baseline comparison as a table
+ * @param comparisons Comparison entries
+ * @param count Number of entries
+ * @return Report string (must be freed) or NULL on error
+ */
+char* benchmark_comparison_report(const benchmark_comparison* comparisons, size_t count);
+
 /**
  * @brief Destroy benchmark suite
  * @param suite Benchmark suite
@@ -298,6 +597,22 @@ int compare_times(const void* a, const void* b);
         if (profiler) perf_profiler_record_cache_miss(profiler); \
     } while(0)
 
+/**
+ * @brief Enter a pipeline stage on the thread's attached profiler
+ */
+#define PERF_STAGE_BEGIN(stage) \
+    do { \
+        if (xmd_active_profiler) perf_profiler_stage_begin(xmd_active_profiler, stage); \
+    } while(0)
+
+/**
+ * @brief Leave a pipeline stage on the thread's attached profiler
+ */
+#define PERF_STAGE_END(stage) \
+    do { \
+        if (xmd_active_profiler) perf_profiler_stage_end(xmd_active_profiler, stage); \
+    } while(0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -183,10 +183,14 @@ xmd_dir_t xmd_opendir(const char* path);
 xmd_dirent_t* xmd_readdir(xmd_dir_t dir);
 void xmd_closedir(xmd_dir_t dir);
 char* xmd_get_filename(xmd_dirent_t* entry);
+int xmd_fsync_file(FILE* file);
+int xmd_fsync_directory(const char* path);
+int xmd_replace_file(const char* from, const char* to);
 
 // Memory Functions
 void* xmd_aligned_alloc(size_t alignment, size_t size);
 void xmd_aligned_free(void* ptr);
+size_t xmd_malloc_size(void* ptr);
 
 // System Information
 uint32_t xmd_get_cpu_count(void);
@@ -232,6 +236,24 @@ int xmd_get_fd_count(void);
     #define XMD_PACKED_END
 #endif
 
+// Atomic Macros (64-bit words: reference counts and published hashes)
+#ifdef XMD_COMPILER_MSVC
+    #define XMD_ATOMIC_LOAD(p) ((uint64_t)InterlockedOr64((volatile LONG64*)(p), 0))
+    #define XMD_ATOMIC_STORE(p, v) InterlockedExchange64((volatile LONG64*)(p), (LONG64)(v))
+    #define XMD_ATOMIC_INCREMENT(p) ((uint64_t)InterlockedIncrement64((volatile LONG64*)(p)))
+    #define XMD_ATOMIC_DECREMENT(p) ((uint64_t)InterlockedDecrement64((volatile LONG64*)(p)))
+#elif defined(XMD_COMPILER_GCC) || defined(XMD_COMPILER_CLANG)
+    #define XMD_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define XMD_ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define XMD_ATOMIC_INCREMENT(p) __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+    #define XMD_ATOMIC_DECREMENT(p) __atomic_sub_fetch((p), 1, __ATOMIC_ACQ_REL)
+#else
+    #define XMD_ATOMIC_LOAD(p) (*(p))
+    #define XMD_ATOMIC_STORE(p, v) (*(p) = (v))
+    #define XMD_ATOMIC_INCREMENT(p) (++*(p))
+    #define XMD_ATOMIC_DECREMENT(p) (--*(p))
+#endif
+
 // Debug Macros
 #ifdef _DEBUG
     #define XMD_DEBUG 1
@@ -30,5 +30,19 @@ void perf_profiler_record_cache_miss(perf_profiler* profiler);
 const perf_metrics* perf_profiler_get_metrics(perf_profiler* profiler);
 char* perf_profiler_generate_report(perf_profiler* profiler);
 void perf_profiler_destroy(perf_profiler* profiler);
+perf_profiler* perf_profiler_attach(perf_profiler* profiler);
+void perf_profiler_stage_begin(perf_profiler* profiler, perf_stage stage);
+void perf_profiler_stage_end(perf_profiler* profiler, perf_stage stage);
+const char* perf_stage_name(perf_stage stage);
+char* perf_profiler_report_json(const perf_profiler* profiler, const char* source);
+int perf_profiler_write_json(const perf_profiler* profiler, const char* source, const char* path);
+bool perf_hotspot_enter(perf_profiler* profiler, const source_location* location, const char* label);
+void perf_hotspot_exit(perf_profiler* profiler, size_t output_bytes);
+source_location perf_hotspot_set_origin(perf_profiler* profiler, source_location origin);
+source_location perf_hotspot_locate(const perf_profiler* profiler, size_t line, size_t column,
+                                    const char* fallback_file);
+void perf_hotspot_reset(perf_profiler* profiler);
+char* perf_hotspot_report_table(const perf_profiler* profiler);
+int perf_hotspot_write_folded(const perf_profiler* profiler, const char* path);
 
 #endif /* PROFILER_INTERNAL_H */
\ No newline at end of file
@@ -43,12 +43,23 @@ bool store_set(store* s, const char* name, variable* var);
 
 /**
  * @brief Get a variable from the store
+ *
+ * Lookups fall through to enclosing scope frames.
+ *
  * @param s Store instance
  * @param name Variable name
  * @return Variable pointer or NULL if not found
  */
 variable* store_get(store* s, const char* name);
 
+/**
+ * @brief Get a variable from the innermost frame only
+ * @param s Store instance
+ * @param name Variable name
+ * @return Variable pointer or NULL if this frame does not set it
+ */
+variable* store_get_local(store* s, const char* name);
+
 /**
  * @brief Check if variable exists in store
  * @param s Store instance
@@ -86,4 +97,23 @@ size_t store_size(store* s);
  */
 char** store_keys(store* s, size_t* count);
 
+/**
+ * @brief Open a scope frame on top of a store
+ *
+ * Reads through the frame fall back to the parent chain; store_set,
+ * store_remove, store_clear, store_size and store_keys act on the frame
+ * only. Pushing is O(1) and copies nothing.
+ *
+ * @param parent Enclosing store (must outlive the frame)
+ * @return New frame or NULL on failure
+ */
+store* store_push_scope(store* parent);
+
+/**
+ * @brief Close a scope frame, releasing its variables
+ * @param frame Frame from store_push_scope
+ * @return The enclosing store
+ */
+store* store_pop_scope(store* frame);
+
 #endif /* STORE_H */
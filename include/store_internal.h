@@ -36,6 +36,7 @@ struct store {
     store_entry** buckets;         /**< Hash table buckets */
     size_t capacity;               /**< Current capacity */
     size_t size;                   /**< Number of stored variables */
+    struct store* parent;          /**< Enclosing scope frame, NULL at the root */
 };
 
 // Function declarations
@@ -51,5 +52,7 @@ bool store_remove(store* s, const char* name);
 void store_clear(store* s);
 size_t store_size(store* s);
 char** store_keys(store* s, size_t* count);
+store* store_push_scope(store* parent);
+store* store_pop_scope(store* frame);
 
 #endif /* STORE_INTERNAL_H */
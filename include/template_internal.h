@@ -27,6 +27,7 @@ struct template_context {
 bool find_next_variable(const char* template, size_t start, 
                        size_t* var_start, size_t* var_end);
 char* extract_variable_name(const char* template, size_t start, size_t end);
+bool copy_variable_name(const char* template, size_t start, size_t end, char* name);
 
 // Public function declarations
 template_context* template_context_create(store* store);
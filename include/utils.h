@@ -10,6 +10,7 @@
 
 #include <stddef.h>
 #include "variable.h"
+#include "allocator.h"
 
 /**
  * @brief Calculate hash for a string key using djb2 algorithm
@@ -34,13 +35,6 @@ double xmd_variable_to_number(const variable* var);
  */
 bool xmd_variable_equals(const variable* a, const variable* b);
 
-/**
- * @brief Safe malloc with NULL check
- * @param size Size to allocate
- * @return Allocated memory or NULL on failure
- */
-void* xmd_malloc(size_t size);
-
 /**
  * @brief Allocate memory safely
  * @param size Number of bytes to allocate
@@ -70,29 +64,6 @@ char* string_duplicate(const char* str);
  */
 char* string_extract(const char* str, size_t start, size_t length);
 
-/**
- * @brief Safe calloc with NULL check
- * @param count Number of elements
- * @param size Size of each element
- * @return Allocated and zeroed memory or NULL on failure
- */
-void* xmd_calloc(size_t count, size_t size);
-
-/**
- * @brief Safe realloc with NULL check
- * @param ptr Existing pointer
- * @param size New size
- * @return Reallocated memory or NULL on failure
- */
-void* xmd_realloc(void* ptr, size_t size);
-
-/**
- * @brief Safe string duplication
- * @param str String to duplicate
- * @return Duplicated string or NULL on failure
- */
-char* xmd_strdup(const char* str);
-
 /**
  * @brief Expand array capacity safely
  * @param ptr Pointer to array pointer
@@ -139,6 +110,21 @@ void* xmd_malloc_safe(size_t size, const char* error_msg);
         if (!(ptr)) return (retval); \
     } while(0)
 
+/** Buffer size that holds any number formatted by xmd_format_number */
+#define XMD_NUMBER_BUFFER_SIZE 32
+
+/**
+ * @brief Format a number as the shortest text that reads back as the same value
+ *
+ * Integers print without a fraction or exponent up to 1e15, and NaN and
+ * infinities print as NaN, Infinity and -Infinity.
+ *
+ * @param value Number to format
+ * @param buffer Output of at least XMD_NUMBER_BUFFER_SIZE bytes
+ * @return Length written, excluding the terminator
+ */
+size_t xmd_format_number(double value, char* buffer);
+
 /**
  * @brief Process escape sequences in string literals
  * @param input Input string with potential escape sequences
@@ -11,7 +11,9 @@
 #define VARIABLE_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include "xmd_sink.h"
 
 /**
  * @enum variable_type
@@ -38,15 +40,72 @@ typedef enum {
 typedef struct variable variable;
 typedef struct variable_array variable_array;
 typedef struct variable_object variable_object;
+typedef struct variable_source variable_source;
+
+/**
+ * @struct variable_source
+ * @brief Document that builds the members of lazily loaded containers
+ *
+ * An array or object drawn from a source records where each member lives
+ * in it and builds the member on first access, so only the parts of an
+ * imported file that are read become variables. Every such container
+ * holds a reference to its source.
+ */
+struct variable_source {
+    /** New variable for the value at position, or NULL if it is malformed */
+    variable* (*build)(variable_source* source, uint64_t position);
+    /** Release the source once no container draws from it */
+    void (*destroy)(variable_source* source);
+    size_t ref_count;       /**< Containers drawing from the source */
+};
+
+/**
+ * @enum variable_array_kind
+ * @brief How an array stores its items
+ *
+ * An array whose items all share one scalar type keeps them packed.
+ * Inserting an item of any other type boxes the whole array into
+ * variable pointers, which it then keeps.
+ */
+typedef enum {
+    VAR_ARRAY_BOXED,        /**< Variable pointers in items */
+    VAR_ARRAY_NUMBERS,      /**< Packed doubles */
+    VAR_ARRAY_STRINGS,      /**< NUL-terminated slices of one character buffer */
+    VAR_ARRAY_BOOLEANS,     /**< Bitset */
+    VAR_ARRAY_RANGE,        /**< Arithmetic sequence computed on access */
+    VAR_ARRAY_SOURCE        /**< Items built from a variable_source on access */
+} variable_array_kind;
 
 /**
  * @struct variable_array
  * @brief Dynamic array of variables
+ *
+ * For a packed array, items holds variables boxed on demand by
+ * variable_array_get (NULL until the first such access), so returned
+ * pointers stay valid until the item is replaced or the array released.
  */
 typedef struct variable_array {
     variable** items;        /**< Array of variable pointers */
     size_t count;           /**< Number of items */
     size_t capacity;        /**< Allocated capacity */
+    variable_array_kind kind; /**< Storage of the items */
+    union {
+        double* numbers;    /**< Values of a numbers array */
+        uint64_t* bits;     /**< Values of a booleans array, 64 per word */
+        struct {
+            size_t* offsets;    /**< Start of each item in text, plus the end (count + 1 entries) */
+            char* text;         /**< Item characters, each followed by a NUL */
+            size_t text_capacity; /**< Allocated text bytes */
+        } strings;          /**< Values of a strings array */
+        struct {
+            double start;       /**< First item */
+            double step;        /**< Difference between consecutive items */
+        } range;            /**< Items of a range: start + index * step */
+        struct {
+            variable_source* source;    /**< Source the items are built from */
+            uint64_t* positions;        /**< Position of each item in source */
+        } source;           /**< Items of a lazily loaded array */
+    } packed;               /**< Packed storage, unused when boxed */
 } variable_array;
 
 /**
@@ -61,11 +120,17 @@ typedef struct variable_object_pair {
 /**
  * @struct variable_object
  * @brief Dynamic object/map of key-value pairs
+ *
+ * An object drawn from a source knows all of its keys; a pair's value is
+ * NULL until variable_object_get builds it from the source. Changing the
+ * object builds every remaining value first and drops the source.
  */
 typedef struct variable_object {
     variable_object_pair* pairs;  /**< Array of key-value pairs */
     size_t count;                /**< Number of pairs */
     size_t capacity;             /**< Allocated capacity */
+    variable_source* source;     /**< Source of values not built yet, or NULL */
+    uint64_t* positions;         /**< Position of each pair's value in source */
 } variable_object;
 
 /**
@@ -77,7 +142,7 @@ typedef struct variable {
     union {
         bool boolean_value;       /**< Boolean value */
         double number_value;      /**< Numeric value */
-        char* string_value;       /**< String value (owned) */
+        char* string_value;       /**< String value (xmd_string characters, never modified) */
         variable_array* array_value;   /**< Array structure pointer */
         variable_object* object_value; /**< Object structure pointer */
     } value;                      /**< Value union */
@@ -117,12 +182,66 @@ variable* variable_create_string(const char* value);
  */
 variable* variable_create_array(void);
 
+/**
+ * @brief Create an array variable holding a numeric range
+ *
+ * Items are computed on access, so a range costs the same at any size.
+ * Adding or replacing items turns it into an ordinary array.
+ *
+ * @param start First item
+ * @param end Last item, included if the range reaches it exactly
+ * @param step Difference between consecutive items (nonzero; its sign
+ *             must lead from start towards end or the range is empty)
+ * @return New array variable or NULL on failure or invalid step
+ */
+variable* variable_create_range(double start, double end, double step);
+
 /**
  * @brief Create a new object variable
  * @return New empty object variable or NULL on failure
  */
 variable* variable_create_object(void);
 
+/**
+ * @brief Create a string variable that takes ownership of a heap buffer
+ * @param value Heap-allocated NUL-terminated string (always released)
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_owned(char* value);
+
+/**
+ * @brief Create a string variable from bytes
+ *
+ * Strings up to XMD_STRING_INLINE_MAX bytes are stored in the variable's
+ * own allocation.
+ *
+ * @param value Bytes to copy (need not be terminated)
+ * @param length Number of bytes
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_length(const char* value, size_t length);
+
+/**
+ * @brief Create a string variable sharing an existing string
+ * @param chars Characters of an xmd_string (a reference is taken)
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_shared(const char* chars);
+
+/**
+ * @brief Create an empty array variable with pre-allocated capacity
+ * @param capacity Number of item slots to reserve
+ * @return New empty array variable or NULL on failure
+ */
+variable* variable_create_array_with_capacity(size_t capacity);
+
+/**
+ * @brief Create an empty object variable with pre-allocated capacity
+ * @param capacity Number of key-value slots to reserve
+ * @return New empty object variable or NULL on failure
+ */
+variable* variable_create_object_with_capacity(size_t capacity);
+
 /* Array operations */
 
 /**
@@ -133,14 +252,71 @@ variable* variable_create_object(void);
  */
 bool variable_array_add(variable* array_var, variable* item);
 
+/**
+ * @brief Append a number to an array variable without boxing it
+ * @param array_var Array variable
+ * @param value Number to add
+ * @return true on success, false on failure
+ */
+bool variable_array_add_number(variable* array_var, double value);
+
+/**
+ * @brief Append a string to an array variable without boxing it
+ * @param array_var Array variable
+ * @param value Bytes to copy (need not be terminated)
+ * @param length Number of bytes
+ * @return true on success, false on failure
+ */
+bool variable_array_add_string(variable* array_var, const char* value, size_t length);
+
+/**
+ * @brief Append a boolean to an array variable without boxing it
+ * @param array_var Array variable
+ * @param value Boolean to add
+ * @return true on success, false on failure
+ */
+bool variable_array_add_boolean(variable* array_var, bool value);
+
 /**
  * @brief Get item from array variable by index
+ *
+ * An item of a packed array is boxed on first access and kept with the
+ * array; use variable_array_element to read one without keeping a box.
+ *
  * @param array_var Array variable
  * @param index Item index
  * @return Item variable or NULL if not found/invalid
  */
 variable* variable_array_get(const variable* array_var, size_t index);
 
+/**
+ * @brief Get a new reference to an array item
+ *
+ * Items of a packed array are boxed afresh (or the existing box is
+ * shared) and nothing is added to the array.
+ *
+ * @param array_var Array variable
+ * @param index Item index
+ * @return New reference (caller must unref) or NULL if not found/invalid
+ */
+variable* variable_array_element(const variable* array_var, size_t index);
+
+/**
+ * @brief Append an array item's string form to an output sink
+ * @param sink Output sink
+ * @param array_var Array variable
+ * @param index Item index
+ * @return true on success, false if the sink has failed or the index is invalid
+ */
+bool variable_array_write_item(xmd_sink* sink, const variable* array_var, size_t index);
+
+/**
+ * @brief Convert a packed array to variable pointers
+ * @param array_var Array variable
+ * @return true on success (or if already boxed), false on failure
+ */
+bool variable_array_box(variable* array_var);
+
 /**
  * @brief Set item in array variable by index
  * @param array_var Array variable
@@ -150,6 +326,19 @@ variable* variable_array_get(const variable* array_var, size_t index);
  */
 bool variable_array_set(variable* array_var, size_t index, variable* item);
 
+/**
+ * @brief Append an item built from a source when first read
+ *
+ * Only an empty array or one already drawing from the same source can
+ * take such items.
+ *
+ * @param array_var Array variable
+ * @param source Source of the item (a reference is taken)
+ * @param position Position of the item in source
+ * @return true on success, false on failure
+ */
+bool variable_array_defer(variable* array_var, variable_source* source, uint64_t position);
+
 /**
  * @brief Get array size
  * @param array_var Array variable
@@ -199,6 +388,21 @@ size_t variable_object_size(const variable* object_var);
  */
 char** variable_object_keys(const variable* object_var, size_t* count);
 
+/**
+ * @brief Append a pair whose value is built from a source when first read
+ *
+ * Keys are not checked for duplicates; call variable_object_dedupe_keys
+ * once all pairs are in. Only an empty object or one already drawing
+ * from the same source can take such pairs.
+ *
+ * @param object_var Object variable
+ * @param source Source of the value (a reference is taken)
+ * @param key Key (ownership is taken, freed on failure)
+ * @param position Position of the value in source
+ * @return true on success, false on failure
+ */
+bool variable_object_defer(variable* object_var, variable_source* source, char* key, uint64_t position);
+
 /**
  * @brief Find key index in object variable (internal helper)
  * @param object_var Object variable
@@ -207,6 +411,18 @@ char** variable_object_keys(const variable* object_var, size_t* count);
  */
 size_t variable_object_find_key(const variable* object_var, const char* key);
 
+/**
+ * @brief Collapse duplicate keys after bulk insertion
+ *
+ * Keeps the first position of each key with the last value assigned to it,
+ * matching repeated variable_object_set calls. Linear for small objects,
+ * hashed for large ones.
+ *
+ * @param object_var Object variable
+ * @return true on success, false on failure
+ */
+bool variable_object_dedupe_keys(variable* object_var);
+
 /**
  * @brief Increment reference count
  * @param var Variable to reference (can be NULL)
@@ -220,6 +436,19 @@ variable* variable_ref(variable* var);
  */
 void variable_unref(variable* var);
 
+/**
+ * @brief Take a reference to a variable source
+ * @param source Source (can be NULL)
+ * @return Same source for chaining
+ */
+variable_source* variable_source_ref(variable_source* source);
+
+/**
+ * @brief Drop a reference to a variable source, destroying it with the last
+ * @param source Source (can be NULL)
+ */
+void variable_source_release(variable_source* source);
+
 /**
  * @brief Get variable type
  * @param var Variable to check
@@ -248,6 +477,18 @@ double variable_to_number(const variable* var);
  */
 char* variable_to_string(const variable* var);
 
+/**
+ * @brief Append a variable's string form to an output sink
+ *
+ * Produces the same text as variable_to_string without allocating
+ * anything but sink growth.
+ *
+ * @param sink Output sink
+ * @param var Variable (NULL writes nothing)
+ * @return true on success, false if the sink has failed
+ */
+bool variable_write_to(xmd_sink* sink, const variable* var);
+
 /**
  * @brief Check if two variables are equal
  * @param a First variable
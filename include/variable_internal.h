@@ -15,6 +15,47 @@
 #include "variable.h"
 #include "utils.h"
 
-/* Variable internal header - no forward declarations needed */
+/**
+ * @brief Free array structure and all its items
+ * @param array Array to free
+ */
+void variable_array_free(variable_array* array);
+
+/**
+ * @brief Make room for more items in an array's current storage
+ * @param array Array to grow
+ * @param capacity Item count the storage must hold
+ * @return true on success, false on failure
+ */
+bool variable_array_reserve(variable_array* array, size_t capacity);
+
+/**
+ * @brief Switch an empty array to the storage for a scalar type
+ * @param array Empty array
+ * @param kind Storage to use
+ * @return true on success, false on failure
+ */
+bool variable_array_set_kind(variable_array* array, variable_array_kind kind);
+
+/**
+ * @brief Box one item of a packed array into a new variable
+ * @param array Packed array
+ * @param index Item index (must be in range)
+ * @return New variable or NULL on failure
+ */
+variable* variable_array_box_item(const variable_array* array, size_t index);
+
+/**
+ * @brief Build every value an object has not built yet and drop its source
+ * @param object Object
+ * @return true on success, false if a value could not be built
+ */
+bool variable_object_settle(variable_object* object);
+
+/**
+ * @brief Release an object's source and value positions
+ * @param object Object
+ */
+void variable_object_drop_source(variable_object* object);
 
 #endif /* VARIABLE_INTERNAL_H */
@@ -126,6 +126,10 @@ void xmd_config_free(xmd_config* config);
 
 /**
  * @brief Create XMD processor with given configuration
+ *
+ * A processor is used by one thread at a time: its variables are shared
+ * by every render. Create one processor per thread to render in parallel.
+ *
  * @param config Configuration for the processor
  * @return Processor instance or NULL on error
  */
@@ -52,6 +52,20 @@ typedef struct {
     SandboxContext* sandbox_ctx;            /**< Sandbox security context */
 } processor_context;
 
+/**
+ * @struct exec_prefetch
+ * @brief Independent exec directives run ahead of the main pass
+ *
+ * Only unconditional top-level execs whose command text does not depend on
+ * variables are collected; outputs are consumed in document order.
+ */
+typedef struct {
+    size_t count;           /**< Number of collected exec directives */
+    size_t* offsets;        /**< Offset of each directive's "<!--" in the input */
+    char** commands;        /**< Command text of each directive */
+    char** outputs;         /**< Captured outputs (NULL until run or once taken) */
+} exec_prefetch;
+
 /* Context functions */
 processor_context* create_context(store* variables);
 void destroy_context(processor_context* ctx);
@@ -62,11 +76,15 @@ bool should_execute_block(processor_context* ctx);
 int execute_command(const char* command, char* output, size_t output_size);
 char* execute_command_dynamic(const char* command, int* exit_status);
 
+/* Exec prefetch functions */
+exec_prefetch* exec_prefetch_scan(const char* input);
+void exec_prefetch_run(exec_prefetch* prefetch, size_t max_parallel);
+char* exec_prefetch_take(exec_prefetch* prefetch, size_t offset);
+void exec_prefetch_free(exec_prefetch* prefetch);
+
 /* Utility functions */
 char* trim_whitespace(char* str);
 char* substitute_variables(const char* text, store* variables);
-store* backup_variable_scope(store* variables, const char* loop_var_name);
-void restore_variable_scope(store* variables, store* backup, const char* loop_var_name);
 int process_loop_body(const char* content, processor_context* ctx, LoopContext* loop_ctx);
 
 /* Directive processing functions */
@@ -0,0 +1,66 @@
+/**
+ * @file xmd_sink.h
+ * @brief Growable output buffer
+ * @author XMD Team
+ *
+ * Renderers append output to a sink instead of building and copying
+ * temporary strings. The buffer grows geometrically and is kept
+ * NUL-terminated. A failed allocation marks the sink failed; later
+ * appends are ignored and finishing returns NULL.
+ */
+
+#ifndef XMD_SINK_H
+#define XMD_SINK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Output buffer under construction
+ */
+typedef struct xmd_sink {
+    char* data;         /**< Bytes written so far, NUL-terminated */
+    size_t length;      /**< Bytes written, excluding the terminator */
+    size_t capacity;    /**< Bytes available, excluding the terminator */
+    bool failed;        /**< An append could not grow the buffer */
+} xmd_sink;
+
+/**
+ * @brief Initialize an empty sink
+ * @param sink Sink to initialize
+ * @param capacity Bytes to reserve up front
+ * @return true on success, false if the buffer could not be allocated
+ */
+bool xmd_sink_init(xmd_sink* sink, size_t capacity);
+
+/**
+ * @brief Append bytes
+ * @param sink Sink
+ * @param data Bytes to append
+ * @param length Number of bytes
+ * @return true on success, false if the sink has failed
+ */
+bool xmd_sink_append(xmd_sink* sink, const char* data, size_t length);
+
+/**
+ * @brief Append a C string
+ * @param sink Sink
+ * @param text String to append (NULL appends nothing)
+ * @return true on success, false if the sink has failed
+ */
+bool xmd_sink_append_string(xmd_sink* sink, const char* text);
+
+/**
+ * @brief Take the sink's buffer
+ * @param sink Sink (left empty)
+ * @return NUL-terminated buffer (caller must free), or NULL if the sink failed
+ */
+char* xmd_sink_finish(xmd_sink* sink);
+
+/**
+ * @brief Release a sink's buffer without taking it
+ * @param sink Sink (left empty)
+ */
+void xmd_sink_free(xmd_sink* sink);
+
+#endif /* XMD_SINK_H */
@@ -0,0 +1,131 @@
+/**
+ * @file xmd_string.h
+ * @brief Reference-counted immutable strings
+ * @author XMD Team
+ *
+ * String values are stored in a single block holding a header (reference
+ * count, length, capacity and hash) followed by the NUL-terminated
+ * characters. Value slots such as variable::value.string_value and
+ * ast_value::value.string_value hold a pointer to the characters, so they
+ * read as ordinary C strings while the header gives the length and hash
+ * in O(1) and lets the same characters be shared without copying.
+ *
+ * Short strings can instead be embedded in the block of the value that
+ * owns them. Embedded strings are not reference counted: sharing one
+ * makes a copy.
+ *
+ * Reference counts change atomically and a computed hash is published
+ * with an atomic store, so threads may share and release the same string
+ * and hash it concurrently. Characters only change in the hands of a
+ * sole owner.
+ */
+
+#ifndef XMD_STRING_H
+#define XMD_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Longest string a variable stores in its own allocation */
+#define XMD_STRING_INLINE_MAX 22
+
+/** Reference count marking a string embedded in its owner's block */
+#define XMD_STRING_EMBEDDED SIZE_MAX
+
+/**
+ * @brief String header, immediately followed by the characters
+ */
+typedef struct xmd_string {
+    size_t ref_count;   /**< Owners, or XMD_STRING_EMBEDDED (atomic) */
+    size_t length;      /**< Bytes, excluding the terminator */
+    size_t capacity;    /**< Bytes available for characters, excluding the terminator */
+    uint64_t hash;      /**< Content hash, 0 until computed (atomic) */
+    char data[];        /**< NUL-terminated characters */
+} xmd_string;
+
+/** Bytes needed to embed a string of the given length */
+#define XMD_STRING_SIZE(length) (sizeof(xmd_string) + (length) + 1)
+
+/**
+ * @brief Create a string from bytes
+ * @param text Bytes to copy (NULL for an empty string)
+ * @param length Number of bytes
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_from(const char* text, size_t length);
+
+/**
+ * @brief Create a string from a C string
+ * @param text String to copy (NULL for an empty string)
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_dup(const char* text);
+
+/**
+ * @brief Create an empty string with room to grow
+ * @param capacity Bytes to reserve for characters
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_with_capacity(size_t capacity);
+
+/**
+ * @brief Initialize a string embedded in caller-owned storage
+ * @param storage At least XMD_STRING_SIZE(length) bytes, suitably aligned
+ * @param text Bytes to copy
+ * @param length Number of bytes
+ * @return Characters of the embedded string
+ */
+char* xmd_string_embed(void* storage, const char* text, size_t length);
+
+/**
+ * @brief Get the header of a string
+ * @param chars Characters of a string
+ * @return Header
+ */
+xmd_string* xmd_string_of(const char* chars);
+
+/**
+ * @brief Take another reference to a string
+ * @param chars Characters of a string
+ * @return The same characters, or a new copy if the string is embedded;
+ *         NULL on failure
+ */
+char* xmd_string_share(const char* chars);
+
+/**
+ * @brief Drop a reference to a string
+ * @param chars Characters of a string, or NULL
+ */
+void xmd_string_release(const char* chars);
+
+/**
+ * @brief Get the length of a string in O(1)
+ * @param chars Characters of a string
+ * @return Length in bytes
+ */
+size_t xmd_string_length(const char* chars);
+
+/**
+ * @brief Get the content hash of a string, computed once
+ * @param chars Characters of a string
+ * @return 64-bit hash (never 0)
+ */
+uint64_t xmd_string_hash(const char* chars);
+
+/**
+ * @brief Append bytes to a string the caller holds a reference to
+ *
+ * A string the caller owns alone is grown in place with geometric
+ * capacity, so repeated appends cost amortized O(1) per byte. A shared
+ * or embedded string is copied first and the caller's reference to it
+ * is dropped.
+ *
+ * @param chars Characters of the string (reference consumed on success)
+ * @param text Bytes to append
+ * @param length Number of bytes
+ * @return Characters of the result (one reference), or NULL on failure
+ *         with the caller's reference to chars left intact
+ */
+char* xmd_string_append(char* chars, const char* text, size_t length);
+
+#endif /* XMD_STRING_H */
@@ -0,0 +1,39 @@
+/**
+ * @file yaml_parser.h
+ * @brief YAML parser producing XMD variables
+ * @author XMD Team
+ */
+
+#ifndef XMD_YAML_PARSER_H
+#define XMD_YAML_PARSER_H
+
+#include "variable.h"
+
+/**
+ * @brief Parse a YAML string into an XMD variable
+ * @param yaml_string YAML text
+ * @return Parsed variable or NULL on error (see yaml_parser_get_error)
+ */
+variable* yaml_parser_parse_string(const char* yaml_string);
+
+/**
+ * @brief Parse a YAML file into an XMD variable, streaming from disk
+ * @param file_path Path to YAML file
+ * @return Parsed variable or NULL on error
+ */
+variable* yaml_parser_parse_file(const char* file_path);
+
+/**
+ * @brief Convert XMD variable to YAML string
+ * @param var Variable to convert
+ * @return YAML string (caller must free) or NULL if unsupported
+ */
+char* yaml_parser_variable_to_string(variable* var);
+
+/**
+ * @brief Get the last YAML parse error on this thread
+ * @return Error message string
+ */
+const char* yaml_parser_get_error(void);
+
+#endif /* XMD_YAML_PARSER_H */
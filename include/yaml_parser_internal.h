@@ -0,0 +1,81 @@
+/**
+ * @file yaml_parser_internal.h
+ * @brief Internal interfaces of the libyaml event loader
+ * @author XMD Team
+ *
+ * The loader consumes libyaml events once and builds variables bottom-up:
+ * children accumulate on a shared slot stack and each container is
+ * allocated at its exact size when its end event arrives.
+ */
+
+#ifndef YAML_PARSER_INTERNAL_H
+#define YAML_PARSER_INTERNAL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "yaml_parser.h"
+
+/**
+ * @brief Pending child of an open container
+ */
+typedef struct {
+    char* key;              /**< Mapping key (NULL inside sequences) */
+    variable* value;        /**< Child value (owned) */
+} yaml_slot;
+
+/**
+ * @brief Open sequence or mapping
+ */
+typedef struct {
+    bool is_mapping;        /**< Mapping (true) or sequence (false) */
+    size_t base;            /**< First slot belonging to this container */
+    char* anchor;           /**< Anchor to register on close (owned) */
+    char* pending_key;      /**< Key awaiting its value (owned) */
+} yaml_frame;
+
+/**
+ * @brief Anchored node, shared by reference on every alias
+ */
+typedef struct {
+    char* name;             /**< Anchor name (owned) */
+    variable* value;        /**< Anchored value (reference held) */
+} yaml_anchor;
+
+/**
+ * @brief Event loader state
+ */
+typedef struct {
+    yaml_slot* slots;
+    size_t slot_count;
+    size_t slot_capacity;
+    yaml_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    yaml_anchor* anchors;
+    size_t anchor_count;
+    size_t anchor_capacity;
+    variable* root;         /**< Completed document root */
+} yaml_loader;
+
+/* Loader operations */
+bool yaml_loader_expects_key(const yaml_loader* loader);
+bool yaml_loader_push_value(yaml_loader* loader, variable* value, const char* anchor);
+bool yaml_loader_open(yaml_loader* loader, bool is_mapping, const char* anchor);
+bool yaml_loader_close(yaml_loader* loader);
+variable* yaml_loader_find_anchor(const yaml_loader* loader, const char* name);
+void yaml_loader_free(yaml_loader* loader);
+
+/* Scalar resolution (YAML core schema) */
+variable* yaml_resolve_scalar(const char* value, size_t length, bool plain, const char* tag);
+
+/* Error reporting */
+void yaml_parser_set_error(const char* message, size_t line, size_t column);
+
+#ifdef HAVE_LIBYAML
+#include <yaml.h>
+variable* yaml_load_events(yaml_parser_t* parser);
+#endif
+
+#endif /* YAML_PARSER_INTERNAL_H */
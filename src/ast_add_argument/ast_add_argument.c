@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Add argument to AST node (function call or directive)
@@ -22,8 +23,8 @@ int ast_add_argument(ast_node* node, ast_node* argument) {
     
     if (node->type == AST_FUNCTION_CALL) {
         size_t new_count = node->data.function_call.argument_count + 1;
-        ast_node** new_args = realloc(node->data.function_call.arguments, 
-                                      new_count * sizeof(ast_node*));
+        ast_node** new_args = xmd_realloc_tagged(node->data.function_call.arguments, 
+                                      new_count * sizeof(ast_node*), XMD_ALLOC_AST);
         if (!new_args) {
             return -1;
         }
@@ -36,8 +37,8 @@ int ast_add_argument(ast_node* node, ast_node* argument) {
     
     if (node->type == AST_DIRECTIVE) {
         size_t new_count = node->data.directive.argument_count + 1;
-        ast_node** new_args = realloc(node->data.directive.arguments, 
-                                      new_count * sizeof(ast_node*));
+        ast_node** new_args = xmd_realloc_tagged(node->data.directive.arguments, 
+                                      new_count * sizeof(ast_node*), XMD_ALLOC_AST);
         if (!new_args) {
             return -1;
         }
@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Add element to AST array literal node
@@ -20,8 +21,8 @@ int ast_add_element(ast_node* array, ast_node* element) {
     }
     
     size_t new_count = array->data.array_literal.element_count + 1;
-    ast_node** new_elements = realloc(array->data.array_literal.elements, 
-                                      new_count * sizeof(ast_node*));
+    ast_node** new_elements = xmd_realloc_tagged(array->data.array_literal.elements, 
+                                      new_count * sizeof(ast_node*), XMD_ALLOC_AST);
     if (!new_elements) {
         return -1;
     }
@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Add statement to AST block or program node
@@ -21,8 +22,8 @@ int ast_add_statement(ast_node* block, ast_node* statement) {
     
     if (block->type == AST_BLOCK) {
         size_t new_count = block->data.block.statement_count + 1;
-        ast_node** new_statements = realloc(block->data.block.statements, 
-                                           new_count * sizeof(ast_node*));
+        ast_node** new_statements = xmd_realloc_tagged(block->data.block.statements, 
+                                           new_count * sizeof(ast_node*), XMD_ALLOC_AST);
         if (!new_statements) {
             return -1;
         }
@@ -35,8 +36,8 @@ int ast_add_statement(ast_node* block, ast_node* statement) {
     
     if (block->type == AST_PROGRAM) {
         size_t new_count = block->data.program.statement_count + 1;
-        ast_node** new_statements = realloc(block->data.program.statements, 
-                                           new_count * sizeof(ast_node*));
+        ast_node** new_statements = xmd_realloc_tagged(block->data.program.statements, 
+                                           new_count * sizeof(ast_node*), XMD_ALLOC_AST);
         if (!new_statements) {
             return -1;
         }
@@ -7,6 +7,7 @@
 
 #include "../../include/ast_node.h"
 #include <stdlib.h>
+#include "../../include/allocator.h"
 
 /**
  * @brief Create array access AST node
@@ -20,7 +21,7 @@ ast_node* ast_create_array_access(ast_node* array_expr, ast_node* index_expr, so
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST assignment node
@@ -23,7 +24,7 @@ ast_node* ast_create_assignment(const char* variable, binary_operator op, ast_no
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -32,9 +33,9 @@ ast_node* ast_create_assignment(const char* variable, binary_operator op, ast_no
     node->type = AST_ASSIGNMENT;
     node->location = loc;
     
-    node->data.assignment.variable = strdup(variable);
+    node->data.assignment.variable = xmd_strdup(variable);
     if (!node->data.assignment.variable) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST binary operation node
@@ -22,7 +23,7 @@ ast_node* ast_create_binary_op(binary_operator op, ast_node* left, ast_node* rig
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST block node
@@ -15,7 +16,7 @@
  * @return New block node or NULL on error
  */
 ast_node* ast_create_block(source_location loc) {
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST boolean literal node
@@ -16,7 +17,7 @@
  * @return New boolean literal node or NULL on error
  */
 ast_node* ast_create_boolean_literal(bool value, source_location loc) {
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
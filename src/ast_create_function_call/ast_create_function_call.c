@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST function call node
@@ -21,7 +22,7 @@ ast_node* ast_create_function_call(const char* name, source_location loc) {
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -30,9 +31,9 @@ ast_node* ast_create_function_call(const char* name, source_location loc) {
     node->type = AST_FUNCTION_CALL;
     node->location = loc;
     
-    node->data.function_call.name = strdup(name);
+    node->data.function_call.name = xmd_strdup(name);
     if (!node->data.function_call.name) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
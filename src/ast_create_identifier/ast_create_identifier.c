@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST identifier node
@@ -21,7 +22,7 @@ ast_node* ast_create_identifier(const char* name, source_location loc) {
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -30,9 +31,9 @@ ast_node* ast_create_identifier(const char* name, source_location loc) {
     node->type = AST_IDENTIFIER;
     node->location = loc;
     
-    node->data.identifier.name = strdup(name);
+    node->data.identifier.name = xmd_strdup(name);
     if (!node->data.identifier.name) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
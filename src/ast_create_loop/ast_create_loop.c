@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST loop node
@@ -22,7 +23,7 @@ ast_node* ast_create_loop(const char* variable, ast_node* iterable, source_locat
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -31,9 +32,9 @@ ast_node* ast_create_loop(const char* variable, ast_node* iterable, source_locat
     node->type = AST_LOOP;
     node->location = loc;
     
-    node->data.loop.variable = strdup(variable);
+    node->data.loop.variable = xmd_strdup(variable);
     if (!node->data.loop.variable) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
@@ -0,0 +1,36 @@
+/**
+ * @file ast_create_range.c
+ * @brief Create AST node for numeric range expressions
+ * @author XMD Team
+ */
+
+#include "../../include/ast_node.h"
+#include <stdlib.h>
+#include "../../include/allocator.h"
+
+/**
+ * @brief Create range AST node
+ * @param start First item expression
+ * @param end Last item expression
+ * @param step Step expression, or NULL to step by 1 towards end
+ * @param loc Source location
+ * @return New AST node or NULL on error
+ */
+ast_node* ast_create_range(ast_node* start, ast_node* end, ast_node* step, source_location loc) {
+    if (!start || !end) {
+        return NULL;
+    }
+    
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
+    if (!node) {
+        return NULL;
+    }
+    
+    node->type = AST_RANGE;
+    node->location = loc;
+    node->data.range.start = start;
+    node->data.range.end = end;
+    node->data.range.step = step;
+    
+    return node;
+}
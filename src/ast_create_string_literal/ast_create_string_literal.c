@@ -10,6 +10,8 @@
 #include <string.h>
 #include "../../include/ast_node.h"
 #include "../../include/utils.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
 
 /**
  * @brief Create AST string literal node
@@ -22,7 +24,7 @@ ast_node* ast_create_string_literal(const char* value, source_location loc) {
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -32,9 +34,16 @@ ast_node* ast_create_string_literal(const char* value, source_location loc) {
     node->location = loc;
     
     node->data.literal.type = LITERAL_STRING;
-    node->data.literal.value.string_value = process_escape_sequences(value);
+    // Stored as a shared string so evaluating the literal never copies it
+    char* escaped = process_escape_sequences(value);
+    if (!escaped) {
+        xmd_free(node);
+        return NULL;
+    }
+    node->data.literal.value.string_value = xmd_string_dup(escaped);
+    xmd_free(escaped);
     if (!node->data.literal.value.string_value) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST variable reference node
@@ -21,7 +22,7 @@ ast_node* ast_create_variable_ref(const char* name, source_location loc) {
         return NULL;
     }
     
-    ast_node* node = malloc(sizeof(ast_node));
+    ast_node* node = xmd_malloc_tagged(sizeof(ast_node), XMD_ALLOC_AST);
     if (!node) {
         return NULL;
     }
@@ -30,9 +31,9 @@ ast_node* ast_create_variable_ref(const char* name, source_location loc) {
     node->type = AST_VARIABLE_REF;
     node->location = loc;
     
-    node->data.variable_ref.name = strdup(name);
+    node->data.variable_ref.name = xmd_strdup(name);
     if (!node->data.variable_ref.name) {
-        free(node);
+        xmd_free(node);
         return NULL;
     }
     
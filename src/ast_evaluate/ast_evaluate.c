@@ -9,6 +9,81 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
+
+/**
+ * @brief Convert one array item to an AST value
+ *
+ * Packed items are read straight from the array's storage.
+ *
+ * @param array Array variable
+ * @param index Item index (must be in range)
+ * @return Value, or NULL if the item is not a string, number or boolean
+ */
+static ast_value* array_item_value(const variable* array, size_t index) {
+    const variable_array* items = array->value.array_value;
+    ast_value* value = NULL;
+    
+    switch (items->kind) {
+        case VAR_ARRAY_NUMBERS:
+            value = ast_value_create(AST_VAL_NUMBER);
+            if (value) {
+                value->value.number_value = items->packed.numbers[index];
+            }
+            return value;
+        case VAR_ARRAY_RANGE:
+            value = ast_value_create(AST_VAL_NUMBER);
+            if (value) {
+                value->value.number_value = items->packed.range.start + (double)index * items->packed.range.step;
+            }
+            return value;
+        case VAR_ARRAY_BOOLEANS:
+            value = ast_value_create(AST_VAL_BOOLEAN);
+            if (value) {
+                value->value.boolean_value = (items->packed.bits[index / 64] >> (index % 64)) & 1;
+            }
+            return value;
+        case VAR_ARRAY_STRINGS: {
+            const size_t* offsets = items->packed.strings.offsets;
+            char* chars = xmd_string_from(items->packed.strings.text + offsets[index],
+                                          offsets[index + 1] - offsets[index] - 1);
+            value = chars ? ast_value_create(AST_VAL_STRING) : NULL;
+            if (value) {
+                value->value.string_value = chars;
+            } else {
+                xmd_string_release(chars);
+            }
+            return value;
+        }
+        default:
+            break;
+    }
+    
+    const variable* item = variable_array_get(array, index);
+    switch (item ? item->type : VAR_NULL) {
+        case VAR_STRING:
+            value = ast_value_create(AST_VAL_STRING);
+            if (value) {
+                value->value.string_value = xmd_string_share(item->value.string_value);
+            }
+            return value;
+        case VAR_NUMBER:
+            value = ast_value_create(AST_VAL_NUMBER);
+            if (value) {
+                value->value.number_value = item->value.number_value;
+            }
+            return value;
+        case VAR_BOOLEAN:
+            value = ast_value_create(AST_VAL_BOOLEAN);
+            if (value) {
+                value->value.boolean_value = item->value.boolean_value;
+            }
+            return value;
+        default:
+            return NULL;
+    }
+}
 
 /**
  * @brief Evaluate AST node
@@ -28,7 +103,7 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
                 case LITERAL_STRING:
                     value = ast_value_create(AST_VAL_STRING);
                     if (value) {
-                        value->value.string_value = strdup(node->data.literal.value.string_value);
+                        value->value.string_value = xmd_string_share(node->data.literal.value.string_value);
                     }
                     break;
                 case LITERAL_NUMBER:
@@ -58,28 +133,34 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
                 case VAR_STRING: {
                     ast_value* value = ast_value_create(AST_VAL_STRING);
                     if (value) {
-                        value->value.string_value = strdup(var->value.string_value);
+                        value->value.string_value = xmd_string_share(var->value.string_value);
+                    }
+                    return value;
+                }
+                case VAR_NUMBER: {
+                    ast_value* value = ast_value_create(AST_VAL_NUMBER);
+                    if (value) {
+                        value->value.number_value = var->value.number_value;
+                    }
+                    return value;
+                }
+                case VAR_BOOLEAN: {
+                    ast_value* value = ast_value_create(AST_VAL_BOOLEAN);
+                    if (value) {
+                        value->value.boolean_value = var->value.boolean_value;
                     }
                     return value;
                 }
                 case VAR_ARRAY: {
                     ast_value* value = ast_value_create(AST_VAL_ARRAY);
-                    if (value) {
-                        // Copy array elements from variable to AST value
-                        value->value.array_value.element_count = var->value.array_value->count;
-                        if (value->value.array_value.element_count > 0) {
-                            value->value.array_value.elements = malloc(value->value.array_value.element_count * sizeof(ast_value*));
-                            if (value->value.array_value.elements) {
-                                for (size_t i = 0; i < value->value.array_value.element_count; i++) {
-                                    variable* elem_var = var->value.array_value->items[i];
-                                    if (elem_var && elem_var->type == VAR_STRING) {
-                                        ast_value* elem_val = ast_value_create(AST_VAL_STRING);
-                                        if (elem_val) {
-                                            elem_val->value.string_value = strdup(elem_var->value.string_value);
-                                            value->value.array_value.elements[i] = elem_val;
-                                        }
-                                    }
-                                }
+                    size_t count = variable_array_size(var);
+                    if (value && count > 0) {
+                        // Items without a scalar value are left NULL
+                        value->value.array_value.elements = xmd_calloc(count, sizeof(ast_value*));
+                        if (value->value.array_value.elements) {
+                            value->value.array_value.element_count = count;
+                            for (size_t i = 0; i < count; i++) {
+                                value->value.array_value.elements[i] = array_item_value(var, i);
                             }
                         }
                     }
@@ -135,10 +216,12 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
                     case BINOP_ADD:
                         result = ast_value_create(AST_VAL_STRING);
                         if (result) {
-                            size_t len = strlen(left->value.string_value) + strlen(right->value.string_value) + 1;
-                            result->value.string_value = malloc(len);
+                            // Extend the left operand's string, in place when nothing else shares it
+                            result->value.string_value = xmd_string_append(left->value.string_value,
+                                                                           right->value.string_value,
+                                                                           xmd_string_length(right->value.string_value));
                             if (result->value.string_value) {
-                                snprintf(result->value.string_value, len, "%s%s", left->value.string_value, right->value.string_value);
+                                left->value.string_value = NULL;
                             }
                         }
                         break;
@@ -175,7 +258,7 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
             
             size_t element_count = node->data.array_literal.element_count;
             if (element_count > 0) {
-                array_val->value.array_value.elements = malloc(element_count * sizeof(ast_value*));
+                array_val->value.array_value.elements = xmd_malloc(element_count * sizeof(ast_value*));
                 if (!array_val->value.array_value.elements) {
                     ast_value_free(array_val);
                     return NULL;
@@ -195,6 +278,24 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
         }
         
         case AST_ARRAY_ACCESS: {
+            // Index a stored array in place instead of converting all of it
+            if (node->data.array_access.array_expr->type == AST_VARIABLE_REF) {
+                variable* var = store_get(evaluator->variables,
+                                          node->data.array_access.array_expr->data.variable_ref.name);
+                if (var && var->type == VAR_ARRAY) {
+                    ast_value* index_val = ast_evaluate(node->data.array_access.index_expr, evaluator);
+                    ast_value* result = NULL;
+                    if (index_val && index_val->type == AST_VAL_NUMBER) {
+                        int index = (int)index_val->value.number_value;
+                        if (index >= 0 && (size_t)index < variable_array_size(var)) {
+                            result = array_item_value(var, (size_t)index);
+                        }
+                    }
+                    ast_value_free(index_val);
+                    return result;
+                }
+            }
+            
             // Evaluate array expression
             ast_value* array_val = ast_evaluate(node->data.array_access.array_expr, evaluator);
             if (!array_val) {
@@ -242,7 +343,7 @@ ast_value* ast_evaluate(ast_node* node, ast_evaluator* evaluator) {
                 if (result) {
                     switch (element->type) {
                         case AST_VAL_STRING:
-                            result->value.string_value = strdup(element->value.string_value);
+                            result->value.string_value = xmd_string_share(element->value.string_value);
                             break;
                         case AST_VAL_NUMBER:
                             result->value.number_value = element->value.number_value;
@@ -8,6 +8,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
 
 // Function declarations
 extern variable* ast_split_comma_string(const char* str);
@@ -23,8 +25,20 @@ int ast_evaluate_assignment(ast_node* node, ast_evaluator* evaluator) {
         return -1;
     }
     
+    // A range is stored as is, without producing its items
+    ast_node* rhs = node->data.assignment.value;
+    if (rhs && rhs->type == AST_RANGE && node->data.assignment.op == BINOP_ASSIGN) {
+        variable* range = ast_evaluate_range(rhs, evaluator);
+        if (!range) {
+            return -1;
+        }
+        store_set(evaluator->variables, node->data.assignment.variable, range);
+        variable_unref(range);
+        return 0;
+    }
+    
     // Evaluate the right-hand side
-    ast_value* value = ast_evaluate(node->data.assignment.value, evaluator);
+    ast_value* value = ast_evaluate(rhs, evaluator);
     if (!value) {
         return -1;
     }
@@ -65,16 +79,30 @@ int ast_evaluate_assignment(ast_node* node, ast_evaluator* evaluator) {
         variable* existing = store_get(evaluator->variables, node->data.assignment.variable);
         if (existing && existing->type == VAR_STRING && var->type == VAR_STRING) {
             // String concatenation
-            size_t new_len = strlen(existing->value.string_value) + strlen(var->value.string_value) + 1;
-            char* new_value = malloc(new_len);
-            if (new_value) {
-                snprintf(new_value, new_len, "%s%s", existing->value.string_value, var->value.string_value);
-                variable* concat_var = variable_create_string(new_value);
-                if (concat_var) {
-                    store_set(evaluator->variables, node->data.assignment.variable, concat_var);
-                    variable_unref(concat_var);
+            const char* suffix = var->value.string_value;
+            size_t suffix_len = xmd_string_length(suffix);
+            if (existing->ref_count == 1 &&
+                store_get_local(evaluator->variables, node->data.assignment.variable) == existing) {
+                // Only the binding being assigned holds the variable: grow its
+                // string in place, so building a string in a loop is amortized
+                // linear
+                char* grown = xmd_string_append(existing->value.string_value, suffix, suffix_len);
+                if (grown) {
+                    existing->value.string_value = grown;
+                }
+            } else {
+                char* joined = xmd_string_share(existing->value.string_value);
+                char* grown = joined ? xmd_string_append(joined, suffix, suffix_len) : NULL;
+                if (grown) {
+                    variable* concat_var = variable_create_string_shared(grown);
+                    if (concat_var) {
+                        store_set(evaluator->variables, node->data.assignment.variable, concat_var);
+                        variable_unref(concat_var);
+                    }
+                    xmd_string_release(grown);
+                } else {
+                    xmd_string_release(joined);
                 }
-                free(new_value);
             }
         } else {
             // Just set the new value if types don't match or existing doesn't exist
@@ -12,6 +12,8 @@
 #include "../../include/ast_parser.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/allocator.h"
+#include "../../include/utils.h"
 
 /**
  * @brief Evaluate concatenation expression using AST
@@ -53,16 +55,15 @@ char* ast_evaluate_concatenation_expression(const char* expr, processor_context*
     char* result_str = NULL;
     if (result) {
         if (result->type == AST_VAL_STRING && result->value.string_value) {
-            result_str = strdup(result->value.string_value);
+            result_str = xmd_strdup(result->value.string_value);
         } else if (result->type == AST_VAL_NUMBER) {
-            result_str = malloc(64);
-            if (result_str) {
-                snprintf(result_str, 64, "%.15g", result->value.number_value);
-            }
+            char number[XMD_NUMBER_BUFFER_SIZE];
+            xmd_format_number(result->value.number_value, number);
+            result_str = xmd_strdup(number);
         } else if (result->type == AST_VAL_BOOLEAN) {
-            result_str = strdup(result->value.boolean_value ? "true" : "false");
+            result_str = xmd_strdup(result->value.boolean_value ? "true" : "false");
         } else {
-            result_str = strdup("");
+            result_str = xmd_strdup("");
         }
         ast_value_free(result);
     }
@@ -10,19 +10,41 @@
 #include <string.h>
 #include "../../include/ast_evaluator.h"
 #include "../../include/ast_parser.h"
+#include "../../include/ast_parse_cache.h"
 #include "../../include/lexer_enhanced.h"
 
 /**
- * @brief Evaluate condition using AST parsing (replaces string-based evaluate_condition)
- * @param condition Condition string to evaluate (e.g., "var == value")
- * @param variables Variable store for variable lookups
- * @return true if condition is true, false otherwise
+ * @brief Interpret an evaluated condition as true or false
+ * @param result Evaluation result (may be NULL)
+ * @return Truth value
  */
-bool ast_evaluate_condition(const char* condition, store* variables) {
-    if (!condition || !variables) {
+static bool is_truthy(const ast_value* result) {
+    if (!result) {
         return false;
     }
-    
+    switch (result->type) {
+        case AST_VAL_BOOLEAN:
+            return result->value.boolean_value;
+        case AST_VAL_NUMBER:
+            return result->value.number_value != 0.0;
+        case AST_VAL_STRING:
+            return result->value.string_value &&
+                   strlen(result->value.string_value) > 0 &&
+                   strcmp(result->value.string_value, "false") != 0 &&
+                   strcmp(result->value.string_value, "0") != 0;
+        case AST_VAL_NULL:
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Evaluate a condition without a cache
+ * @param condition Condition string
+ * @param variables Variable store
+ * @return true if condition is true
+ */
+static bool evaluate_uncached(const char* condition, store* variables) {
     // Tokenize the condition
     token* tokens = lexer_enhanced_tokenize(condition, "condition");
     if (!tokens) {
@@ -52,32 +74,43 @@ bool ast_evaluate_condition(const char* condition, store* variables) {
     // Evaluate the expression
     ast_node* expr = ast->data.program.statements[0];
     ast_value* result = ast_evaluate(expr, evaluator);
-    
-    bool condition_result = false;
-    if (result) {
-        switch (result->type) {
-            case AST_VAL_BOOLEAN:
-                condition_result = result->value.boolean_value;
-                break;
-            case AST_VAL_NUMBER:
-                condition_result = (result->value.number_value != 0.0);
-                break;
-            case AST_VAL_STRING:
-                condition_result = (result->value.string_value && 
-                                  strlen(result->value.string_value) > 0 &&
-                                  strcmp(result->value.string_value, "false") != 0 &&
-                                  strcmp(result->value.string_value, "0") != 0);
-                break;
-            case AST_VAL_NULL:
-            default:
-                condition_result = false;
-                break;
-        }
-    }
+    bool condition_result = is_truthy(result);
     
     ast_value_free(result);
     ast_evaluator_free(evaluator);
     ast_free(ast);
     
     return condition_result;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Evaluate condition using AST parsing (replaces string-based evaluate_condition)
+ *
+ * With a parse cache attached to the thread, the condition is parsed once
+ * per distinct text and evaluated with the cache's evaluator.
+ *
+ * @param condition Condition string to evaluate (e.g., "var == value")
+ * @param variables Variable store for variable lookups
+ * @return true if condition is true, false otherwise
+ */
+bool ast_evaluate_condition(const char* condition, store* variables) {
+    if (!condition || !variables) {
+        return false;
+    }
+    
+    ast_parse_cache* cache = xmd_active_parse_cache;
+    ast_evaluator* evaluator = ast_parse_cache_take_evaluator(cache, variables);
+    if (!evaluator) {
+        return evaluate_uncached(condition, variables);
+    }
+    
+    bool condition_result = false;
+    ast_node* program = ast_parse_cache_lookup(cache, condition);
+    if (program) {
+        ast_value* result = ast_evaluate(program->data.program.statements[0], evaluator);
+        condition_result = is_truthy(result);
+        ast_value_free(result);
+    }
+    ast_parse_cache_release(cache);
+    return condition_result;
+}
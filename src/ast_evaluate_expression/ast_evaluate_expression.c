@@ -12,6 +12,8 @@
 #include "../../include/ast_parser.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/allocator.h"
+#include "../../include/utils.h"
 
 /**
  * @brief Evaluate concatenation expression using AST (replaces evaluate_concatenation_expression)
@@ -55,22 +57,21 @@ char* ast_evaluate_concatenation_expression(const char* expr, processor_context*
         switch (result->type) {
             case AST_VAL_STRING:
                 if (result->value.string_value) {
-                    result_str = strdup(result->value.string_value);
+                    result_str = xmd_strdup(result->value.string_value);
                 }
                 break;
             case AST_VAL_NUMBER: {
-                result_str = malloc(64);
-                if (result_str) {
-                    snprintf(result_str, 64, "%.15g", result->value.number_value);
-                }
+                char number[XMD_NUMBER_BUFFER_SIZE];
+                xmd_format_number(result->value.number_value, number);
+                result_str = xmd_strdup(number);
                 break;
             }
             case AST_VAL_BOOLEAN:
-                result_str = strdup(result->value.boolean_value ? "true" : "false");
+                result_str = xmd_strdup(result->value.boolean_value ? "true" : "false");
                 break;
             case AST_VAL_NULL:
             default:
-                result_str = strdup("");
+                result_str = xmd_strdup("");
                 break;
         }
     }
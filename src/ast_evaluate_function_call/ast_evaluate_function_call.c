@@ -10,6 +10,9 @@
 #include <string.h>
 #include "../../include/ast_evaluator.h"
 #include "../../include/security.h"
+#include "../../include/performance.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
 
 /**
  * @brief Evaluate function call
@@ -38,7 +41,9 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
         
         // Call existing import functionality
         char import_output[65536] = {0};
+        PERF_STAGE_BEGIN(PERF_STAGE_IMPORT);
         int result = process_import(filename_val->value.string_value, evaluator->ctx, import_output, sizeof(import_output));
+        PERF_STAGE_END(PERF_STAGE_IMPORT);
         
         ast_value_free(filename_val);
         
@@ -51,7 +56,7 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             
             ast_value* value = ast_value_create(AST_VAL_STRING);
             if (value) {
-                value->value.string_value = strdup(import_output);
+                value->value.string_value = xmd_string_dup(import_output);
             }
             return value;
         }
@@ -95,24 +100,26 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             
             // Clean up
             if (substituted_command) {
-                free(substituted_command);
+                xmd_free(substituted_command);
             }
             ast_value_free(command_val);
             
             // Return error message
             ast_value* value = ast_value_create(AST_VAL_STRING);
             if (value) {
-                value->value.string_value = strdup(error_msg);
+                value->value.string_value = xmd_string_dup(error_msg);
             }
             return value;
         }
         
         // Execute command and get output
+        PERF_STAGE_BEGIN(PERF_STAGE_EXEC);
         char* command_output = execute_command_dynamic(final_command, NULL);
+        PERF_STAGE_END(PERF_STAGE_EXEC);
         
         // Clean up substituted command
         if (substituted_command) {
-            free(substituted_command);
+            xmd_free(substituted_command);
         }
         ast_value_free(command_val);
         
@@ -131,9 +138,9 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             
             ast_value* value = ast_value_create(AST_VAL_STRING);
             if (value) {
-                value->value.string_value = strdup(command_output);
+                value->value.string_value = xmd_string_dup(command_output);
             }
-            free(command_output);
+            xmd_free(command_output);
             return value;
         }
         return NULL;
@@ -145,8 +152,25 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             return NULL;
         }
         
-        ast_value* array_val = ast_evaluate(node->data.function_call.arguments[0], evaluator);
-        if (!array_val) {
+        // A stored array or a range is joined straight from its storage
+        ast_node* array_arg = node->data.function_call.arguments[0];
+        variable* stored = NULL;
+        variable* range = NULL;
+        if (array_arg->type == AST_RANGE) {
+            range = ast_evaluate_range(array_arg, evaluator);
+            if (!range) {
+                return NULL;
+            }
+            stored = range;
+        } else if (array_arg->type == AST_VARIABLE_REF) {
+            stored = store_get(evaluator->variables, array_arg->data.variable_ref.name);
+            if (stored && stored->type != VAR_ARRAY) {
+                stored = NULL;
+            }
+        }
+        
+        ast_value* array_val = stored ? NULL : ast_evaluate(array_arg, evaluator);
+        if (!stored && !array_val) {
             return NULL;
         }
         
@@ -160,6 +184,34 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             }
         }
         
+        if (stored) {
+            size_t count = variable_array_size(stored);
+            size_t separator_len = strlen(separator);
+            const variable_array* items = stored->value.array_value;
+            size_t estimate = items->kind == VAR_ARRAY_STRINGS ? items->packed.strings.offsets[count] : count * 8;
+            
+            xmd_sink joined;
+            bool ok = xmd_sink_init(&joined, estimate + count * separator_len);
+            for (size_t i = 0; ok && i < count; i++) {
+                if (i > 0) {
+                    xmd_sink_append(&joined, separator, separator_len);
+                }
+                variable_array_write_item(&joined, stored, i);
+            }
+            ast_value_free(separator_val);
+            
+            char* result_str = ok && !joined.failed ? xmd_string_from(joined.data, joined.length) : NULL;
+            xmd_sink_free(&joined);
+            variable_unref(range);
+            ast_value* value = result_str ? ast_value_create(AST_VAL_STRING) : NULL;
+            if (value) {
+                value->value.string_value = result_str;
+            } else {
+                xmd_string_release(result_str);
+            }
+            return value;
+        }
+        
         // Handle both array literals and array variables
         if (array_val->type == AST_VAL_ARRAY) {
             size_t separator_len = strlen(separator);
@@ -169,28 +221,28 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             for (size_t i = 0; i < array_val->value.array_value.element_count; i++) {
                 ast_value* element = array_val->value.array_value.elements[i];
                 if (element && element->type == AST_VAL_STRING && element->value.string_value) {
-                    total_len += strlen(element->value.string_value);
+                    total_len += xmd_string_length(element->value.string_value);
                     if (i > 0) total_len += separator_len;
                 }
             }
             
-            // Create result string
-            char* result_str = malloc(total_len + 1);
+            // Create result string with room for every element, so appends never reallocate
+            char* result_str = xmd_string_with_capacity(total_len);
             if (!result_str) {
                 ast_value_free(array_val);
                 ast_value_free(separator_val);
                 return NULL;
             }
-            result_str[0] = '\0';
             
             // Join array elements with custom separator
             for (size_t i = 0; i < array_val->value.array_value.element_count; i++) {
                 ast_value* element = array_val->value.array_value.elements[i];
                 if (element && element->type == AST_VAL_STRING && element->value.string_value) {
                     if (i > 0) {
-                        strcat(result_str, separator);
+                        result_str = xmd_string_append(result_str, separator, separator_len);
                     }
-                    strcat(result_str, element->value.string_value);
+                    result_str = xmd_string_append(result_str, element->value.string_value,
+                                                   xmd_string_length(element->value.string_value));
                 }
             }
             
@@ -201,7 +253,7 @@ ast_value* ast_evaluate_function_call(ast_node* node, ast_evaluator* evaluator)
             if (value) {
                 value->value.string_value = result_str;
             } else {
-                free(result_str);
+                xmd_string_release(result_str);
             }
             return value;
         }
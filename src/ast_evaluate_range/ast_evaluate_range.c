@@ -0,0 +1,87 @@
+/**
+ * @file ast_evaluate_range.c
+ * @brief Evaluate numeric range expressions
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "../../include/ast_evaluator.h"
+#include "../../include/config.h"
+#include "../../include/allocator.h"
+
+/**
+ * @brief Evaluate a range bound or step to a number
+ *
+ * Variables set from number literals hold their text, so numeric strings
+ * count as numbers.
+ *
+ * @param node Expression node
+ * @param evaluator Evaluator context
+ * @param number Receives the number
+ * @return true if the expression is numeric
+ */
+static bool evaluate_number(ast_node* node, ast_evaluator* evaluator, double* number) {
+    ast_value* value = ast_evaluate(node, evaluator);
+    if (!value) {
+        return false;
+    }
+    
+    bool numeric = false;
+    if (value->type == AST_VAL_NUMBER) {
+        *number = value->value.number_value;
+        numeric = true;
+    } else if (value->type == AST_VAL_STRING && value->value.string_value && value->value.string_value[0]) {
+        char* end = NULL;
+        *number = strtod(value->value.string_value, &end);
+        numeric = *end == '\0';
+    }
+    ast_value_free(value);
+    return numeric;
+}
+
+/**
+ * @brief Evaluate a range expression without materializing its items
+ * @param node Range AST node
+ * @param evaluator Evaluator context
+ * @return Range array variable or NULL on error
+ */
+variable* ast_evaluate_range(ast_node* node, ast_evaluator* evaluator) {
+    if (!node || !evaluator || node->type != AST_RANGE) {
+        return NULL;
+    }
+    
+    double start = 0;
+    double end = 0;
+    if (!evaluate_number(node->data.range.start, evaluator, &start) ||
+        !evaluate_number(node->data.range.end, evaluator, &end)) {
+        return NULL;
+    }
+    
+    double step = start <= end ? 1 : -1;
+    if (node->data.range.step && !evaluate_number(node->data.range.step, evaluator, &step)) {
+        return NULL;
+    }
+    
+    variable* range = variable_create_range(start, end, step);
+    if (!range) {
+        return NULL;
+    }
+    
+    // The range is the loop, so it is bounded like one
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    size_t limit = config ? config->limits.max_loop_iterations : 0;
+    size_t count = range->value.array_value->count;
+    if (limit > 0 && count > limit) {
+        variable_unref(range);
+        char message[128];
+        snprintf(message, sizeof(message), "Range of %zu items exceeds the loop limit of %zu iterations",
+                 count, limit);
+        xmd_free(evaluator->error_message);
+        evaluator->error_message = xmd_strdup(message);
+        evaluator->has_error = true;
+        return NULL;
+    }
+    return range;
+}
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Append string to evaluator's output buffer
@@ -28,7 +29,7 @@ int ast_evaluator_append_output(ast_evaluator* evaluator, const char* text) {
     
     // Allocate or expand buffer
     if (!evaluator->output_buffer) {
-        evaluator->output_buffer = malloc(text_len + 1);
+        evaluator->output_buffer = xmd_malloc(text_len + 1);
         if (!evaluator->output_buffer) {
             return -1;
         }
@@ -38,7 +39,7 @@ int ast_evaluator_append_output(ast_evaluator* evaluator, const char* text) {
     } else {
         // Expand existing buffer
         size_t new_size = evaluator->output_size + text_len;
-        char* new_buffer = realloc(evaluator->output_buffer, new_size + 1);
+        char* new_buffer = xmd_realloc(evaluator->output_buffer, new_size + 1);
         if (!new_buffer) {
             return -1;
         }
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST evaluator
@@ -20,7 +21,7 @@ ast_evaluator* ast_evaluator_create(store* variables, processor_context* ctx) {
         return NULL;
     }
     
-    ast_evaluator* evaluator = malloc(sizeof(ast_evaluator));
+    ast_evaluator* evaluator = xmd_malloc(sizeof(ast_evaluator));
     if (!evaluator) {
         return NULL;
     }
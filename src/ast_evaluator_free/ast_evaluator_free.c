@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Free AST evaluator
@@ -17,6 +18,6 @@ void ast_evaluator_free(ast_evaluator* evaluator) {
         return;
     }
     
-    free(evaluator->error_message);
-    free(evaluator);
+    xmd_free(evaluator->error_message);
+    xmd_free(evaluator);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #include <stdlib.h>
 #include "../../include/ast_node.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
 
 /**
  * @brief Free AST node and all its children recursively
@@ -23,22 +25,22 @@ void ast_free(ast_node* node) {
                 for (size_t i = 0; i < node->data.program.statement_count; i++) {
                     ast_free(node->data.program.statements[i]);
                 }
-                free(node->data.program.statements);
+                xmd_free(node->data.program.statements);
             }
             break;
             
         case AST_DIRECTIVE:
-            free(node->data.directive.command);
+            xmd_free(node->data.directive.command);
             if (node->data.directive.arguments) {
                 for (size_t i = 0; i < node->data.directive.argument_count; i++) {
                     ast_free(node->data.directive.arguments[i]);
                 }
-                free(node->data.directive.arguments);
+                xmd_free(node->data.directive.arguments);
             }
             break;
             
         case AST_ASSIGNMENT:
-            free(node->data.assignment.variable);
+            xmd_free(node->data.assignment.variable);
             ast_free(node->data.assignment.value);
             break;
             
@@ -52,22 +54,22 @@ void ast_free(ast_node* node) {
             break;
             
         case AST_FUNCTION_CALL:
-            free(node->data.function_call.name);
+            xmd_free(node->data.function_call.name);
             if (node->data.function_call.arguments) {
                 for (size_t i = 0; i < node->data.function_call.argument_count; i++) {
                     ast_free(node->data.function_call.arguments[i]);
                 }
-                free(node->data.function_call.arguments);
+                xmd_free(node->data.function_call.arguments);
             }
             break;
             
         case AST_VARIABLE_REF:
-            free(node->data.variable_ref.name);
+            xmd_free(node->data.variable_ref.name);
             break;
             
         case AST_LITERAL:
             if (node->data.literal.type == LITERAL_STRING) {
-                free(node->data.literal.value.string_value);
+                xmd_string_release(node->data.literal.value.string_value);
             }
             break;
             
@@ -76,7 +78,7 @@ void ast_free(ast_node* node) {
                 for (size_t i = 0; i < node->data.array_literal.element_count; i++) {
                     ast_free(node->data.array_literal.elements[i]);
                 }
-                free(node->data.array_literal.elements);
+                xmd_free(node->data.array_literal.elements);
             }
             break;
             
@@ -85,6 +87,12 @@ void ast_free(ast_node* node) {
             ast_free(node->data.array_access.index_expr);
             break;
             
+        case AST_RANGE:
+            ast_free(node->data.range.start);
+            ast_free(node->data.range.end);
+            ast_free(node->data.range.step);
+            break;
+            
         case AST_CONDITIONAL:
             ast_free(node->data.conditional.condition);
             ast_free(node->data.conditional.then_block);
@@ -92,7 +100,7 @@ void ast_free(ast_node* node) {
             break;
             
         case AST_LOOP:
-            free(node->data.loop.variable);
+            xmd_free(node->data.loop.variable);
             ast_free(node->data.loop.iterable);
             ast_free(node->data.loop.body);
             break;
@@ -102,14 +110,14 @@ void ast_free(ast_node* node) {
                 for (size_t i = 0; i < node->data.block.statement_count; i++) {
                     ast_free(node->data.block.statements[i]);
                 }
-                free(node->data.block.statements);
+                xmd_free(node->data.block.statements);
             }
             break;
             
         case AST_IDENTIFIER:
-            free(node->data.identifier.name);
+            xmd_free(node->data.identifier.name);
             break;
     }
     
-    free(node);
+    xmd_free(node);
 }
\ No newline at end of file
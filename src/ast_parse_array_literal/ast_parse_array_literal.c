@@ -11,6 +11,7 @@
 #include "../../include/ast_evaluator.h"
 #include "../../include/ast_parser.h"
 #include "../../include/lexer_enhanced.h"
+#include "../../include/utils.h"
 
 /**
  * @brief Parse array literal using AST (replaces string-based parse_array_literal)
@@ -65,9 +66,9 @@ variable* ast_parse_array_literal(const char* input) {
                     item = variable_create_string(element->data.literal.value.string_value);
                     break;
                 case LITERAL_NUMBER: {
-                    char number_str[64];
-                    snprintf(number_str, sizeof(number_str), "%.15g", element->data.literal.value.number_value);
-                    item = variable_create_string(number_str);
+                    char number_str[XMD_NUMBER_BUFFER_SIZE];
+                    size_t length = xmd_format_number(element->data.literal.value.number_value, number_str);
+                    item = variable_create_string_length(number_str, length);
                     break;
                 }
                 case LITERAL_BOOLEAN:
@@ -0,0 +1,20 @@
+/**
+ * @file ast_parse_cache_attach.c
+ * @brief Attach a parsed-program cache to the calling thread
+ * @author XMD Team
+ */
+
+#include "../../../include/ast_parse_cache.h"
+
+XMD_THREAD_LOCAL ast_parse_cache* xmd_active_parse_cache = NULL;
+
+/**
+ * @brief Attach a cache to the calling thread
+ * @param cache Cache to attach, or NULL to detach
+ * @return Previously attached cache
+ */
+ast_parse_cache* ast_parse_cache_attach(ast_parse_cache* cache) {
+    ast_parse_cache* previous = xmd_active_parse_cache;
+    xmd_active_parse_cache = cache;
+    return previous;
+}
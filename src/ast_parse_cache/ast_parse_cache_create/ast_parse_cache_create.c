@@ -0,0 +1,25 @@
+/**
+ * @file ast_parse_cache_create.c
+ * @brief Create a parsed-program cache
+ * @author XMD Team
+ */
+
+#include "../../../include/ast_parse_cache.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create an empty cache
+ * @return Cache or NULL on allocation failure
+ */
+ast_parse_cache* ast_parse_cache_create(void) {
+    ast_parse_cache* cache = xmd_calloc(1, sizeof(ast_parse_cache));
+    if (!cache) {
+        return NULL;
+    }
+    for (size_t i = 0; i < AST_PARSE_CACHE_BUCKETS; i++) {
+        cache->buckets[i] = -1;
+    }
+    cache->newest = -1;
+    cache->oldest = -1;
+    return cache;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file ast_parse_cache_destroy.c
+ * @brief Destroy a parsed-program cache
+ * @author XMD Team
+ */
+
+#include "../../../include/ast_parse_cache.h"
+#include "../../../include/ast_parser.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Destroy a cache and every program it holds
+ * @param cache Cache to destroy
+ */
+void ast_parse_cache_destroy(ast_parse_cache* cache) {
+    if (!cache) {
+        return;
+    }
+    for (size_t i = 0; i < cache->count; i++) {
+        xmd_free(cache->entries[i].text);
+        ast_free(cache->entries[i].program);
+    }
+    xmd_free(cache->evaluator.output_buffer);
+    xmd_free(cache->evaluator.error_message);
+    xmd_free(cache);
+}
@@ -0,0 +1,131 @@
+/**
+ * @file ast_parse_cache_lookup.c
+ * @brief Look up or parse a program by its text
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/ast_parse_cache.h"
+#include "../../../include/ast_parser.h"
+#include "../../../include/lexer_enhanced.h"
+#include "../../../include/performance.h"
+#include "../../../include/utils.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Unlink an entry from the recency list
+ */
+static void unlink_recent(ast_parse_cache* cache, int32_t index) {
+    ast_parse_cache_entry* entry = &cache->entries[index];
+    if (entry->newer >= 0) {
+        cache->entries[entry->newer].older = entry->older;
+    } else {
+        cache->newest = entry->older;
+    }
+    if (entry->older >= 0) {
+        cache->entries[entry->older].newer = entry->newer;
+    } else {
+        cache->oldest = entry->newer;
+    }
+}
+
+/**
+ * @brief Make an entry the most recently used
+ */
+static void push_newest(ast_parse_cache* cache, int32_t index) {
+    ast_parse_cache_entry* entry = &cache->entries[index];
+    entry->newer = -1;
+    entry->older = cache->newest;
+    if (cache->newest >= 0) {
+        cache->entries[cache->newest].newer = index;
+    } else {
+        cache->oldest = index;
+    }
+    cache->newest = index;
+}
+
+/**
+ * @brief Release the least recently used entry and return its slot
+ */
+static int32_t evict_oldest(ast_parse_cache* cache) {
+    int32_t index = cache->oldest;
+    ast_parse_cache_entry* entry = &cache->entries[index];
+    
+    int32_t* link = &cache->buckets[xmd_hash_key(entry->text, AST_PARSE_CACHE_BUCKETS)];
+    while (*link != index) {
+        link = &cache->entries[*link].chain;
+    }
+    *link = entry->chain;
+    unlink_recent(cache, index);
+    
+    xmd_free(entry->text);
+    ast_free(entry->program);
+    entry->text = NULL;
+    entry->program = NULL;
+    return index;
+}
+
+/**
+ * @brief Lex and parse a text
+ * @param text Source text
+ * @return Program with at least one statement, or NULL
+ */
+static ast_node* parse(const char* text) {
+    token* tokens = lexer_enhanced_tokenize(text, "expression");
+    if (!tokens) {
+        return NULL;
+    }
+    ast_node* program = ast_parse_program(tokens);
+    token_list_free(tokens);
+    if (!program || program->type != AST_PROGRAM || program->data.program.statement_count == 0) {
+        ast_free(program);
+        return NULL;
+    }
+    return program;
+}
+
+/**
+ * @brief Get the parsed program for a text, parsing it on a miss
+ * @param cache Cache
+ * @param text Source text
+ * @return Parsed program (owned by the cache) or NULL if the text does not parse
+ */
+ast_node* ast_parse_cache_lookup(ast_parse_cache* cache, const char* text) {
+    if (!cache || !text) {
+        return NULL;
+    }
+    
+    size_t bucket = xmd_hash_key(text, AST_PARSE_CACHE_BUCKETS);
+    for (int32_t i = cache->buckets[bucket]; i >= 0; i = cache->entries[i].chain) {
+        if (strcmp(cache->entries[i].text, text) == 0) {
+            if (cache->newest != i) {
+                unlink_recent(cache, i);
+                push_newest(cache, i);
+            }
+            cache->hits++;
+            PERF_RECORD_CACHE_HIT(xmd_active_profiler);
+            return cache->entries[i].program;
+        }
+    }
+    
+    cache->misses++;
+    PERF_RECORD_CACHE_MISS(xmd_active_profiler);
+    ast_node* program = parse(text);
+    char* copy = xmd_strdup(text);
+    if (!copy) {
+        // Programs are only handed out through the cache
+        ast_free(program);
+        return NULL;
+    }
+    
+    int32_t index = cache->count < AST_PARSE_CACHE_CAPACITY
+        ? (int32_t)cache->count++
+        : evict_oldest(cache);
+    ast_parse_cache_entry* entry = &cache->entries[index];
+    entry->text = copy;
+    entry->program = program;
+    entry->chain = cache->buckets[bucket];
+    cache->buckets[bucket] = index;
+    push_newest(cache, index);
+    return program;
+}
@@ -0,0 +1,17 @@
+/**
+ * @file ast_parse_cache_release.c
+ * @brief Give back a cache's reusable evaluator
+ * @author XMD Team
+ */
+
+#include "../../../include/ast_parse_cache.h"
+
+/**
+ * @brief Give back the evaluator taken from a cache
+ * @param cache Cache
+ */
+void ast_parse_cache_release(ast_parse_cache* cache) {
+    if (cache) {
+        cache->evaluating = false;
+    }
+}
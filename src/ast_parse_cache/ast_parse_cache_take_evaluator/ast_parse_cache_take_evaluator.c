@@ -0,0 +1,37 @@
+/**
+ * @file ast_parse_cache_take_evaluator.c
+ * @brief Take a cache's reusable evaluator
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/ast_parse_cache.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Take the cache's evaluator, reset for a new evaluation
+ * @param cache Cache
+ * @param variables Variables the evaluation reads
+ * @return Evaluator or NULL if it is in use
+ */
+ast_evaluator* ast_parse_cache_take_evaluator(ast_parse_cache* cache, store* variables) {
+    if (!cache || cache->evaluating || !variables) {
+        return NULL;
+    }
+    
+    // Drop whatever the previous evaluation left behind
+    xmd_free(cache->evaluator.output_buffer);
+    xmd_free(cache->evaluator.error_message);
+    memset(&cache->context, 0, sizeof(cache->context));
+    cache->context.variables = variables;
+    
+    cache->evaluator.variables = variables;
+    cache->evaluator.ctx = &cache->context;
+    cache->evaluator.output_buffer = NULL;
+    cache->evaluator.output_size = 0;
+    cache->evaluator.has_error = false;
+    cache->evaluator.error_message = NULL;
+    cache->evaluator.in_statement_context = false;
+    cache->evaluating = true;
+    return &cache->evaluator;
+}
@@ -10,6 +10,8 @@
 #include "../../include/ast_parser.h"
 #include "../../include/ast_node.h"
 
+static ast_node* parse_expression_prec(parser_state* state, int min_prec);
+
 /**
  * @brief Get operator precedence (higher number = higher precedence)
  * @param op_str Operator string
@@ -18,13 +20,14 @@
 static int get_precedence(const char* op_str) {
     if (!op_str) return 0;
     
-    if (strcmp(op_str, "||") == 0) return 1;
-    if (strcmp(op_str, "&&") == 0) return 2;
-    if (strcmp(op_str, "==") == 0 || strcmp(op_str, "!=") == 0) return 3;
+    if (strcmp(op_str, "..") == 0) return 1;
+    if (strcmp(op_str, "||") == 0) return 2;
+    if (strcmp(op_str, "&&") == 0) return 3;
+    if (strcmp(op_str, "==") == 0 || strcmp(op_str, "!=") == 0) return 4;
     if (strcmp(op_str, "<") == 0 || strcmp(op_str, ">") == 0 ||
-        strcmp(op_str, "<=") == 0 || strcmp(op_str, ">=") == 0) return 4;
-    if (strcmp(op_str, "+") == 0 || strcmp(op_str, "-") == 0) return 5;
-    if (strcmp(op_str, "*") == 0 || strcmp(op_str, "/") == 0) return 6;
+        strcmp(op_str, "<=") == 0 || strcmp(op_str, ">=") == 0) return 5;
+    if (strcmp(op_str, "+") == 0 || strcmp(op_str, "-") == 0) return 6;
+    if (strcmp(op_str, "*") == 0 || strcmp(op_str, "/") == 0) return 7;
     
     return 0;
 }
@@ -50,6 +53,42 @@ static binary_operator string_to_binop(const char* op_str) {
     return BINOP_ADD; // Default
 }
 
+/**
+ * @brief Parse the rest of a range after its ".." operator
+ * @param state Parser state (positioned after "..")
+ * @param start First item expression (owned by the range)
+ * @param loc Location of the operator
+ * @return Range node or NULL on error
+ */
+static ast_node* parse_range(parser_state* state, ast_node* start, source_location loc) {
+    ast_node* end = parse_expression_prec(state, 2);
+    if (!end) {
+        ast_free(start);
+        return NULL;
+    }
+    
+    // Optional "step n"
+    ast_node* step = NULL;
+    token* next = parser_peek_token(state);
+    if (next && next->type == TOKEN_IDENTIFIER && strcmp(next->value, "step") == 0) {
+        parser_advance_token(state);
+        step = parse_expression_prec(state, 2);
+        if (!step) {
+            ast_free(start);
+            ast_free(end);
+            return NULL;
+        }
+    }
+    
+    ast_node* range = ast_create_range(start, end, step, loc);
+    if (!range) {
+        ast_free(start);
+        ast_free(end);
+        ast_free(step);
+    }
+    return range;
+}
+
 /**
  * @brief Parse expression with precedence climbing
  * @param state Parser state
@@ -74,6 +113,11 @@ static ast_node* parse_expression_prec(parser_state* state, int min_prec) {
         }
         
         source_location loc = {op_tok->line, op_tok->column, state->filename};
+        if (strcmp(op_tok->value, "..") == 0) {
+            // Ranges bind loosest and do not chain
+            parser_advance_token(state);
+            return parse_range(state, left, loc);
+        }
         binary_operator op = string_to_binop(op_tok->value);
         parser_advance_token(state); // Skip operator
         
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include "../../include/ast_parser.h"
 #include "../../include/ast_node.h"
+#include "../../include/performance.h"
 
 /**
  * @brief Parse program from token stream
@@ -30,6 +31,8 @@ ast_node* ast_parse_program(token* tokens) {
         return NULL;
     }
     
+    PERF_STAGE_BEGIN(PERF_STAGE_PARSE);
+    
     // Parse statements until EOF
     while (state->current_token && state->current_token->type != TOKEN_EOF) {
         ast_node* stmt = ast_parse_statement(state);
@@ -48,6 +51,7 @@ ast_node* ast_parse_program(token* tokens) {
     
     bool had_error = state->has_error;
     parser_state_free(state);
+    PERF_STAGE_END(PERF_STAGE_PARSE);
     
     if (had_error) {
         ast_free(program);
@@ -14,6 +14,7 @@
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
 #include "../../include/ast_process_directive_content.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Process XMD directive found in HTML comment
@@ -85,7 +86,7 @@ int ast_process_directive_content(const char* directive_content,
         // Need to properly quote the command
         size_t cmd_len = strlen(cmd_start);
         size_t new_len = cmd_len * 2 + 20; // exec("") + null + escapes
-        char* transformed = malloc(new_len);
+        char* transformed = xmd_malloc(new_len);
         if (!transformed) return -1;
         
         // If command already has quotes, use as-is; otherwise add quotes
@@ -94,9 +95,9 @@ int ast_process_directive_content(const char* directive_content,
             snprintf(transformed, new_len, "exec(%s)", cmd_start);
         } else {
             // Need to escape the command for string literal
-            char* escaped_cmd = malloc(cmd_len * 2 + 1);
+            char* escaped_cmd = xmd_malloc(cmd_len * 2 + 1);
             if (!escaped_cmd) {
-                free(transformed);
+                xmd_free(transformed);
                 return -1;
             }
             
@@ -110,12 +111,12 @@ int ast_process_directive_content(const char* directive_content,
             escaped_cmd[j] = '\0';
             
             snprintf(transformed, new_len, "exec(\"%s\")", escaped_cmd);
-            free(escaped_cmd);
+            xmd_free(escaped_cmd);
         }
         
         // Use transformed content
         token* tokens = lexer_enhanced_tokenize(transformed, "xmd_directive");
-        free(transformed);
+        xmd_free(transformed);
         
         if (!tokens) {
             return -1;
@@ -144,7 +145,7 @@ int ast_process_directive_content(const char* directive_content,
                 size_t required = *output_pos + result_len;
                 if (required >= *output_capacity) {
                     *output_capacity = required * 2;
-                    *output = realloc(*output, *output_capacity);
+                    *output = xmd_realloc(*output, *output_capacity);
                     if (!*output) {
                         ast_value_free(result);
                         ast_evaluator_free(evaluator);
@@ -165,7 +166,7 @@ int ast_process_directive_content(const char* directive_content,
             size_t required = *output_pos + evaluator->output_size;
             if (required >= *output_capacity) {
                 *output_capacity = required * 2;
-                *output = realloc(*output, *output_capacity);
+                *output = xmd_realloc(*output, *output_capacity);
                 if (!*output) {
                     ast_evaluator_free(evaluator);
                     ast_free(ast);
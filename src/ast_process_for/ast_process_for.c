@@ -12,6 +12,7 @@
 #include "../../include/ast_parser.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Process for directive using AST (replaces string-based process_for)
@@ -54,12 +55,12 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
     // This is a transitional implementation that uses AST for expression evaluation
     // but retains the basic for loop parsing structure
     
-    char* args_copy = strdup(args);
+    char* args_copy = xmd_strdup(args);
     char* in_pos = strstr(args_copy, " in ");
     
     if (!in_pos) {
         snprintf(output, output_size, "<!-- Error: Invalid for loop syntax '%s' -->", args);
-        free(args_copy);
+        xmd_free(args_copy);
         ast_free(ast);
         return -1;
     }
@@ -72,7 +73,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
     ast_evaluator* evaluator = ast_evaluator_create(ctx->variables, ctx);
     if (!evaluator) {
         snprintf(output, output_size, "<!-- Error: Failed to create AST evaluator -->");
-        free(args_copy);
+        xmd_free(args_copy);
         ast_free(ast);
         return -1;
     }
@@ -80,7 +81,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
     // For range syntax (contains ..), handle specially
     if (strstr(collection_expr, "..")) {
         // For now, keep the basic range parsing but use AST for variable resolution
-        char* range_copy = strdup(collection_expr);
+        char* range_copy = xmd_strdup(collection_expr);
         char* dots_pos = strstr(range_copy, "..");
         
         if (dots_pos) {
@@ -95,7 +96,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
             if (start_var) {
                 char* start_value = variable_to_string(start_var);
                 start_val = atoi(start_value);
-                free(start_value);
+                xmd_free(start_value);
             } else {
                 start_val = atoi(start_str);
             }
@@ -104,7 +105,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
             if (end_var) {
                 char* end_value = variable_to_string(end_var);
                 end_val = atoi(end_value);
-                free(end_value);
+                xmd_free(end_value);
             } else {
                 end_val = atoi(end_str);
             }
@@ -121,7 +122,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
             }
         }
         
-        free(range_copy);
+        xmd_free(range_copy);
     } else {
         // Collection lookup - get variable and set first element
         variable* collection_var = store_get(ctx->variables, collection_expr);
@@ -139,7 +140,7 @@ int ast_process_for(const char* args, processor_context* ctx, char* output, size
     
     ast_evaluator_free(evaluator);
     ast_free(ast);
-    free(args_copy);
+    xmd_free(args_copy);
     
     // The for loop itself doesn't produce output - the content between
     // for/endfor tags gets processed with the loop variable set
@@ -14,6 +14,7 @@
 #include "../../include/ast_parser.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Check if content contains a function definition
@@ -68,7 +69,7 @@ static int parse_multiline_function(const char* content,
     size_t name_len = ptr - name_start;
     if (name_len == 0) return -1;
     
-    *func_name = malloc(name_len + 1);
+    *func_name = xmd_malloc(name_len + 1);
     if (!*func_name) return -1;
     memcpy(*func_name, name_start, name_len);
     (*func_name)[name_len] = '\0';
@@ -80,9 +81,9 @@ static int parse_multiline_function(const char* content,
     while (*ptr && *ptr != '\n') ptr++;
     
     size_t params_len = ptr - params_start;
-    *func_params = malloc(params_len + 1);
+    *func_params = xmd_malloc(params_len + 1);
     if (!*func_params) {
-        free(*func_name);
+        xmd_free(*func_name);
         *func_name = NULL;
         return -1;
     }
@@ -93,10 +94,10 @@ static int parse_multiline_function(const char* content,
     if (*ptr == '\n') ptr++;
     
     // Rest is the function body
-    *func_body = strdup(ptr);
+    *func_body = xmd_strdup(ptr);
     if (!*func_body) {
-        free(*func_name);
-        free(*func_params);
+        xmd_free(*func_name);
+        xmd_free(*func_params);
         *func_name = NULL;
         *func_params = NULL;
         return -1;
@@ -119,7 +120,7 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
     // Create evaluator for this multiline block
     ast_evaluator* evaluator = ast_evaluator_create(ctx->variables, ctx);
     if (!evaluator) {
-        return strdup("");
+        return xmd_strdup("");
     }
     
     // Check if this is a function definition
@@ -137,19 +138,19 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
             
             if (func_def) {
                 // Add parameters
-                char* params_copy = strdup(func_params);
+                char* params_copy = xmd_strdup(func_params);
                 char* param = strtok(params_copy, " \t");
                 while (param) {
                     ast_add_parameter(func_def, param);
                     param = strtok(NULL, " \t");
                 }
-                free(params_copy);
+                xmd_free(params_copy);
                 
                 // Parse function body
                 // Split body into lines and process each
                 ast_node* body_block = ast_create_block(loc);
                 
-                char* body_copy = strdup(func_body);
+                char* body_copy = xmd_strdup(func_body);
                 char* line = strtok(body_copy, "\n");
                 
                 while (line) {
@@ -180,7 +181,7 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
                     line = strtok(NULL, "\n");
                 }
                 
-                free(body_copy);
+                xmd_free(body_copy);
                 
                 // Set function body
                 func_def->data.function_def.body = body_block;
@@ -192,7 +193,7 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
                 if (reg_status == 0 && ctx) {
                     // Grow the global functions array
                     size_t new_count = ctx->global_function_count + 1;
-                    ast_node** new_functions = realloc(ctx->global_functions,
+                    ast_node** new_functions = xmd_realloc(ctx->global_functions,
                                                       new_count * sizeof(ast_node*));
                     if (new_functions) {
                         new_functions[new_count - 1] = func_def;
@@ -205,22 +206,22 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
             }
             */
             
-            free(func_name);
-            free(func_params);
-            free(func_body);
+            xmd_free(func_name);
+            xmd_free(func_params);
+            xmd_free(func_body);
             
             // Return empty string for function definition
-            return strdup("");
+            return xmd_strdup("");
         }
     }
     
     // For non-function multiline directives, process each line separately
-    char* result = malloc(1);
+    char* result = xmd_malloc(1);
     result[0] = '\0';
     size_t result_len = 0;
     
     
-    char* content_copy = strdup(content);
+    char* content_copy = xmd_strdup(content);
     char* line = strtok(content_copy, "\n");
     
     while (line) {
@@ -266,7 +267,7 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
                                 char* new_output = evaluator->output_buffer + prev_output_size;
                                 
                                 // Append to result
-                                result = realloc(result, result_len + new_output_len + 2);
+                                result = xmd_realloc(result, result_len + new_output_len + 2);
                                 if (result) {
                                     memcpy(result + result_len, new_output, new_output_len);
                                     result_len += new_output_len;
@@ -278,7 +279,7 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
                                 // Handle non-print expressions
                                 if (value->type == AST_VAL_STRING && value->value.string_value) {
                                     size_t val_len = strlen(value->value.string_value);
-                                    result = realloc(result, result_len + val_len + 2);
+                                    result = xmd_realloc(result, result_len + val_len + 2);
                                     if (result) {
                                         strcpy(result + result_len, value->value.string_value);
                                         result_len += val_len;
@@ -297,14 +298,14 @@ char* ast_process_multiline_directive(const char* content, processor_context* ct
             
             // Free transformed string if it was allocated
             if (transformed) {
-                free(transformed);
+                xmd_free(transformed);
             }
         }
         
         line = strtok(NULL, "\n");
     }
     
-    free(content_copy);
+    xmd_free(content_copy);
     
     // Remove trailing newline if present
     if (result_len > 0 && result[result_len-1] == '\n') {
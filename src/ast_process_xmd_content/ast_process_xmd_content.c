@@ -11,8 +11,12 @@
 #include <stdio.h>
 #include "../../include/ast_evaluator.h"
 #include "../../include/ast_parser.h"
+#include "../../include/ast_parse_cache.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/config.h"
+#include "../../include/performance.h"
+#include "../../include/allocator.h"
 
 // Function declarations
 extern char* ast_substitute_variables(const char* text, store* variables);
@@ -35,7 +39,7 @@ static char* preprocess_at_syntax(const char* input) {
     
     size_t input_len = strlen(input);
     size_t output_capacity = input_len * 2 + 1; // Extra space for expansions  
-    char* output = malloc(output_capacity);
+    char* output = xmd_malloc(output_capacity);
     if (!output) {
         return NULL;
     }
@@ -54,7 +58,7 @@ static char* preprocess_at_syntax(const char* input) {
                 if (end) {
                     // Extract filename (remove quotes if present)
                     size_t filename_len = end - start;
-                    char* filename = malloc(filename_len + 1);
+                    char* filename = xmd_malloc(filename_len + 1);
                     if (filename) {
                         strncpy(filename, start, filename_len);
                         filename[filename_len] = '\0';
@@ -73,10 +77,10 @@ static char* preprocess_at_syntax(const char* input) {
                         size_t replacement_len = 15 + strlen(clean_filename) + 4; // "<!-- xmd: import " + filename + " -->"
                         if (output_pos + replacement_len >= output_capacity) {
                             output_capacity = (output_pos + replacement_len) * 2;
-                            char* new_output = realloc(output, output_capacity);
+                            char* new_output = xmd_realloc(output, output_capacity);
                             if (!new_output) {
-                                free(filename);
-                                free(output);
+                                xmd_free(filename);
+                                xmd_free(output);
                                 return NULL;
                             }
                             output = new_output;
@@ -89,7 +93,7 @@ static char* preprocess_at_syntax(const char* input) {
                             output_pos += written;
                         }
                         
-                        free(filename);
+                        xmd_free(filename);
                         ptr = end + 1; // Skip past the closing parenthesis
                         continue;
                     }
@@ -99,9 +103,9 @@ static char* preprocess_at_syntax(const char* input) {
             // If we get here, @ wasn't a recognized directive, copy it as-is
             if (output_pos >= output_capacity - 1) {
                 output_capacity *= 2;
-                char* new_output = realloc(output, output_capacity);
+                char* new_output = xmd_realloc(output, output_capacity);
                 if (!new_output) {
-                    free(output);
+                    xmd_free(output);
                     return NULL;
                 }
                 output = new_output;
@@ -111,9 +115,9 @@ static char* preprocess_at_syntax(const char* input) {
             // Copy regular character
             if (output_pos >= output_capacity - 1) {
                 output_capacity *= 2;
-                char* new_output = realloc(output, output_capacity);
+                char* new_output = xmd_realloc(output, output_capacity);
                 if (!new_output) {
-                    free(output);
+                    xmd_free(output);
                     return NULL;
                 }
                 output = new_output;
@@ -196,7 +200,7 @@ static int ast_process_directive_content(const char* directive_content,
         
         // Remove quotes if present
         size_t filename_len = strlen(filename_start);
-        char* filename = malloc(filename_len + 1);
+        char* filename = xmd_malloc(filename_len + 1);
         if (!filename) return -1;
         
         if ((filename_start[0] == '"' && filename_start[filename_len-1] == '"') ||
@@ -210,17 +214,17 @@ static int ast_process_directive_content(const char* directive_content,
         
         // Transform to function call format
         size_t transformed_len = strlen(filename) + 20;
-        char* transformed = malloc(transformed_len);
+        char* transformed = xmd_malloc(transformed_len);
         if (!transformed) {
-            free(filename);
+            xmd_free(filename);
             return -1;
         }
         snprintf(transformed, transformed_len, "import(\"%s\")", filename);
-        free(filename);
+        xmd_free(filename);
         
         // Use transformed content
         token* tokens = lexer_enhanced_tokenize(transformed, "xmd_directive");
-        free(transformed);
+        xmd_free(transformed);
         
         if (!tokens) {
             return -1;
@@ -249,7 +253,7 @@ static int ast_process_directive_content(const char* directive_content,
                 size_t required = *output_pos + result_len;
                 if (required >= *output_capacity) {
                     *output_capacity = required * 2;
-                    *output = realloc(*output, *output_capacity);
+                    *output = xmd_realloc(*output, *output_capacity);
                     if (!*output) {
                         ast_value_free(result);
                         ast_evaluator_free(evaluator);
@@ -270,7 +274,7 @@ static int ast_process_directive_content(const char* directive_content,
             size_t required = *output_pos + evaluator->output_size;
             if (required >= *output_capacity) {
                 *output_capacity = required * 2;
-                *output = realloc(*output, *output_capacity);
+                *output = xmd_realloc(*output, *output_capacity);
                 if (!*output) {
                     ast_evaluator_free(evaluator);
                     ast_free(ast);
@@ -293,7 +297,7 @@ static int ast_process_directive_content(const char* directive_content,
         // Need to properly quote the command
         size_t cmd_len = strlen(cmd_start);
         size_t new_len = cmd_len * 2 + 20; // exec("") + null + escapes
-        char* transformed = malloc(new_len);
+        char* transformed = xmd_malloc(new_len);
         if (!transformed) return -1;
         
         // If command already has quotes, use as-is; otherwise add quotes
@@ -302,9 +306,9 @@ static int ast_process_directive_content(const char* directive_content,
             snprintf(transformed, new_len, "exec(%s)", cmd_start);
         } else {
             // Need to escape the command for string literal
-            char* escaped_cmd = malloc(cmd_len * 2 + 1);
+            char* escaped_cmd = xmd_malloc(cmd_len * 2 + 1);
             if (!escaped_cmd) {
-                free(transformed);
+                xmd_free(transformed);
                 return -1;
             }
             
@@ -318,12 +322,12 @@ static int ast_process_directive_content(const char* directive_content,
             escaped_cmd[j] = '\0';
             
             snprintf(transformed, new_len, "exec(\"%s\")", escaped_cmd);
-            free(escaped_cmd);
+            xmd_free(escaped_cmd);
         }
         
         // Use transformed content
         token* tokens = lexer_enhanced_tokenize(transformed, "xmd_directive");
-        free(transformed);
+        xmd_free(transformed);
         
         if (!tokens) {
             return -1;
@@ -352,7 +356,7 @@ static int ast_process_directive_content(const char* directive_content,
                 size_t required = *output_pos + result_len;
                 if (required >= *output_capacity) {
                     *output_capacity = required * 2;
-                    *output = realloc(*output, *output_capacity);
+                    *output = xmd_realloc(*output, *output_capacity);
                     if (!*output) {
                         ast_value_free(result);
                         ast_evaluator_free(evaluator);
@@ -373,7 +377,7 @@ static int ast_process_directive_content(const char* directive_content,
             size_t required = *output_pos + evaluator->output_size;
             if (required >= *output_capacity) {
                 *output_capacity = required * 2;
-                *output = realloc(*output, *output_capacity);
+                *output = xmd_realloc(*output, *output_capacity);
                 if (!*output) {
                     ast_evaluator_free(evaluator);
                     ast_free(ast);
@@ -497,7 +501,7 @@ static int ast_process_directive_content(const char* directive_content,
         size_t required = *output_pos + evaluator->output_size;
         if (required >= *output_capacity) {
             *output_capacity = required * 2;
-            *output = realloc(*output, *output_capacity);
+            *output = xmd_realloc(*output, *output_capacity);
             if (!*output) {
                 ast_evaluator_free(evaluator);
                 ast_free(ast);
@@ -553,18 +557,119 @@ static const char* ast_find_matching_endfor(const char* input) {
 }
 
 /**
- * @brief Process XMD content using AST parser
- * @param input Input content containing XMD directives
- * @param variables Variable store
- * @return Processed content (caller must free) or NULL on error
+ * @brief Evaluate a loop's range expression such as 1..n step 2
+ * @param expression Collection text of the for directive
+ * @param variables Variable store for the bounds
+ * @param error Set to the evaluation error, if any (caller frees)
+ * @return Range array variable or NULL if the text is not a range
  */
-char* ast_process_xmd_content(const char* input, store* variables) {
-    if (!input || !variables) {
+static variable* evaluate_loop_range(const char* expression, store* variables, char** error) {
+    ast_parse_cache* cache = xmd_active_parse_cache;
+    ast_evaluator* evaluator = ast_parse_cache_take_evaluator(cache, variables);
+    if (evaluator) {
+        variable* range = NULL;
+        ast_node* program = ast_parse_cache_lookup(cache, expression);
+        if (program && program->data.program.statements[0]->type == AST_RANGE) {
+            range = ast_evaluate_range(program->data.program.statements[0], evaluator);
+        }
+        *error = evaluator->error_message;
+        evaluator->error_message = NULL;
+        ast_parse_cache_release(cache);
+        return range;
+    }
+    
+    token* tokens = lexer_enhanced_tokenize(expression, "for_range");
+    if (!tokens) {
+        return NULL;
+    }
+    ast_node* ast = ast_parse_program(tokens);
+    token_list_free(tokens);
+    if (!ast || ast->type != AST_PROGRAM || ast->data.program.statement_count == 0 ||
+        ast->data.program.statements[0]->type != AST_RANGE) {
+        ast_free(ast);
         return NULL;
     }
     
+    processor_context temp_ctx = {0};
+    temp_ctx.variables = variables;
+    variable* range = NULL;
+    evaluator = ast_evaluator_create(variables, &temp_ctx);
+    if (evaluator) {
+        range = ast_evaluate_range(ast->data.program.statements[0], evaluator);
+        *error = evaluator->error_message;
+        evaluator->error_message = NULL;
+        ast_evaluator_free(evaluator);
+    }
+    ast_free(ast);
+    return range;
+}
+
+/**
+ * @brief Line/column cursor over the content being scanned
+ */
+typedef struct {
+    const char* scanned;     /**< Position counted up to */
+    const char* line_start;  /**< Start of the line containing scanned */
+    size_t line;             /**< Line number of scanned (1-based) */
+} line_cursor;
+
+/**
+ * @brief Locate a position in the enclosing file for hot-spot profiling
+ * @param cursor Cursor over the current content (positions must not go back)
+ * @param position Position to locate
+ * @param ctx Processor context providing the top-level file name
+ * @return Absolute location (filename borrowed)
+ */
+static source_location cursor_locate(line_cursor* cursor, const char* position,
+                                     processor_context* ctx) {
+    for (; cursor->scanned < position; cursor->scanned++) {
+        if (*cursor->scanned == '\n') {
+            cursor->line++;
+            cursor->line_start = cursor->scanned + 1;
+        }
+    }
+    return perf_hotspot_locate(xmd_active_profiler, cursor->line,
+                               (size_t)(position - cursor->line_start) + 1,
+                               ctx->source_file_path);
+}
+
+/**
+ * @brief Open a hot-spot frame for a directive when directive profiling is on
+ * @param cursor Cursor over the current content
+ * @param comment_start Start of the directive comment
+ * @param directive_start Directive text after the "xmd:" prefix
+ * @param ctx Processor context
+ * @return true if a frame was opened and must be closed
+ */
+static bool enter_directive(line_cursor* cursor, const char* comment_start,
+                            const char* directive_start, processor_context* ctx) {
+    if (!xmd_active_profiler || !xmd_active_profiler->hotspots_enabled) {
+        return false;
+    }
+    
+    char label[32];
+    size_t label_len = strcspn(directive_start, " \t\r\n-(");
+    if (label_len >= sizeof(label)) {
+        label_len = sizeof(label) - 1;
+    }
+    memcpy(label, directive_start, label_len);
+    label[label_len] = '\0';
+    
+    source_location location = cursor_locate(cursor, comment_start, ctx);
+    return perf_hotspot_enter(xmd_active_profiler, &location, label);
+}
+
+/**
+ * @brief Scan content for directives and render it
+ * @param input Input content containing XMD directives
+ * @param variables Variable store
+ * @return Processed content (caller must free) or NULL on error
+ */
+static char* process_content(const char* input, store* variables) {
     // Step 1: Apply @ syntax preprocessing FIRST
+    PERF_STAGE_BEGIN(PERF_STAGE_PREPROCESS);
     char* preprocessed_input = preprocess_at_syntax(input);
+    PERF_STAGE_END(PERF_STAGE_PREPROCESS);
     if (!preprocessed_input) {
         return NULL;
     }
@@ -572,7 +677,7 @@ char* ast_process_xmd_content(const char* input, store* variables) {
     // Create processor context
     processor_context* ctx = create_context(variables);
     if (!ctx) {
-        free(preprocessed_input);
+        xmd_free(preprocessed_input);
         return NULL;
     }
     
@@ -584,17 +689,35 @@ char* ast_process_xmd_content(const char* input, store* variables) {
     
     size_t input_len = strlen(preprocessed_input);
     size_t output_capacity = input_len * 2 + 1;
-    char* output = malloc(output_capacity);
+    char* output = xmd_malloc(output_capacity);
     if (!output) {
         destroy_context(ctx);
-        free(preprocessed_input);
+        xmd_free(preprocessed_input);
         return NULL;
     }
     
     size_t output_pos = 0;
     const char* ptr = preprocessed_input;
+    line_cursor cursor = { preprocessed_input, preprocessed_input, 1 };
+    
+    // Run independent exec directives concurrently before the main pass
+    exec_prefetch* prefetch = NULL;
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    if (config && config->limits.max_parallel_exec > 1) {
+        PERF_STAGE_BEGIN(PERF_STAGE_PREPROCESS);
+        prefetch = exec_prefetch_scan(preprocessed_input);
+        PERF_STAGE_END(PERF_STAGE_PREPROCESS);
+        PERF_STAGE_BEGIN(PERF_STAGE_EXEC);
+        exec_prefetch_run(prefetch, config->limits.max_parallel_exec);
+        PERF_STAGE_END(PERF_STAGE_EXEC);
+    }
     
     while (*ptr) {
+        // A render over its heap budget stops here and unwinds
+        if (xmd_heap_budget_exhausted()) {
+            break;
+        }
+        
         // Look for HTML comment start
         const char* comment_start = strstr(ptr, "<!--");
         
@@ -604,11 +727,15 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                 size_t remaining = strlen(ptr);
                 if (output_pos + remaining >= output_capacity) {
                     output_capacity = (output_pos + remaining + 1) * 2;
-                    output = realloc(output, output_capacity);
-                    if (!output) {
+                    char* grown = xmd_realloc(output, output_capacity);
+                    if (!grown) {
+                        xmd_free(output);
+                        xmd_free(preprocessed_input);
+                        exec_prefetch_free(prefetch);
                         destroy_context(ctx);
                         return NULL;
                     }
+                    output = grown;
                 }
                 memcpy(output + output_pos, ptr, remaining);
                 output_pos += remaining;
@@ -621,11 +748,15 @@ char* ast_process_xmd_content(const char* input, store* variables) {
             size_t before_len = comment_start - ptr;
             if (output_pos + before_len >= output_capacity) {
                 output_capacity = (output_pos + before_len + 1) * 2;
-                output = realloc(output, output_capacity);
-                if (!output) {
+                char* grown = xmd_realloc(output, output_capacity);
+                if (!grown) {
+                    xmd_free(output);
+                    xmd_free(preprocessed_input);
+                    exec_prefetch_free(prefetch);
                     destroy_context(ctx);
                     return NULL;
                 }
+                output = grown;
             }
             memcpy(output + output_pos, ptr, before_len);
             output_pos += before_len;
@@ -639,7 +770,11 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                 size_t remaining = strlen(comment_start);
                 if (output_pos + remaining >= output_capacity) {
                     output_capacity = (output_pos + remaining + 1) * 2;
-                    output = realloc(output, output_capacity);
+                    char* grown = xmd_realloc(output, output_capacity);
+                    if (!grown) {
+                        break;
+                    }
+                    output = grown;
                 }
                 memcpy(output + output_pos, comment_start, remaining);
                 output_pos += remaining;
@@ -663,7 +798,7 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                 
                 // Extract loop arguments
                 size_t args_len = comment_end - args;
-                char* args_str = malloc(args_len + 1);
+                char* args_str = xmd_malloc(args_len + 1);
                 if (!args_str) {
                     ptr = comment_end + 3;
                     continue;
@@ -678,32 +813,90 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                     char* var_name = trim_whitespace(args_str);
                     char* collection_expr = trim_whitespace(in_pos + 4);
                     
-                    // Get the collection
+                    // Get the collection; a range is iterated without
+                    // producing its items
                     variable* collection = store_get(ctx->variables, collection_expr);
+                    variable* range = NULL;
+                    char* range_error = NULL;
+                    if (!collection && strstr(collection_expr, "..")) {
+                        range = evaluate_loop_range(collection_expr, ctx->variables, &range_error);
+                        collection = range;
+                    }
                     
                     // Find the matching endfor
                     const char* endfor_start = ast_find_matching_endfor(comment_end + 3);
-                    if (endfor_start && collection && collection->type == VAR_ARRAY) {
+                    if (endfor_start && (range_error || (collection && collection->type == VAR_ARRAY))) {
+                        // A range over the loop limit renders an error in
+                        // place of the loop rather than a truncated loop
+                        if (range_error) {
+                            size_t error_len = strlen(range_error) + sizeof("[Error: ]") - 1;
+                            if (output_pos + error_len >= output_capacity) {
+                                output_capacity = (output_pos + error_len + 1) * 2;
+                                char* grown = xmd_realloc(output, output_capacity);
+                                if (grown) {
+                                    output = grown;
+                                } else {
+                                    error_len = 0;
+                                }
+                            }
+                            if (error_len > 0) {
+                                snprintf(output + output_pos, output_capacity - output_pos,
+                                         "[Error: %s]", range_error);
+                                output_pos += error_len;
+                            }
+                        }
+                        
                         // Extract loop body
                         const char* body_start = comment_end + 3;
                         size_t body_len = endfor_start - body_start;
-                        char* loop_body = malloc(body_len + 1);
+                        char* loop_body = range_error ? NULL : xmd_malloc(body_len + 1);
+                        
+                        // Iterations aggregate into one frame; the body's
+                        // directives are located relative to where it starts
+                        size_t loop_output_start = output_pos;
+                        bool loop_frame = enter_directive(&cursor, comment_start, directive_start, ctx);
+                        source_location outer_origin = {0, 0, NULL};
+                        if (loop_frame) {
+                            outer_origin = perf_hotspot_set_origin(xmd_active_profiler,
+                                                                   cursor_locate(&cursor, body_start, ctx));
+                        }
+                        // Every iteration runs in the enclosing store, so the
+                        // loop variable and names set in the body outlive it
                         if (loop_body) {
                             memcpy(loop_body, body_start, body_len);
                             loop_body[body_len] = '\0';
                             
                             // Iterate over array elements
-                            size_t array_size = collection->value.array_value->count;
-                            for (size_t i = 0; i < array_size; i++) {
-                                variable* item = collection->value.array_value->items[i];
-                                if (item) {
-                                    // Create a copy of the item for the loop variable
-                                    variable* loop_var = variable_copy(item);
+                            size_t array_size = variable_array_size(collection);
+                            variable* counter = NULL;
+                            for (size_t i = 0; i < array_size && !xmd_heap_budget_exhausted(); i++) {
+                                const variable_array* items = collection->value.array_value;
+                                variable* loop_var = NULL;
+                                if (items->kind == VAR_ARRAY_NUMBERS || items->kind == VAR_ARRAY_RANGE) {
+                                    // A number no one else holds is updated in place
+                                    double number = items->kind == VAR_ARRAY_RANGE
+                                        ? items->packed.range.start + (double)i * items->packed.range.step
+                                        : items->packed.numbers[i];
+                                    if (counter && counter->ref_count == 2 &&
+                                        store_get_local(ctx->variables, var_name) == counter) {
+                                        counter->value.number_value = number;
+                                    } else {
+                                        variable_unref(counter);
+                                        counter = variable_create_number(number);
+                                        if (counter) {
+                                            store_set(ctx->variables, var_name, counter);
+                                        }
+                                    }
+                                    loop_var = counter;
+                                } else {
+                                    // Packed items are boxed for this iteration only
+                                    loop_var = variable_array_element(collection, i);
                                     if (loop_var) {
-                                        // Set loop variable
                                         store_set(ctx->variables, var_name, loop_var);
                                         variable_unref(loop_var);
                                     }
+                                }
+                                if (loop_var) {
                                     
                                     // Process loop body recursively
                                     char* iteration_result = ast_process_xmd_content(loop_body, ctx->variables);
@@ -711,23 +904,36 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                                         size_t result_len = strlen(iteration_result);
                                         if (output_pos + result_len >= output_capacity) {
                                             output_capacity = (output_pos + result_len + 1) * 2;
-                                            output = realloc(output, output_capacity);
-                                            if (!output) {
-                                                free(iteration_result);
-                                                free(loop_body);
-                                                free(args_str);
+                                            char* grown = xmd_realloc(output, output_capacity);
+                                            if (!grown) {
+                                                xmd_free(iteration_result);
+                                                variable_unref(counter);
+                                                variable_unref(range);
+                                                xmd_free(loop_body);
+                                                xmd_free(args_str);
+                                                xmd_free(output);
+                                                xmd_free(preprocessed_input);
+                                                exec_prefetch_free(prefetch);
                                                 destroy_context(ctx);
                                                 return NULL;
                                             }
+                                            output = grown;
                                         }
                                         memcpy(output + output_pos, iteration_result, result_len);
                                         output_pos += result_len;
-                                        free(iteration_result);
+                                        xmd_free(iteration_result);
                                     }
                                 }
                             }
                             
-                            free(loop_body);
+                            variable_unref(counter);
+                        }
+                        variable_unref(range);
+                        xmd_free(range_error);
+                        xmd_free(loop_body);
+                        if (loop_frame) {
+                            perf_hotspot_set_origin(xmd_active_profiler, outer_origin);
+                            perf_hotspot_exit(xmd_active_profiler, output_pos - loop_output_start);
                         }
                         
                         // Skip to after endfor
@@ -737,20 +943,53 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                         } else {
                             ptr = endfor_start + strlen(endfor_start);
                         }
-                        free(args_str);
+                        xmd_free(args_str);
                         continue;
                     }
+                    variable_unref(range);
+                    xmd_free(range_error);
                 }
                 
-                free(args_str);
+                xmd_free(args_str);
             }
             
             // Extract directive content for other directives
             if (!strncmp(directive_start, "for ", 4)) {
                 // Skip - already handled above
             } else if (should_execute_block(ctx)) {
+                size_t directive_output_start = output_pos;
+                bool directive_frame = enter_directive(&cursor, comment_start, directive_start, ctx);
+                char* prefetched = exec_prefetch_take(prefetch, comment_start - preprocessed_input);
+                if (prefetch) {
+                    if (prefetched) {
+                        PERF_RECORD_CACHE_HIT(xmd_active_profiler);
+                    } else {
+                        PERF_RECORD_CACHE_MISS(xmd_active_profiler);
+                    }
+                }
+                if (prefetched) {
+                    size_t result_len = strlen(prefetched);
+                    if (output_pos + result_len >= output_capacity) {
+                        char* grown = xmd_realloc(output, (output_pos + result_len + 1) * 2);
+                        if (grown) {
+                            output = grown;
+                            output_capacity = (output_pos + result_len + 1) * 2;
+                        }
+                    }
+                    if (output_pos + result_len < output_capacity) {
+                        memcpy(output + output_pos, prefetched, result_len);
+                        output_pos += result_len;
+                    }
+                    xmd_free(prefetched);
+                    if (directive_frame) {
+                        perf_hotspot_exit(xmd_active_profiler, output_pos - directive_output_start);
+                    }
+                    ptr = comment_end + 3;
+                    continue;
+                }
+                
                 size_t directive_len = comment_end - xmd_start;
-                char* directive = malloc(directive_len + 1);
+                char* directive = xmd_malloc(directive_len + 1);
                 if (directive) {
                     memcpy(directive, xmd_start, directive_len);
                     directive[directive_len] = '\0';
@@ -758,8 +997,13 @@ char* ast_process_xmd_content(const char* input, store* variables) {
                     // Process the directive (debug removed)
                     
                     // Process the directive
+                    PERF_STAGE_BEGIN(PERF_STAGE_EVALUATE);
                     ast_process_directive_content(directive, ctx, &output, &output_capacity, &output_pos);
-                    free(directive);
+                    PERF_STAGE_END(PERF_STAGE_EVALUATE);
+                    xmd_free(directive);
+                }
+                if (directive_frame) {
+                    perf_hotspot_exit(xmd_active_profiler, output_pos - directive_output_start);
                 }
             }
         } else {
@@ -767,8 +1011,12 @@ char* ast_process_xmd_content(const char* input, store* variables) {
             if (should_execute_block(ctx)) {
                 size_t comment_len = (comment_end + 3) - comment_start;
                 if (output_pos + comment_len >= output_capacity) {
+                    char* grown = xmd_realloc(output, (output_pos + comment_len + 1) * 2);
+                    if (!grown) {
+                        break;
+                    }
+                    output = grown;
                     output_capacity = (output_pos + comment_len + 1) * 2;
-                    output = realloc(output, output_capacity);
                 }
                 memcpy(output + output_pos, comment_start, comment_len);
                 output_pos += comment_len;
@@ -779,12 +1027,44 @@ char* ast_process_xmd_content(const char* input, store* variables) {
     }
     
     output[output_pos] = '\0';
+    exec_prefetch_free(prefetch);
     
     // Perform variable substitution on the entire output
+    PERF_STAGE_BEGIN(PERF_STAGE_EVALUATE);
     char* substituted = ast_substitute_variables(output, variables);
-    free(output);
-    free(preprocessed_input);
+    PERF_STAGE_END(PERF_STAGE_EVALUATE);
+    xmd_free(output);
+    xmd_free(preprocessed_input);
     
     destroy_context(ctx);
-    return substituted ? substituted : strdup("");
+    return substituted ? substituted : xmd_strdup("");
+}
+
+/**
+ * @brief Process XMD content using AST parser
+ * @param input Input content containing XMD directives
+ * @param variables Variable store
+ * @return Processed content (caller must free) or NULL on error
+ */
+char* ast_process_xmd_content(const char* input, store* variables) {
+    if (!input || !variables) {
+        return NULL;
+    }
+    
+    // The outermost render keeps conditions and placeholders parsed for nested content
+    // (loop bodies, imports) unless the caller attached a longer-lived cache
+    ast_parse_cache* owned = xmd_active_parse_cache ? NULL : ast_parse_cache_create();
+    if (owned) {
+        ast_parse_cache_attach(owned);
+    }
+    
+    PERF_STAGE_BEGIN(PERF_STAGE_SCAN);
+    char* result = process_content(input, variables);
+    PERF_STAGE_END(PERF_STAGE_SCAN);
+    
+    if (owned) {
+        ast_parse_cache_attach(NULL);
+        ast_parse_cache_destroy(owned);
+    }
+    return result;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "../../include/variable.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Split comma-separated string into array variable
@@ -26,7 +27,7 @@ variable* ast_split_comma_string(const char* str) {
         return NULL;
     }
     
-    char* str_copy = strdup(str);
+    char* str_copy = xmd_strdup(str);
     if (!str_copy) {
         variable_unref(array);
         return NULL;
@@ -45,7 +46,7 @@ variable* ast_split_comma_string(const char* str) {
             if (!variable_array_add(array, item)) {
                 variable_unref(item);
                 variable_unref(array);
-                free(str_copy);
+                xmd_free(str_copy);
                 return NULL;
             }
             variable_unref(item); // Array took reference
@@ -54,6 +55,6 @@ variable* ast_split_comma_string(const char* str) {
         token = strtok(NULL, ",");
     }
     
-    free(str_copy);
+    xmd_free(str_copy);
     return array;
 }
\ No newline at end of file
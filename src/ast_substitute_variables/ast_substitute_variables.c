@@ -6,15 +6,116 @@
  */
 
 #define _GNU_SOURCE
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
 #include "../../include/ast_parser.h"
+#include "../../include/ast_parse_cache.h"
 #include "../../include/lexer_enhanced.h"
 #include "../../include/xmd_processor_internal.h"
+#include "../../include/allocator.h"
+#include "../../include/utils.h"
+#include "../../include/xmd_string.h"
+
+/**
+ * @brief Check whether a placeholder needs expression evaluation
+ * @param expr Trimmed placeholder text
+ * @return true if it contains an operator or a call
+ */
+static bool is_complex_expression(const char* expr) {
+    return strpbrk(expr, "+-*/()") != NULL;
+}
+
+/**
+ * @brief Write an evaluation result to the output
+ * @param sink Output sink
+ * @param result Evaluation result (NULL writes nothing)
+ */
+static void write_result(xmd_sink* sink, const ast_value* result) {
+    if (!result) {
+        return;
+    }
+    switch (result->type) {
+        case AST_VAL_STRING:
+            if (result->value.string_value) {
+                xmd_sink_append(sink, result->value.string_value,
+                                xmd_string_length(result->value.string_value));
+            }
+            break;
+        case AST_VAL_NUMBER: {
+            char buffer[XMD_NUMBER_BUFFER_SIZE];
+            xmd_sink_append(sink, buffer, xmd_format_number(result->value.number_value, buffer));
+            break;
+        }
+        case AST_VAL_BOOLEAN:
+            xmd_sink_append_string(sink, result->value.boolean_value ? "true" : "false");
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Evaluate an expression without a cache
+ * @param sink Output sink
+ * @param expr Expression text
+ * @param variables Variable store
+ */
+static void evaluate_uncached(xmd_sink* sink, const char* expr, store* variables) {
+    token* tokens = lexer_enhanced_tokenize(expr, "variable_expr");
+    if (!tokens) {
+        return;
+    }
+    ast_node* ast = ast_parse_program(tokens);
+    token_list_free(tokens);
+    
+    if (ast && ast->type == AST_PROGRAM && ast->data.program.statement_count > 0) {
+        // Create temporary processor context
+        processor_context temp_ctx = {0};
+        temp_ctx.variables = variables;
+        
+        ast_evaluator* evaluator = ast_evaluator_create(variables, &temp_ctx);
+        if (evaluator) {
+            ast_value* result = ast_evaluate(ast->data.program.statements[0], evaluator);
+            write_result(sink, result);
+            ast_value_free(result);
+            ast_evaluator_free(evaluator);
+        }
+    }
+    ast_free(ast);
+}
+
+/**
+ * @brief Evaluate an expression, through the attached parse cache if any
+ * @param sink Output sink
+ * @param expr Expression text
+ * @param variables Variable store
+ */
+static void evaluate_expression(xmd_sink* sink, const char* expr, store* variables) {
+    ast_parse_cache* cache = xmd_active_parse_cache;
+    ast_evaluator* evaluator = ast_parse_cache_take_evaluator(cache, variables);
+    if (!evaluator) {
+        evaluate_uncached(sink, expr, variables);
+        return;
+    }
+    
+    ast_node* program = ast_parse_cache_lookup(cache, expr);
+    if (program) {
+        ast_value* result = ast_evaluate(program->data.program.statements[0], evaluator);
+        write_result(sink, result);
+        ast_value_free(result);
+    }
+    ast_parse_cache_release(cache);
+}
 
 /**
  * @brief Substitute {{variable}} patterns using AST (replaces string-based substitute_variables)
+ *
+ * Simple variables are written straight into the output; expressions are
+ * evaluated through the attached parse cache, so a repeated placeholder
+ * is parsed once.
+ *
  * @param text Input text containing {{variable}} patterns
  * @param variables Variable store for variable lookups
  * @return New string with variables substituted (caller must free) or NULL on error
@@ -24,138 +125,50 @@ char* ast_substitute_variables(const char* text, store* variables) {
         return NULL;
     }
     
-    size_t text_len = strlen(text);
-    size_t output_capacity = text_len * 2;
-    char* output = malloc(output_capacity);
-    if (!output) {
+    xmd_sink output;
+    if (!xmd_sink_init(&output, strlen(text) * 2)) {
         return NULL;
     }
-    size_t output_pos = 0;
     
     const char* ptr = text;
     while (*ptr) {
         // Look for variable substitution patterns {{...}}
-        if (ptr[0] == '{' && ptr[1] == '{') {
-            const char* close = strstr(ptr + 2, "}}");
-            if (close) {
-                // Extract variable expression
-                size_t expr_len = close - ptr - 2;
-                char* expr = malloc(expr_len + 1);
-                if (!expr) {
-                    free(output);
-                    return NULL;
-                }
-                strncpy(expr, ptr + 2, expr_len);
-                expr[expr_len] = '\0';
-                
-                // Trim whitespace
-                char* trimmed_expr = trim_whitespace(expr);
-                
-                // Use AST to evaluate the variable expression
-                // For simple variables, just do direct lookup
-                // For complex expressions, use AST evaluation
-                char* var_value = NULL;
-                
-                if (strchr(trimmed_expr, '+') || strchr(trimmed_expr, '-') || 
-                    strchr(trimmed_expr, '*') || strchr(trimmed_expr, '/') ||
-                    strchr(trimmed_expr, '(') || strchr(trimmed_expr, ')')) {
-                    // Complex expression - use AST evaluation
-                    token* tokens = lexer_enhanced_tokenize(trimmed_expr, "variable_expr");
-                    if (tokens) {
-                        ast_node* ast = ast_parse_program(tokens);
-                        token_list_free(tokens);
-                        
-                        if (ast && ast->type == AST_PROGRAM && ast->data.program.statement_count > 0) {
-                            // Create temporary processor context
-                            processor_context temp_ctx = {0};
-                            temp_ctx.variables = variables;
-                            
-                            ast_evaluator* evaluator = ast_evaluator_create(variables, &temp_ctx);
-                            if (evaluator) {
-                                ast_node* expr_node = ast->data.program.statements[0];
-                                ast_value* result = ast_evaluate(expr_node, evaluator);
-                                
-                                if (result) {
-                                    switch (result->type) {
-                                        case AST_VAL_STRING:
-                                            if (result->value.string_value) {
-                                                var_value = strdup(result->value.string_value);
-                                            }
-                                            break;
-                                        case AST_VAL_NUMBER: {
-                                            var_value = malloc(64);
-                                            if (var_value) {
-                                                snprintf(var_value, 64, "%.15g", result->value.number_value);
-                                            }
-                                            break;
-                                        }
-                                        case AST_VAL_BOOLEAN:
-                                            var_value = strdup(result->value.boolean_value ? "true" : "false");
-                                            break;
-                                        default:
-                                            var_value = strdup("");
-                                            break;
-                                    }
-                                    ast_value_free(result);
-                                }
-                                ast_evaluator_free(evaluator);
-                            }
-                            ast_free(ast);
-                        }
-                    }
-                } else {
-                    // Simple variable lookup
-                    variable* var = store_get(variables, trimmed_expr);
-                    if (var) {
-                        var_value = variable_to_string(var);
-                    } else {
-                        var_value = strdup("");
-                    }
-                }
-                
-                if (!var_value) {
-                    var_value = strdup("");
-                }
-                
-                // Ensure output buffer has enough space
-                size_t value_len = strlen(var_value);
-                if (output_pos + value_len >= output_capacity) {
-                    output_capacity = (output_pos + value_len + 1000) * 2;
-                    char* new_output = realloc(output, output_capacity);
-                    if (!new_output) {
-                        free(output);
-                        free(var_value);
-                        free(expr);
-                        return NULL;
-                    }
-                    output = new_output;
-                }
-                
-                // Copy variable value to output
-                memcpy(output + output_pos, var_value, value_len);
-                output_pos += value_len;
-                
-                free(var_value);
-                free(expr);
-                ptr = close + 2;
-                continue;
-            }
+        const char* open = strstr(ptr, "{{");
+        const char* close = open ? strstr(open + 2, "}}") : NULL;
+        if (!close) {
+            xmd_sink_append_string(&output, ptr);
+            break;
         }
+        xmd_sink_append(&output, ptr, open - ptr);
         
-        // Regular character - ensure buffer space
-        if (output_pos >= output_capacity - 1) {
-            output_capacity *= 2;
-            char* new_output = realloc(output, output_capacity);
-            if (!new_output) {
-                free(output);
-                return NULL;
-            }
-            output = new_output;
+        // Trim the expression in place, copying it only to terminate it
+        const char* start = open + 2;
+        const char* end = close;
+        while (start < end && isspace((unsigned char)*start)) start++;
+        while (end > start && isspace((unsigned char)end[-1])) end--;
+        size_t expr_len = end - start;
+        
+        char small[128];
+        char* expr = expr_len < sizeof(small) ? small : xmd_malloc(expr_len + 1);
+        if (!expr) {
+            xmd_sink_free(&output);
+            return NULL;
         }
+        memcpy(expr, start, expr_len);
+        expr[expr_len] = '\0';
         
-        output[output_pos++] = *ptr++;
+        // For simple variables, just do direct lookup
+        // For complex expressions, use AST evaluation
+        if (is_complex_expression(expr)) {
+            evaluate_expression(&output, expr, variables);
+        } else {
+            variable_write_to(&output, store_get(variables, expr));
+        }
+        if (expr != small) {
+            xmd_free(expr);
+        }
+        ptr = close + 2;
     }
     
-    output[output_pos] = '\0';
-    return output;
-}
\ No newline at end of file
+    return xmd_sink_finish(&output);
+}
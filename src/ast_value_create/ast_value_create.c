@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create AST value
@@ -15,7 +16,7 @@
  * @return New AST value or NULL on error
  */
 ast_value* ast_value_create(int type) {
-    ast_value* value = malloc(sizeof(ast_value));
+    ast_value* value = xmd_malloc(sizeof(ast_value));
     if (!value) {
         return NULL;
     }
@@ -7,6 +7,8 @@
 
 #include <stdlib.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/allocator.h"
+#include "../../include/xmd_string.h"
 
 /**
  * @brief Free AST value
@@ -18,15 +20,15 @@ void ast_value_free(ast_value* value) {
     }
     
     if (value->type == AST_VAL_STRING) {
-        free(value->value.string_value);
+        xmd_string_release(value->value.string_value);
     } else if (value->type == AST_VAL_ARRAY) {
         if (value->value.array_value.elements) {
             for (size_t i = 0; i < value->value.array_value.element_count; i++) {
                 ast_value_free(value->value.array_value.elements[i]);
             }
-            free(value->value.array_value.elements);
+            xmd_free(value->value.array_value.elements);
         }
     }
     
-    free(value);
+    xmd_free(value);
 }
\ No newline at end of file
@@ -6,8 +6,9 @@
  */
 
 #include <stdlib.h>
-#include <stdio.h>
 #include "../../include/ast_evaluator.h"
+#include "../../include/xmd_string.h"
+#include "../../include/utils.h"
 
 /**
  * @brief Convert AST value to variable
@@ -21,13 +22,13 @@ variable* ast_value_to_variable(ast_value* value) {
     
     switch (value->type) {
         case AST_VAL_STRING:
-            return variable_create_string(value->value.string_value);
+            return variable_create_string_shared(value->value.string_value);
             
         case AST_VAL_NUMBER: {
             // Convert number to string representation
-            char num_str[64];
-            snprintf(num_str, sizeof(num_str), "%.10g", value->value.number_value);
-            return variable_create_string(num_str);
+            char num_str[XMD_NUMBER_BUFFER_SIZE];
+            size_t length = xmd_format_number(value->value.number_value, num_str);
+            return variable_create_string_length(num_str, length);
         }
         
         case AST_VAL_BOOLEAN:
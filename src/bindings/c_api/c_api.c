@@ -6,6 +6,7 @@
  */
 
 #include "../../../include/c_api_internal.h"
+#include "../../../include/allocator.h"
 
 // Forward declaration for AST-based XMD processor
 extern char* ast_process_xmd_content(const char* input, store* variables);
@@ -33,56 +34,70 @@ xmd_result* xmd_process_string_api(void* handle, const char* input, size_t input
     
     xmd_context_internal* ctx = (xmd_context_internal*)handle;
     if (!ctx->initialized) {
-        return c_api_create_result(-1, NULL, "XMD context not initialized");
+        return create_result(-1, NULL, "XMD context not initialized");
     }
     
+    // Renders on one context share its globals and profiler: they take turns
+    xmd_mutex_lock(&ctx->lock);
+    
     // Record start time
-    clock_t start_time = clock();
+    uint64_t start_ns = get_time_ns();
     
-    // Create variable store for processing
-    store* var_store = store_create();
-    if (!var_store) {
-        return c_api_create_result(-1, NULL, "Failed to create variable store");
+    // Profile this render on the calling thread when enabled
+    perf_profiler* previous = NULL;
+    if (ctx->profiler && perf_profiler_start(ctx->profiler) == 0) {
+        previous = perf_profiler_attach(ctx->profiler);
     }
     
-    // Copy global variables from context to processing store
-    if (ctx->global_variables) {
-        size_t global_var_count;
-        char** global_keys = store_keys(ctx->global_variables, &global_var_count);
-        if (global_keys) {
-            for (size_t i = 0; i < global_var_count; i++) {
-                variable* global_var = store_get(ctx->global_variables, global_keys[i]);
-                if (global_var) {
-                    // Create a copy of the variable for the processing store
-                    const char* var_value = variable_to_string(global_var);
-                    if (var_value) {
-                        variable* var_copy = variable_create_string(var_value);
-                        if (var_copy) {
-                            store_set(var_store, global_keys[i], var_copy);
-                        }
-                    }
-                }
-            }
-            free(global_keys);
-        }
+    // Live heap of this render, held to the sandbox memory limit
+    uint64_t memory_limit = 0;
+    if (ctx->config && ctx->config->sandbox) {
+        memory_limit = (uint64_t)ctx->config->sandbox->max_memory_mb * 1024 * 1024;
     }
+    xmd_heap_budget budget;
+    xmd_heap_budget_init(&budget, memory_limit);
+    xmd_heap_budget* previous_budget = xmd_heap_budget_attach(&budget);
     
-    // Use AST-based processor to handle all XMD directives
-    char* output = ast_process_xmd_content(input, var_store);
+    // Per-call frame over the shared globals: lookups read the global
+    // variables in place, assignments stay local to this call
+    store* var_store = ctx->global_variables ? store_push_scope(ctx->global_variables)
+                                             : store_create();
+    char* output = NULL;
+    if (var_store) {
+        // Use AST-based processor to handle all XMD directives
+        output = ast_process_xmd_content(input, var_store);
+        store_destroy(var_store);
+    }
+    xmd_heap_budget_attach(previous_budget);
     
-    // Cleanup
-    store_destroy(var_store);
+    if (ctx->profiler && ctx->profiler->is_active) {
+        perf_profiler_stop(ctx->profiler);
+        perf_profiler_attach(previous);
+        xmd_free(ctx->profile_report);
+        ctx->profile_report = perf_profiler_report_json(ctx->profiler, NULL);
+    }
+    xmd_mutex_unlock(&ctx->lock);
     
-    // Calculate processing time
-    clock_t end_time = clock();
-    double processing_time = ((double)(end_time - start_time)) / CLOCKS_PER_SEC * 1000.0;
+    // Calculate processing time (wall clock: exec and imports block)
+    double processing_time = (double)(get_time_ns() - start_ns) / 1e6;
     
-    xmd_result* result = c_api_create_result(0, output, NULL);
+    xmd_result* result;
+    if (budget.exceeded) {
+        char message[96];
+        snprintf(message, sizeof(message), "Render exceeded the memory limit of %llu MB",
+                 (unsigned long long)(memory_limit / (1024 * 1024)));
+        result = create_result(XMD_ERROR_OUT_OF_MEMORY, NULL, message);
+    } else if (!var_store) {
+        result = create_result(-1, NULL, "Failed to create variable store");
+    } else {
+        result = create_result(0, output, NULL);
+    }
     if (result) {
         result->processing_time_ms = processing_time;
+        result->memory_used_bytes = budget.peak_bytes;
     }
     
-    free(output);
+    xmd_free(output);
     return result;
 }
 
@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Create XMD result structure
@@ -21,7 +22,7 @@
  * @return New result structure or NULL on error
  */
 xmd_result* create_result(int error_code, const char* output, const char* error_message) {
-    xmd_result* result = calloc(1, sizeof(xmd_result));
+    xmd_result* result = xmd_calloc(1, sizeof(xmd_result));
     if (!result) {
         return NULL;
     }
@@ -29,7 +30,7 @@ xmd_result* create_result(int error_code, const char* output, const char* error_
     result->error_code = error_code;
     
     if (output) {
-        result->output = strdup(output);
+        result->output = xmd_strdup(output);
         result->output_length = strlen(output);
     } else {
         result->output = NULL;
@@ -37,7 +38,7 @@ xmd_result* create_result(int error_code, const char* output, const char* error_
     }
     
     if (error_message) {
-        result->error_message = strdup(error_message);
+        result->error_message = xmd_strdup(error_message);
     } else {
         result->error_message = NULL;
     }
@@ -7,6 +7,7 @@
  */
 
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Cleanup XMD processor
@@ -25,5 +26,8 @@ void c_api_xmd_cleanup(void* handle) {
     if (ctx->global_variables) {
         store_destroy(ctx->global_variables);
     }
-    free(ctx);
+    perf_profiler_destroy(ctx->profiler);
+    xmd_free(ctx->profile_report);
+    xmd_mutex_destroy(&ctx->lock);
+    xmd_free(ctx);
 }
\ No newline at end of file
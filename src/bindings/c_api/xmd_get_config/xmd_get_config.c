@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Get configuration option
@@ -31,7 +32,7 @@ char* c_api_xmd_get_config(void* handle, const char* key) {
     
     config_value* value = config_get(ctx->config, key);
     if (value && value->type == CONFIG_STRING && value->data.string_val) {
-        return strdup(value->data.string_val);
+        return xmd_strdup(value->data.string_val);
     }
     
     return NULL;
@@ -0,0 +1,23 @@
+/**
+ * @file xmd_get_profile.c
+ * @brief XMD render profile accessor
+ * @author XMD Team
+ *
+ * Implementation of profile retrieval for the C API.
+ */
+
+#include "../../../../include/c_api_internal.h"
+
+/**
+ * @brief Get the JSON profile of the most recent profiled render
+ * @param handle XMD context handle
+ * @return Report owned by the context, or NULL if none was recorded
+ */
+const char* c_api_xmd_get_profile(void* handle) {
+    if (!handle) {
+        return NULL;
+    }
+    
+    xmd_context_internal* ctx = (xmd_context_internal*)handle;
+    return ctx->profile_report;
+}
@@ -6,6 +6,7 @@
  */
 
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Initialize XMD processor (internal C API)
@@ -13,7 +14,7 @@
  * @return XMD context handle or NULL on error
  */
 void* c_api_xmd_init(const char* config_path) {
-    xmd_context_internal* ctx = calloc(1, sizeof(xmd_context_internal));
+    xmd_context_internal* ctx = xmd_calloc(1, sizeof(xmd_context_internal));
     if (!ctx) {
         return NULL;
     }
@@ -21,7 +22,7 @@ void* c_api_xmd_init(const char* config_path) {
     // Initialize configuration
     ctx->config = config_create();
     if (!ctx->config) {
-        free(ctx);
+        xmd_free(ctx);
         return NULL;
     }
     
@@ -29,7 +30,7 @@ void* c_api_xmd_init(const char* config_path) {
     if (config_path) {
         if (config_load_file(ctx->config, config_path) != 0) {
             config_destroy(ctx->config);
-            free(ctx);
+            xmd_free(ctx);
             return NULL;
         }
     }
@@ -41,7 +42,13 @@ void* c_api_xmd_init(const char* config_path) {
     ctx->global_variables = store_create();
     if (!ctx->global_variables) {
         config_destroy(ctx->config);
-        free(ctx);
+        xmd_free(ctx);
+        return NULL;
+    }
+    if (xmd_mutex_init(&ctx->lock) != 0) {
+        store_destroy(ctx->global_variables);
+        config_destroy(ctx->config);
+        xmd_free(ctx);
         return NULL;
     }
     
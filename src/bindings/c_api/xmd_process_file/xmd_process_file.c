@@ -7,6 +7,7 @@
  */
 
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Process markdown file
@@ -47,7 +48,7 @@ xmd_result* c_api_xmd_process_file(void* handle, const char* input_path, const c
     }
     
     // Read file content
-    char* content = malloc(file_size + 1);
+    char* content = xmd_malloc(file_size + 1);
     if (!content) {
         fclose(input_file);
         return create_result(-1, NULL, "Memory allocation failed");
@@ -69,7 +70,7 @@ xmd_result* c_api_xmd_process_file(void* handle, const char* input_path, const c
         }
     }
     
-    free(content);
+    xmd_free(content);
     
     // Clear the file path after processing
     xmd_clear_current_file_path();
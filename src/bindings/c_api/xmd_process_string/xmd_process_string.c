@@ -12,6 +12,7 @@
 #include "../../../../include/cli.h"
 #include "../../../../include/store.h"
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 // Forward declaration of XMD processor function
 char* ast_process_xmd_content(const char* input, store* variables);
@@ -29,12 +30,12 @@ xmd_result* c_api_xmd_process_string(void* handle, const char* input, size_t inp
     }
     
     // Create result structure
-    xmd_result* result = malloc(sizeof(xmd_result));
+    xmd_result* result = xmd_malloc(sizeof(xmd_result));
     if (!result) {
         return NULL;
     }
     
     // Clean up temporary result structure and use the proper API
-    free(result);
+    xmd_free(result);
     return c_api_xmd_process_string_api(handle, input, input_length);
 }
\ No newline at end of file
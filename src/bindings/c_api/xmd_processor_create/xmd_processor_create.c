@@ -8,6 +8,8 @@
 
 #include "../../../../include/c_api_internal.h"
 #include "../../../../include/store_internal.h"
+#include "../../../../include/ast_parse_cache.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Create XMD processor
@@ -15,19 +17,29 @@
  * @return Processor instance or NULL on error
  */
 xmd_processor* c_api_xmd_processor_create(const xmd_config* config) {
-    (void)config; // Suppress unused parameter warning
-    
     // Initialize XMD system first
     if (xmd_init() != XMD_SUCCESS) {
         return NULL;
     }
     
-    // Create a proper store as processor (matches expectation in xmd_process_string)
-    store* variable_store = store_create();
-    if (!variable_store) {
+    xmd_processor* processor = xmd_calloc(1, sizeof(xmd_processor));
+    if (!processor) {
+        return NULL;
+    }
+    processor->variables = store_create();
+    processor->expressions = ast_parse_cache_create();
+    if (!processor->variables || !processor->expressions) {
+        store_destroy(processor->variables);
+        ast_parse_cache_destroy(processor->expressions);
+        xmd_free(processor);
         return NULL;
     }
-    return (xmd_processor*)variable_store;
+    
+    // Each render is held to the sandbox memory limit
+    if (config && config->sandbox) {
+        processor->memory_limit_bytes = (uint64_t)config->sandbox->max_memory_mb * 1024 * 1024;
+    }
+    return processor;
 }
 
 /**
@@ -7,6 +7,8 @@
  */
 
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/ast_parse_cache.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free XMD processor
@@ -14,10 +16,10 @@
  */
 void c_api_xmd_processor_free(xmd_processor* processor) {
     if (processor) {
-        // Free the processor memory - in a full implementation this would
-        // properly clean up the processor context
-        // xmd_cleanup() is a global cleanup function
-        free(processor);
+        // Destroying the store also releases the variables it holds
+        store_destroy(processor->variables);
+        ast_parse_cache_destroy(processor->expressions);
+        xmd_free(processor);
     }
 }
 
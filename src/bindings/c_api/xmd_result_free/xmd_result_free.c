@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free XMD result structure
@@ -15,9 +16,9 @@ void c_api_xmd_result_free(xmd_result* result) {
         return;
     }
     
-    free(result->output);
-    free(result->error_message);
-    free(result);
+    xmd_free(result->output);
+    xmd_free(result->error_message);
+    xmd_free(result);
 }
 
 /**
@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/c_api_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Set configuration option
@@ -30,13 +31,13 @@ int c_api_xmd_set_config(void* handle, const char* key, const char* value) {
         return -1;
     }
     
-    config_value* config_val = malloc(sizeof(config_value));
+    config_value* config_val = xmd_malloc(sizeof(config_value));
     if (!config_val) {
         return -1;
     }
     
     config_val->type = CONFIG_STRING;
-    config_val->data.string_val = strdup(value);
+    config_val->data.string_val = xmd_strdup(value);
     
     return config_set(ctx->config, key, config_val);
 }
@@ -0,0 +1,38 @@
+/**
+ * @file xmd_set_global.c
+ * @brief XMD typed global variable setter
+ * @author XMD Team
+ *
+ * Implementation of typed global variables for the C API.
+ */
+
+#include "../../../../include/c_api_internal.h"
+
+/**
+ * @brief Set a global variable of any type in the processor context
+ *
+ * The value is shared by reference with every subsequent render; renders
+ * see it with its original type and cannot modify the binding. From then
+ * on the value belongs to this context: it must not be used by another
+ * thread or registered with another context while the context renders.
+ *
+ * @param processor Processor instance (actually xmd_context_internal*)
+ * @param key Variable name
+ * @param value Variable value (a reference is taken)
+ * @return 0 on success, -1 on error
+ */
+int c_api_xmd_set_global(void* processor, const char* key, variable* value) {
+    if (!processor || !key || !value) {
+        return -1;
+    }
+    
+    xmd_context_internal* ctx = (xmd_context_internal*)processor;
+    if (!ctx->initialized || !ctx->global_variables) {
+        return -1;
+    }
+    
+    xmd_mutex_lock(&ctx->lock);
+    bool stored = store_set(ctx->global_variables, key, value);
+    xmd_mutex_unlock(&ctx->lock);
+    return stored ? 0 : -1;
+}
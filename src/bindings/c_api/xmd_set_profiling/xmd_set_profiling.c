@@ -0,0 +1,41 @@
+/**
+ * @file xmd_set_profiling.c
+ * @brief XMD render profiling toggle
+ * @author XMD Team
+ *
+ * Implementation of per-render profiling for the C API.
+ */
+
+#include "../../../../include/c_api_internal.h"
+
+/**
+ * @brief Enable or disable profiling of renders on a context
+ *
+ * While enabled, each xmd_process_string_api call times its pipeline
+ * stages and replaces the report returned by c_api_xmd_get_profile.
+ *
+ * @param handle XMD context handle
+ * @param enabled Whether to profile subsequent renders
+ * @return 0 on success, -1 on error
+ */
+int c_api_xmd_set_profiling(void* handle, bool enabled) {
+    if (!handle) {
+        return -1;
+    }
+    
+    xmd_context_internal* ctx = (xmd_context_internal*)handle;
+    if (!ctx->initialized) {
+        return -1;
+    }
+    
+    xmd_mutex_lock(&ctx->lock);
+    if (enabled && !ctx->profiler) {
+        ctx->profiler = perf_profiler_create();
+    } else if (!enabled) {
+        perf_profiler_destroy(ctx->profiler);
+        ctx->profiler = NULL;
+    }
+    bool ready = !enabled || ctx->profiler;
+    xmd_mutex_unlock(&ctx->lock);
+    return ready ? 0 : -1;
+}
@@ -31,10 +31,9 @@ int c_api_xmd_set_variable(void* processor, const char* key, const char* value)
         return -1;
     }
     
-    if (!store_set(ctx->global_variables, key, var)) {
-        variable_unref(var);
-        return -1;
-    }
-    
-    return 0;
+    xmd_mutex_lock(&ctx->lock);
+    bool stored = store_set(ctx->global_variables, key, var);
+    xmd_mutex_unlock(&ctx->lock);
+    variable_unref(var); // store_set takes its own reference
+    return stored ? 0 : -1;
 }
@@ -0,0 +1,98 @@
+/**
+ * @file build_cache_build_file.c
+ * @brief Build one file through the cache
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/ast_evaluator.h"
+#include "../../../include/allocator.h"
+
+extern void xmd_set_current_file_path(const char* path);
+extern void xmd_clear_current_file_path(void);
+
+/**
+ * @brief Create the directory that will hold an output file
+ * @param output_path Output file
+ * @return 0 on success, -1 on error
+ */
+static int make_output_directory(const char* output_path) {
+    const char* last_slash = strrchr(output_path, '/');
+    if (!last_slash || last_slash == output_path) {
+        return 0;
+    }
+    char* directory = xmd_strndup(output_path, (size_t)(last_slash - output_path));
+    if (!directory) {
+        return -1;
+    }
+    int result = build_cache_make_directory(directory);
+    xmd_free(directory);
+    return result;
+}
+
+/**
+ * @brief Build one file through the cache
+ *
+ * Each file renders in its own scope over variables, so assignments in
+ * one document never leak into the next. A failed build removes the
+ * file's entry, so the next build tries again.
+ *
+ * @param cache Cache, or NULL to always render
+ * @param variables Variables visible to the render
+ * @param input_path Source file
+ * @param output_path Output file
+ * @return Outcome
+ */
+build_file_status build_cache_build_file(const build_cache* cache, store* variables,
+                                         const char* input_path, const char* output_path) {
+    if (!variables || !input_path || !output_path) {
+        return BUILD_FILE_FAILED;
+    }
+    
+    size_t source_length = 0;
+    char* source = build_cache_read_file(input_path, &source_length);
+    if (!source) {
+        build_cache_forget(cache, input_path);
+        return BUILD_FILE_FAILED;
+    }
+    uint64_t source_hash = build_cache_hash(source, source_length);
+    if (build_cache_is_fresh(cache, input_path, source_hash, output_path)) {
+        xmd_free(source);
+        return BUILD_FILE_CACHED;
+    }
+    
+    // Record what the render reads while it runs
+    build_inputs inputs;
+    memset(&inputs, 0, sizeof(inputs));
+    build_inputs* previous = build_inputs_attach(&inputs);
+    char* output = NULL;
+    store* scope = store_push_scope(variables);
+    if (scope) {
+        xmd_set_current_file_path(input_path);
+        output = source_length > 0 ? ast_process_xmd_content(source, scope) : xmd_strdup("");
+        xmd_clear_current_file_path();
+        store_pop_scope(scope);
+    }
+    build_inputs_attach(previous);
+    xmd_free(source);
+    
+    build_file_status status = BUILD_FILE_FAILED;
+    bool written = false;
+    size_t output_length = output ? strlen(output) : 0;
+    if (output && make_output_directory(output_path) == 0 &&
+        build_write_output(output_path, output, output_length, &written) == 0) {
+        status = written ? BUILD_FILE_RENDERED : BUILD_FILE_UNCHANGED;
+    }
+    
+    if (status == BUILD_FILE_FAILED) {
+        build_cache_forget(cache, input_path);
+    } else if (cache) {
+        build_cache_store(cache, input_path, source_hash, output_path,
+                          build_cache_hash(output, output_length), &inputs);
+    }
+    
+    build_inputs_clear(&inputs);
+    xmd_free(output);
+    return status;
+}
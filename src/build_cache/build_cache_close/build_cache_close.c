@@ -0,0 +1,20 @@
+/**
+ * @file build_cache_close.c
+ * @brief Close a build cache
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Close a cache
+ * @param cache Cache to close
+ */
+void build_cache_close(build_cache* cache) {
+    if (!cache) {
+        return;
+    }
+    xmd_free(cache->directory);
+    xmd_free(cache);
+}
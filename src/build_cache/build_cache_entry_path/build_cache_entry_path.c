@@ -0,0 +1,30 @@
+/**
+ * @file build_cache_entry_path.c
+ * @brief Locate the entry file of a source file
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Path of the entry file for a source file
+ *
+ * Entries are keyed by a hash of the source path; the entry repeats the
+ * path so a collision reads as a miss.
+ *
+ * @param cache Cache
+ * @param input_path Source file
+ * @return Entry path (caller frees) or NULL on error
+ */
+char* build_cache_entry_path(const build_cache* cache, const char* input_path) {
+    size_t length = strlen(cache->directory) + 24;
+    char* path = xmd_malloc(length);
+    if (path) {
+        uint64_t key = build_cache_hash(input_path, strlen(input_path));
+        snprintf(path, length, "%s/%016llx.xbc", cache->directory, (unsigned long long)key);
+    }
+    return path;
+}
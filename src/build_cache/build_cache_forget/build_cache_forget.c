@@ -0,0 +1,25 @@
+/**
+ * @file build_cache_forget.c
+ * @brief Remove a file's build cache entry
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Remove a file's entry
+ * @param cache Cache
+ * @param input_path Source file
+ */
+void build_cache_forget(const build_cache* cache, const char* input_path) {
+    if (!cache || !input_path) {
+        return;
+    }
+    char* entry_path = build_cache_entry_path(cache, input_path);
+    if (entry_path) {
+        remove(entry_path);
+        xmd_free(entry_path);
+    }
+}
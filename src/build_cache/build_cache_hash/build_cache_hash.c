@@ -0,0 +1,19 @@
+/**
+ * @file build_cache_hash.c
+ * @brief Content hash for build cache entries
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/data_snapshot.h"
+
+/**
+ * @brief Hash file or output content for the cache
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @return 64-bit content hash (never 0, which marks a missing file)
+ */
+uint64_t build_cache_hash(const void* data, size_t length) {
+    uint64_t hash = data_snapshot_hash(data, length, BUILD_CACHE_HASH_SEED);
+    return hash ? hash : 1;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file build_cache_is_fresh.c
+ * @brief Check whether a file's last build is still valid
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Check that a file still has the hash recorded for it
+ * @param path File path
+ * @param expected Recorded hash, 0 if the file was missing
+ * @return true if the file is unchanged
+ */
+static bool file_matches(const char* path, uint64_t expected) {
+    size_t length = 0;
+    char* content = build_cache_read_file(path, &length);
+    if (!content) {
+        return expected == 0;
+    }
+    bool matches = build_cache_hash(content, length) == expected;
+    xmd_free(content);
+    return matches;
+}
+
+/**
+ * @brief Read one "<tag> <hex> <path>" line
+ * @param line Entry line
+ * @param tag Expected tag
+ * @param hash Receives the hash
+ * @param path Receives the path (BUILD_CACHE_PATH_MAX bytes)
+ * @return true if the line has that form
+ */
+static bool parse_line(const char* line, const char* tag, uint64_t* hash, char* path) {
+    size_t tag_length = strlen(tag);
+    if (strncmp(line, tag, tag_length) != 0 || line[tag_length] != ' ') {
+        return false;
+    }
+    unsigned long long value;
+    if (sscanf(line + tag_length + 1, "%llx %4095[^\n]", &value, path) != 2) {
+        return false;
+    }
+    *hash = value;
+    return true;
+}
+
+/**
+ * @brief Check whether a file's last build is still valid
+ * @param cache Cache
+ * @param input_path Source file
+ * @param source_hash Hash of the current source
+ * @param output_path Output file
+ * @return true if the source, options, imports and output all match
+ */
+bool build_cache_is_fresh(const build_cache* cache, const char* input_path,
+                          uint64_t source_hash, const char* output_path) {
+    if (!cache || !input_path || !output_path) {
+        return false;
+    }
+    
+    char* entry_path = build_cache_entry_path(cache, input_path);
+    FILE* entry = entry_path ? fopen(entry_path, "r") : NULL;
+    xmd_free(entry_path);
+    if (!entry) {
+        return false;
+    }
+    
+    char line[BUILD_CACHE_PATH_MAX + 64];
+    char path[BUILD_CACHE_PATH_MAX];
+    uint64_t hash = 0;
+    unsigned long long options = 0;
+    int commands = 1;
+    bool fresh = fgets(line, sizeof(line), entry) &&
+                 strncmp(line, BUILD_CACHE_MAGIC "\n", sizeof(BUILD_CACHE_MAGIC)) == 0 &&
+                 fgets(line, sizeof(line), entry) &&
+                 parse_line(line, "source", &hash, path) &&
+                 hash == source_hash && strcmp(path, input_path) == 0 &&
+                 fgets(line, sizeof(line), entry) &&
+                 sscanf(line, "options %llx", &options) == 1 &&
+                 options == cache->options_hash &&
+                 fgets(line, sizeof(line), entry) &&
+                 parse_line(line, "output", &hash, path) &&
+                 strcmp(path, output_path) == 0 && file_matches(output_path, hash) &&
+                 fgets(line, sizeof(line), entry) &&
+                 sscanf(line, "commands %d", &commands) == 1 && commands == 0;
+    
+    while (fresh && fgets(line, sizeof(line), entry)) {
+        fresh = parse_line(line, "dep", &hash, path) && file_matches(path, hash);
+    }
+    
+    fclose(entry);
+    return fresh;
+}
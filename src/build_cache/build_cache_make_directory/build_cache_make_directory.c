@@ -0,0 +1,37 @@
+/**
+ * @file build_cache_make_directory.c
+ * @brief Create a directory and its missing parents
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create a directory and its missing parents
+ * @param directory Directory path
+ * @return 0 on success, -1 on error
+ */
+int build_cache_make_directory(const char* directory) {
+    if (!directory || !*directory) {
+        return 0;
+    }
+    
+    char* path = xmd_strdup(directory);
+    if (!path) {
+        return -1;
+    }
+    
+    for (char* p = path + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            xmd_create_directory(path);
+            *p = '/';
+        }
+    }
+    int result = xmd_create_directory(path);
+    xmd_free(path);
+    return result;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file build_cache_open.c
+ * @brief Open a build cache directory
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Open a cache directory, creating it if needed
+ * @param directory Cache directory
+ * @param options_hash Hash of the options that affect rendering
+ * @return Cache or NULL on error
+ */
+build_cache* build_cache_open(const char* directory, uint64_t options_hash) {
+    if (!directory || build_cache_make_directory(directory) != 0) {
+        return NULL;
+    }
+    
+    build_cache* cache = xmd_calloc(1, sizeof(build_cache));
+    if (!cache) {
+        return NULL;
+    }
+    cache->directory = xmd_strdup(directory);
+    if (!cache->directory) {
+        xmd_free(cache);
+        return NULL;
+    }
+    cache->options_hash = options_hash;
+    return cache;
+}
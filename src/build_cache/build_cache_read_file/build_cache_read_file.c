@@ -0,0 +1,32 @@
+/**
+ * @file build_cache_read_file.c
+ * @brief Read a whole file for hashing or rendering
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Read a whole file into a NUL-terminated buffer
+ * @param path File to read
+ * @param length Set to the content length
+ * @return Buffer (caller frees) or NULL if the file cannot be read
+ */
+char* build_cache_read_file(const char* path, size_t* length) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* content = size >= 0 ? xmd_malloc((size_t)size + 1) : NULL;
+    if (content) {
+        *length = fread(content, 1, (size_t)size, file);
+        content[*length] = '\0';
+    }
+    fclose(file);
+    return content;
+}
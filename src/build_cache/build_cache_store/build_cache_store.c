@@ -0,0 +1,82 @@
+/**
+ * @file build_cache_store.c
+ * @brief Store the entry for a file that was just built
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+#ifdef XMD_PLATFORM_WINDOWS
+#define getpid _getpid
+#endif
+
+/**
+ * @brief Store the entry for a file that was just built
+ *
+ * The entry is written to a temporary file and renamed into place, so a
+ * build interrupted midway leaves either the old entry or the new one.
+ * Paths longer than an entry line can hold are not cached.
+ *
+ * @param cache Cache
+ * @param input_path Source file
+ * @param source_hash Hash of the source that was rendered
+ * @param output_path Output file
+ * @param output_hash Hash of the output
+ * @param inputs Inputs the render consumed
+ * @return 0 on success, -1 on error
+ */
+int build_cache_store(const build_cache* cache, const char* input_path, uint64_t source_hash,
+                      const char* output_path, uint64_t output_hash, const build_inputs* inputs) {
+    if (!cache || !input_path || !output_path || !inputs) {
+        return -1;
+    }
+    bool cacheable = strlen(input_path) < BUILD_CACHE_PATH_MAX && !strchr(input_path, '\n') &&
+                     strlen(output_path) < BUILD_CACHE_PATH_MAX && !strchr(output_path, '\n');
+    for (size_t i = 0; cacheable && i < inputs->count; i++) {
+        cacheable = strlen(inputs->files[i].path) < BUILD_CACHE_PATH_MAX &&
+                    !strchr(inputs->files[i].path, '\n');
+    }
+    if (!cacheable) {
+        build_cache_forget(cache, input_path);
+        return -1;
+    }
+    
+    char* entry_path = build_cache_entry_path(cache, input_path);
+    if (!entry_path) {
+        return -1;
+    }
+    
+    char temp_path[BUILD_CACHE_PATH_MAX + 32];
+    snprintf(temp_path, sizeof(temp_path), "%s.%ld.tmp", entry_path, (long)getpid());
+    FILE* entry = fopen(temp_path, "w");
+    if (!entry) {
+        xmd_free(entry_path);
+        return -1;
+    }
+    
+    fprintf(entry, "%s\n", BUILD_CACHE_MAGIC);
+    fprintf(entry, "source %016llx %s\n", (unsigned long long)source_hash, input_path);
+    fprintf(entry, "options %016llx\n", (unsigned long long)cache->options_hash);
+    fprintf(entry, "output %016llx %s\n", (unsigned long long)output_hash, output_path);
+    fprintf(entry, "commands %d\n", inputs->ran_commands ? 1 : 0);
+    for (size_t i = 0; i < inputs->count; i++) {
+        fprintf(entry, "dep %016llx %s\n", (unsigned long long)inputs->files[i].hash,
+                inputs->files[i].path);
+    }
+    
+    bool written = !ferror(entry);
+    if (fclose(entry) != 0) {
+        written = false;
+    }
+    if (!written || xmd_replace_file(temp_path, entry_path) != 0) {
+        remove(temp_path);
+        xmd_free(entry_path);
+        return -1;
+    }
+    xmd_free(entry_path);
+    return 0;
+}
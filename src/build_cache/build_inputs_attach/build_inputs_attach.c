@@ -0,0 +1,20 @@
+/**
+ * @file build_inputs_attach.c
+ * @brief Attach an inputs recorder to the calling thread
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+
+XMD_THREAD_LOCAL build_inputs* xmd_active_build_inputs = NULL;
+
+/**
+ * @brief Attach an inputs recorder to the calling thread
+ * @param inputs Recorder to attach, or NULL to detach
+ * @return Previously attached recorder
+ */
+build_inputs* build_inputs_attach(build_inputs* inputs) {
+    build_inputs* previous = xmd_active_build_inputs;
+    xmd_active_build_inputs = inputs;
+    return previous;
+}
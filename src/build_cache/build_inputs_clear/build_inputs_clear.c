@@ -0,0 +1,25 @@
+/**
+ * @file build_inputs_clear.c
+ * @brief Release recorded build inputs
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Release the recorded inputs
+ * @param inputs Recorder to clear (remains usable)
+ */
+void build_inputs_clear(build_inputs* inputs) {
+    if (!inputs) {
+        return;
+    }
+    
+    for (size_t i = 0; i < inputs->count; i++) {
+        xmd_free(inputs->files[i].path);
+    }
+    xmd_free(inputs->files);
+    memset(inputs, 0, sizeof(*inputs));
+}
@@ -0,0 +1,22 @@
+/**
+ * @file build_inputs_record_command.c
+ * @brief Record that the current render ran a command
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+
+/**
+ * @brief Record that the current render ran a command
+ *
+ * Command output is an input the cache cannot observe, so the document
+ * will be rendered again by every build.
+ *
+ * @param command Command text
+ */
+void build_inputs_record_command(const char* command) {
+    (void)command;
+    if (xmd_active_build_inputs) {
+        xmd_active_build_inputs->ran_commands = true;
+    }
+}
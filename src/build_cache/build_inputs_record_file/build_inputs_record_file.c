@@ -0,0 +1,53 @@
+/**
+ * @file build_inputs_record_file.c
+ * @brief Record a file read by the current render
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Record a file read by the current render
+ *
+ * A file imported several times is recorded once, with the content of
+ * its first read.
+ *
+ * @param path File path
+ * @param content File content, or NULL if the file was missing
+ * @param length Content length
+ */
+void build_inputs_record_file(const char* path, const void* content, size_t length) {
+    build_inputs* inputs = xmd_active_build_inputs;
+    if (!inputs || !path) {
+        return;
+    }
+    
+    for (size_t i = 0; i < inputs->count; i++) {
+        if (strcmp(inputs->files[i].path, path) == 0) {
+            return;
+        }
+    }
+    
+    if (inputs->count == inputs->capacity) {
+        size_t capacity = inputs->capacity ? inputs->capacity * 2 : 8;
+        build_input* files = xmd_realloc(inputs->files, capacity * sizeof(build_input));
+        if (!files) {
+            // An unrecorded input must not let the file be skipped later
+            inputs->ran_commands = true;
+            return;
+        }
+        inputs->files = files;
+        inputs->capacity = capacity;
+    }
+    
+    char* copy = xmd_strdup(path);
+    if (!copy) {
+        inputs->ran_commands = true;
+        return;
+    }
+    inputs->files[inputs->count].path = copy;
+    inputs->files[inputs->count].hash = content ? build_cache_hash(content, length) : 0;
+    inputs->count++;
+}
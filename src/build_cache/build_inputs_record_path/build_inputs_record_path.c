@@ -0,0 +1,26 @@
+/**
+ * @file build_inputs_record_path.c
+ * @brief Record a file the current render reads by path
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Record a file the current render reads by path
+ *
+ * For readers that do not keep the file's bytes (parsers, mappings): the
+ * file is read again for hashing, and only while a recorder is attached.
+ *
+ * @param path File path
+ */
+void build_inputs_record_path(const char* path) {
+    if (!xmd_active_build_inputs || !path) {
+        return;
+    }
+    size_t length = 0;
+    char* content = build_cache_read_file(path, &length);
+    build_inputs_record_file(path, content, length);
+    xmd_free(content);
+}
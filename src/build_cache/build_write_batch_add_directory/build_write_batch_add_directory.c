@@ -0,0 +1,45 @@
+/**
+ * @file build_write_batch_add_directory.c
+ * @brief Record the directory of a file renamed during a wave
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Record the directory of a file renamed during a wave
+ * @param batch Write batch
+ * @param file_path Path of the renamed file
+ * @return 0 on success, -1 on allocation failure
+ */
+int build_write_batch_add_directory(build_write_batch* batch, const char* file_path) {
+    // "dir/name" -> "dir", "/name" -> "/", "name" -> "."
+    const char* last_slash = strrchr(file_path, '/');
+    const char* directory = last_slash ? file_path : ".";
+    size_t length = (last_slash && last_slash != file_path) ? (size_t)(last_slash - file_path) : 1;
+    
+    for (size_t i = 0; i < batch->count; i++) {
+        if (strlen(batch->directories[i]) == length &&
+            strncmp(batch->directories[i], directory, length) == 0) {
+            return 0;
+        }
+    }
+    
+    if (batch->count == batch->capacity) {
+        size_t capacity = batch->capacity ? batch->capacity * 2 : 8;
+        char** directories = xmd_realloc(batch->directories, capacity * sizeof(char*));
+        if (!directories) {
+            return -1;
+        }
+        batch->directories = directories;
+        batch->capacity = capacity;
+    }
+    char* copy = xmd_strndup(directory, length);
+    if (!copy) {
+        return -1;
+    }
+    batch->directories[batch->count++] = copy;
+    return 0;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file build_write_batch_attach.c
+ * @brief Attach a write batch to the calling thread
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+
+XMD_THREAD_LOCAL build_write_batch* xmd_active_write_batch = NULL;
+
+/**
+ * @brief Attach a write batch to the calling thread
+ * @param batch Batch to attach, or NULL to detach
+ * @return Previously attached batch
+ */
+build_write_batch* build_write_batch_attach(build_write_batch* batch) {
+    build_write_batch* previous = xmd_active_write_batch;
+    xmd_active_write_batch = batch;
+    return previous;
+}
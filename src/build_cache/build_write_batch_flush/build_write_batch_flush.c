@@ -0,0 +1,31 @@
+/**
+ * @file build_write_batch_flush.c
+ * @brief End a rebuild wave
+ * @author XMD Team
+ */
+
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief End a rebuild wave: flush every directory written to, once
+ * @param batch Batch to flush (emptied, and reusable for the next wave)
+ * @return 0 on success, -1 if a directory could not be flushed
+ */
+int build_write_batch_flush(build_write_batch* batch) {
+    if (!batch) {
+        return 0;
+    }
+    
+    int result = 0;
+    for (size_t i = 0; i < batch->count; i++) {
+        if (xmd_fsync_directory(batch->directories[i]) != 0) {
+            result = -1;
+        }
+        xmd_free(batch->directories[i]);
+    }
+    xmd_free(batch->directories);
+    build_write_batch_init(batch);
+    return result;
+}
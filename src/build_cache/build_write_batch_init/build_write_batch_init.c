@@ -0,0 +1,18 @@
+/**
+ * @file build_write_batch_init.c
+ * @brief Initialize a write batch
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/build_cache_internal.h"
+
+/**
+ * @brief Initialize a write batch
+ * @param batch Batch to initialize
+ */
+void build_write_batch_init(build_write_batch* batch) {
+    if (batch) {
+        memset(batch, 0, sizeof(*batch));
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @file build_write_output.c
+ * @brief Write a build output only when its content changed
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include "../../../include/build_cache_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+#ifdef XMD_PLATFORM_WINDOWS
+#define getpid _getpid
+#endif
+
+/**
+ * @brief Check whether a file already holds exactly some content
+ * @param path Existing file
+ * @param content Content
+ * @param length Content length
+ * @return true if the file has that size and those bytes
+ */
+static bool holds_content(const char* path, const char* content, size_t length) {
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode) || (uint64_t)st.st_size != length) {
+        return false;
+    }
+    size_t existing_length = 0;
+    char* existing = build_cache_read_file(path, &existing_length);
+    bool same = existing && existing_length == length &&
+                (length == 0 || memcmp(existing, content, length) == 0);
+    xmd_free(existing);
+    return same;
+}
+
+/**
+ * @brief Write content to a file unless it already holds exactly those bytes
+ *
+ * Leaving an identical output untouched keeps its modification time, so
+ * tools watching the output directory see no change. A changed output is
+ * written beside the old one and renamed over it, taking over the old
+ * file's permission bits. An output reached through a symlink is replaced
+ * at the link's target, so the link stays. Under an attached write batch
+ * the data is flushed before the rename and the directory is flushed
+ * when the batch is.
+ *
+ * @param path Output file
+ * @param content Content
+ * @param length Content length
+ * @param written Receives whether the file was written (optional)
+ * @return 0 on success, -1 on error
+ */
+int build_write_output(const char* path, const char* content, size_t length, bool* written) {
+    if (written) {
+        *written = false;
+    }
+    if (!path || (!content && length > 0)) {
+        return -1;
+    }
+    
+    if (holds_content(path, content ? content : "", length)) {
+        return 0;
+    }
+    
+    // Replace the file a symlink points to rather than the link itself
+    const char* target = path;
+#ifndef XMD_PLATFORM_WINDOWS
+    char resolved[PATH_MAX];
+    struct stat link_st;
+    if (lstat(path, &link_st) == 0 && S_ISLNK(link_st.st_mode) && realpath(path, resolved)) {
+        target = resolved;
+    }
+#endif
+    struct stat target_st;
+    bool replacing = stat(target, &target_st) == 0 && S_ISREG(target_st.st_mode);
+    
+    build_write_batch* batch = xmd_active_write_batch;
+    size_t temp_length = strlen(target) + 32;
+    char* temp_path = xmd_malloc(temp_length);
+    if (!temp_path) {
+        return -1;
+    }
+    snprintf(temp_path, temp_length, "%s.%ld.tmp", target, (long)getpid());
+    
+    FILE* file = fopen(temp_path, "wb");
+    bool complete = file && (length == 0 || fwrite(content, 1, length, file) == length);
+    if (complete && batch && xmd_fsync_file(file) != 0) {
+        complete = false;
+    }
+    if (file && fclose(file) != 0) {
+        complete = false;
+    }
+#ifndef XMD_PLATFORM_WINDOWS
+    if (complete && replacing && chmod(temp_path, target_st.st_mode & 07777) != 0) {
+        complete = false;
+    }
+#else
+    (void)replacing;
+#endif
+    if (!complete || xmd_replace_file(temp_path, target) != 0) {
+        remove(temp_path);
+        xmd_free(temp_path);
+        return -1;
+    }
+    xmd_free(temp_path);
+    
+    if (batch) {
+        batch->files_written++;
+        build_write_batch_add_directory(batch, target);
+    }
+    if (written) {
+        *written = true;
+    }
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Cleanup CLI context
@@ -19,21 +20,21 @@ void cli_cleanup(cli_context* ctx) {
     }
     
     if (ctx->args) {
-        free(ctx->args->input_file);
-        free(ctx->args->output_file);
-        free(ctx->args->config_file);
-        free(ctx->args->watch_directory);
-        free(ctx->args);
+        xmd_free(ctx->args->input_file);
+        xmd_free(ctx->args->output_file);
+        xmd_free(ctx->args->config_file);
+        xmd_free(ctx->args->watch_directory);
+        xmd_free(ctx->args);
     }
     
-    free(ctx->program_name);
+    xmd_free(ctx->program_name);
     
     // Cleanup XMD context if initialized
     if (ctx->xmd) {
         // Free the XMD context (xmd_cleanup() is global)
-        free(ctx->xmd);
+        xmd_free(ctx->xmd);
         ctx->xmd = NULL;
     }
     
-    free(ctx);
+    xmd_free(ctx);
 }
\ No newline at end of file
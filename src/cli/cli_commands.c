@@ -11,6 +11,8 @@
 #include <string.h>
 #include <unistd.h>
 #include "cli.h"
+#include "performance.h"
+#include "allocator.h"
 
 // External function to get version
 extern const char* xmd_get_version(void);
@@ -25,6 +27,10 @@ int cmd_process(int argc, char* argv[]) {
     const char* input_file = NULL;
     const char* output_file = NULL;
     bool verbose = false;
+    bool profile = false;
+    const char* profile_output = NULL;
+    bool hotspots = false;
+    const char* hotspots_output = NULL;
     
     // Parse arguments
     for (int i = 2; i < argc; i++) {
@@ -34,6 +40,16 @@ int cmd_process(int argc, char* argv[]) {
             if (i + 1 < argc) {
                 output_file = argv[++i];
             }
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profile = true;
+        } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+            profile = true;
+            profile_output = argv[i] + 10;
+        } else if (strcmp(argv[i], "--hotspots") == 0) {
+            hotspots = true;
+        } else if (strncmp(argv[i], "--hotspots=", 11) == 0) {
+            hotspots = true;
+            hotspots_output = argv[i] + 11;
         } else if (argv[i][0] != '-') {
             if (input_file == NULL) {
                 input_file = argv[i];
@@ -41,7 +57,50 @@ int cmd_process(int argc, char* argv[]) {
         }
     }
     
-    return cli_process_file(input_file, output_file, verbose);
+    if (!profile && !hotspots) {
+        return cli_process_file(input_file, output_file, verbose);
+    }
+    
+    // Count heap traffic for the profile unless an allocator is already installed
+    xmd_alloc_stats heap;
+    bool track_heap = !xmd_allocator_get() && xmd_alloc_stats_init(&heap) == 0;
+    if (track_heap) {
+        xmd_allocator tracking = xmd_alloc_stats_allocator(&heap);
+        xmd_allocator_set(&tracking);
+    }
+    
+    // Time the render stages and/or directives of this file
+    perf_profiler* profiler = perf_profiler_create();
+    if (profiler) {
+        profiler->hotspots_enabled = hotspots;
+        if (perf_profiler_start(profiler) == 0) {
+            perf_profiler_attach(profiler);
+        }
+    }
+    int status = cli_process_file(input_file, output_file, verbose);
+    if (profiler) {
+        perf_profiler_stop(profiler);
+        perf_profiler_attach(NULL);
+        if (profile && perf_profiler_write_json(profiler, input_file, profile_output) != 0) {
+            fprintf(stderr, "Warning: Failed to write profile report\n");
+        }
+        if (hotspots) {
+            char* table = perf_hotspot_report_table(profiler);
+            if (table) {
+                fputs(table, stderr);
+                xmd_free(table);
+            }
+            if (hotspots_output && perf_hotspot_write_folded(profiler, hotspots_output) != 0) {
+                fprintf(stderr, "Warning: Cannot write collapsed stacks to '%s'\n", hotspots_output);
+            }
+        }
+        perf_profiler_destroy(profiler);
+    }
+    if (track_heap) {
+        xmd_allocator_set(NULL);
+        xmd_alloc_stats_destroy(&heap);
+    }
+    return status;
 }
 
 /**
@@ -79,13 +138,17 @@ void print_usage(const char* program_name) {
     printf("  process [file]     Process markdown file (default: stdin)\n");
     printf("  watch <input> [output]  Watch files/directories for changes\n");
     printf("  validate <file>    Validate markdown file syntax\n");
+    printf("  build <in> <out>  Render a file or directory, skipping unchanged files\n");
+    printf("  bench             Run the macro-benchmark corpus\n");
     printf("  upgrade           Upgrade to latest version\n");
     printf("  uninstall         Uninstall XMD from the system\n");
     printf("  version           Show version information\n");
     printf("  help              Show this help message\n\n");
     printf("Options:\n");
     printf("  -v, --verbose     Enable verbose output\n");
-    printf("  -o, --output      Specify output file\n\n");
+    printf("  -o, --output      Specify output file\n");
+    printf("  --profile[=file]  Report per-stage timings as JSON (default: stderr)\n");
+    printf("  --hotspots[=file] Print per-directive costs; write collapsed stacks to file\n\n");
     printf("Shorthand usage:\n");
     printf("  %s <file>         Same as '%s process <file>'\n", program_name, program_name);
     printf("  echo 'text' | %s  Process from stdin\n", program_name);
@@ -107,7 +170,8 @@ int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char***
     const char* arg1 = argv[1];
     
     // Check if it's a known command
-    if (strcmp(arg1, "process") == 0 || strcmp(arg1, "validate") == 0 || 
+    if (strcmp(arg1, "process") == 0 || strcmp(arg1, "validate") == 0 ||
+        strcmp(arg1, "bench") == 0 || strcmp(arg1, "build") == 0 ||
         strcmp(arg1, "upgrade") == 0 || strcmp(arg1, "uninstall") == 0 ||
         strcmp(arg1, "version") == 0 || strcmp(arg1, "help") == 0 || 
         strcmp(arg1, "--help") == 0) {
@@ -121,15 +185,15 @@ int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char***
     
     // Convert to process command
     *new_argc = argc + 1;
-    *new_argv = malloc((*new_argc) * sizeof(char*));
+    *new_argv = xmd_malloc((*new_argc) * sizeof(char*));
     if (*new_argv == NULL) {
         return -1;
     }
     
     (*new_argv)[0] = argv[0];
-    (*new_argv)[1] = strdup("process");
+    (*new_argv)[1] = xmd_strdup("process");
     for (int i = 1; i < argc; i++) {
-        (*new_argv)[i + 1] = strdup(argv[i]);
+        (*new_argv)[i + 1] = xmd_strdup(argv[i]);
     }
     
     return 0;
@@ -143,7 +207,7 @@ void free_converted_argv(int argc, char** argv) {
     
     // Free individual strings (except argv[0] which wasn't duplicated)
     for (int i = 1; i < argc; i++) {
-        free(argv[i]);
+        xmd_free(argv[i]);
     }
-    free(argv);
+    xmd_free(argv);
 }
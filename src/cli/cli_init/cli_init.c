@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Initialize CLI context
@@ -22,7 +23,7 @@ cli_context* cli_init(int argc, char** argv) {
         return NULL;
     }
     
-    cli_context* ctx = calloc(1, sizeof(cli_context));
+    cli_context* ctx = xmd_calloc(1, sizeof(cli_context));
     if (!ctx) {
         return NULL;
     }
@@ -30,13 +31,13 @@ cli_context* cli_init(int argc, char** argv) {
     // Parse arguments
     ctx->args = cli_parse_args(argc, argv);
     if (!ctx->args) {
-        free(ctx);
+        xmd_free(ctx);
         return NULL;
     }
     
     // Store program name
     if (argv[0]) {
-        ctx->program_name = strdup(argv[0]);
+        ctx->program_name = xmd_strdup(argv[0]);
     }
     
     // Initialize XMD context
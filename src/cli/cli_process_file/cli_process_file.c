@@ -14,6 +14,9 @@
 #include "../../../include/lexer.h"
 #include "../../../include/variable.h"
 #include "../../../include/store.h"
+#include "../../../include/performance.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process a markdown file
@@ -55,7 +58,7 @@ int cli_process_file(const char* input_file, const char* output_file, bool verbo
     fseek(input, 0, SEEK_SET);
     
     // Read content
-    char* content = malloc(size + 1);
+    char* content = xmd_malloc(size + 1);
     if (!content) {
         fprintf(stderr, "Error: Memory allocation failed\n");
         fclose(input);
@@ -70,7 +73,7 @@ int cli_process_file(const char* input_file, const char* output_file, bool verbo
     lexer* lex = lexer_create(content);
     if (!lex) {
         fprintf(stderr, "Error: Failed to create lexer\n");
-        free(content);
+        xmd_free(content);
         return 1;
     }
     
@@ -78,7 +81,7 @@ int cli_process_file(const char* input_file, const char* output_file, bool verbo
     if (xmd_init() != XMD_SUCCESS) {
         fprintf(stderr, "Error: Failed to initialize XMD system\n");
         lexer_free(lex);
-        free(content);
+        xmd_free(content);
         return 1;
     }
     
@@ -87,7 +90,7 @@ int cli_process_file(const char* input_file, const char* output_file, bool verbo
     if (!xmd_handle) {
         fprintf(stderr, "Error: Failed to create XMD processor\n");
         lexer_free(lex);
-        free(content);
+        xmd_free(content);
         return 1;
     }
     
@@ -105,37 +108,39 @@ int cli_process_file(const char* input_file, const char* output_file, bool verbo
         fprintf(stderr, "Error: XMD processing failed\n");
         xmd_processor_free(xmd_handle);
         lexer_free(lex);
-        free(content);
+        xmd_free(content);
         return 1;
     }
     
-    FILE* output = stdout;
+    // An output file that already holds the result is left untouched
+    PERF_STAGE_BEGIN(PERF_STAGE_FORMAT);
+    bool written = false;
+    int write_status = 0;
     if (output_file) {
-        output = fopen(output_file, "w");
-        if (!output) {
-            fprintf(stderr, "Error: Cannot create output file '%s'\n", output_file);
-            xmd_result_free(result);
-            xmd_processor_free(xmd_handle);
-            lexer_free(lex);
-            free(content);
-            return 1;
-        }
+        write_status = build_write_output(output_file, result->output, result->output_length, &written);
+    } else {
+        fputs(result->output, stdout);
     }
+    PERF_STAGE_END(PERF_STAGE_FORMAT);
     
-    fprintf(output, "%s", result->output);
+    if (write_status != 0) {
+        fprintf(stderr, "Error: Cannot create output file '%s'\n", output_file);
+        xmd_result_free(result);
+        xmd_processor_free(xmd_handle);
+        lexer_free(lex);
+        xmd_free(content);
+        return 1;
+    }
     
-    if (output_file && output != stdout) {
-        fclose(output);
-        if (verbose) {
-            printf("Output written to: %s\n", output_file);
-        }
+    if (output_file && verbose) {
+        printf(written ? "Output written to: %s\n" : "Output unchanged: %s\n", output_file);
     }
     
     // Cleanup
     xmd_result_free(result);
     xmd_processor_free(xmd_handle);
     lexer_free(lex);
-    free(content);
+    xmd_free(content);
     
     return 0;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <sys/stat.h>
 #include <stdbool.h>
 #include "../../../include/lexer.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Validate XMD file syntax
@@ -46,7 +47,7 @@ int cli_validate_file(const char* input_file, bool verbose) {
     long size = ftell(input);
     fseek(input, 0, SEEK_SET);
     
-    char* content = malloc(size + 1);
+    char* content = xmd_malloc(size + 1);
     if (!content) {
         fprintf(stderr, "Error: Memory allocation failed\n");
         fclose(input);
@@ -61,7 +62,7 @@ int cli_validate_file(const char* input_file, bool verbose) {
     lexer* lex = lexer_create(content);
     if (!lex) {
         fprintf(stderr, "Error: Failed to create lexer for validation\n");
-        free(content);
+        xmd_free(content);
         return 1;
     }
     
@@ -72,7 +73,7 @@ int cli_validate_file(const char* input_file, bool verbose) {
     printf("✓ File '%s' is valid\n", input_file);
     
     lexer_free(lex);
-    free(content);
+    xmd_free(content);
     
     return 0;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
  */
 
 #include "../../../../include/parser_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Parse command line arguments
@@ -19,7 +20,7 @@ cli_args* cli_parse_args(int argc, char** argv) {
         return NULL;
     }
     
-    cli_args* args = calloc(1, sizeof(cli_args));
+    cli_args* args = xmd_calloc(1, sizeof(cli_args));
     if (!args) {
         return NULL;
     }
@@ -39,13 +40,13 @@ cli_args* cli_parse_args(int argc, char** argv) {
     
     // Parse command first
     if (i >= argc) {
-        free(args);
+        xmd_free(args);
         return NULL; // No command specified
     }
     
     int cmd_type = parse_command_type(argv[i]);
     if (cmd_type == -1) {
-        free(args);
+        xmd_free(args);
         return NULL; // Invalid command
     }
     
@@ -58,10 +59,10 @@ cli_args* cli_parse_args(int argc, char** argv) {
         case CLI_CMD_VALIDATE:
             // Expect input file
             if (i >= argc || is_flag(argv[i])) {
-                free(args);
+                xmd_free(args);
                 return NULL;
             }
-            args->input_file = strdup(argv[i]);
+            args->input_file = xmd_strdup(argv[i]);
             i++;
             
             // Check for optional output file
@@ -69,13 +70,13 @@ cli_args* cli_parse_args(int argc, char** argv) {
                 if (strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) {
                     i++;
                     if (i < argc && !is_flag(argv[i])) {
-                        args->output_file = strdup(argv[i]);
+                        args->output_file = xmd_strdup(argv[i]);
                         i++;
                     }
                 } else if (strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--config") == 0) {
                     i++;
                     if (i < argc && !is_flag(argv[i])) {
-                        args->config_file = strdup(argv[i]);
+                        args->config_file = xmd_strdup(argv[i]);
                         i++;
                     }
                 } else if (strcmp(argv[i], "--verbose") == 0) {
@@ -96,10 +97,10 @@ cli_args* cli_parse_args(int argc, char** argv) {
         case CLI_CMD_WATCH:
             // Expect directory path
             if (i >= argc || is_flag(argv[i])) {
-                free(args);
+                xmd_free(args);
                 return NULL;
             }
-            args->watch_directory = strdup(argv[i]);
+            args->watch_directory = xmd_strdup(argv[i]);
             i++;
             
             // Check for optional flags
@@ -122,10 +123,10 @@ cli_args* cli_parse_args(int argc, char** argv) {
         case CLI_CMD_PLUGIN:
             // Expect plugin subcommand
             if (i >= argc || is_flag(argv[i])) {
-                free(args);
+                xmd_free(args);
                 return NULL;
             }
-            args->plugin_name = strdup(argv[i]);
+            args->plugin_name = xmd_strdup(argv[i]);
             i++;
             break;
             
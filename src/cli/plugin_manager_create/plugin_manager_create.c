@@ -9,13 +9,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new plugin manager
  * @return New plugin manager or NULL on error
  */
 plugin_manager* plugin_manager_create(void) {
-    plugin_manager* manager = malloc(sizeof(plugin_manager));
+    plugin_manager* manager = xmd_malloc(sizeof(plugin_manager));
     if (!manager) {
         return NULL;
     }
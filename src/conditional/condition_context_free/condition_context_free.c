@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/conditional.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a condition context
@@ -18,6 +19,6 @@ void condition_context_free(ConditionContext* ctx) {
         return;
     }
     
-    free(ctx->last_error);
-    free(ctx);
+    xmd_free(ctx->last_error);
+    xmd_free(ctx);
 }
\ No newline at end of file
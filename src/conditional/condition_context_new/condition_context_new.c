@@ -8,13 +8,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/conditional.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new condition context
  * @return New condition context or NULL on error
  */
 ConditionContext* condition_context_new(void) {
-    ConditionContext* ctx = malloc(sizeof(ConditionContext));
+    ConditionContext* ctx = xmd_malloc(sizeof(ConditionContext));
     if (!ctx) {
         return NULL;
     }
@@ -12,6 +12,7 @@
 #include "../../../include/conditional.h"
 #include "../../../include/variable.h"
 #include "../../../include/store.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Evaluate a condition expression
@@ -60,12 +61,12 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         size_t left_len = and_pos - condition;
         size_t right_offset = and_pos - condition + 4; // Skip " && "
         
-        char* left_expr = malloc(left_len + 1);
-        char* right_expr = malloc(len - right_offset + 1);
+        char* left_expr = xmd_malloc(left_len + 1);
+        char* right_expr = xmd_malloc(len - right_offset + 1);
         
         if (!left_expr || !right_expr) {
-            free(left_expr);
-            free(right_expr);
+            xmd_free(left_expr);
+            xmd_free(right_expr);
             return CONDITION_ERROR;
         }
         
@@ -76,8 +77,8 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         int left_result = condition_evaluate(ctx, left_expr, variables);
         int right_result = condition_evaluate(ctx, right_expr, variables);
         
-        free(left_expr);
-        free(right_expr);
+        xmd_free(left_expr);
+        xmd_free(right_expr);
         
         if (left_result == CONDITION_ERROR || right_result == CONDITION_ERROR) {
             return CONDITION_ERROR;
@@ -95,12 +96,12 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         size_t left_len = or_pos - condition;
         size_t right_offset = or_pos - condition + 4; // Skip " || "
         
-        char* left_expr = malloc(left_len + 1);
-        char* right_expr = malloc(len - right_offset + 1);
+        char* left_expr = xmd_malloc(left_len + 1);
+        char* right_expr = xmd_malloc(len - right_offset + 1);
         
         if (!left_expr || !right_expr) {
-            free(left_expr);
-            free(right_expr);
+            xmd_free(left_expr);
+            xmd_free(right_expr);
             return CONDITION_ERROR;
         }
         
@@ -111,8 +112,8 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         int left_result = condition_evaluate(ctx, left_expr, variables);
         int right_result = condition_evaluate(ctx, right_expr, variables);
         
-        free(left_expr);
-        free(right_expr);
+        xmd_free(left_expr);
+        xmd_free(right_expr);
         
         if (left_result == CONDITION_ERROR || right_result == CONDITION_ERROR) {
             return CONDITION_ERROR;
@@ -129,7 +130,7 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         
         // Extract variable name from {{variable_name}}
         size_t var_len = len - 4; // Remove {{ and }}
-        char* var_name = malloc(var_len + 1);
+        char* var_name = xmd_malloc(var_len + 1);
         if (!var_name) {
             return CONDITION_ERROR;
         }
@@ -151,12 +152,12 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
             result = CONDITION_FALSE;
         }
         
-        free(var_name);
+        xmd_free(var_name);
         return result;
     }
     
     // For now, treat other expressions as simple variable names (fallback)
-    char* var_name = malloc(len + 1);
+    char* var_name = xmd_malloc(len + 1);
     if (!var_name) {
         return CONDITION_ERROR;
     }
@@ -177,6 +178,6 @@ int condition_evaluate(ConditionContext* ctx, const char* condition, store* vari
         ctx->last_result = false;
     }
     
-    free(var_name);
+    xmd_free(var_name);
     return result;
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <string.h>
 #include "../../../include/conditional.h"
 #include "../../../include/template.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process an if/else statement
@@ -47,12 +48,12 @@ int if_statement_process(ConditionContext* ctx, const char* condition,
         chosen_content = false_content;
     } else {
         // No else branch, return empty string
-        *result = strdup("");
+        *result = xmd_strdup("");
         return *result ? 0 : -1;
     }
     
     // For now, just return the content as-is (template processing can be added later)
-    *result = strdup(chosen_content);
+    *result = xmd_strdup(chosen_content);
     return *result ? 0 : -1;
 }
 
@@ -89,12 +90,12 @@ int elif_statement_process(ConditionContext* ctx, const char* conditions[],
         
         if (condition_result == CONDITION_TRUE) {
             // This condition is true, return its content
-            *result = strdup(contents[i]);
+            *result = xmd_strdup(contents[i]);
             return *result ? 0 : -1;
         }
     }
     
     // No condition was true, return empty string
-    *result = strdup("");
+    *result = xmd_strdup("");
     return *result ? 0 : -1;
 }
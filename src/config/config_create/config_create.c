@@ -9,13 +9,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create configuration structure
  * @return Configuration structure or NULL on error
  */
 xmd_config* config_create(void) {
-    xmd_config* config = malloc(sizeof(xmd_config));
+    xmd_config* config = xmd_malloc(sizeof(xmd_config));
     if (!config) {
         return NULL;
     }
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Destroy configuration structure
@@ -20,19 +21,19 @@ void config_destroy(xmd_config* config) {
     
     // Free sandbox config if present
     if (config->sandbox) {
-        free(config->sandbox);
+        xmd_free(config->sandbox);
     }
     
     // Free module search paths
     if (config->module_search_paths) {
         for (size_t i = 0; i < config->search_path_count; i++) {
-            free(config->module_search_paths[i]);
+            xmd_free(config->module_search_paths[i]);
         }
-        free(config->module_search_paths);
+        xmd_free(config->module_search_paths);
     }
     
     // Free output format string
-    free(config->output_format);
+    xmd_free(config->output_format);
     
-    free(config);
+    xmd_free(config);
 }
\ No newline at end of file
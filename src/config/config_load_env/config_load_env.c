@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load configuration from environment
@@ -34,10 +35,10 @@ int config_load_env(xmd_config* config) {
     for (int i = 0; env_vars[i][0]; i++) {
         const char* env_value = getenv(env_vars[i][0]);
         if (env_value) {
-            config_value* value = malloc(sizeof(config_value));
+            config_value* value = xmd_malloc(sizeof(config_value));
             if (value) {
                 value->type = CONFIG_STRING;
-                value->data.string_val = strdup(env_value);
+                value->data.string_val = xmd_strdup(env_value);
                 config_set(config, env_vars[i][1], value);
             }
         }
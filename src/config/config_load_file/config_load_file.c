@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load configuration from file
@@ -51,10 +52,10 @@ int config_load_file(xmd_config* config, const char* file_path) {
             }
             
             // Create value
-            config_value* value = malloc(sizeof(config_value));
+            config_value* value = xmd_malloc(sizeof(config_value));
             if (value) {
                 value->type = CONFIG_STRING;
-                value->data.string_val = strdup(value_str);
+                value->data.string_val = xmd_strdup(value_str);
                 config_set(config, key, value);
             }
         }
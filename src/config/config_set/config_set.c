@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 // Global storage for configuration values (shared across config functions)
 extern config_value* g_stored_values[100];
@@ -40,7 +41,7 @@ int config_set(xmd_config* config, const char* key, config_value* value) {
     
     // Add new key-value pair
     if (g_stored_count < 100) {
-        g_stored_keys[g_stored_count] = strdup(key);
+        g_stored_keys[g_stored_count] = xmd_strdup(key);
         g_stored_values[g_stored_count] = value;
         g_stored_count++;
         return 0;
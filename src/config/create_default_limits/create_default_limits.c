@@ -19,7 +19,8 @@ xmd_resource_limits create_default_limits(void) {
         .execution_time_limit_ms = 10000,
         .max_output_size = 1024 * 1024,  // 1MB
         .max_recursion_depth = 100,
-        .max_loop_iterations = 10000
+        .max_loop_iterations = 10000,
+        .max_parallel_exec = 1           // Sequential unless configured
     };
     return limits;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create default paths configuration
@@ -18,9 +19,10 @@
  */
 xmd_paths_config create_default_paths(void) {
     xmd_paths_config paths = {
-        .proc_status_path = strdup("/proc/self/status"),
-        .proc_fd_path = strdup("/proc/self/fd"),
-        .temp_dir = strdup("/tmp"),
+        .proc_status_path = xmd_strdup("/proc/self/status"),
+        .proc_fd_path = xmd_strdup("/proc/self/fd"),
+        .temp_dir = xmd_strdup("/tmp"),
+        .data_cache_dir = NULL,
         .module_search_paths = NULL,
         .module_search_path_count = 0
     };
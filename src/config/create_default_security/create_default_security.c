@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create default security configuration
@@ -26,11 +27,11 @@ xmd_security_config create_default_security(void) {
     };
     
     // Add default whitelist
-    security.exec_whitelist = malloc(3 * sizeof(char*));
+    security.exec_whitelist = xmd_malloc(3 * sizeof(char*));
     if (security.exec_whitelist) {
-        security.exec_whitelist[0] = strdup("echo");
-        security.exec_whitelist[1] = strdup("date");
-        security.exec_whitelist[2] = strdup("cat");
+        security.exec_whitelist[0] = xmd_strdup("echo");
+        security.exec_whitelist[1] = xmd_strdup("date");
+        security.exec_whitelist[2] = xmd_strdup("cat");
         security.exec_whitelist_count = 3;
     }
     
@@ -7,18 +7,20 @@
  */
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free paths configuration
  * @param paths Paths configuration to free
  */
 void free_paths_config(xmd_paths_config* paths) {
-    free(paths->proc_status_path);
-    free(paths->proc_fd_path);
-    free(paths->temp_dir);
+    xmd_free(paths->proc_status_path);
+    xmd_free(paths->proc_fd_path);
+    xmd_free(paths->temp_dir);
+    xmd_free(paths->data_cache_dir);
     
     for (size_t i = 0; i < paths->module_search_path_count; i++) {
-        free(paths->module_search_paths[i]);
+        xmd_free(paths->module_search_paths[i]);
     }
-    free(paths->module_search_paths);
+    xmd_free(paths->module_search_paths);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free security configuration
@@ -14,7 +15,7 @@
  */
 void free_security_config(xmd_security_config* security) {
     for (size_t i = 0; i < security->exec_whitelist_count; i++) {
-        free(security->exec_whitelist[i]);
+        xmd_free(security->exec_whitelist[i]);
     }
-    free(security->exec_whitelist);
+    xmd_free(security->exec_whitelist);
 }
\ No newline at end of file
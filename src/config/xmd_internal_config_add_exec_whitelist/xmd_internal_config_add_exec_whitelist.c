@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add executable to whitelist
@@ -22,14 +23,14 @@ int xmd_internal_config_add_exec_whitelist(xmd_internal_config* config, const ch
         return -1;
     }
     
-    char** new_whitelist = realloc(config->security.exec_whitelist,
+    char** new_whitelist = xmd_realloc(config->security.exec_whitelist,
                                   (config->security.exec_whitelist_count + 1) * sizeof(char*));
     if (!new_whitelist) {
         return -1;
     }
     
     config->security.exec_whitelist = new_whitelist;
-    config->security.exec_whitelist[config->security.exec_whitelist_count] = strdup(executable);
+    config->security.exec_whitelist[config->security.exec_whitelist_count] = xmd_strdup(executable);
     config->security.exec_whitelist_count++;
     
     return 0;
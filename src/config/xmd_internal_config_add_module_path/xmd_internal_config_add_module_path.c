@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add module path to configuration
@@ -23,14 +24,14 @@ int xmd_internal_config_add_module_path(xmd_internal_config* config, const char*
         return -1;
     }
     
-    char** new_paths = realloc(config->paths.module_search_paths,
+    char** new_paths = xmd_realloc(config->paths.module_search_paths,
                               (config->paths.module_search_path_count + 1) * sizeof(char*));
     if (!new_paths) {
         return -1;
     }
     
     config->paths.module_search_paths = new_paths;
-    config->paths.module_search_paths[config->paths.module_search_path_count] = strdup(path);
+    config->paths.module_search_paths[config->paths.module_search_path_count] = xmd_strdup(path);
     config->paths.module_search_path_count++;
     
     return 0;
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free internal configuration
@@ -19,6 +20,6 @@ void xmd_internal_config_free(xmd_internal_config* config) {
     
     free_paths_config(&config->paths);
     free_security_config(&config->security);
-    free(config->config_file_path);
-    free(config);
+    xmd_free(config->config_file_path);
+    xmd_free(config);
 }
\ No newline at end of file
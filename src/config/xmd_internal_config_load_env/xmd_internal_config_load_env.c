@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load configuration from environment variables
@@ -29,6 +30,7 @@ int xmd_internal_config_load_env(xmd_internal_config* config) {
     config->limits.max_output_size = parse_env_size_t("XMD_MAX_OUTPUT_SIZE", config->limits.max_output_size);
     config->limits.max_recursion_depth = parse_env_size_t("XMD_MAX_RECURSION_DEPTH", config->limits.max_recursion_depth);
     config->limits.max_loop_iterations = parse_env_size_t("XMD_MAX_LOOP_ITERATIONS", config->limits.max_loop_iterations);
+    config->limits.max_parallel_exec = parse_env_size_t("XMD_MAX_PARALLEL_EXEC", config->limits.max_parallel_exec);
     
     // Load buffer configuration
     config->buffers.line_buffer_size = parse_env_size_t("XMD_LINE_BUFFER_SIZE", config->buffers.line_buffer_size);
@@ -39,20 +41,26 @@ int xmd_internal_config_load_env(xmd_internal_config* config) {
     // Load paths
     const char* proc_status = getenv("XMD_PROC_STATUS_PATH");
     if (proc_status) {
-        free(config->paths.proc_status_path);
-        config->paths.proc_status_path = strdup(proc_status);
+        xmd_free(config->paths.proc_status_path);
+        config->paths.proc_status_path = xmd_strdup(proc_status);
     }
     
     const char* proc_fd = getenv("XMD_PROC_FD_PATH");
     if (proc_fd) {
-        free(config->paths.proc_fd_path);
-        config->paths.proc_fd_path = strdup(proc_fd);
+        xmd_free(config->paths.proc_fd_path);
+        config->paths.proc_fd_path = xmd_strdup(proc_fd);
     }
     
     const char* temp_dir = getenv("XMD_TEMP_DIR");
     if (temp_dir) {
-        free(config->paths.temp_dir);
-        config->paths.temp_dir = strdup(temp_dir);
+        xmd_free(config->paths.temp_dir);
+        config->paths.temp_dir = xmd_strdup(temp_dir);
+    }
+    
+    const char* data_cache_dir = getenv("XMD_DATA_CACHE_DIR");
+    if (data_cache_dir) {
+        xmd_free(config->paths.data_cache_dir);
+        config->paths.data_cache_dir = *data_cache_dir ? xmd_strdup(data_cache_dir) : NULL;
     }
     
     // Load security configuration
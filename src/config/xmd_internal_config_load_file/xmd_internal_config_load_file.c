@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load configuration from file
@@ -60,6 +61,11 @@ int xmd_internal_config_load_file(xmd_internal_config* config, const char* file_
             config->limits.memory_limit_mb = (size_t)atoi(value);
         } else if (strcmp(key, "cpu_time_limit_ms") == 0) {
             config->limits.cpu_time_limit_ms = (size_t)atoi(value);
+        } else if (strcmp(key, "max_parallel_exec") == 0) {
+            config->limits.max_parallel_exec = (size_t)atoi(value);
+        } else if (strcmp(key, "data_cache_dir") == 0) {
+            xmd_free(config->paths.data_cache_dir);
+            config->paths.data_cache_dir = *value ? xmd_strdup(value) : NULL;
         } else if (strcmp(key, "enable_sandbox") == 0) {
             config->security.enable_sandbox = (strcmp(value, "true") == 0);
         }
@@ -69,8 +75,8 @@ int xmd_internal_config_load_file(xmd_internal_config* config, const char* file_
     fclose(file);
     
     // Store the config file path
-    free(config->config_file_path);
-    config->config_file_path = strdup(file_path);
+    xmd_free(config->config_file_path);
+    config->config_file_path = xmd_strdup(file_path);
     
     return 0;
 }
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load whitelist from environment variable
@@ -29,7 +30,7 @@ int xmd_internal_config_load_whitelist_env(xmd_internal_config* config, const ch
     }
     
     // Parse comma-separated list
-    char* env_copy = strdup(env_value);
+    char* env_copy = xmd_strdup(env_value);
     if (!env_copy) {
         return -1;
     }
@@ -43,9 +44,9 @@ int xmd_internal_config_load_whitelist_env(xmd_internal_config* config, const ch
     }
     
     // Allocate array for executable names
-    const char** executables = malloc(count * sizeof(char*));
+    const char** executables = xmd_malloc(count * sizeof(char*));
     if (!executables) {
-        free(env_copy);
+        xmd_free(env_copy);
         return -1;
     }
     
@@ -66,7 +67,7 @@ int xmd_internal_config_load_whitelist_env(xmd_internal_config* config, const ch
     // Set the whitelist
     int result = xmd_internal_config_set_exec_whitelist(config, executables, index);
     
-    free(executables);
-    free(env_copy);
+    xmd_free(executables);
+    xmd_free(env_copy);
     return result;
 }
@@ -7,13 +7,14 @@
  */
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new configuration with default values
  * @return New configuration instance or NULL on failure
  */
 xmd_internal_config* xmd_internal_config_new(void) {
-    xmd_internal_config* config = malloc(sizeof(xmd_internal_config));
+    xmd_internal_config* config = xmd_malloc(sizeof(xmd_internal_config));
     if (!config) {
         return NULL;
     }
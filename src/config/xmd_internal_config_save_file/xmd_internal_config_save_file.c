@@ -32,6 +32,7 @@ int xmd_internal_config_save_file(const xmd_internal_config* config, const char*
     fprintf(file, "max_output_size=%zu\n", config->limits.max_output_size);
     fprintf(file, "max_recursion_depth=%zu\n", config->limits.max_recursion_depth);
     fprintf(file, "max_loop_iterations=%zu\n", config->limits.max_loop_iterations);
+    fprintf(file, "max_parallel_exec=%zu\n", config->limits.max_parallel_exec);
     
     fprintf(file, "\n# Buffer Configuration\n");
     fprintf(file, "line_buffer_size=%zu\n", config->buffers.line_buffer_size);
@@ -39,6 +40,11 @@ int xmd_internal_config_save_file(const xmd_internal_config* config, const char*
     fprintf(file, "initial_store_capacity=%zu\n", config->buffers.initial_store_capacity);
     fprintf(file, "store_load_factor=%.3f\n", config->buffers.store_load_factor);
     
+    if (config->paths.data_cache_dir) {
+        fprintf(file, "\n# Paths\n");
+        fprintf(file, "data_cache_dir=%s\n", config->paths.data_cache_dir);
+    }
+    
     fprintf(file, "\n# Security Configuration\n");
     fprintf(file, "enable_sandbox=%s\n", config->security.enable_sandbox ? "true" : "false");
     fprintf(file, "allow_file_access=%s\n", config->security.allow_file_access ? "true" : "false");
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 
 #include "../../../include/config_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set complete executable whitelist (replaces existing)
@@ -26,9 +27,9 @@ int xmd_internal_config_set_exec_whitelist(xmd_internal_config* config, const ch
     
     // Free existing whitelist
     for (size_t i = 0; i < config->security.exec_whitelist_count; i++) {
-        free(config->security.exec_whitelist[i]);
+        xmd_free(config->security.exec_whitelist[i]);
     }
-    free(config->security.exec_whitelist);
+    xmd_free(config->security.exec_whitelist);
     
     // Set new whitelist
     if (count == 0 || !executables) {
@@ -37,20 +38,20 @@ int xmd_internal_config_set_exec_whitelist(xmd_internal_config* config, const ch
         return 0;
     }
     
-    config->security.exec_whitelist = malloc(count * sizeof(char*));
+    config->security.exec_whitelist = xmd_malloc(count * sizeof(char*));
     if (!config->security.exec_whitelist) {
         config->security.exec_whitelist_count = 0;
         return -1;
     }
     
     for (size_t i = 0; i < count; i++) {
-        config->security.exec_whitelist[i] = strdup(executables[i]);
+        config->security.exec_whitelist[i] = xmd_strdup(executables[i]);
         if (!config->security.exec_whitelist[i]) {
             // Cleanup on error
             for (size_t j = 0; j < i; j++) {
-                free(config->security.exec_whitelist[j]);
+                xmd_free(config->security.exec_whitelist[j]);
             }
-            free(config->security.exec_whitelist);
+            xmd_free(config->security.exec_whitelist);
             config->security.exec_whitelist = NULL;
             config->security.exec_whitelist_count = 0;
             return -1;
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add module to cycle path
@@ -22,14 +23,14 @@ int add_to_cycle_path(DependencyDetector* detector, const char* module_name) {
         return MODULE_ERROR;
     }
     
-    char** new_path = realloc(detector->cycle_path, 
+    char** new_path = xmd_realloc(detector->cycle_path, 
                              (detector->cycle_path_count + 1) * sizeof(char*));
     if (!new_path) {
         return MODULE_ERROR;
     }
     
     detector->cycle_path = new_path;
-    detector->cycle_path[detector->cycle_path_count] = strdup(module_name);
+    detector->cycle_path[detector->cycle_path_count] = xmd_strdup(module_name);
     
     if (!detector->cycle_path[detector->cycle_path_count]) {
         return MODULE_ERROR;
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Clear the current cycle path
@@ -19,9 +20,9 @@ void clear_cycle_path(DependencyDetector* detector) {
     }
     
     for (size_t i = 0; i < detector->cycle_path_count; i++) {
-        free(detector->cycle_path[i]);
+        xmd_free(detector->cycle_path[i]);
     }
-    free(detector->cycle_path);
+    xmd_free(detector->cycle_path);
     
     detector->cycle_path = NULL;
     detector->cycle_path_count = 0;
@@ -5,20 +5,62 @@
  * @date 2025-07-30
  */
 
-#include "dependency.h"
+#include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
- * Check if the dependency graph contains circular dependencies
+ * @brief Copy the cycle recorded by the graph into the detector
+ * @param detector Dependency detector
+ * @return MODULE_CIRCULAR_DEPENDENCY, or MODULE_ERROR on allocation failure
+ */
+static int copy_recorded_cycle(DependencyDetector* detector) {
+    DependencyGraph* graph = detector->graph;
+    detector->cycle_path = xmd_calloc(graph->cycle_length, sizeof(char*));
+    if (!detector->cycle_path) {
+        return MODULE_ERROR;
+    }
+    detector->cycle_path_count = graph->cycle_length;
+    for (size_t i = 0; i < graph->cycle_length; i++) {
+        detector->cycle_path[i] = xmd_strdup(graph->nodes[graph->cycle[i]]->module->name);
+        if (!detector->cycle_path[i]) {
+            clear_cycle_path(detector);
+            return MODULE_ERROR;
+        }
+    }
+    return MODULE_CIRCULAR_DEPENDENCY;
+}
+
+/**
+ * @brief Check if the dependency graph contains circular dependencies
+ *
+ * The graph tracks cycles as edges are added, so this normally only
+ * copies the recorded cycle. A graph that lost its order is searched
+ * depth-first from every node: O(modules + dependencies).
+ *
  * @param detector The dependency detector instance
- * @return 1 if circular dependencies found, 0 otherwise, -1 on error
+ * @return MODULE_SUCCESS, MODULE_CIRCULAR_DEPENDENCY (cycle path recorded)
+ *         or MODULE_ERROR
  */
 int dependency_check_circular(DependencyDetector* detector) {
-    if (!detector) {
-        return -1;
+    if (!detector || !detector->graph) {
+        return MODULE_ERROR;
     }
     
-    // For now, return no circular dependencies found
-    // This is a stub implementation to satisfy tests
-    // TODO: Implement actual circular dependency detection algorithm
-    return 0;
-}
\ No newline at end of file
+    clear_cycle_path(detector);
+    DependencyGraph* graph = detector->graph;
+    if (graph->cycle_length > 0) {
+        return copy_recorded_cycle(detector);
+    }
+    if (graph->order_valid) {
+        return MODULE_SUCCESS;
+    }
+    
+    reset_visit_states(graph);
+    for (size_t i = 0; i < graph->node_count; i++) {
+        int result = dfs_cycle_detection(detector, graph->nodes[i]);
+        if (result != MODULE_SUCCESS) {
+            return result;
+        }
+    }
+    return MODULE_SUCCESS;
+}
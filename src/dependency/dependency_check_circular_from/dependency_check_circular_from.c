@@ -5,21 +5,29 @@
  * @date 2025-07-30
  */
 
-#include "dependency.h"
+#include "../../../include/dependency.h"
 
 /**
- * Check for circular dependencies starting from a specific module
+ * @brief Check for circular dependencies starting from a specific module
  * @param detector The dependency detector instance
  * @param module_name The module to start checking from
- * @return 1 if circular dependencies found, 0 otherwise, -1 on error
+ * @return MODULE_SUCCESS, MODULE_CIRCULAR_DEPENDENCY (cycle path recorded),
+ *         MODULE_NOT_FOUND or MODULE_ERROR
  */
 int dependency_check_circular_from(DependencyDetector* detector, const char* module_name) {
-    if (!detector || !module_name) {
-        return -1;
+    if (!detector || !detector->graph || !module_name) {
+        return MODULE_ERROR;
+    }
+    
+    DependencyNode* node = dependency_graph_find_node(detector->graph, module_name);
+    if (!node) {
+        return MODULE_NOT_FOUND;
     }
     
-    // For now, return no circular dependencies found
-    // This is a stub implementation to satisfy tests
-    // TODO: Implement actual circular dependency detection algorithm
-    return 0;
-}
\ No newline at end of file
+    clear_cycle_path(detector);
+    if (detector->graph->order_valid && detector->graph->cycle_length == 0) {
+        return MODULE_SUCCESS; // No cycle anywhere in the graph
+    }
+    reset_visit_states(detector->graph);
+    return dfs_cycle_detection(detector, node);
+}
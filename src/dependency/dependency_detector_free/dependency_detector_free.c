@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a dependency detector
@@ -20,10 +21,10 @@ void dependency_detector_free(DependencyDetector* detector) {
     
     // Free cycle path
     for (size_t i = 0; i < detector->cycle_path_count; i++) {
-        free(detector->cycle_path[i]);
+        xmd_free(detector->cycle_path[i]);
     }
-    free(detector->cycle_path);
+    xmd_free(detector->cycle_path);
     
-    free(detector->last_error);
-    free(detector);
+    xmd_free(detector->last_error);
+    xmd_free(detector);
 }
\ No newline at end of file
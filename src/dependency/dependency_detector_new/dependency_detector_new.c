@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new dependency detector
@@ -20,7 +21,7 @@ DependencyDetector* dependency_detector_new(DependencyGraph* graph) {
         return NULL;
     }
     
-    DependencyDetector* detector = malloc(sizeof(DependencyDetector));
+    DependencyDetector* detector = xmd_malloc(sizeof(DependencyDetector));
     if (!detector) {
         return NULL;
     }
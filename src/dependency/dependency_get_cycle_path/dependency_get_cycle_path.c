@@ -5,25 +5,45 @@
  * @date 2025-07-30
  */
 
-#include "dependency.h"
 #include <stdlib.h>
+#include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
 
 /**
- * Get the path of a circular dependency cycle
+ * @brief Get the path of a circular dependency cycle
  * @param detector The dependency detector instance
- * @param path_buffer Buffer to store cycle path (caller must free)
+ * @param path_buffer Receives a copy of the cycle path (caller must free
+ *                    each name and the array), NULL if no cycle was found
  * @param path_length Output path length
- * @return 0 on success, -1 on error
+ * @return MODULE_SUCCESS or MODULE_ERROR
  */
 int dependency_get_cycle_path(DependencyDetector* detector, char*** path_buffer, size_t* path_length) {
     if (!detector || !path_buffer || !path_length) {
-        return -1;
+        return MODULE_ERROR;
     }
     
-    // For now, return no cycle found
-    // This is a stub implementation to satisfy tests
-    // TODO: Implement actual cycle path retrieval
     *path_buffer = NULL;
     *path_length = 0;
-    return 0;
-}
\ No newline at end of file
+    if (detector->cycle_path_count == 0) {
+        return MODULE_SUCCESS;
+    }
+    
+    char** path = xmd_calloc(detector->cycle_path_count, sizeof(char*));
+    if (!path) {
+        return MODULE_ERROR;
+    }
+    for (size_t i = 0; i < detector->cycle_path_count; i++) {
+        path[i] = xmd_strdup(detector->cycle_path[i]);
+        if (!path[i]) {
+            for (size_t j = 0; j < i; j++) {
+                xmd_free(path[j]);
+            }
+            xmd_free(path);
+            return MODULE_ERROR;
+        }
+    }
+    
+    *path_buffer = path;
+    *path_length = detector->cycle_path_count;
+    return MODULE_SUCCESS;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file dependency_load_modules.c
+ * @brief Load and compile modules over the dependency graph on worker threads
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+
+#include "../../../include/dependency_graph_internal.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Shared scheduler state
+ *
+ * Every field except graph, compile and user_data is guarded by lock.
+ */
+typedef struct {
+    DependencyGraph* graph;
+    dependency_compile_fn compile;
+    void* user_data;
+    size_t* in_degree;          /**< Dependencies not yet done, by node ID */
+    size_t* ready;              /**< Node IDs whose dependencies are all done */
+    size_t ready_head;
+    size_t ready_tail;
+    size_t remaining;           /**< Modules not yet done */
+    int* status;                /**< Outcome by node ID */
+    bool* blocked;              /**< A dependency failed, by node ID */
+    bool* read;                 /**< Content was read by this run, by node ID */
+    const bool* needed;         /**< Modules this run loads, by node ID (NULL for all) */
+    xmd_mutex_t lock;
+#ifndef XMD_PLATFORM_WINDOWS
+    pthread_cond_t changed;     /**< Signalled when ready grows or remaining hits 0 */
+#endif
+} module_scheduler;
+
+/**
+ * @brief Load and compile one module
+ * @param scheduler Scheduler
+ * @param module Module
+ * @param read Receives whether the file was read (missing files count)
+ * @return ModuleResult
+ */
+static int load_one(module_scheduler* scheduler, Module* module, bool* read) {
+    module->loading = true;
+    int result = module_load_content(module);
+    *read = result != MODULE_ALREADY_LOADED && result != MODULE_ERROR;
+    if (result == MODULE_ALREADY_LOADED) {
+        result = MODULE_SUCCESS;
+    }
+    if (result == MODULE_SUCCESS && scheduler->compile) {
+        result = scheduler->compile(module, scheduler->user_data);
+    }
+    module->loading = false;
+    return result;
+}
+
+/**
+ * @brief Worker loop: take ready modules until every module is done
+ *
+ * Also drains the whole graph when run alone on the calling thread: in an
+ * acyclic graph the ready queue only empties when nothing remains.
+ *
+ * @param arg Scheduler
+ * @return NULL
+ */
+static void* load_worker(void* arg) {
+    module_scheduler* scheduler = arg;
+    DependencyGraph* graph = scheduler->graph;
+
+    xmd_mutex_lock(&scheduler->lock);
+    for (;;) {
+        while (scheduler->ready_head == scheduler->ready_tail && scheduler->remaining > 0) {
+#ifndef XMD_PLATFORM_WINDOWS
+            pthread_cond_wait(&scheduler->changed, &scheduler->lock);
+#else
+            break;
+#endif
+        }
+        if (scheduler->ready_head == scheduler->ready_tail) {
+            break;
+        }
+        size_t id = scheduler->ready[scheduler->ready_head++];
+        bool blocked = scheduler->blocked[id];
+        xmd_mutex_unlock(&scheduler->lock);
+
+        bool read = false;
+        int result = blocked ? MODULE_ERROR : load_one(scheduler, graph->nodes[id]->module, &read);
+
+        xmd_mutex_lock(&scheduler->lock);
+        scheduler->status[id] = result;
+        scheduler->read[id] = read;
+        DependencyNode* node = graph->nodes[id];
+        for (size_t i = 0; i < node->child_count; i++) {
+            size_t child = node->children[i]->id;
+            if (child >= graph->node_count || graph->nodes[child] != node->children[i]) {
+                continue;
+            }
+            if (result != MODULE_SUCCESS) {
+                scheduler->blocked[child] = true;
+            }
+            if (--scheduler->in_degree[child] == 0 && (!scheduler->needed || scheduler->needed[child])) {
+                scheduler->ready[scheduler->ready_tail++] = child;
+            }
+        }
+        scheduler->remaining--;
+#ifndef XMD_PLATFORM_WINDOWS
+        pthread_cond_broadcast(&scheduler->changed);
+#endif
+    }
+    xmd_mutex_unlock(&scheduler->lock);
+    return NULL;
+}
+
+/**
+ * @brief Run the scheduler on up to max_parallel threads
+ * @param scheduler Initialized scheduler
+ * @param max_parallel Maximum number of worker threads
+ */
+static void run_workers(module_scheduler* scheduler, size_t max_parallel) {
+    size_t worker_count = max_parallel < scheduler->remaining ? max_parallel : scheduler->remaining;
+    if (worker_count < 2) {
+        load_worker(scheduler);
+        return;
+    }
+
+#ifndef XMD_PLATFORM_WINDOWS
+    xmd_thread_t* workers = xmd_malloc(worker_count * sizeof(xmd_thread_t));
+    size_t started = 0;
+    for (; workers && started < worker_count; started++) {
+        if (pthread_create(&workers[started], NULL, load_worker, scheduler) != 0) {
+            break;
+        }
+    }
+    if (started == 0) {
+        // No threads available: drain the graph on this thread
+        load_worker(scheduler);
+    }
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    xmd_free(workers);
+#else
+    load_worker(scheduler);
+#endif
+}
+
+/**
+ * @brief Mark a module and everything it depends on, directly or not
+ * @param graph Dependency graph built from the registry
+ * @param root Node ID of the module
+ * @param needed Set for each module reached (zeroed by the caller)
+ * @return MODULE_SUCCESS, MODULE_CIRCULAR_DEPENDENCY if the modules reached
+ *         form a cycle, or MODULE_ERROR
+ */
+static int mark_closure(DependencyGraph* graph, size_t root, bool* needed) {
+    size_t count = graph->node_count;
+    size_t* stack = xmd_malloc(count * sizeof(size_t));
+    size_t* next = xmd_calloc(count, sizeof(size_t));
+    bool* open = xmd_calloc(count, sizeof(bool));
+    if (!stack || !next || !open) {
+        xmd_free(stack);
+        xmd_free(next);
+        xmd_free(open);
+        return MODULE_ERROR;
+    }
+
+    int result = MODULE_SUCCESS;
+    size_t depth = 0;
+    stack[depth++] = root;
+    needed[root] = open[root] = true;
+    while (depth > 0 && result == MODULE_SUCCESS) {
+        size_t id = stack[depth - 1];
+        Module* module = graph->nodes[id]->module;
+        if (next[id] == module->dependency_count) {
+            open[id] = false;
+            depth--;
+            continue;
+        }
+        DependencyNode* dependency = dependency_graph_find_node(graph, module->dependencies[next[id]++]);
+        if (!dependency) {
+            continue; // Not registered: not part of the graph
+        }
+        if (open[dependency->id]) {
+            result = MODULE_CIRCULAR_DEPENDENCY;
+        } else if (!needed[dependency->id]) {
+            needed[dependency->id] = open[dependency->id] = true;
+            stack[depth++] = dependency->id;
+        }
+    }
+
+    xmd_free(stack);
+    xmd_free(next);
+    xmd_free(open);
+    return result;
+}
+
+/**
+ * @brief Load and compile a module's dependencies and itself, or every
+ *        registered module, in dependency order
+ * @param registry Module registry
+ * @param target Module to load, or NULL for all
+ * @param max_parallel Maximum number of modules in flight (0 or 1 loads on this thread)
+ * @param compile Compile step, or NULL to only load
+ * @param user_data Passed to compile
+ * @return MODULE_SUCCESS, MODULE_NOT_FOUND for an unknown target,
+ *         MODULE_CIRCULAR_DEPENDENCY before anything is loaded, or the
+ *         first failure in module ID order
+ */
+int dependency_load_modules(ModuleRegistry* registry, const char* target, size_t max_parallel,
+                            dependency_compile_fn compile, void* user_data) {
+    if (!registry) {
+        return MODULE_ERROR;
+    }
+    if (target && !module_registry_find(registry, target)) {
+        return MODULE_NOT_FOUND;
+    }
+
+    DependencyGraph* graph = NULL;
+    int result = dependency_build_graph(registry, &graph);
+    if (result != MODULE_SUCCESS) {
+        return result;
+    }
+    size_t count = graph->node_count;
+    bool* needed = NULL;
+    size_t needed_count = count;
+    if (target) {
+        // Only the target's dependencies matter; cycles elsewhere do not
+        needed = xmd_calloc(count, sizeof(bool));
+        DependencyNode* root = dependency_graph_find_node(graph, target);
+        result = needed && root ? mark_closure(graph, root->id, needed) : MODULE_ERROR;
+        needed_count = 0;
+        for (size_t i = 0; needed && i < count; i++) {
+            needed_count += needed[i];
+        }
+    } else {
+        result = dependency_graph_topological_sort(graph);
+    }
+    if (result != MODULE_SUCCESS || count == 0) {
+        xmd_free(needed);
+        dependency_graph_free(graph);
+        return result;
+    }
+
+    module_scheduler scheduler = {
+        .graph = graph,
+        .compile = compile,
+        .user_data = user_data,
+        .in_degree = xmd_malloc(count * sizeof(size_t)),
+        .ready = xmd_malloc(count * sizeof(size_t)),
+        .remaining = needed_count,
+        .status = xmd_malloc(count * sizeof(int)),
+        .blocked = xmd_calloc(count, sizeof(bool)),
+        .read = xmd_calloc(count, sizeof(bool)),
+        .needed = needed
+    };
+    bool ready = scheduler.in_degree && scheduler.ready && scheduler.status &&
+                 scheduler.blocked && scheduler.read &&
+                 calculate_in_degrees(graph, scheduler.in_degree) == MODULE_SUCCESS &&
+                 xmd_mutex_init(&scheduler.lock) == 0;
+#ifndef XMD_PLATFORM_WINDOWS
+    if (ready && pthread_cond_init(&scheduler.changed, NULL) != 0) {
+        xmd_mutex_destroy(&scheduler.lock);
+        ready = false;
+    }
+#endif
+
+    if (ready) {
+        for (size_t i = 0; i < count; i++) {
+            scheduler.status[i] = MODULE_ERROR;
+            if (scheduler.in_degree[i] == 0 && (!needed || needed[i])) {
+                scheduler.ready[scheduler.ready_tail++] = i;
+            }
+        }
+
+        // Workers have no recorder; the caller's is filled in ID order below
+        build_inputs* recorder = build_inputs_attach(NULL);
+        run_workers(&scheduler, max_parallel);
+        build_inputs_attach(recorder);
+
+#ifndef XMD_PLATFORM_WINDOWS
+        pthread_cond_destroy(&scheduler.changed);
+#endif
+        xmd_mutex_destroy(&scheduler.lock);
+
+        for (size_t i = 0; i < count; i++) {
+            Module* module = graph->nodes[i]->module;
+            if (scheduler.read[i]) {
+                build_inputs_record_file(module->path, module->content,
+                                         module->content ? strlen(module->content) : 0);
+            }
+            if (result == MODULE_SUCCESS && (!needed || needed[i]) && !scheduler.blocked[i] &&
+                scheduler.status[i] != MODULE_SUCCESS) {
+                result = scheduler.status[i];
+            }
+        }
+    } else {
+        result = MODULE_ERROR;
+    }
+
+    xmd_free(scheduler.in_degree);
+    xmd_free(scheduler.ready);
+    xmd_free(scheduler.status);
+    xmd_free(scheduler.blocked);
+    xmd_free(scheduler.read);
+    xmd_free(needed);
+    dependency_graph_free(graph);
+    return result;
+}
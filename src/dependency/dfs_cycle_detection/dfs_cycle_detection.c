@@ -0,0 +1,115 @@
+/**
+ * @file dfs_cycle_detection.c
+ * @brief Depth-first cycle search over a dependency graph
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/dependency.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief A node on the current search path and its next child to visit
+ */
+typedef struct {
+    DependencyNode* node;
+    size_t next;
+} dfs_frame;
+
+/**
+ * @brief Store the cycle closed by an edge back onto the search path
+ *
+ * Edges point from a dependency to its dependents, so the path is
+ * written backwards: each module is followed by one it depends on.
+ *
+ * @param detector Dependency detector
+ * @param stack Search path
+ * @param depth Search path length
+ * @param target Node on the path the last node leads back to
+ * @return MODULE_CIRCULAR_DEPENDENCY, or MODULE_ERROR on allocation failure
+ */
+static int record_cycle(DependencyDetector* detector, const dfs_frame* stack, size_t depth,
+                        const DependencyNode* target) {
+    size_t start = depth - 1;
+    while (stack[start].node != target) {
+        start--;
+    }
+    
+    size_t length = depth - start + 1;
+    clear_cycle_path(detector);
+    detector->cycle_path = xmd_calloc(length, sizeof(char*));
+    if (!detector->cycle_path) {
+        return MODULE_ERROR;
+    }
+    detector->cycle_path_count = length;
+    
+    detector->cycle_path[0] = xmd_strdup(target->module->name);
+    for (size_t i = 1; i < length - 1; i++) {
+        detector->cycle_path[i] = xmd_strdup(stack[depth - i].node->module->name);
+    }
+    detector->cycle_path[length - 1] = xmd_strdup(target->module->name);
+    for (size_t i = 0; i < length; i++) {
+        if (!detector->cycle_path[i]) {
+            clear_cycle_path(detector);
+            return MODULE_ERROR;
+        }
+    }
+    return MODULE_CIRCULAR_DEPENDENCY;
+}
+
+/**
+ * @brief Perform DFS cycle detection from a specific node
+ *
+ * Iterative, so deep dependency chains cannot overflow the call stack.
+ * Nodes left black by earlier searches are not visited again, so
+ * searching from every node of a graph takes linear time overall.
+ *
+ * @param detector Dependency detector
+ * @param node Starting node for DFS
+ * @return MODULE_SUCCESS if no cycle, MODULE_CIRCULAR_DEPENDENCY if cycle found
+ */
+int dfs_cycle_detection(DependencyDetector* detector, DependencyNode* node) {
+    if (!detector || !detector->graph || !node) {
+        return MODULE_ERROR;
+    }
+    if (node->visit_state != 0) {
+        return MODULE_SUCCESS;
+    }
+    
+    DependencyGraph* graph = detector->graph;
+    // Each node is on the path at most once
+    dfs_frame* stack = xmd_malloc(graph->node_count * sizeof(dfs_frame));
+    if (!stack) {
+        return MODULE_ERROR;
+    }
+    
+    int result = MODULE_SUCCESS;
+    size_t depth = 0;
+    node->visit_state = 1;
+    stack[depth++] = (dfs_frame){node, 0};
+    while (depth > 0) {
+        dfs_frame* top = &stack[depth - 1];
+        if (top->next == top->node->child_count) {
+            top->node->visit_state = 2; // Black (finished)
+            depth--;
+            continue;
+        }
+        
+        DependencyNode* child = top->node->children[top->next++];
+        if (child->id >= graph->node_count || graph->nodes[child->id] != child) {
+            continue; // Not part of this graph
+        }
+        if (child->visit_state == 0) {
+            child->visit_state = 1; // Gray (on the path)
+            stack[depth++] = (dfs_frame){child, 0};
+        } else if (child->visit_state == 1) {
+            result = record_cycle(detector, stack, depth, child);
+            break;
+        }
+    }
+    
+    xmd_free(stack);
+    return result;
+}
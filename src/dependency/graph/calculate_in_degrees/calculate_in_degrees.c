@@ -22,16 +22,14 @@ int calculate_in_degrees(DependencyGraph* graph, size_t* in_degree) {
         in_degree[i] = 0;
     }
     
-    // Count incoming edges for each node
+    // Count incoming edges for each node; children of this graph are
+    // addressed by their ID
     for (size_t i = 0; i < graph->node_count; i++) {
         DependencyNode* node = graph->nodes[i];
         for (size_t j = 0; j < node->child_count; j++) {
-            // Find the index of the child node
-            for (size_t k = 0; k < graph->node_count; k++) {
-                if (graph->nodes[k] == node->children[j]) {
-                    in_degree[k]++;
-                    break;
-                }
+            size_t child = node->children[j]->id;
+            if (child < graph->node_count && graph->nodes[child] == node->children[j]) {
+                in_degree[child]++;
             }
         }
     }
@@ -34,5 +34,12 @@ int dependency_graph_add_dependency(DependencyGraph* graph,
         return MODULE_NOT_FOUND;
     }
     
-    return dependency_node_add_child(dependency_node, dependent_node);
+    int result = dependency_node_add_child(dependency_node, dependent_node);
+    if (result != MODULE_SUCCESS) {
+        return result;
+    }
+    
+    // The edge is kept even if it closes a cycle; the graph records it
+    dependency_graph_order_edge(graph, dependency_node, dependent_node);
+    return MODULE_SUCCESS;
 }
\ No newline at end of file
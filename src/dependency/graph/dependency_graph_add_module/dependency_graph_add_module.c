@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Add module to dependency graph
@@ -18,22 +19,28 @@ int dependency_graph_add_module(DependencyGraph* graph, Module* module) {
     }
     
     // Check if module already exists
-    for (size_t i = 0; i < graph->node_count; i++) {
-        if (strcmp(graph->nodes[i]->module->name, module->name) == 0) {
-            return MODULE_ALREADY_LOADED;
-        }
+    if (name_index_find(&graph->index, module->name) != NAME_INDEX_NONE) {
+        return MODULE_ALREADY_LOADED;
     }
     
     // Expand capacity if needed
     if (graph->node_count >= graph->node_capacity) {
         size_t new_capacity = graph->node_capacity == 0 ? 8 : graph->node_capacity * 2;
-        DependencyNode** new_nodes = realloc(graph->nodes, 
+        DependencyNode** new_nodes = xmd_realloc(graph->nodes, 
                                             new_capacity * sizeof(DependencyNode*));
         if (!new_nodes) {
             return MODULE_ERROR;
         }
         
         graph->nodes = new_nodes;
+        
+        DependencyNode** new_order = xmd_realloc(graph->order,
+                                                 new_capacity * sizeof(DependencyNode*));
+        if (!new_order) {
+            return MODULE_ERROR;
+        }
+        
+        graph->order = new_order;
         graph->node_capacity = new_capacity;
     }
     
@@ -42,8 +49,16 @@ int dependency_graph_add_module(DependencyGraph* graph, Module* module) {
     if (!node) {
         return MODULE_ERROR;
     }
+    if (!name_index_insert(&graph->index, module->name, graph->node_count)) {
+        dependency_node_free(node);
+        return MODULE_ERROR;
+    }
     
+    // A new module has no dependents yet, so it can go last
+    node->id = graph->node_count;
+    node->order = graph->node_count;
     graph->nodes[graph->node_count] = node;
+    graph->order[graph->node_count] = node;
     graph->node_count++;
     
     return MODULE_SUCCESS;
@@ -18,11 +18,6 @@ DependencyNode* dependency_graph_find_node(DependencyGraph* graph,
         return NULL;
     }
     
-    for (size_t i = 0; i < graph->node_count; i++) {
-        if (strcmp(graph->nodes[i]->module->name, module_name) == 0) {
-            return graph->nodes[i];
-        }
-    }
-    
-    return NULL;
+    size_t id = name_index_find(&graph->index, module_name);
+    return id == NAME_INDEX_NONE ? NULL : graph->nodes[id];
 }
\ No newline at end of file
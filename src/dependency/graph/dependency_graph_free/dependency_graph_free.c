@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free a dependency graph
@@ -19,13 +20,16 @@ void dependency_graph_free(DependencyGraph* graph) {
     for (size_t i = 0; i < graph->node_count; i++) {
         dependency_node_free(graph->nodes[i]);
     }
-    free(graph->nodes);
+    xmd_free(graph->nodes);
     
     // Free load order
     for (size_t i = 0; i < graph->load_order_count; i++) {
-        free(graph->load_order[i]);
+        xmd_free(graph->load_order[i]);
     }
-    free(graph->load_order);
+    xmd_free(graph->load_order);
+    name_index_free(&graph->index);
+    xmd_free(graph->order);
+    xmd_free(graph->cycle);
     
-    free(graph);
+    xmd_free(graph);
 }
\ No newline at end of file
@@ -5,13 +5,14 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Create a new dependency graph
  * @return New dependency graph or NULL on error
  */
 DependencyGraph* dependency_graph_new(void) {
-    DependencyGraph* graph = malloc(sizeof(DependencyGraph));
+    DependencyGraph* graph = xmd_malloc(sizeof(DependencyGraph));
     if (!graph) {
         return NULL;
     }
@@ -21,6 +22,12 @@ DependencyGraph* dependency_graph_new(void) {
     graph->node_capacity = 0;
     graph->load_order = NULL;
     graph->load_order_count = 0;
+    graph->index = (name_index){0};
+    graph->order = NULL;
+    graph->order_valid = true;
+    graph->mark_epoch = 0;
+    graph->cycle = NULL;
+    graph->cycle_length = 0;
     
     return graph;
 }
\ No newline at end of file
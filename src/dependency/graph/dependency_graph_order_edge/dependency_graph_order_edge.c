@@ -0,0 +1,143 @@
+/**
+ * @file dependency_graph_order_edge.c
+ * @brief Keep the graph's topological order when an edge is added
+ * @author XMD Team
+ */
+
+#include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief A node on the current search path and its next child to visit
+ */
+typedef struct {
+    DependencyNode* node;
+    size_t next;
+} order_frame;
+
+/**
+ * @brief Record the cycle closed by an edge into the graph
+ *
+ * The search path runs from the dependent to the node before the
+ * dependency along dependency-to-dependent edges, so walking it backwards
+ * lists each module followed by one it depends on.
+ *
+ * @param graph Dependency graph
+ * @param dependency_node Dependency end of the new edge
+ * @param stack Search path, starting at the dependent end
+ * @param depth Search path length
+ * @return MODULE_CIRCULAR_DEPENDENCY, or MODULE_ERROR on allocation failure
+ */
+static int record_cycle(DependencyGraph* graph, const DependencyNode* dependency_node,
+                        const order_frame* stack, size_t depth) {
+    graph->cycle = xmd_malloc((depth + 2) * sizeof(size_t));
+    if (!graph->cycle) {
+        graph->order_valid = false;
+        return MODULE_ERROR;
+    }
+    graph->cycle[0] = dependency_node->id;
+    for (size_t i = 0; i < depth; i++) {
+        graph->cycle[i + 1] = stack[depth - 1 - i].node->id;
+    }
+    graph->cycle[depth + 1] = dependency_node->id;
+    graph->cycle_length = depth + 2;
+    return MODULE_CIRCULAR_DEPENDENCY;
+}
+
+/**
+ * @brief Keep the graph's topological order when an edge is added
+ *
+ * The dependency must come before its dependent. If it already does,
+ * nothing changes. Otherwise only the nodes placed from the dependent up
+ * to the dependency are involved: a search from the dependent over that
+ * range either reaches the dependency, closing a cycle, or finds the nodes
+ * that must move behind it. Those keep their relative order and are
+ * placed right after the nodes it did not reach (Marchetti-Spaccamela et
+ * al.), so the cost is bounded by the range, not the graph.
+ *
+ * A self-dependency is recorded as a cycle of one module.
+ *
+ * @param graph Dependency graph
+ * @param dependency_node Dependency end of the new edge
+ * @param dependent_node Dependent end of the new edge
+ * @return MODULE_SUCCESS, MODULE_CIRCULAR_DEPENDENCY if the edge closed
+ *         the graph's first cycle, or MODULE_ERROR if the order was lost
+ */
+int dependency_graph_order_edge(DependencyGraph* graph, DependencyNode* dependency_node,
+                                DependencyNode* dependent_node) {
+    if (!graph || !dependency_node || !dependent_node) {
+        return MODULE_ERROR;
+    }
+    if (!graph->order_valid || graph->cycle_length > 0) {
+        return MODULE_SUCCESS;
+    }
+
+    size_t lower = dependent_node->order;
+    size_t upper = dependency_node->order;
+    if (upper < lower) {
+        return MODULE_SUCCESS;
+    }
+    if (dependency_node == dependent_node) {
+        return record_cycle(graph, dependency_node, NULL, 0);
+    }
+
+    // Each node of the range is on the path or moved at most once
+    size_t span = upper - lower + 1;
+    order_frame* stack = xmd_malloc(span * sizeof(order_frame));
+    DependencyNode** moved = xmd_malloc(span * sizeof(DependencyNode*));
+    if (!stack || !moved) {
+        xmd_free(stack);
+        xmd_free(moved);
+        graph->order_valid = false;
+        return MODULE_ERROR;
+    }
+
+    size_t mark = ++graph->mark_epoch;
+    size_t depth = 0;
+    dependent_node->mark = mark;
+    stack[depth++] = (order_frame){dependent_node, 0};
+    while (depth > 0) {
+        order_frame* top = &stack[depth - 1];
+        if (top->next == top->node->child_count) {
+            depth--;
+            continue;
+        }
+
+        DependencyNode* child = top->node->children[top->next++];
+        if (child->id >= graph->node_count || graph->nodes[child->id] != child) {
+            continue; // Not part of this graph
+        }
+        if (child == dependency_node) {
+            int result = record_cycle(graph, dependency_node, stack, depth);
+            xmd_free(stack);
+            xmd_free(moved);
+            return result;
+        }
+        // Nodes placed after the dependency are already behind it
+        if (child->mark != mark && child->order <= upper) {
+            child->mark = mark;
+            stack[depth++] = (order_frame){child, 0};
+        }
+    }
+
+    // Unreached nodes, the dependency last among them, then the reached ones
+    size_t next = lower;
+    size_t moved_count = 0;
+    for (size_t position = lower; position <= upper; position++) {
+        DependencyNode* node = graph->order[position];
+        if (node->mark == mark) {
+            moved[moved_count++] = node;
+        } else {
+            node->order = next;
+            graph->order[next++] = node;
+        }
+    }
+    for (size_t i = 0; i < moved_count; i++) {
+        moved[i]->order = next;
+        graph->order[next++] = moved[i];
+    }
+
+    xmd_free(stack);
+    xmd_free(moved);
+    return MODULE_SUCCESS;
+}
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Generate topological sort order using Kahn's algorithm
@@ -22,9 +23,9 @@ int dependency_graph_topological_sort(DependencyGraph* graph) {
     
     // Free existing load order
     for (size_t i = 0; i < graph->load_order_count; i++) {
-        free(graph->load_order[i]);
+        xmd_free(graph->load_order[i]);
     }
-    free(graph->load_order);
+    xmd_free(graph->load_order);
     graph->load_order = NULL;
     graph->load_order_count = 0;
     
@@ -33,21 +34,21 @@ int dependency_graph_topological_sort(DependencyGraph* graph) {
     }
     
     // Calculate in-degrees
-    size_t* in_degree = malloc(graph->node_count * sizeof(size_t));
+    size_t* in_degree = xmd_malloc(graph->node_count * sizeof(size_t));
     if (!in_degree) {
         return MODULE_ERROR;
     }
     
     int result = calculate_in_degrees(graph, in_degree);
     if (result != MODULE_SUCCESS) {
-        free(in_degree);
+        xmd_free(in_degree);
         return result;
     }
     
     // Create queue for nodes with in-degree 0
-    size_t* queue = malloc(graph->node_count * sizeof(size_t));
+    size_t* queue = xmd_malloc(graph->node_count * sizeof(size_t));
     if (!queue) {
-        free(in_degree);
+        xmd_free(in_degree);
         return MODULE_ERROR;
     }
     
@@ -61,10 +62,10 @@ int dependency_graph_topological_sort(DependencyGraph* graph) {
     }
     
     // Initialize result array
-    graph->load_order = malloc(graph->node_count * sizeof(char*));
+    graph->load_order = xmd_malloc(graph->node_count * sizeof(char*));
     if (!graph->load_order) {
-        free(in_degree);
-        free(queue);
+        xmd_free(in_degree);
+        xmd_free(queue);
         return MODULE_ERROR;
     }
     
@@ -76,43 +77,38 @@ int dependency_graph_topological_sort(DependencyGraph* graph) {
         DependencyNode* node = graph->nodes[node_idx];
         
         // Add to result
-        graph->load_order[graph->load_order_count] = strdup(node->module->name);
+        graph->load_order[graph->load_order_count] = xmd_strdup(node->module->name);
         if (!graph->load_order[graph->load_order_count]) {
             // Cleanup on error
             for (size_t i = 0; i < graph->load_order_count; i++) {
-                free(graph->load_order[i]);
+                xmd_free(graph->load_order[i]);
             }
-            free(graph->load_order);
-            free(in_degree);
-            free(queue);
+            xmd_free(graph->load_order);
+            xmd_free(in_degree);
+            xmd_free(queue);
             return MODULE_ERROR;
         }
         graph->load_order_count++;
         
         // Reduce in-degree of all children
         for (size_t i = 0; i < node->child_count; i++) {
-            // Find child index
-            for (size_t j = 0; j < graph->node_count; j++) {
-                if (graph->nodes[j] == node->children[i]) {
-                    in_degree[j]--;
-                    if (in_degree[j] == 0) {
-                        queue[queue_end++] = j;
-                    }
-                    break;
-                }
+            size_t child = node->children[i]->id;
+            if (child < graph->node_count && graph->nodes[child] == node->children[i] &&
+                --in_degree[child] == 0) {
+                queue[queue_end++] = child;
             }
         }
     }
     
-    free(in_degree);
-    free(queue);
+    xmd_free(in_degree);
+    xmd_free(queue);
     
     // Check if all nodes were processed (no cycles)
     if (graph->load_order_count != graph->node_count) {
         for (size_t i = 0; i < graph->load_order_count; i++) {
-            free(graph->load_order[i]);
+            xmd_free(graph->load_order[i]);
         }
-        free(graph->load_order);
+        xmd_free(graph->load_order);
         graph->load_order = NULL;
         graph->load_order_count = 0;
         return MODULE_CIRCULAR_DEPENDENCY;
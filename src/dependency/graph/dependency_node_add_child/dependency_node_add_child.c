@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Add dependency to node
@@ -20,7 +21,7 @@ int dependency_node_add_child(DependencyNode* node, DependencyNode* dependency_n
     // Check if we need to expand capacity
     if (node->child_count >= node->child_capacity) {
         size_t new_capacity = node->child_capacity == 0 ? 4 : node->child_capacity * 2;
-        DependencyNode** new_children = realloc(node->children, 
+        DependencyNode** new_children = xmd_realloc(node->children, 
                                                new_capacity * sizeof(DependencyNode*));
         if (!new_children) {
             return MODULE_ERROR;
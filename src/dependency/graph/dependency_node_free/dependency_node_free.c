@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free a dependency node
@@ -16,6 +17,6 @@ void dependency_node_free(DependencyNode* node) {
     }
     
     // Note: We don't free the module itself as it's owned by the registry
-    free(node->children);
-    free(node);
+    xmd_free(node->children);
+    xmd_free(node);
 }
\ No newline at end of file
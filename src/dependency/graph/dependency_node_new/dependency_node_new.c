@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/dependency_graph_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Create a new dependency node
@@ -16,7 +17,7 @@ DependencyNode* dependency_node_new(Module* module) {
         return NULL;
     }
     
-    DependencyNode* node = malloc(sizeof(DependencyNode));
+    DependencyNode* node = xmd_malloc(sizeof(DependencyNode));
     if (!node) {
         return NULL;
     }
@@ -26,6 +27,9 @@ DependencyNode* dependency_node_new(Module* module) {
     node->child_count = 0;
     node->child_capacity = 0;
     node->visit_state = 0; // White (unvisited)
+    node->id = 0;
+    node->order = 0;
+    node->mark = 0;
     
     return node;
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <stdbool.h>
 #include <dirent.h>
 #include "../../../include/platform.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Generate API reference documentation from header files
@@ -49,12 +50,12 @@ int reference_generate(const char* include_dir, const char* output_file) {
     // First pass: generate table of contents
     while ((entry = readdir(dir)) != NULL) {
         if (entry->d_type == DT_REG && strstr(entry->d_name, ".h")) {
-            char* module_name = strdup(entry->d_name);
+            char* module_name = xmd_strdup(entry->d_name);
             char* dot = strrchr(module_name, '.');
             if (dot) *dot = '\0';
             
             fprintf(ref_file, "- [%s Module](#%s-module)\n", module_name, module_name);
-            free(module_name);
+            xmd_free(module_name);
             header_count++;
         }
     }
@@ -76,7 +77,7 @@ int reference_generate(const char* include_dir, const char* output_file) {
                 continue;
             }
             
-            char* module_name = strdup(entry->d_name);
+            char* module_name = xmd_strdup(entry->d_name);
             char* dot = strrchr(module_name, '.');
             if (dot) *dot = '\0';
             
@@ -139,7 +140,7 @@ int reference_generate(const char* include_dir, const char* output_file) {
             fprintf(ref_file, "---\n\n");
             
             fclose(header_file);
-            free(module_name);
+            xmd_free(module_name);
         }
     }
     
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/error.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free an error context
@@ -19,5 +20,5 @@ void error_context_free(ErrorContext* ctx) {
     }
     
     free_xmd_error(ctx->current_error);
-    free(ctx);
+    xmd_free(ctx);
 }
\ No newline at end of file
@@ -9,13 +9,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/error.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new error context
  * @return New error context or NULL on error
  */
 ErrorContext* error_context_new(void) {
-    ErrorContext* ctx = malloc(sizeof(ErrorContext));
+    ErrorContext* ctx = xmd_malloc(sizeof(ErrorContext));
     if (!ctx) {
         return NULL;
     }
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/error.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Throw an error
@@ -31,14 +32,14 @@ int error_throw(ErrorContext* ctx, ErrorType type, const char* message,
     free_xmd_error(ctx->current_error);
     
     // Create new error
-    XMDError* error = malloc(sizeof(XMDError));
+    XMDError* error = xmd_malloc(sizeof(XMDError));
     if (!error) {
         return -1;
     }
     
     error->type = type;
-    error->message = message ? strdup(message) : strdup("Unknown error");
-    error->file = file ? strdup(file) : strdup("unknown");
+    error->message = message ? xmd_strdup(message) : xmd_strdup("Unknown error");
+    error->file = file ? xmd_strdup(file) : xmd_strdup("unknown");
     error->line = line;
     
     ctx->current_error = error;
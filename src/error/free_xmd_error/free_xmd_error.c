@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/error.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free XMDError structure
@@ -18,7 +19,7 @@ void free_xmd_error(XMDError* error) {
         return;
     }
     
-    free(error->message);
-    free(error->file);
-    free(error);
+    xmd_free(error->message);
+    xmd_free(error->file);
+    xmd_free(error);
 }
\ No newline at end of file
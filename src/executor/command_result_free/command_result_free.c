@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/executor.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a command result
@@ -18,7 +19,7 @@ void command_result_free(CommandResult* result) {
         return;
     }
     
-    free(result->stdout_data);
-    free(result->stderr_data);
-    free(result);
+    xmd_free(result->stdout_data);
+    xmd_free(result->stderr_data);
+    xmd_free(result);
 }
\ No newline at end of file
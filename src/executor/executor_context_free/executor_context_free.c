@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/executor.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free an executor context
@@ -19,8 +20,8 @@ void executor_context_free(ExecutorContext* ctx) {
     }
     
     if (ctx->last_error) {
-        free(ctx->last_error);
+        xmd_free(ctx->last_error);
     }
     
-    free(ctx);
+    xmd_free(ctx);
 }
\ No newline at end of file
@@ -8,13 +8,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/executor.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new executor context
  * @return New executor context or NULL on error
  */
 ExecutorContext* executor_context_new(void) {
-    ExecutorContext* ctx = malloc(sizeof(ExecutorContext));
+    ExecutorContext* ctx = xmd_malloc(sizeof(ExecutorContext));
     if (!ctx) {
         return NULL;
     }
@@ -11,6 +11,7 @@
 #include <errno.h>
 #include "../../../include/platform.h"
 #include "../../../include/executor.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Cross-platform command execution using system()
@@ -48,7 +49,7 @@ int executor_run_command(ExecutorContext* ctx, const char* command, CommandResul
            exit_code, (unsigned long long)exec_time_ms);
     
     // Create result structure
-    CommandResult* cmd_result = malloc(sizeof(CommandResult));
+    CommandResult* cmd_result = xmd_malloc(sizeof(CommandResult));
     if (!cmd_result) {
         return EXECUTOR_ERROR;
     }
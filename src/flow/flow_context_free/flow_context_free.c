@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/flow.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a flow context
@@ -21,5 +22,5 @@ void flow_context_free(FlowContext* ctx) {
     if (ctx->return_value) {
         variable_unref(ctx->return_value);
     }
-    free(ctx);
+    xmd_free(ctx);
 }
\ No newline at end of file
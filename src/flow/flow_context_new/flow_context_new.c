@@ -8,13 +8,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/flow.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new flow context
  * @return New flow context or NULL on error
  */
 FlowContext* flow_context_new(void) {
-    FlowContext* ctx = malloc(sizeof(FlowContext));
+    FlowContext* ctx = xmd_malloc(sizeof(FlowContext));
     if (!ctx) {
         return NULL;
     }
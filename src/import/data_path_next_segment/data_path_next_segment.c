@@ -0,0 +1,34 @@
+/**
+ * @file data_path_next_segment.c
+ * @brief Tokenize data paths such as "users[2].name"
+ * @author XMD Team
+ */
+
+#include "../../../include/data_snapshot_internal.h"
+
+/**
+ * @brief Split the next segment off a data path
+ * @param cursor Path cursor (advanced past the segment)
+ * @param segment Set to the segment start
+ * @param length Set to the segment length
+ * @return false when the path is exhausted
+ */
+bool data_path_next_segment(const char** cursor, const char** segment, size_t* length) {
+    const char* p = *cursor;
+    while (*p == '.' || *p == '[' || *p == ']') {
+        p++;
+    }
+    if (*p == '\0') {
+        *cursor = p;
+        return false;
+    }
+
+    const char* start = p;
+    while (*p != '\0' && *p != '.' && *p != '[' && *p != ']') {
+        p++;
+    }
+    *segment = start;
+    *length = (size_t)(p - start);
+    *cursor = p;
+    return true;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file data_snapshot_close.c
+ * @brief Release a snapshot mapping
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+#ifndef XMD_PLATFORM_WINDOWS
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Release a snapshot; the mapping goes with the last view on it
+ * @param snapshot Snapshot handle
+ */
+void data_snapshot_close(data_snapshot* snapshot) {
+    if (!snapshot || --snapshot->ref_count > 0) {
+        return;
+    }
+    if (snapshot->data) {
+#ifndef XMD_PLATFORM_WINDOWS
+        if (snapshot->mapped) {
+            munmap((void*)snapshot->data, snapshot->size);
+        } else
+#endif
+        {
+            xmd_free((void*)snapshot->data);
+        }
+    }
+    xmd_free(snapshot);
+}
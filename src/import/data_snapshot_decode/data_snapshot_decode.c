@@ -0,0 +1,184 @@
+/**
+ * @file data_snapshot_decode.c
+ * @brief Decode a snapshot subtree into variables
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Table slot for a node offset: its entry, or the empty slot to fill
+ */
+static data_snapshot_decoded* decoded_slot(const data_snapshot_decoder* decoder, uint64_t offset) {
+    size_t mask = decoder->decoded_capacity - 1;
+    size_t index = (size_t)((offset >> 3) * 0x9e3779b97f4a7c15ULL) & mask;
+    while (decoder->decoded[index].offset && decoder->decoded[index].offset != offset) {
+        index = (index + 1) & mask;
+    }
+    return &decoder->decoded[index];
+}
+
+/**
+ * @brief Remember the variable decoded for a container node
+ * @return false on allocation failure
+ */
+static bool remember_decoded(data_snapshot_decoder* decoder, uint64_t offset, variable* value) {
+    if ((decoder->decoded_count + 1) * 2 > decoder->decoded_capacity) {
+        size_t capacity = decoder->decoded_capacity ? decoder->decoded_capacity * 2 : 64;
+        data_snapshot_decoded* old = decoder->decoded;
+        size_t old_capacity = decoder->decoded_capacity;
+        decoder->decoded = xmd_calloc(capacity, sizeof(data_snapshot_decoded));
+        if (!decoder->decoded) {
+            decoder->decoded = old;
+            return false;
+        }
+        decoder->decoded_capacity = capacity;
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old[i].offset) {
+                *decoded_slot(decoder, old[i].offset) = old[i];
+            }
+        }
+        xmd_free(old);
+    }
+    *decoded_slot(decoder, offset) = (data_snapshot_decoded){ offset, variable_ref(value) };
+    decoder->decoded_count++;
+    return true;
+}
+
+/**
+ * @brief Decode an array item, packing scalars without boxing them
+ */
+static bool decode_item(data_snapshot_decoder* decoder, variable* array, uint64_t offset, int depth) {
+    const data_snapshot* snapshot = decoder->snapshot;
+    data_snapshot_node node;
+    if (depth > DATA_SNAPSHOT_MAX_DEPTH || !data_snapshot_read_node(snapshot, offset, &node, NULL)) {
+        return false;
+    }
+    const unsigned char* body = snapshot->data + offset + sizeof(node);
+
+    switch (node.type) {
+        case VAR_BOOLEAN:
+            return variable_array_add_boolean(array, node.count != 0);
+        case VAR_NUMBER: {
+            double number;
+            memcpy(&number, body, sizeof(number));
+            return variable_array_add_number(array, number);
+        }
+        case VAR_STRING:
+            return variable_array_add_string(array, (const char*)body, node.count);
+        default: {
+            variable* item = data_snapshot_decode(decoder, offset, depth);
+            bool added = item && variable_array_add(array, item);
+            variable_unref(item);
+            return added;
+        }
+    }
+}
+
+/**
+ * @brief Decode a container node's children into a new array or object
+ */
+static variable* decode_container(data_snapshot_decoder* decoder, uint64_t offset,
+                                  const data_snapshot_node* node, int depth) {
+    const data_snapshot* snapshot = decoder->snapshot;
+    if (node->type == VAR_ARRAY) {
+        variable* array = variable_create_array_with_capacity(node->count);
+        for (uint32_t i = 0; array && i < node->count; i++) {
+            uint64_t child;
+            if (!data_snapshot_read_slot(snapshot, offset, i, &child) ||
+                !decode_item(decoder, array, child, depth + 1)) {
+                variable_unref(array);
+                return NULL;
+            }
+        }
+        return array;
+    }
+
+    variable* object = variable_create_object_with_capacity(node->count);
+    for (uint32_t i = 0; object && i < node->count; i++) {
+        uint64_t key_offset, child;
+        data_snapshot_node key;
+        variable* value = NULL;
+        if (data_snapshot_read_slot(snapshot, offset, (uint64_t)i * 2, &key_offset) &&
+            data_snapshot_read_slot(snapshot, offset, (uint64_t)i * 2 + 1, &child) &&
+            data_snapshot_read_node(snapshot, key_offset, &key, NULL) && key.type == VAR_STRING) {
+            value = data_snapshot_decode(decoder, child, depth + 1);
+        }
+        char* name = value ? xmd_malloc((size_t)key.count + 1) : NULL;
+        if (!name) {
+            variable_unref(value);
+            variable_unref(object);
+            return NULL;
+        }
+        memcpy(name, snapshot->data + key_offset + sizeof(key), key.count);
+        name[key.count] = '\0';
+        variable_object* pairs = object->value.object_value;
+        pairs->pairs[pairs->count].key = name;
+        pairs->pairs[pairs->count].value = value;
+        pairs->count++;
+    }
+    return object;
+}
+
+/**
+ * @brief Decode the node at an offset and everything below it
+ *
+ * Containers are decoded on first use and referenced again afterwards,
+ * so a subtree the writer shared is shared in the result too, and no
+ * file, however its offsets are arranged, decodes to more variables
+ * than it has nodes plus packed items.
+ *
+ * @param decoder Decoding state
+ * @param offset Node offset
+ * @param depth Current nesting depth
+ * @return New variable (caller unrefs), or NULL if corrupt
+ */
+variable* data_snapshot_decode(data_snapshot_decoder* decoder, uint64_t offset, int depth) {
+    const data_snapshot* snapshot = decoder->snapshot;
+    data_snapshot_node node;
+    if (depth > DATA_SNAPSHOT_MAX_DEPTH || !data_snapshot_read_node(snapshot, offset, &node, NULL)) {
+        return NULL;
+    }
+    const unsigned char* body = snapshot->data + offset + sizeof(node);
+
+    bool container = node.type == VAR_ARRAY || node.type == VAR_OBJECT;
+    if (container && decoder->decoded_count > 0) {
+        const data_snapshot_decoded* entry = decoded_slot(decoder, offset);
+        if (entry->offset) {
+            return variable_ref(entry->value);
+        }
+    }
+
+    variable* value;
+    switch (node.type) {
+        case VAR_NULL:
+            value = variable_create_null();
+            break;
+        case VAR_BOOLEAN:
+            value = variable_create_boolean(node.count != 0);
+            break;
+        case VAR_NUMBER: {
+            double number;
+            memcpy(&number, body, sizeof(number));
+            value = variable_create_number(number);
+            break;
+        }
+        case VAR_STRING:
+            value = variable_create_string_length((const char*)body, node.count);
+            break;
+        case VAR_ARRAY:
+        case VAR_OBJECT:
+            value = decode_container(decoder, offset, &node, depth);
+            break;
+        default:
+            return NULL;
+    }
+    if (value && container && !remember_decoded(decoder, offset, value)) {
+        variable_unref(value);
+        return NULL;
+    }
+    return value;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file data_snapshot_decoder_release.c
+ * @brief Release a snapshot decoder's table
+ * @author XMD Team
+ */
+
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Drop the decoder's references and free its table
+ * @param decoder Decoding state
+ */
+void data_snapshot_decoder_release(data_snapshot_decoder* decoder) {
+    if (!decoder) {
+        return;
+    }
+    for (size_t i = 0; i < decoder->decoded_capacity; i++) {
+        if (decoder->decoded[i].offset) {
+            variable_unref(decoder->decoded[i].value);
+        }
+    }
+    xmd_free(decoder->decoded);
+    decoder->decoded = NULL;
+    decoder->decoded_count = 0;
+    decoder->decoded_capacity = 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file data_snapshot_find.c
+ * @brief Navigate a mapped snapshot and view one subtree
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Source building the nodes of a snapshot on access
+ */
+typedef struct {
+    variable_source base;
+    data_snapshot* snapshot;        /**< Reference held until the last view goes */
+    data_snapshot_decoder shared;   /**< Subtrees the writer shared, decoded once */
+} snapshot_view;
+
+/**
+ * @brief Whether every child of an array node is a scalar
+ */
+static bool scalar_items(const data_snapshot* snapshot, uint64_t offset, const data_snapshot_node* node) {
+    for (uint32_t i = 0; i < node->count; i++) {
+        uint64_t child;
+        data_snapshot_node item;
+        if (!data_snapshot_read_slot(snapshot, offset, i, &child) ||
+            !data_snapshot_read_node(snapshot, child, &item, NULL) ||
+            item.type == VAR_ARRAY || item.type == VAR_OBJECT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Build the node at an offset of a snapshot
+ *
+ * Objects and arrays only record where their members are. A shared
+ * subtree is decoded whole through the view's table, so every parent
+ * gets the same variable and no alias is expanded twice; an array of
+ * scalars is decoded at once into packed storage.
+ *
+ * @param source Snapshot view
+ * @param position Node offset
+ * @return New variable or NULL if the node is corrupt
+ */
+static variable* build_node(variable_source* source, uint64_t position) {
+    snapshot_view* view = (snapshot_view*)source;
+    const data_snapshot* snapshot = view->snapshot;
+    data_snapshot_node node;
+    bool shared;
+    if (!data_snapshot_read_node(snapshot, position, &node, &shared)) {
+        return NULL;
+    }
+    if (shared || (node.type != VAR_ARRAY && node.type != VAR_OBJECT)) {
+        return data_snapshot_decode(&view->shared, position, 0);
+    }
+    if (node.type == VAR_ARRAY && scalar_items(snapshot, position, &node)) {
+        data_snapshot_decoder decoder = { snapshot, NULL, 0, 0 };
+        variable* array = data_snapshot_decode(&decoder, position, 0);
+        data_snapshot_decoder_release(&decoder);
+        return array;
+    }
+
+    if (node.type == VAR_ARRAY) {
+        variable* array = variable_create_array_with_capacity(node.count);
+        for (uint32_t i = 0; array && i < node.count; i++) {
+            uint64_t child;
+            if (!data_snapshot_read_slot(snapshot, position, i, &child) ||
+                !variable_array_defer(array, source, child)) {
+                variable_unref(array);
+                return NULL;
+            }
+        }
+        return array;
+    }
+
+    variable* object = variable_create_object_with_capacity(node.count);
+    for (uint32_t i = 0; object && i < node.count; i++) {
+        uint64_t key_offset, child;
+        data_snapshot_node key;
+        char* name = NULL;
+        if (data_snapshot_read_slot(snapshot, position, (uint64_t)i * 2, &key_offset) &&
+            data_snapshot_read_slot(snapshot, position, (uint64_t)i * 2 + 1, &child) &&
+            data_snapshot_read_node(snapshot, key_offset, &key, NULL) && key.type == VAR_STRING) {
+            name = xmd_malloc((size_t)key.count + 1);
+        }
+        if (!name) {
+            variable_unref(object);
+            return NULL;
+        }
+        memcpy(name, snapshot->data + key_offset + sizeof(key), key.count);
+        name[key.count] = '\0';
+        if (!variable_object_defer(object, source, name, child)) {
+            variable_unref(object);
+            return NULL;
+        }
+    }
+    return object;
+}
+
+/**
+ * @brief Release a snapshot view once no container draws from it
+ * @param source Snapshot view
+ */
+static void destroy_view(variable_source* source) {
+    snapshot_view* view = (snapshot_view*)source;
+    data_snapshot_decoder_release(&view->shared);
+    data_snapshot_close(view->snapshot);
+    xmd_free(view);
+}
+
+/**
+ * @brief Step from a container node to one member
+ * @param snapshot Snapshot
+ * @param offset Container offset (replaced by the member offset)
+ * @param segment Key or decimal index
+ * @param length Segment length
+ * @return false if the member does not exist
+ */
+static bool step(const data_snapshot* snapshot, uint64_t* offset, const char* segment, size_t length) {
+    data_snapshot_node node;
+    if (!data_snapshot_read_node(snapshot, *offset, &node, NULL)) {
+        return false;
+    }
+
+    if (node.type == VAR_ARRAY) {
+        uint64_t index = 0;
+        for (size_t i = 0; i < length; i++) {
+            if (segment[i] < '0' || segment[i] > '9' || index > UINT32_MAX) return false;
+            index = index * 10 + (uint64_t)(segment[i] - '0');
+        }
+        return length > 0 && index < node.count && data_snapshot_read_slot(snapshot, *offset, index, offset);
+    }
+    if (node.type != VAR_OBJECT) {
+        return false;
+    }
+    for (uint32_t i = 0; i < node.count; i++) {
+        uint64_t key_offset;
+        data_snapshot_node key;
+        if (!data_snapshot_read_slot(snapshot, *offset, (uint64_t)i * 2, &key_offset) ||
+            !data_snapshot_read_node(snapshot, key_offset, &key, NULL)) {
+            continue;
+        }
+        if (key.type == VAR_STRING && key.count == length &&
+            memcmp(snapshot->data + key_offset + sizeof(key), segment, length) == 0) {
+            return data_snapshot_read_slot(snapshot, *offset, (uint64_t)i * 2 + 1, offset);
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief View the value at a dotted path of a snapshot
+ * @param snapshot Snapshot handle
+ * @param path Path to the value ("" for the root)
+ * @return New variable (caller unrefs), or NULL if absent
+ */
+variable* data_snapshot_find(data_snapshot* snapshot, const char* path) {
+    if (!snapshot || !path) {
+        return NULL;
+    }
+    data_snapshot_header header;
+    memcpy(&header, snapshot->data, sizeof(header));
+
+    uint64_t offset = header.root_offset;
+    const char* cursor = path;
+    const char* segment;
+    size_t length;
+    while (data_path_next_segment(&cursor, &segment, &length)) {
+        if (!step(snapshot, &offset, segment, length)) {
+            return NULL;
+        }
+    }
+
+    snapshot_view* view = xmd_calloc(1, sizeof(snapshot_view));
+    if (!view) {
+        return NULL;
+    }
+    view->base.build = build_node;
+    view->base.destroy = destroy_view;
+    view->base.ref_count = 1;
+    view->snapshot = snapshot;
+    view->shared.snapshot = snapshot;
+    snapshot->ref_count++;
+
+    // Containers built from the view keep it; scalars let it go at once
+    variable* value = build_node(&view->base, offset);
+    variable_source_release(&view->base);
+    return value;
+}
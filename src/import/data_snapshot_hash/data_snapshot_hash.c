@@ -0,0 +1,44 @@
+/**
+ * @file data_snapshot_hash.c
+ * @brief Content hash used to key data snapshots
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/data_snapshot.h"
+
+/**
+ * @brief Hash content to key a snapshot
+ *
+ * FNV-1a over 8-byte words with a final avalanche; this is a cache key,
+ * not a cryptographic digest.
+ *
+ * @param data Bytes to hash
+ * @param length Number of bytes
+ * @param seed Seed distinguishing the source format
+ * @return 64-bit content hash
+ */
+uint64_t data_snapshot_hash(const void* data, size_t length, uint64_t seed) {
+    const unsigned char* bytes = data;
+    uint64_t hash = 0xcbf29ce484222325ULL ^ seed;
+    const uint64_t prime = 0x100000001b3ULL;
+
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 29;
+    }
+    for (; i < length; i++) {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+
+    hash ^= (uint64_t)length;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
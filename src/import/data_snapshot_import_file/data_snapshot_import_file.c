@@ -0,0 +1,205 @@
+/**
+ * @file data_snapshot_import_file.c
+ * @brief Import a data file through the snapshot cache
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/data_snapshot.h"
+#include "../../../include/json_parser.h"
+#include "../../../include/yaml_parser.h"
+#include "../../../include/platform.h"
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+#ifdef XMD_PLATFORM_WINDOWS
+#define getpid _getpid
+#endif
+
+#define SOURCE_STAMP_MAGIC "XMDSTMP"
+
+/**
+ * @brief What a source file looked like when its key was last computed
+ */
+typedef struct {
+    char magic[8];              /**< SOURCE_STAMP_MAGIC, NUL padded */
+    uint64_t device;            /**< st_dev */
+    uint64_t inode;             /**< st_ino (0 where the platform has none) */
+    uint64_t size;              /**< st_size */
+    int64_t modified;           /**< st_mtime */
+    int64_t stamped;            /**< When the key was computed */
+    data_snapshot_key key;      /**< Key of the content seen then */
+} source_stamp;
+
+/**
+ * @brief Read a whole file into a NUL-terminated buffer
+ * @param file_path File to read
+ * @param length Set to the content length
+ * @return Buffer (caller frees) or NULL on error
+ */
+static char* read_file(const char* file_path, size_t* length) {
+    FILE* file = fopen(file_path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* content = size >= 0 ? xmd_malloc((size_t)size + 1) : NULL;
+    if (content) {
+        *length = fread(content, 1, (size_t)size, file);
+        content[*length] = '\0';
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Whether a stamp describes the file as it is now
+ * @param stamp Stamp read from the cache
+ * @param info Current status of the file
+ * @return true if the stamped key can be used without reading the file
+ */
+static bool stamp_matches(const source_stamp* stamp, const struct stat* info) {
+    // A file modified in the second it was stamped may have changed again
+    // since without its mtime moving, so only earlier changes are trusted
+    return memcmp(stamp->magic, SOURCE_STAMP_MAGIC, sizeof(SOURCE_STAMP_MAGIC)) == 0 &&
+           stamp->device == (uint64_t)info->st_dev &&
+           stamp->inode == (uint64_t)info->st_ino &&
+           stamp->size == (uint64_t)info->st_size &&
+           stamp->modified == (int64_t)info->st_mtime &&
+           stamp->modified < stamp->stamped;
+}
+
+/**
+ * @brief Record the key computed for a file, if it did not change meanwhile
+ * @param stamp_path Stamp file
+ * @param before Status of the file before it was read
+ * @param file_path File the key was computed from
+ * @param key Key of the content read
+ */
+static void write_stamp(const char* stamp_path, const struct stat* before,
+                        const char* file_path, const data_snapshot_key* key) {
+    struct stat after;
+    if (stat(file_path, &after) != 0 || after.st_mtime != before->st_mtime ||
+        after.st_size != before->st_size || after.st_ino != before->st_ino) {
+        return;
+    }
+    source_stamp stamp;
+    memset(&stamp, 0, sizeof(stamp));
+    memcpy(stamp.magic, SOURCE_STAMP_MAGIC, sizeof(SOURCE_STAMP_MAGIC));
+    stamp.device = (uint64_t)before->st_dev;
+    stamp.inode = (uint64_t)before->st_ino;
+    stamp.size = (uint64_t)before->st_size;
+    stamp.modified = (int64_t)before->st_mtime;
+    stamp.stamped = (int64_t)time(NULL);
+    stamp.key = *key;
+
+    char temp_path[4096];
+    snprintf(temp_path, sizeof(temp_path), "%s.%ld.tmp", stamp_path, (long)getpid());
+    FILE* file = fopen(temp_path, "wb");
+    bool written = file && fwrite(&stamp, sizeof(stamp), 1, file) == 1;
+    if (file && fclose(file) != 0) {
+        written = false;
+    }
+    if (!written || xmd_replace_file(temp_path, stamp_path) != 0) {
+        remove(temp_path);
+    }
+}
+
+/**
+ * @brief View the root of the cached snapshot for a key
+ * @param cache_dir Snapshot directory
+ * @param key Source key
+ * @param snapshot_path Set to the snapshot file name
+ * @param size Size of snapshot_path
+ * @return Lazy view of the data, or NULL on a miss
+ */
+static variable* find_cached(const char* cache_dir, const data_snapshot_key* key,
+                             char* snapshot_path, size_t size) {
+    snprintf(snapshot_path, size, "%s/%016llx.xsnap", cache_dir, (unsigned long long)key->hash);
+    data_snapshot* snapshot = data_snapshot_open(snapshot_path, key);
+    variable* cached = snapshot ? data_snapshot_find(snapshot, "") : NULL;
+    data_snapshot_close(snapshot);
+    return cached;
+}
+
+/**
+ * @brief Import a data file through the snapshot cache
+ * @param file_path JSON or YAML file
+ * @param is_yaml Parse as YAML rather than JSON
+ * @param cache_dir Snapshot directory (created if missing)
+ * @param error_message Pointer to store error message (optional, caller frees)
+ * @return Imported data or NULL on error
+ */
+variable* data_snapshot_import_file(const char* file_path, bool is_yaml,
+                                    const char* cache_dir, char** error_message) {
+    if (!file_path || !cache_dir) {
+        return NULL;
+    }
+
+    // The format is part of every key: the same bytes may parse differently
+    uint64_t seed = is_yaml ? 2 : 1;
+    char snapshot_path[4096];
+    char stamp_path[4096];
+    snprintf(stamp_path, sizeof(stamp_path), "%s/%016llx.xstamp", cache_dir,
+             (unsigned long long)data_snapshot_hash(file_path, strlen(file_path), seed));
+
+    struct stat info;
+    bool stated = stat(file_path, &info) == 0;
+    if (stated) {
+        source_stamp stamp;
+        FILE* file = fopen(stamp_path, "rb");
+        bool stamped = file && fread(&stamp, sizeof(stamp), 1, file) == 1;
+        if (file) {
+            fclose(file);
+        }
+        variable* cached = stamped && stamp_matches(&stamp, &info)
+            ? find_cached(cache_dir, &stamp.key, snapshot_path, sizeof(snapshot_path)) : NULL;
+        if (cached) {
+            PERF_RECORD_CACHE_HIT(xmd_active_profiler);
+            return cached;
+        }
+    }
+
+    size_t length = 0;
+    char* content = read_file(file_path, &length);
+    if (!content) {
+        if (error_message) {
+            *error_message = xmd_strdup("Cannot read file");
+        }
+        return NULL;
+    }
+
+    data_snapshot_key key = data_snapshot_key_of(content, length, seed);
+    variable* cached = find_cached(cache_dir, &key, snapshot_path, sizeof(snapshot_path));
+    if (cached) {
+        PERF_RECORD_CACHE_HIT(xmd_active_profiler);
+        xmd_free(content);
+        if (stated) {
+            write_stamp(stamp_path, &info, file_path, &key);
+        }
+        return cached;
+    }
+    PERF_RECORD_CACHE_MISS(xmd_active_profiler);
+
+    variable* result = is_yaml ? yaml_parser_parse_string(content)
+                               : json_parser_parse_buffer(content, length);
+    xmd_free(content);
+    if (!result) {
+        if (error_message) {
+            *error_message = xmd_strdup(is_yaml ? "Failed to parse YAML file" : "Failed to parse JSON file");
+        }
+        return NULL;
+    }
+
+    // A failed cache write only costs the next import a reparse
+    xmd_mkdir(cache_dir);
+    if (data_snapshot_write(result, &key, snapshot_path) && stated) {
+        write_stamp(stamp_path, &info, file_path, &key);
+    }
+    return result;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file data_snapshot_key_of.c
+ * @brief Compute the snapshot key of source content
+ * @author XMD Team
+ */
+
+#include "../../../include/data_snapshot.h"
+
+/**
+ * @brief Compute the snapshot key of source content
+ *
+ * The check hash runs the same function from an unrelated starting
+ * state, so a source is only mistaken for another if both 64-bit hashes
+ * and the length collide at once.
+ *
+ * @param data Source bytes
+ * @param length Number of bytes
+ * @param seed Seed distinguishing the source format
+ * @return Key
+ */
+data_snapshot_key data_snapshot_key_of(const void* data, size_t length, uint64_t seed) {
+    data_snapshot_key key;
+    key.hash = data_snapshot_hash(data, length, seed);
+    key.check = data_snapshot_hash(data, length, ~seed * 0x9e3779b97f4a7c15ULL);
+    key.length = (uint64_t)length;
+    return key;
+}
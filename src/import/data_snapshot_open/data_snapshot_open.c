@@ -0,0 +1,86 @@
+/**
+ * @file data_snapshot_open.c
+ * @brief Map and validate a snapshot file
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+#ifndef XMD_PLATFORM_WINDOWS
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Map a snapshot file
+ * @param path Snapshot file
+ * @param key Expected source key (hash, check and length must all match)
+ * @return Snapshot handle, or NULL if missing, stale or corrupt
+ */
+data_snapshot* data_snapshot_open(const char* path, const data_snapshot_key* key) {
+    if (!path || !key) {
+        return NULL;
+    }
+    data_snapshot* snapshot = xmd_calloc(1, sizeof(data_snapshot));
+    if (!snapshot) {
+        return NULL;
+    }
+    snapshot->ref_count = 1;
+
+#ifndef XMD_PLATFORM_WINDOWS
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        xmd_free(snapshot);
+        return NULL;
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(data_snapshot_header)) {
+        void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            snapshot->data = mapping;
+            snapshot->size = (size_t)info.st_size;
+            snapshot->mapped = true;
+        }
+    }
+    close(fd);
+#else
+    FILE* file = fopen(path, "rb");
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        unsigned char* content = size > 0 ? xmd_malloc((size_t)size) : NULL;
+        if (content && fread(content, 1, (size_t)size, file) == (size_t)size) {
+            snapshot->data = content;
+            snapshot->size = (size_t)size;
+        } else {
+            xmd_free(content);
+        }
+        fclose(file);
+    }
+#endif
+
+    data_snapshot_header header;
+    if (!snapshot->data || snapshot->size < sizeof(header)) {
+        data_snapshot_close(snapshot);
+        return NULL;
+    }
+    memcpy(&header, snapshot->data, sizeof(header));
+    if (memcmp(header.magic, DATA_SNAPSHOT_MAGIC, sizeof(DATA_SNAPSHOT_MAGIC)) != 0 ||
+        header.version != DATA_SNAPSHOT_VERSION ||
+        header.byte_order != 0x01020304 ||
+        header.content_hash != key->hash ||
+        header.content_check != key->check ||
+        header.content_length != key->length ||
+        header.total_size != snapshot->size ||
+        header.root_offset < sizeof(header) ||
+        header.root_offset > snapshot->size - sizeof(data_snapshot_node)) {
+        data_snapshot_close(snapshot);
+        return NULL;
+    }
+    return snapshot;
+}
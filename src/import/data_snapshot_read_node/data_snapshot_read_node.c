@@ -0,0 +1,43 @@
+/**
+ * @file data_snapshot_read_node.c
+ * @brief Read a snapshot node header
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+
+/**
+ * @brief Bytes following a node header for its fixed part
+ */
+static uint64_t fixed_size(const data_snapshot_node* node) {
+    switch (node->type) {
+        case VAR_NUMBER: return sizeof(double);
+        case VAR_STRING: return (uint64_t)node->count + 1;
+        case VAR_ARRAY: return (uint64_t)node->count * 8;
+        case VAR_OBJECT: return (uint64_t)node->count * 16;
+        default: return 0;
+    }
+}
+
+/**
+ * @brief Read the node at an offset, checking that it lies inside the file
+ * @param snapshot Snapshot
+ * @param offset Node offset
+ * @param node Output header, its type without DATA_SNAPSHOT_SHARED
+ * @param shared Set to whether the writer shared the node (optional)
+ * @return false if the node or its fixed part is out of bounds
+ */
+bool data_snapshot_read_node(const data_snapshot* snapshot, uint64_t offset,
+                             data_snapshot_node* node, bool* shared) {
+    if (offset % 8 != 0 || offset > snapshot->size ||
+        snapshot->size - offset < sizeof(*node)) {
+        return false;
+    }
+    memcpy(node, snapshot->data + offset, sizeof(*node));
+    if (shared) {
+        *shared = (node->type & DATA_SNAPSHOT_SHARED) != 0;
+    }
+    node->type &= ~DATA_SNAPSHOT_SHARED;
+    return snapshot->size - offset - sizeof(*node) >= fixed_size(node);
+}
@@ -0,0 +1,27 @@
+/**
+ * @file data_snapshot_read_slot.c
+ * @brief Resolve a child offset of a snapshot container
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+
+/**
+ * @brief Resolve the n-th relative offset slot of a container node
+ * @param snapshot Snapshot
+ * @param node Container offset, already read
+ * @param slot Slot index (8-byte units after the header)
+ * @param target Output absolute offset
+ * @return false if the offset does not point backward past the file header
+ */
+bool data_snapshot_read_slot(const data_snapshot* snapshot, uint64_t node, uint64_t slot,
+                             uint64_t* target) {
+    uint64_t relative;
+    memcpy(&relative, snapshot->data + node + sizeof(data_snapshot_node) + slot * 8, sizeof(relative));
+    if (relative == 0 || relative > node - sizeof(data_snapshot_header)) {
+        return false;
+    }
+    *target = node - relative;
+    return true;
+}
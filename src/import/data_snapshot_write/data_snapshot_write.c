@@ -0,0 +1,329 @@
+/**
+ * @file data_snapshot_write.c
+ * @brief Serialize a variable tree to a snapshot file
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/data_snapshot_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+#ifdef XMD_PLATFORM_WINDOWS
+#define getpid _getpid
+#endif
+
+/**
+ * @brief A shared value already written, by address
+ */
+typedef struct {
+    const variable* value;
+    size_t offset;
+} written_value;
+
+/**
+ * @brief Growable output buffer
+ */
+typedef struct {
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+    written_value* written;     /**< Open-addressed table of shared values written */
+    size_t written_count;
+    size_t written_capacity;    /**< Power of two, or 0 */
+} snapshot_buffer;
+
+/**
+ * @brief Append zeroed space at the next 8-byte boundary
+ * @param buffer Output buffer
+ * @param bytes Bytes to reserve
+ * @param offset Set to the start of the reserved space
+ * @return false on allocation failure
+ */
+static bool reserve(snapshot_buffer* buffer, size_t bytes, size_t* offset) {
+    size_t start = (buffer->size + 7) & ~(size_t)7;
+    size_t end = start + bytes;
+    if (end > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (capacity < end) {
+            capacity *= 2;
+        }
+        unsigned char* data = xmd_realloc(buffer->data, capacity);
+        if (!data) {
+            return false;
+        }
+        buffer->data = data;
+        buffer->capacity = capacity;
+    }
+    memset(buffer->data + buffer->size, 0, end - buffer->size);
+    buffer->size = end;
+    *offset = start;
+    return true;
+}
+
+/**
+ * @brief Table slot for a value: its entry, or the empty slot to fill
+ */
+static written_value* written_slot(const snapshot_buffer* buffer, const variable* value) {
+    size_t mask = buffer->written_capacity - 1;
+    size_t index = (size_t)(((uintptr_t)value >> 4) * 0x9e3779b97f4a7c15ULL) & mask;
+    while (buffer->written[index].value && buffer->written[index].value != value) {
+        index = (index + 1) & mask;
+    }
+    return &buffer->written[index];
+}
+
+/**
+ * @brief Remember where a shared value was written
+ * @return false on allocation failure
+ */
+static bool remember_written(snapshot_buffer* buffer, const variable* value, size_t offset) {
+    if ((buffer->written_count + 1) * 2 > buffer->written_capacity) {
+        size_t capacity = buffer->written_capacity ? buffer->written_capacity * 2 : 64;
+        written_value* old = buffer->written;
+        size_t old_capacity = buffer->written_capacity;
+        buffer->written = xmd_calloc(capacity, sizeof(written_value));
+        if (!buffer->written) {
+            buffer->written = old;
+            return false;
+        }
+        buffer->written_capacity = capacity;
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old[i].value) {
+                *written_slot(buffer, old[i].value) = old[i];
+            }
+        }
+        xmd_free(old);
+    }
+    *written_slot(buffer, value) = (written_value){ value, offset };
+    buffer->written_count++;
+    return true;
+}
+
+/**
+ * @brief Write a node header
+ */
+static void put_node(snapshot_buffer* buffer, size_t offset, uint32_t type, uint32_t count) {
+    data_snapshot_node node = { type, count };
+    memcpy(buffer->data + offset, &node, sizeof(node));
+}
+
+/**
+ * @brief Write a relative offset slot
+ */
+static void put_offset(snapshot_buffer* buffer, size_t slot, size_t node, size_t target) {
+    uint64_t relative = (uint64_t)(node - target);
+    memcpy(buffer->data + slot, &relative, sizeof(relative));
+}
+
+/**
+ * @brief Encode a string node
+ */
+static bool encode_string(snapshot_buffer* buffer, const char* text, size_t* offset) {
+    size_t length = text ? strlen(text) : 0;
+    if (length > UINT32_MAX || !reserve(buffer, sizeof(data_snapshot_node) + length + 1, offset)) {
+        return false;
+    }
+    put_node(buffer, *offset, VAR_STRING, (uint32_t)length);
+    if (length > 0) {
+        memcpy(buffer->data + *offset + sizeof(data_snapshot_node), text, length);
+    }
+    return true;
+}
+
+static bool encode(snapshot_buffer* buffer, const variable* value, int depth, size_t* offset);
+
+/**
+ * @brief Encode an array item, reading packed items from their storage
+ */
+static bool encode_item(snapshot_buffer* buffer, const variable* owner, size_t index, int depth,
+                        size_t* offset) {
+    const variable_array* array = owner->value.array_value;
+    if (depth > DATA_SNAPSHOT_MAX_DEPTH) {
+        return false;
+    }
+    const size_t header = sizeof(data_snapshot_node);
+
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS:
+        case VAR_ARRAY_RANGE: {
+            double number = array->kind == VAR_ARRAY_NUMBERS ? array->packed.numbers[index]
+                : array->packed.range.start + (double)index * array->packed.range.step;
+            if (!reserve(buffer, header + sizeof(double), offset)) return false;
+            put_node(buffer, *offset, VAR_NUMBER, 0);
+            memcpy(buffer->data + *offset + header, &number, sizeof(double));
+            return true;
+        }
+        case VAR_ARRAY_BOOLEANS:
+            if (!reserve(buffer, header, offset)) return false;
+            put_node(buffer, *offset, VAR_BOOLEAN, (uint32_t)((array->packed.bits[index / 64] >> (index % 64)) & 1));
+            return true;
+        case VAR_ARRAY_STRINGS: {
+            const size_t* offsets = array->packed.strings.offsets;
+            size_t length = offsets[index + 1] - offsets[index] - 1;
+            if (length > UINT32_MAX || !reserve(buffer, header + length + 1, offset)) return false;
+            put_node(buffer, *offset, VAR_STRING, (uint32_t)length);
+            memcpy(buffer->data + *offset + header, array->packed.strings.text + offsets[index], length);
+            return true;
+        }
+        case VAR_ARRAY_SOURCE:
+            return encode(buffer, variable_array_get(owner, index), depth, offset);
+        default:
+            return encode(buffer, array->items[index], depth, offset);
+    }
+}
+
+/**
+ * @brief Encode a container: children first, then the node pointing back at them
+ * @param buffer Output buffer
+ * @param value Array or object
+ * @param depth Current nesting depth
+ * @param offset Set to the node offset
+ * @return false on failure
+ */
+static bool encode_container(snapshot_buffer* buffer, const variable* value, int depth, size_t* offset) {
+    const size_t header = sizeof(data_snapshot_node);
+    bool is_array = value->type == VAR_ARRAY;
+    const variable_array* array = value->value.array_value;
+    const variable_object* object = value->value.object_value;
+    size_t count = is_array ? (array ? array->count : 0) : (object ? object->count : 0);
+    size_t slots = is_array ? count : count * 2;
+    if (count > UINT32_MAX) {
+        return false;
+    }
+
+    size_t* children = slots > 0 ? xmd_malloc(slots * sizeof(size_t)) : NULL;
+    bool encoded = slots == 0 || children;
+    for (size_t i = 0; encoded && i < count; i++) {
+        encoded = is_array ? encode_item(buffer, value, i, depth + 1, &children[i])
+            : encode_string(buffer, object->pairs[i].key, &children[i * 2]) &&
+              encode(buffer, object->pairs[i].value ? object->pairs[i].value
+                                                    : variable_object_get(value, object->pairs[i].key),
+                     depth + 1, &children[i * 2 + 1]);
+    }
+    if (!encoded || !reserve(buffer, header + slots * 8, offset)) {
+        xmd_free(children);
+        return false;
+    }
+    put_node(buffer, *offset, is_array ? VAR_ARRAY : VAR_OBJECT, (uint32_t)count);
+    for (size_t i = 0; i < slots; i++) {
+        put_offset(buffer, *offset + header + i * 8, *offset, children[i]);
+    }
+    xmd_free(children);
+    return true;
+}
+
+/**
+ * @brief Encode a value and its children
+ *
+ * A value referenced from several places (YAML aliases share the anchored
+ * subtree) is written once and later references point back at it, so
+ * output stays linear in the number of distinct values.
+ *
+ * @param buffer Output buffer
+ * @param value Value to encode
+ * @param depth Current nesting depth
+ * @param offset Set to the node offset
+ * @return false on failure
+ */
+static bool encode(snapshot_buffer* buffer, const variable* value, int depth, size_t* offset) {
+    if (depth > DATA_SNAPSHOT_MAX_DEPTH) {
+        return false;
+    }
+    const size_t header = sizeof(data_snapshot_node);
+
+    bool shared = value && value->ref_count > 1;
+    if (shared && buffer->written_count > 0) {
+        const written_value* entry = written_slot(buffer, value);
+        if (entry->value) {
+            *offset = entry->offset;
+            return true;
+        }
+    }
+
+    bool encoded;
+    switch (value ? value->type : VAR_NULL) {
+        case VAR_BOOLEAN:
+            encoded = reserve(buffer, header, offset);
+            if (encoded) put_node(buffer, *offset, VAR_BOOLEAN, value->value.boolean_value ? 1 : 0);
+            break;
+        case VAR_NUMBER:
+            encoded = reserve(buffer, header + sizeof(double), offset);
+            if (encoded) {
+                put_node(buffer, *offset, VAR_NUMBER, 0);
+                memcpy(buffer->data + *offset + header, &value->value.number_value, sizeof(double));
+            }
+            break;
+        case VAR_STRING:
+            encoded = encode_string(buffer, value->value.string_value, offset);
+            break;
+        case VAR_ARRAY:
+        case VAR_OBJECT:
+            encoded = encode_container(buffer, value, depth, offset);
+            break;
+        default:
+            encoded = reserve(buffer, header, offset);
+            if (encoded) put_node(buffer, *offset, VAR_NULL, 0);
+            break;
+    }
+    if (encoded && shared) {
+        // Readers decode a shared node once instead of lazily per parent
+        data_snapshot_node node;
+        memcpy(&node, buffer->data + *offset, sizeof(node));
+        put_node(buffer, *offset, node.type | DATA_SNAPSHOT_SHARED, node.count);
+        encoded = remember_written(buffer, value, *offset);
+    }
+    return encoded;
+}
+
+/**
+ * @brief Serialize a variable tree to a snapshot file
+ * @param value Tree to serialize
+ * @param key Key of the source the tree was parsed from
+ * @param path Destination file
+ * @return true on success
+ */
+bool data_snapshot_write(const variable* value, const data_snapshot_key* key, const char* path) {
+    if (!key || !path) {
+        return false;
+    }
+
+    snapshot_buffer buffer = { 0 };
+    size_t header_offset, root;
+    bool encoded = reserve(&buffer, sizeof(data_snapshot_header), &header_offset) &&
+                   encode(&buffer, value, 0, &root);
+    xmd_free(buffer.written);
+    if (!encoded) {
+        xmd_free(buffer.data);
+        return false;
+    }
+
+    data_snapshot_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DATA_SNAPSHOT_MAGIC, sizeof(DATA_SNAPSHOT_MAGIC));
+    header.version = DATA_SNAPSHOT_VERSION;
+    header.byte_order = 0x01020304;
+    header.content_hash = key->hash;
+    header.content_check = key->check;
+    header.content_length = key->length;
+    header.root_offset = root;
+    header.total_size = buffer.size;
+    memcpy(buffer.data, &header, sizeof(header));
+
+    char temp_path[4096];
+    snprintf(temp_path, sizeof(temp_path), "%s.%ld.tmp", path, (long)getpid());
+    FILE* file = fopen(temp_path, "wb");
+    bool written = file && fwrite(buffer.data, 1, buffer.size, file) == buffer.size;
+    if (file && fclose(file) != 0) {
+        written = false;
+    }
+    xmd_free(buffer.data);
+
+    if (!written || xmd_replace_file(temp_path, path) != 0) {
+        remove(temp_path);
+        return false;
+    }
+    return true;
+}
@@ -12,6 +12,7 @@
 #include "../../../include/xmd.h"
 #include "../../../include/xmd_processor_internal.h"
 #include "../../../include/store.h"
+#include "../../../include/allocator.h"
 
 // Forward declarations
 extern variable* unified_data_converter_import_file(const char* file_path, char** error_message);
@@ -36,7 +37,7 @@ int import_json_file(xmd_processor* processor, const char* file_path, const char
         // Log error if available
         if (error_message != NULL) {
             fprintf(stderr, "Error importing JSON: %s\n", error_message);
-            free(error_message);
+            xmd_free(error_message);
         }
         return -1;
     }
@@ -71,7 +72,7 @@ int import_json_string(xmd_processor* processor, const char* json_string, const
         // Log error if available
         if (error_message != NULL) {
             fprintf(stderr, "Error importing JSON: %s\n", error_message);
-            free(error_message);
+            xmd_free(error_message);
         }
         return -1;
     }
@@ -123,7 +124,7 @@ bool validate_json_string(const char* json_string) {
         return true;
     } else {
         if (error_message != NULL) {
-            free(error_message);
+            xmd_free(error_message);
         }
         return false;
     }
@@ -11,12 +11,12 @@
 #include <string.h>
 #include "../../../include/variable.h"
 #include "../../../include/xmd.h"
-
-// Forward declarations for parser functions
-extern variable* json_parser_parse_file(const char* file_path);
-extern variable* yaml_parser_parse_file(const char* file_path);
-extern variable* json_parser_parse_string(const char* json_string);
-extern variable* yaml_parser_parse_string(const char* yaml_string);
+#include "../../../include/json_parser.h"
+#include "../../../include/yaml_parser.h"
+#include "../../../include/data_snapshot.h"
+#include "../../../include/config.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 // Forward declarations for file type detection
 typedef enum {
@@ -39,59 +39,51 @@ extern const char* file_type_to_string(import_file_type_t type);
 variable* unified_data_converter_import_file(const char* file_path, char** error_message) {
     if (file_path == NULL) {
         if (error_message) {
-            *error_message = strdup("File path is NULL");
+            *error_message = xmd_strdup("File path is NULL");
         }
         return NULL;
     }
     
-    // DEBUG: Print file path
-    printf("DEBUG CONVERTER: Importing file [%s]\n", file_path);
-    fflush(stdout);
+    build_inputs_record_path(file_path);
     
     // Detect file type
     import_file_type_t file_type = detect_file_type(file_path);
     
-    // DEBUG: Print detected file type
-    printf("DEBUG CONVERTER: Detected file type [%d]\n", file_type);
-    fflush(stdout);
-    
     if (!is_structured_data_type(file_type)) {
-        printf("DEBUG CONVERTER: File type not structured data\n");
-        fflush(stdout);
         if (error_message) {
-            *error_message = strdup("File is not a supported structured data format (JSON or YAML)");
+            *error_message = xmd_strdup("File is not a supported structured data format (JSON or YAML)");
         }
         return NULL;
     }
     
+    // Reuse a binary snapshot of an unchanged file when a cache is configured
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    if (config && config->paths.data_cache_dir) {
+        return data_snapshot_import_file(file_path, file_type == FILE_TYPE_YAML,
+                                         config->paths.data_cache_dir, error_message);
+    }
+    
     variable* result = NULL;
     
     switch (file_type) {
         case FILE_TYPE_JSON:
-            printf("DEBUG CONVERTER: Calling JSON parser\n");
-            fflush(stdout);
-            result = json_parser_parse_file(file_path);
-            printf("DEBUG CONVERTER: JSON parser returned [%p]\n", (void*)result);
-            fflush(stdout);
+            // Only the parts of the file a template reads become variables
+            result = json_parser_parse_file_lazy(file_path);
             if (result == NULL && error_message) {
-                *error_message = strdup("Failed to parse JSON file");
+                *error_message = xmd_strdup("Failed to parse JSON file");
             }
             break;
             
         case FILE_TYPE_YAML:
-            printf("DEBUG CONVERTER: Calling YAML parser\n");
-            fflush(stdout);
             result = yaml_parser_parse_file(file_path);
-            printf("DEBUG CONVERTER: YAML parser returned [%p]\n", (void*)result);
-            fflush(stdout);
             if (result == NULL && error_message) {
-                *error_message = strdup("Failed to parse YAML file");
+                *error_message = xmd_strdup("Failed to parse YAML file");
             }
             break;
             
         default:
             if (error_message) {
-                *error_message = strdup("Unsupported file type");
+                *error_message = xmd_strdup("Unsupported file type");
             }
             break;
     }
@@ -109,7 +101,7 @@ variable* unified_data_converter_import_file(const char* file_path, char** error
 variable* unified_data_converter_import_string(const char* data_string, const char* format_hint, char** error_message) {
     if (data_string == NULL) {
         if (error_message) {
-            *error_message = strdup("Data string is NULL");
+            *error_message = xmd_strdup("Data string is NULL");
         }
         return NULL;
     }
@@ -121,16 +113,16 @@ variable* unified_data_converter_import_string(const char* data_string, const ch
         if (strcmp(format_hint, "json") == 0) {
             result = json_parser_parse_string(data_string);
             if (result == NULL && error_message) {
-                *error_message = strdup("Failed to parse JSON string");
+                *error_message = xmd_strdup("Failed to parse JSON string");
             }
         } else if (strcmp(format_hint, "yaml") == 0 || strcmp(format_hint, "yml") == 0) {
             result = yaml_parser_parse_string(data_string);
             if (result == NULL && error_message) {
-                *error_message = strdup("Failed to parse YAML string");
+                *error_message = xmd_strdup("Failed to parse YAML string");
             }
         } else {
             if (error_message) {
-                *error_message = strdup("Unsupported format hint");
+                *error_message = xmd_strdup("Unsupported format hint");
             }
         }
     } else {
@@ -141,7 +133,7 @@ variable* unified_data_converter_import_string(const char* data_string, const ch
             // Try YAML
             result = yaml_parser_parse_string(data_string);
             if (result == NULL && error_message) {
-                *error_message = strdup("Failed to parse string as JSON or YAML");
+                *error_message = xmd_strdup("Failed to parse string as JSON or YAML");
             }
         }
     }
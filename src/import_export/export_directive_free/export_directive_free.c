@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free an export directive
@@ -18,9 +19,9 @@ void export_directive_free(ExportDirective* directive) {
         return;
     }
     
-    free(directive->symbol_name);
+    xmd_free(directive->symbol_name);
     if (directive->value) {
         variable_unref(directive->value);
     }
-    free(directive);
+    xmd_free(directive);
 }
\ No newline at end of file
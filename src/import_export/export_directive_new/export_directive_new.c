@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new export directive
@@ -22,17 +23,17 @@ ExportDirective* export_directive_new(const char* symbol_name, variable* value)
         return NULL;
     }
     
-    ExportDirective* directive = malloc(sizeof(ExportDirective));
+    ExportDirective* directive = xmd_malloc(sizeof(ExportDirective));
     if (!directive) {
         return NULL;
     }
     
-    directive->symbol_name = strdup(symbol_name);
+    directive->symbol_name = xmd_strdup(symbol_name);
     directive->value = value;
     variable_ref(value); // Increment reference count
     
     if (!directive->symbol_name) {
-        free(directive);
+        xmd_free(directive);
         return NULL;
     }
     
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Parse export directive from XMD comment
@@ -48,13 +49,13 @@ int export_parse_directive(const char* directive_text, store* scope,
     // Check if symbol exists in scope
     variable* var = store_get(scope, symbol_name);
     if (!var) {
-        free(symbol_name);
+        xmd_free(symbol_name);
         return MODULE_ERROR;
     }
     
     // Create export directive
     *export_dir = export_directive_new(symbol_name, var);
-    free(symbol_name);
+    xmd_free(symbol_name);
     
     return *export_dir ? MODULE_SUCCESS : MODULE_ERROR;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract word from string
@@ -56,7 +57,7 @@ size_t extract_word(const char* str, char** word, const char** next) {
     }
     
     if (len > 0) {
-        *word = malloc(len + 1);
+        *word = xmd_malloc(len + 1);
         if (*word) {
             strncpy(*word, start, len);
             (*word)[len] = '\0';
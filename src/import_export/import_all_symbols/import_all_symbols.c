@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Import all symbols from module
@@ -44,9 +45,9 @@ int import_all_symbols(ImportExportProcessor* processor, const char* module_name
     
     // Free keys array
     for (size_t i = 0; i < key_count; i++) {
-        free(keys[i]);
+        xmd_free(keys[i]);
     }
-    free(keys);
+    xmd_free(keys);
     
     return MODULE_SUCCESS;
 }
\ No newline at end of file
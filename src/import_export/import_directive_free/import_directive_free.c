@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free an import directive
@@ -18,9 +19,9 @@ void import_directive_free(ImportDirective* directive) {
         return;
     }
     
-    free(directive->module_name);
-    free(directive->symbol_name);
-    free(directive->alias);
-    free(directive->path);
-    free(directive);
+    xmd_free(directive->module_name);
+    xmd_free(directive->symbol_name);
+    xmd_free(directive->alias);
+    xmd_free(directive->path);
+    xmd_free(directive);
 }
\ No newline at end of file
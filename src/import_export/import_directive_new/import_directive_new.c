@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new import directive
@@ -25,14 +26,14 @@ ImportDirective* import_directive_new(const char* module_name,
         return NULL;
     }
     
-    ImportDirective* directive = malloc(sizeof(ImportDirective));
+    ImportDirective* directive = xmd_malloc(sizeof(ImportDirective));
     if (!directive) {
         return NULL;
     }
     
-    directive->module_name = strdup(module_name);
-    directive->symbol_name = symbol_name ? strdup(symbol_name) : NULL;
-    directive->alias = alias ? strdup(alias) : NULL;
+    directive->module_name = xmd_strdup(module_name);
+    directive->symbol_name = symbol_name ? xmd_strdup(symbol_name) : NULL;
+    directive->alias = alias ? xmd_strdup(alias) : NULL;
     directive->path = NULL;
     
     if (!directive->module_name) {
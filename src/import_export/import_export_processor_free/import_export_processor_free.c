@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free import/export processor
@@ -18,6 +19,6 @@ void import_export_processor_free(ImportExportProcessor* processor) {
         return;
     }
     
-    free(processor->last_error);
-    free(processor);
+    xmd_free(processor->last_error);
+    xmd_free(processor);
 }
\ No newline at end of file
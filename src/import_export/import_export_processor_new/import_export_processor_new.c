@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create import/export processor
@@ -21,7 +22,7 @@ ImportExportProcessor* import_export_processor_new(ModuleRegistry* registry,
         return NULL;
     }
     
-    ImportExportProcessor* processor = malloc(sizeof(ImportExportProcessor));
+    ImportExportProcessor* processor = xmd_malloc(sizeof(ImportExportProcessor));
     if (!processor) {
         return NULL;
     }
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../include/import_export.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Parse import directive from XMD comment
@@ -58,7 +59,7 @@ int import_parse_directive(const char* directive_text, ImportDirective** import_
         pos = skip_whitespace(pos);
         
         if (extract_word(pos, &alias, &pos) == 0) {
-            free(symbol_name);
+            xmd_free(symbol_name);
             return MODULE_ERROR;
         }
         
@@ -67,8 +68,8 @@ int import_parse_directive(const char* directive_text, ImportDirective** import_
     
     // Check for "from" keyword
     if (strncmp(pos, "from", 4) != 0) {
-        free(symbol_name);
-        free(alias);
+        xmd_free(symbol_name);
+        xmd_free(alias);
         return MODULE_ERROR;
     }
     
@@ -77,17 +78,17 @@ int import_parse_directive(const char* directive_text, ImportDirective** import_
     
     // Extract module name
     if (extract_word(pos, &module_name, &pos) == 0) {
-        free(symbol_name);
-        free(alias);
+        xmd_free(symbol_name);
+        xmd_free(alias);
         return MODULE_ERROR;
     }
     
     // Create import directive
     *import_dir = import_directive_new(module_name, symbol_name, alias);
     
-    free(symbol_name);
-    free(alias);
-    free(module_name);
+    xmd_free(symbol_name);
+    xmd_free(alias);
+    xmd_free(module_name);
     
     return *import_dir ? MODULE_SUCCESS : MODULE_ERROR;
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include "../../include/import_tracker.h"
+#include "../../include/allocator.h"
 
 #ifndef PATH_MAX
 #define PATH_MAX 4096
@@ -24,7 +25,7 @@
  * @brief Create a new import tracker
  */
 import_tracker_t* import_tracker_create(void) {
-    import_tracker_t* tracker = calloc(1, sizeof(import_tracker_t));
+    import_tracker_t* tracker = xmd_calloc(1, sizeof(import_tracker_t));
     if (!tracker) {
         return NULL;
     }
@@ -42,7 +43,7 @@ void import_tracker_free(import_tracker_t* tracker) {
     }
     
     import_tracker_clear(tracker);
-    free(tracker);
+    xmd_free(tracker);
 }
 
 /**
@@ -56,9 +57,9 @@ void import_tracker_clear(import_tracker_t* tracker) {
     import_dep_t* current = tracker->dependencies;
     while (current) {
         import_dep_t* next = current->next;
-        free(current->importer_file);
-        free(current->imported_file);
-        free(current);
+        xmd_free(current->importer_file);
+        xmd_free(current->imported_file);
+        xmd_free(current);
         current = next;
     }
     
@@ -72,9 +73,9 @@ void import_tracker_clear(import_tracker_t* tracker) {
 static char* normalize_path(const char* path) {
     char resolved[PATH_MAX];
     if (realpath(path, resolved)) {
-        return strdup(resolved);
+        return xmd_strdup(resolved);
     }
-    return strdup(path);
+    return xmd_strdup(path);
 }
 
 /**
@@ -92,8 +93,8 @@ bool import_tracker_add_dependency(import_tracker_t* tracker,
     char* norm_imported = normalize_path(imported_file);
     
     if (!norm_importer || !norm_imported) {
-        free(norm_importer);
-        free(norm_imported);
+        xmd_free(norm_importer);
+        xmd_free(norm_imported);
         return false;
     }
     
@@ -102,18 +103,18 @@ bool import_tracker_add_dependency(import_tracker_t* tracker,
     while (current) {
         if (strcmp(current->importer_file, norm_importer) == 0 &&
             strcmp(current->imported_file, norm_imported) == 0) {
-            free(norm_importer);
-            free(norm_imported);
+            xmd_free(norm_importer);
+            xmd_free(norm_imported);
             return true; // Already exists
         }
         current = current->next;
     }
     
     // Add new dependency
-    import_dep_t* new_dep = calloc(1, sizeof(import_dep_t));
+    import_dep_t* new_dep = xmd_calloc(1, sizeof(import_dep_t));
     if (!new_dep) {
-        free(norm_importer);
-        free(norm_imported);
+        xmd_free(norm_importer);
+        xmd_free(norm_imported);
         return false;
     }
     
@@ -156,14 +157,14 @@ bool import_tracker_get_importers(import_tracker_t* tracker,
     if (importer_count == 0) {
         *importers = NULL;
         *count = 0;
-        free(norm_imported);
+        xmd_free(norm_imported);
         return true;
     }
     
     // Allocate array
-    char** result = calloc(importer_count, sizeof(char*));
+    char** result = xmd_calloc(importer_count, sizeof(char*));
     if (!result) {
-        free(norm_imported);
+        xmd_free(norm_imported);
         return false;
     }
     
@@ -172,14 +173,14 @@ bool import_tracker_get_importers(import_tracker_t* tracker,
     current = tracker->dependencies;
     while (current && idx < importer_count) {
         if (strcmp(current->imported_file, norm_imported) == 0) {
-            result[idx] = strdup(current->importer_file);
+            result[idx] = xmd_strdup(current->importer_file);
             if (!result[idx]) {
                 // Cleanup on error
                 for (int i = 0; i < idx; i++) {
-                    free(result[i]);
+                    xmd_free(result[i]);
                 }
-                free(result);
-                free(norm_imported);
+                xmd_free(result);
+                xmd_free(norm_imported);
                 return false;
             }
             idx++;
@@ -189,7 +190,7 @@ bool import_tracker_get_importers(import_tracker_t* tracker,
     
     *importers = result;
     *count = importer_count;
-    free(norm_imported);
+    xmd_free(norm_imported);
     return true;
 }
 
@@ -237,7 +238,7 @@ static char* extract_import_path(const char* directive) {
         
         // Extract path
         size_t len = end - start;
-        char* path = malloc(len + 1);
+        char* path = xmd_malloc(len + 1);
         if (!path) {
             return NULL;
         }
@@ -262,7 +263,7 @@ static char* extract_import_path(const char* directive) {
         return NULL;
     }
     
-    char* path = malloc(len + 1);
+    char* path = xmd_malloc(len + 1);
     if (!path) {
         return NULL;
     }
@@ -290,7 +291,7 @@ bool import_tracker_extract_imports(const char* content,
     int import_capacity = 0;
     
     // Get directory of base file
-    char* base_copy = strdup(base_path);
+    char* base_copy = xmd_strdup(base_path);
     char* base_dir = dirname(base_copy);
     
     // Scan for import directives
@@ -326,41 +327,41 @@ bool import_tracker_extract_imports(const char* content,
                 // Add to list
                 if (import_count >= import_capacity) {
                     import_capacity = import_capacity == 0 ? 8 : import_capacity * 2;
-                    char** new_list = realloc(import_list, import_capacity * sizeof(char*));
+                    char** new_list = xmd_realloc(import_list, import_capacity * sizeof(char*));
                     if (!new_list) {
-                        free(import_path);
-                        free(base_copy);
+                        xmd_free(import_path);
+                        xmd_free(base_copy);
                         // Cleanup
                         for (int i = 0; i < import_count; i++) {
-                            free(import_list[i]);
+                            xmd_free(import_list[i]);
                         }
-                        free(import_list);
+                        xmd_free(import_list);
                         return false;
                     }
                     import_list = new_list;
                 }
                 
-                import_list[import_count] = strdup(full_path);
+                import_list[import_count] = xmd_strdup(full_path);
                 if (!import_list[import_count]) {
-                    free(import_path);
-                    free(base_copy);
+                    xmd_free(import_path);
+                    xmd_free(base_copy);
                     // Cleanup
                     for (int i = 0; i < import_count; i++) {
-                        free(import_list[i]);
+                        xmd_free(import_list[i]);
                     }
-                    free(import_list);
+                    xmd_free(import_list);
                     return false;
                 }
                 import_count++;
                 
-                free(import_path);
+                xmd_free(import_path);
             }
         }
         
         pos++;
     }
     
-    free(base_copy);
+    xmd_free(base_copy);
     *imports = import_list;
     *count = import_count;
     return true;
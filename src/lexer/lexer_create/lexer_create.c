@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/lexer_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new lexer
@@ -18,7 +19,7 @@ lexer* lexer_create(const char* input) {
         return NULL;
     }
     
-    lexer* lex = malloc(sizeof(lexer));
+    lexer* lex = xmd_malloc(sizeof(lexer));
     if (lex == NULL) {
         return NULL;
     }
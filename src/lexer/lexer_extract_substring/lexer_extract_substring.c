@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/lexer_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract a substring from lexer input
@@ -37,7 +38,7 @@ char* lexer_extract_substring(const lexer* lex, size_t start_pos, size_t length)
     }
     
     // Allocate memory for result
-    char* result = malloc(length + 1);
+    char* result = xmd_malloc(length + 1);
     if (result == NULL) {
         return NULL;
     }
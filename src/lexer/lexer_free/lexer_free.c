@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/lexer_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free lexer resources
@@ -21,5 +22,5 @@ void lexer_free(lexer* lex) {
         token_free(lex->peeked_token);
     }
     
-    free(lex);
+    xmd_free(lex);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/lexer_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Get next token from lexer
@@ -79,7 +80,7 @@ token* lexer_next_token(lexer* lex) {
     // Default to text
     char* content = lexer_read_text(lex);
     if (content == NULL || strlen(content) == 0) {
-        free(content);
+        xmd_free(content);
         // Skip one character to avoid infinite loop
         lexer_advance(lex);
         return lexer_next_token(lex);
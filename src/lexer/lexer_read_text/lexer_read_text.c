@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/lexer_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Read text until special marker
@@ -43,7 +44,7 @@ char* lexer_read_text(lexer* lex) {
         return NULL;
     }
     
-    char* result = malloc(length + 1);
+    char* result = xmd_malloc(length + 1);
     if (result == NULL) {
         return NULL;
     }
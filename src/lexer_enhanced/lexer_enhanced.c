@@ -10,6 +10,8 @@
 #include <ctype.h>
 #include "../../include/lexer_enhanced.h"
 #include "../../include/token.h"
+#include "../../include/performance.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Check if character is valid identifier start
@@ -75,6 +77,7 @@ const char* get_operator(const char* input, int* length) {
     if (strncmp(input, "&&", 2) == 0) { *length = 2; return "&&"; }
     if (strncmp(input, "||", 2) == 0) { *length = 2; return "||"; }
     if (strncmp(input, "+=", 2) == 0) { *length = 2; return "+="; }
+    if (strncmp(input, "..", 2) == 0) { *length = 2; return ".."; }
     
     // Single-character operators
     switch (input[0]) {
@@ -91,15 +94,12 @@ const char* get_operator(const char* input, int* length) {
 }
 
 /**
- * @brief Tokenize input string with enhanced expression support
+ * @brief Tokenize a non-NULL input string
  * @param input Input string to tokenize
  * @param filename Source filename for location tracking
  * @return Linked list of tokens, or NULL on error
  */
-token* lexer_enhanced_tokenize(const char* input, const char* filename) {
-    if (!input) {
-        return NULL;
-    }
+static token* tokenize_input(const char* input, const char* filename) {
     
     if (strlen(input) == 0) {
         return token_create(TOKEN_EOF, "", 1, 1);
@@ -156,12 +156,12 @@ token* lexer_enhanced_tokenize(const char* input, const char* filename) {
             
             if (pos < len) {
                 size_t str_len = pos - start;
-                char* str_value = malloc(str_len + 1);
+                char* str_value = xmd_malloc(str_len + 1);
                 if (str_value) {
                     strncpy(str_value, &input[start], str_len);
                     str_value[str_len] = '\0';
                     new_token = token_create(TOKEN_STRING, str_value, line, column - str_len - 1);
-                    free(str_value);
+                    xmd_free(str_value);
                 }
                 pos++;
                 column++;
@@ -170,18 +170,20 @@ token* lexer_enhanced_tokenize(const char* input, const char* filename) {
         // Numbers  
         else if (is_digit(c)) {
             size_t start = pos;
-            while (pos < len && (is_digit(input[pos]) || input[pos] == '.')) {
+            // A dot continues the number only before a digit, so 1..5 is a range
+            while (pos < len && (is_digit(input[pos]) ||
+                                 (input[pos] == '.' && pos + 1 < len && is_digit(input[pos + 1])))) {
                 pos++;
                 column++;
             }
             
             size_t num_len = pos - start;
-            char* num_value = malloc(num_len + 1);
+            char* num_value = xmd_malloc(num_len + 1);
             if (num_value) {
                 strncpy(num_value, &input[start], num_len);
                 num_value[num_len] = '\0';
                 new_token = token_create(TOKEN_NUMBER, num_value, line, column - num_len);
-                free(num_value);
+                xmd_free(num_value);
             }
         }
         // Identifiers and keywords
@@ -193,14 +195,14 @@ token* lexer_enhanced_tokenize(const char* input, const char* filename) {
             }
             
             size_t id_len = pos - start;
-            char* identifier = malloc(id_len + 1);
+            char* identifier = xmd_malloc(id_len + 1);
             if (identifier) {
                 strncpy(identifier, &input[start], id_len);
                 identifier[id_len] = '\0';
                 
                 token_type type = is_boolean_literal(identifier) ? TOKEN_BOOLEAN : TOKEN_IDENTIFIER;
                 new_token = token_create(type, identifier, line, column - id_len);
-                free(identifier);
+                xmd_free(identifier);
             }
         }
         // XMD directive detection
@@ -217,12 +219,12 @@ token* lexer_enhanced_tokenize(const char* input, const char* filename) {
             }
             
             size_t dir_len = pos - start;
-            char* directive = malloc(dir_len + 1);
+            char* directive = xmd_malloc(dir_len + 1);
             if (directive) {
                 strncpy(directive, &input[start], dir_len);
                 directive[dir_len] = '\0';
                 new_token = token_create(TOKEN_XMD_DIRECTIVE, directive, line, column - dir_len);
-                free(directive);
+                xmd_free(directive);
             }
         }
         // Single character tokens
@@ -261,4 +263,21 @@ token* lexer_enhanced_tokenize(const char* input, const char* filename) {
     }
     
     return head;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Tokenize input string with enhanced expression support
+ * @param input Input string to tokenize
+ * @param filename Source filename for location tracking
+ * @return Linked list of tokens, or NULL on error
+ */
+token* lexer_enhanced_tokenize(const char* input, const char* filename) {
+    if (!input) {
+        return NULL;
+    }
+    
+    PERF_STAGE_BEGIN(PERF_STAGE_LEX);
+    token* tokens = tokenize_input(input, filename);
+    PERF_STAGE_END(PERF_STAGE_LEX);
+    return tokens;
+}
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/loop.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Append content to result string
@@ -25,7 +26,7 @@ char* append_to_result(char* current_result, const char* new_content) {
     size_t new_len = strlen(new_content);
     size_t total_len = current_len + new_len + 1;
     
-    char* result = malloc(total_len);
+    char* result = xmd_malloc(total_len);
     if (!result) {
         return NULL;
     }
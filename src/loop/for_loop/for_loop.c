@@ -12,6 +12,7 @@
 #include <string.h>
 #include "../../../include/loop.h"
 #include "../../../include/conditional.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process a for-in loop
@@ -41,7 +42,7 @@ int for_loop_process(LoopContext* ctx, const char* item_name,
         return LOOP_ERROR;
     }
     
-    char* output = strdup("");
+    char* output = xmd_strdup("");
     if (!output) {
         return LOOP_ERROR;
     }
@@ -119,7 +120,7 @@ int for_loop_process(LoopContext* ctx, const char* item_name,
     }
     else {
         // Not a collection type
-        free(output);
+        xmd_free(output);
         set_loop_error(ctx, "Variable is not iterable");
         return LOOP_ERROR;
     }
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/loop.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a loop context
@@ -18,6 +19,6 @@ void loop_context_free(LoopContext* ctx) {
         return;
     }
     
-    free(ctx->last_error);
-    free(ctx);
+    xmd_free(ctx->last_error);
+    xmd_free(ctx);
 }
\ No newline at end of file
@@ -8,13 +8,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/loop.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new loop context
  * @return New loop context or NULL on error
  */
 LoopContext* loop_context_new(void) {
-    LoopContext* ctx = malloc(sizeof(LoopContext));
+    LoopContext* ctx = xmd_malloc(sizeof(LoopContext));
     if (!ctx) {
         return NULL;
     }
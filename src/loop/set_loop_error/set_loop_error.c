@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/loop.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set error message in loop context
@@ -21,10 +22,10 @@ void set_loop_error(LoopContext* ctx, const char* message) {
     }
     
     // Free existing error message
-    free(ctx->last_error);
+    xmd_free(ctx->last_error);
     
     // Allocate and copy new error message
-    ctx->last_error = malloc(strlen(message) + 1);
+    ctx->last_error = xmd_malloc(strlen(message) + 1);
     if (ctx->last_error) {
         strcpy(ctx->last_error, message);
     }
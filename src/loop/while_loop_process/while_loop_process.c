@@ -11,6 +11,7 @@
 #include "../../../include/loop.h"
 #include "../../../include/conditional.h"
 #include "../../../include/store.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process a while loop
@@ -27,7 +28,7 @@ int while_loop_process(LoopContext* ctx, const char* condition,
         return LOOP_ERROR;
     }
     
-    *result = malloc(1);
+    *result = xmd_malloc(1);
     if (!*result) {
         return LOOP_ERROR;
     }
@@ -36,7 +37,7 @@ int while_loop_process(LoopContext* ctx, const char* condition,
     // Create condition context for evaluation
     ConditionContext* cond_ctx = condition_context_new();
     if (!cond_ctx) {
-        free(*result);
+        xmd_free(*result);
         *result = NULL;
         return LOOP_ERROR;
     }
@@ -68,12 +69,12 @@ int while_loop_process(LoopContext* ctx, const char* condition,
         char* new_result = append_to_result(*result, template);
         if (!new_result) {
             condition_context_free(cond_ctx);
-            free(*result);
+            xmd_free(*result);
             *result = NULL;
             return LOOP_ERROR;
         }
         
-        free(*result);
+        xmd_free(*result);
         *result = new_result;
         iterations++;
     }
@@ -43,6 +43,10 @@ int main(int argc, char* argv[]) {
         return cmd_validate(argc, argv);
     } else if (strcmp(command, "watch") == 0) {
         return cmd_watch(argc, argv);
+    } else if (strcmp(command, "bench") == 0) {
+        return cmd_bench(argc, argv);
+    } else if (strcmp(command, "build") == 0) {
+        return cmd_build(argc, argv);
     } else if (strcmp(command, "upgrade") == 0) {
         return cmd_upgrade(argc, argv);
     } else if (strcmp(command, "uninstall") == 0) {
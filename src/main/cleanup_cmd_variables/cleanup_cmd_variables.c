@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Cleanup command variables array
@@ -15,7 +16,7 @@
  */
 void cleanup_cmd_variables(cmd_variable_t cmd_variables[], int var_count) {
     for (int i = 0; i < var_count; i++) {
-        free(cmd_variables[i].key);
-        free(cmd_variables[i].value);
+        xmd_free(cmd_variables[i].key);
+        xmd_free(cmd_variables[i].value);
     }
 }
\ No newline at end of file
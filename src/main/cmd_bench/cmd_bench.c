@@ -0,0 +1,222 @@
+/**
+ * @file cmd_bench.c
+ * @brief Bench command implementation function
+ * @author XMD Team
+ *
+ * Runs the macro-benchmark corpus and reports latency percentiles and
+ * throughput, optionally as JSON. With --baseline the run is tested
+ * against earlier results and fails when a case regresses.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/main_internal.h"
+#include "../../../include/performance.h"
+#include "../../../include/bench_corpus.h"
+#include "../../../include/allocator.h"
+
+/** Maximum number of --case filters */
+#define MAX_CASE_FILTERS BENCH_CORPUS_CASE_COUNT
+
+/**
+ * @brief Parse a positive count option value
+ * @param option Option name for error messages
+ * @param text Value text
+ * @param allow_zero Whether zero is accepted
+ * @param value Receives the parsed value
+ * @return true on success
+ */
+static bool parse_count(const char* option, const char* text, bool allow_zero, uint32_t* value) {
+    char* end = NULL;
+    long parsed = strtol(text, &end, 10);
+    if (!end || *end != '\0' || parsed < (allow_zero ? 0 : 1) || parsed > 1000000) {
+        fprintf(stderr, "Error: Invalid value '%s' for %s\n", text, option);
+        return false;
+    }
+    *value = (uint32_t)parsed;
+    return true;
+}
+
+/**
+ * @brief Check whether a case was selected
+ * @param name Case name
+ * @param filters Selected names
+ * @param filter_count Number of selected names (0 selects all)
+ * @return true if the case should run
+ */
+static bool case_selected(const char* name, const char* filters[], int filter_count) {
+    if (filter_count == 0) {
+        return true;
+    }
+    for (int i = 0; i < filter_count; i++) {
+        if (strcmp(filters[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Bench command implementation
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @return Exit code
+ */
+int cmd_bench(int argc, char* argv[]) {
+    uint32_t iterations = 20;
+    uint32_t warmup = 3;
+    double scale = 1.0;
+    const char* corpus_dir = NULL;
+    const char* json_output = NULL;
+    const char* baseline_path = NULL;
+    double threshold = 0.05;
+    double alpha = 0.01;
+    const char* filters[MAX_CASE_FILTERS];
+    int filter_count = 0;
+    
+    for (int i = 2; i < argc; i++) {
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            printf("Usage: xmd bench [--iterations N] [--warmup N] [--scale F]\n"
+                   "                 [--case NAME]... [--corpus DIR] [--json FILE|-]\n"
+                   "                 [--baseline FILE] [--threshold PCT] [--alpha P]\n"
+                   "Exits with status 2 when a case is significantly slower than the\n"
+                   "baseline by more than --threshold percent (default 5).\n"
+                   "Cases: prose, variables, nested_loops, import_fanout, json_import, exec_stub\n");
+            return 0;
+        }
+        if (!value) {
+            fprintf(stderr, "Error: %s requires an argument\n", argv[i]);
+            return 1;
+        }
+        if (strcmp(argv[i], "--iterations") == 0 || strcmp(argv[i], "-n") == 0) {
+            if (!parse_count(argv[i], value, false, &iterations)) return 1;
+        } else if (strcmp(argv[i], "--warmup") == 0) {
+            if (!parse_count(argv[i], value, true, &warmup)) return 1;
+        } else if (strcmp(argv[i], "--scale") == 0) {
+            scale = strtod(value, NULL);
+            if (scale <= 0.0) {
+                fprintf(stderr, "Error: Invalid value '%s' for --scale\n", value);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--case") == 0) {
+            if (filter_count == MAX_CASE_FILTERS) {
+                fprintf(stderr, "Error: Too many --case options\n");
+                return 1;
+            }
+            filters[filter_count++] = value;
+        } else if (strcmp(argv[i], "--corpus") == 0) {
+            corpus_dir = value;
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json_output = value;
+        } else if (strcmp(argv[i], "--baseline") == 0) {
+            baseline_path = value;
+        } else if (strcmp(argv[i], "--threshold") == 0) {
+            threshold = strtod(value, NULL) / 100.0;
+            if (threshold < 0.0) {
+                fprintf(stderr, "Error: Invalid value '%s' for --threshold\n", value);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--alpha") == 0) {
+            alpha = strtod(value, NULL);
+            if (alpha <= 0.0 || alpha >= 1.0) {
+                fprintf(stderr, "Error: Invalid value '%s' for --alpha\n", value);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Error: Unknown option '%s'\n", argv[i]);
+            return 1;
+        }
+        i++;
+    }
+    
+    // Load the baseline first: it may be the file this run overwrites
+    benchmark_suite* baseline = NULL;
+    if (baseline_path) {
+        baseline = benchmark_load_json(baseline_path);
+        if (!baseline) {
+            fprintf(stderr, "Error: Cannot load benchmark baseline '%s'\n", baseline_path);
+            return 1;
+        }
+    }
+    
+    bench_corpus* corpus = bench_corpus_create(corpus_dir, scale);
+    benchmark_suite* suite = benchmark_suite_create("xmd macro-benchmarks");
+    if (!corpus || !suite) {
+        fprintf(stderr, "Error: Failed to generate benchmark corpus\n");
+        bench_corpus_destroy(corpus);
+        benchmark_suite_destroy(suite);
+        benchmark_suite_destroy(baseline);
+        return 1;
+    }
+    suite->warmup_iterations = warmup;
+    
+    int status = 0;
+    for (size_t i = 0; i < corpus->case_count; i++) {
+        bench_case* bench = &corpus->cases[i];
+        if (!case_selected(bench->name, filters, filter_count)) {
+            continue;
+        }
+        if (benchmark_run_throughput(suite, bench->name, bench_corpus_run_case, bench,
+                                     iterations, bench->bytes) != 0) {
+            fprintf(stderr, "Error: Benchmark case '%s' failed\n", bench->name);
+            status = 1;
+        }
+    }
+    
+    if (suite->result_count == 0 && status == 0) {
+        fprintf(stderr, "Error: No benchmark case matched\n");
+        status = 1;
+    }
+    
+    // Human-readable table unless JSON goes to stdout
+    if (suite->result_count > 0 && !(json_output && strcmp(json_output, "-") == 0)) {
+        char* report = benchmark_generate_report(suite);
+        if (report) {
+            fputs(report, stdout);
+            xmd_free(report);
+        }
+    }
+    
+    if (json_output && suite->result_count > 0) {
+        bool written = false;
+        if (strcmp(json_output, "-") == 0) {
+            char* json = benchmark_generate_json(suite);
+            if (json) {
+                printf("%s\n", json);
+                xmd_free(json);
+                written = true;
+            }
+        } else {
+            written = benchmark_save_json(suite, json_output) == 0;
+        }
+        if (!written) {
+            fprintf(stderr, "Error: Cannot write benchmark results to '%s'\n", json_output);
+            status = 1;
+        }
+    }
+    
+    if (baseline && suite->result_count > 0) {
+        benchmark_comparison* comparisons = NULL;
+        size_t count = benchmark_compare(baseline, suite, threshold, alpha, &comparisons);
+        char* report = benchmark_comparison_report(comparisons, count);
+        if (report) {
+            // Keep stdout parseable when it carries the JSON
+            FILE* out = (json_output && strcmp(json_output, "-") == 0) ? stderr : stdout;
+            fprintf(out, "\n%s", report);
+            xmd_free(report);
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (comparisons[i].verdict == BENCHMARK_REGRESSED && status == 0) {
+                status = 2;
+            }
+        }
+        xmd_free(comparisons);
+    }
+    
+    benchmark_suite_destroy(baseline);
+    benchmark_suite_destroy(suite);
+    bench_corpus_destroy(corpus);
+    return status;
+}
@@ -0,0 +1,359 @@
+/**
+ * @file cmd_build.c
+ * @brief Build command implementation function
+ * @author XMD Team
+ *
+ * Renders a file or a directory tree of markdown files into an output
+ * file or directory. The build cache skips files whose source, imported
+ * files and output are unchanged since the previous build, and outputs
+ * that render to the bytes already on disk are not rewritten. Changed
+ * outputs are replaced atomically, with one directory flush per build.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "../../../include/main_internal.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/store.h"
+#include "../../../include/variable.h"
+#include "../../../include/allocator.h"
+
+/** Maximum number of -v variables, as for the process command */
+#define MAX_BUILD_VARIABLES 100
+
+/**
+ * @brief Growable list of source paths
+ */
+typedef struct {
+    char** paths;
+    size_t count;
+    size_t capacity;
+} source_list;
+
+/**
+ * @brief Check for a markdown file name
+ * @param name File name
+ * @return true if the name ends in .md
+ */
+static bool is_markdown_name(const char* name) {
+    size_t length = strlen(name);
+    return length > 3 && strcmp(name + length - 3, ".md") == 0;
+}
+
+/**
+ * @brief Append a path to the list (takes ownership)
+ * @param list Source list
+ * @param path Path to add
+ * @return false on allocation failure
+ */
+static bool add_source(source_list* list, char* path) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 32;
+        char** paths = xmd_realloc(list->paths, capacity * sizeof(char*));
+        if (!paths) {
+            xmd_free(path);
+            return false;
+        }
+        list->paths = paths;
+        list->capacity = capacity;
+    }
+    list->paths[list->count++] = path;
+    return true;
+}
+
+/**
+ * @brief Collect markdown files below a directory
+ * @param directory Directory to scan
+ * @param skip Directory not to descend into (the output directory)
+ * @param list Receives the paths
+ * @return false on allocation failure
+ */
+static bool collect_sources(const char* directory, const char* skip, source_list* list) {
+    DIR* dir = opendir(directory);
+    if (!dir) {
+        return true;
+    }
+    
+    bool ok = true;
+    struct dirent* entry;
+    while (ok && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        size_t length = strlen(directory) + strlen(entry->d_name) + 2;
+        char* path = xmd_malloc(length);
+        if (!path) {
+            ok = false;
+            break;
+        }
+        snprintf(path, length, "%s/%s", directory, entry->d_name);
+        
+        struct stat st;
+        if (stat(path, &st) != 0) {
+            xmd_free(path);
+        } else if (S_ISDIR(st.st_mode)) {
+            if (strcmp(path, skip) != 0) {
+                ok = collect_sources(path, skip, list);
+            }
+            xmd_free(path);
+        } else if (S_ISREG(st.st_mode) && is_markdown_name(entry->d_name)) {
+            ok = add_source(list, path);
+        } else {
+            xmd_free(path);
+        }
+    }
+    closedir(dir);
+    return ok;
+}
+
+/**
+ * @brief qsort comparator for paths
+ */
+static int compare_paths(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/**
+ * @brief Copy a directory argument without trailing slashes
+ * @param path Directory argument
+ * @return Copy (caller frees) or NULL on allocation failure
+ */
+static char* strip_trailing_slashes(const char* path) {
+    char* copy = xmd_strdup(path);
+    if (copy) {
+        size_t length = strlen(copy);
+        while (length > 1 && copy[length - 1] == '/') {
+            copy[--length] = '\0';
+        }
+    }
+    return copy;
+}
+
+/**
+ * @brief Hash everything besides the inputs that changes rendered output
+ * @param variables Command-line variables
+ * @param var_count Number of variables
+ * @return Options hash
+ */
+static uint64_t hash_options(const cmd_variable_t variables[], int var_count) {
+    size_t length = strlen(xmd_get_version()) + 1;
+    for (int i = 0; i < var_count; i++) {
+        length += strlen(variables[i].key) + strlen(variables[i].value) + 2;
+    }
+    char* text = xmd_malloc(length);
+    if (!text) {
+        return 0;
+    }
+    size_t used = (size_t)snprintf(text, length, "%s", xmd_get_version()) + 1;
+    for (int i = 0; i < var_count; i++) {
+        used += (size_t)snprintf(text + used, length - used, "%s=%s",
+                                 variables[i].key, variables[i].value) + 1;
+    }
+    uint64_t hash = build_cache_hash(text, used);
+    xmd_free(text);
+    return hash;
+}
+
+/**
+ * @brief Options of one build run
+ */
+typedef struct {
+    const char* input_path;
+    const char* output_path;
+    const char* cache_dir;      /**< NULL to render every file */
+    bool verbose;
+    const cmd_variable_t* variables;
+    int var_count;
+} build_options;
+
+/**
+ * @brief Build every source of a list
+ * @param options Build options
+ * @param sources Sources to build
+ * @param input_root Input directory, or NULL when building one file
+ * @param output_root Output directory, or output file when building one file
+ * @return Exit code
+ */
+static int build_sources(const build_options* options, const source_list* sources,
+                         const char* input_root, const char* output_root) {
+    store* globals = store_create();
+    if (!globals) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    for (int i = 0; i < options->var_count; i++) {
+        variable* text = variable_create_string(options->variables[i].value);
+        if (text) {
+            store_set(globals, options->variables[i].key, text);
+            variable_unref(text);
+        }
+    }
+    
+    build_cache* cache = NULL;
+    if (options->cache_dir) {
+        cache = build_cache_open(options->cache_dir,
+                                 hash_options(options->variables, options->var_count));
+        if (!cache) {
+            fprintf(stderr, "Warning: Cannot open build cache '%s', rendering every file\n",
+                    options->cache_dir);
+        }
+    }
+    
+    // The whole build is one write wave
+    build_write_batch batch;
+    build_write_batch_init(&batch);
+    build_write_batch* previous = build_write_batch_attach(&batch);
+    
+    size_t counts[BUILD_FILE_FAILED + 1] = { 0 };
+    static const char* const outcomes[] = { "rendered", "unchanged", "cached", "FAILED" };
+    for (size_t i = 0; i < sources->count; i++) {
+        const char* source = sources->paths[i];
+        char* target = NULL;
+        if (input_root) {
+            const char* relative = source + strlen(input_root) + 1;
+            size_t length = strlen(output_root) + strlen(relative) + 2;
+            target = xmd_malloc(length);
+            if (target) {
+                snprintf(target, length, "%s/%s", output_root, relative);
+            }
+        } else {
+            target = xmd_strdup(output_root);
+        }
+        
+        build_file_status outcome = target
+            ? build_cache_build_file(cache, globals, source, target)
+            : BUILD_FILE_FAILED;
+        counts[outcome]++;
+        if (outcome == BUILD_FILE_FAILED) {
+            fprintf(stderr, "Error: Failed to build '%s'\n", source);
+        } else if (options->verbose) {
+            printf("%-9s %s -> %s\n", outcomes[outcome], source, target);
+        }
+        xmd_free(target);
+    }
+    
+    build_write_batch_attach(previous);
+    if (build_write_batch_flush(&batch) != 0) {
+        fprintf(stderr, "Warning: Failed to flush output directories\n");
+    }
+    
+    printf("Built %zu file(s): %zu rendered, %zu unchanged, %zu cached, %zu failed\n",
+           sources->count, counts[BUILD_FILE_RENDERED], counts[BUILD_FILE_UNCHANGED],
+           counts[BUILD_FILE_CACHED], counts[BUILD_FILE_FAILED]);
+    
+    build_cache_close(cache);
+    store_destroy(globals);
+    return counts[BUILD_FILE_FAILED] > 0 ? 1 : 0;
+}
+
+/**
+ * @brief Collect the sources of a build and build them
+ * @param options Build options
+ * @return Exit code
+ */
+static int run_build(const build_options* options) {
+    struct stat input_st;
+    if (stat(options->input_path, &input_st) != 0) {
+        fprintf(stderr, "Error: Input '%s' does not exist\n", options->input_path);
+        return 1;
+    }
+    bool directory_mode = S_ISDIR(input_st.st_mode);
+    
+    char* input_root = strip_trailing_slashes(options->input_path);
+    char* output_root = strip_trailing_slashes(options->output_path);
+    source_list sources = { NULL, 0, 0 };
+    bool collected = input_root && output_root;
+    if (collected && directory_mode) {
+        collected = collect_sources(input_root, output_root, &sources);
+        qsort(sources.paths, sources.count, sizeof(char*), compare_paths);
+    } else if (collected) {
+        char* source = xmd_strdup(options->input_path);
+        collected = source && add_source(&sources, source);
+    }
+    
+    int status = 1;
+    if (collected) {
+        status = build_sources(options, &sources, directory_mode ? input_root : NULL, output_root);
+    } else {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+    }
+    
+    for (size_t i = 0; i < sources.count; i++) {
+        xmd_free(sources.paths[i]);
+    }
+    xmd_free(sources.paths);
+    xmd_free(input_root);
+    xmd_free(output_root);
+    return status;
+}
+
+/**
+ * @brief Build command implementation
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @return Exit code
+ */
+int cmd_build(int argc, char* argv[]) {
+    cmd_variable_t variables[MAX_BUILD_VARIABLES];
+    build_options options = { NULL, NULL, BUILD_CACHE_DEFAULT_DIR, false, variables, 0 };
+    bool failed = false;
+    
+    for (int i = 2; i < argc && !failed; i++) {
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            printf("Usage: xmd build <input_dir|file.md> <output_dir|file> [options]\n"
+                   "Options:\n"
+                   "  -v, --variable <k=v>  Set variable (can be used multiple times)\n"
+                   "  --cache-dir <dir>     Build cache directory (default: %s)\n"
+                   "  --no-cache            Render every file\n"
+                   "  --verbose             List each file and its outcome\n",
+                   BUILD_CACHE_DEFAULT_DIR);
+            cleanup_cmd_variables(variables, options.var_count);
+            return 0;
+        } else if (strcmp(argv[i], "--no-cache") == 0) {
+            options.cache_dir = NULL;
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            options.verbose = true;
+        } else if (strcmp(argv[i], "--cache-dir") == 0 && value) {
+            options.cache_dir = argv[++i];
+        } else if ((strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--variable") == 0) && value) {
+            const char* equals = strchr(value, '=');
+            if (!equals) {
+                fprintf(stderr, "Error: Variable must be in key=value format\n");
+                failed = true;
+            } else if (options.var_count >= MAX_BUILD_VARIABLES) {
+                fprintf(stderr, "Error: Too many variables (max %d)\n", MAX_BUILD_VARIABLES);
+                failed = true;
+            } else {
+                variables[options.var_count].key = xmd_strndup(value, (size_t)(equals - value));
+                variables[options.var_count].value = xmd_strdup(equals + 1);
+                options.var_count++;
+                i++;
+            }
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Error: Unknown option or missing argument '%s'\n", argv[i]);
+            failed = true;
+        } else if (!options.input_path) {
+            options.input_path = argv[i];
+        } else if (!options.output_path) {
+            options.output_path = argv[i];
+        } else {
+            fprintf(stderr, "Error: Unexpected argument '%s'\n", argv[i]);
+            failed = true;
+        }
+    }
+    
+    int status = 1;
+    if (failed) {
+        // Already reported
+    } else if (!options.input_path || !options.output_path) {
+        fprintf(stderr, "Usage: %s build <input_dir|file.md> <output_dir|file> [options]\n", argv[0]);
+    } else {
+        status = run_build(&options);
+    }
+    cleanup_cmd_variables(variables, options.var_count);
+    return status;
+}
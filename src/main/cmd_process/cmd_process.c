@@ -12,6 +12,45 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Stop profiling and emit the requested reports
+ * @param profiler Attached profiler (may be NULL)
+ * @param heap Installed heap statistics to remove (may be NULL)
+ * @param options Parsed options naming the input and report destination
+ */
+static void finish_profile(perf_profiler* profiler, xmd_alloc_stats* heap,
+                           const cmd_process_options_t* options) {
+    if (heap) {
+        xmd_allocator_set(NULL);
+        xmd_alloc_stats_destroy(heap);
+    }
+    if (!profiler) {
+        return;
+    }
+    
+    perf_profiler_stop(profiler);
+    perf_profiler_attach(NULL);
+    
+    if (options->profile &&
+        perf_profiler_write_json(profiler, options->input_file, options->profile_output) != 0) {
+        fprintf(stderr, "Warning: Failed to write profile report\n");
+    }
+    if (options->hotspots) {
+        char* table = perf_hotspot_report_table(profiler);
+        if (table) {
+            fputs(table, stderr);
+            xmd_free(table);
+        }
+        if (options->hotspots_output &&
+            perf_hotspot_write_folded(profiler, options->hotspots_output) != 0) {
+            fprintf(stderr, "Warning: Cannot write collapsed stacks to '%s'\n", options->hotspots_output);
+        }
+    }
+    perf_profiler_destroy(profiler);
+}
 
 /**
  * @brief Process command implementation
@@ -46,10 +85,31 @@ int cmd_process(int argc, char* argv[]) {
         return 1;
     }
     
+    // Attach a profiler for the render and output stages when requested,
+    // counting heap traffic unless an allocator is already installed
+    perf_profiler* profiler = NULL;
+    xmd_alloc_stats heap;
+    bool track_heap = false;
+    if (options.profile || options.hotspots) {
+        track_heap = !xmd_allocator_get() && xmd_alloc_stats_init(&heap) == 0;
+        if (track_heap) {
+            xmd_allocator tracking = xmd_alloc_stats_allocator(&heap);
+            xmd_allocator_set(&tracking);
+        }
+        profiler = perf_profiler_create();
+        if (profiler) {
+            profiler->hotspots_enabled = options.hotspots;
+            if (perf_profiler_start(profiler) == 0) {
+                perf_profiler_attach(profiler);
+            }
+        }
+    }
+    
     // Process input
     xmd_result* result = cmd_process_handle_input(processor, &options);
     if (!result) {
         fprintf(stderr, "Error: Processing failed\n");
+        finish_profile(profiler, track_heap ? &heap : NULL, &options);
         xmd_processor_free(processor);
         xmd_config_free(config);
         cleanup_cmd_variables(cmd_variables, var_count);
@@ -57,7 +117,10 @@ int cmd_process(int argc, char* argv[]) {
     }
     
     // Format and output result
+    PERF_STAGE_BEGIN(PERF_STAGE_FORMAT);
     int output_result = cmd_process_format_output(result, &options);
+    PERF_STAGE_END(PERF_STAGE_FORMAT);
+    finish_profile(profiler, track_heap ? &heap : NULL, &options);
     if (output_result != 0) {
         xmd_result_free(result);
         xmd_processor_free(processor);
@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create XMD configuration for process command
@@ -32,16 +33,16 @@ xmd_config* cmd_process_create_config(const cmd_process_options_t* options) {
     
     config->debug_mode = options->debug_mode;
     config->trace_execution = options->trace_execution;
-    config->output_format = strdup(options->format);
+    config->output_format = xmd_strdup(options->format);
     
     if (!options->allow_exec) {
         // Disable command execution by setting empty whitelist
         if (!config->sandbox) {
             // Create sandbox config if it doesn't exist
-            config->sandbox = calloc(1, sizeof(xmd_sandbox_config));
+            config->sandbox = xmd_calloc(1, sizeof(xmd_sandbox_config));
         }
         if (config->sandbox) {
-            config->sandbox->exec_whitelist = calloc(1, sizeof(char*));
+            config->sandbox->exec_whitelist = xmd_calloc(1, sizeof(char*));
         }
     }
     
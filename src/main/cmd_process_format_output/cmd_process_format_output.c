@@ -12,6 +12,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Format and output result for process command
@@ -40,21 +42,13 @@ int cmd_process_format_output(const xmd_result* result,
     }
     
     // Output result
-    FILE* output_stream = stdout;
-    if (options->output_file && strcmp(options->output_file, "-") != 0) {
-        output_stream = fopen(options->output_file, "w");
-        if (!output_stream) {
-            fprintf(stderr, "Error: Cannot open output file '%s'\n", options->output_file);
-            return 1;
-        }
-    }
+    bool to_file = options->output_file && strcmp(options->output_file, "-") != 0;
     
     // Format output according to specified format
     size_t content_len = strlen(result->output);
-    char* formatted_output = malloc(content_len * 3 + 2000); // Extra space for formatting
+    char* formatted_output = xmd_malloc(content_len * 3 + 2000); // Extra space for formatting
     if (!formatted_output) {
         fprintf(stderr, "Error: Failed to allocate memory for formatting\n");
-        if (output_stream != stdout) fclose(output_stream);
         return 1;
     }
     
@@ -104,18 +98,23 @@ int cmd_process_format_output(const xmd_result* result,
         strcpy(formatted_output, result->output);
     }
     
-    fprintf(output_stream, "%s", formatted_output);
+    // An output file that already holds the result is left untouched
+    size_t formatted_len = strlen(formatted_output);
+    if (!to_file) {
+        fputs(formatted_output, stdout);
+    } else if (build_write_output(options->output_file, formatted_output, formatted_len, NULL) != 0) {
+        fprintf(stderr, "Error: Cannot open output file '%s'\n", options->output_file);
+        xmd_free(formatted_output);
+        return 1;
+    }
     
     // Print statistics in debug mode
     if (options->debug_mode) {
         fprintf(stderr, "Debug: Processed %zu bytes, output %zu bytes\n", 
-                content_len, strlen(formatted_output));
+                content_len, formatted_len);
     }
     
-    free(formatted_output);
-    if (output_stream != stdout) {
-        fclose(output_stream);
-    }
+    xmd_free(formatted_output);
     
     return 0;
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <string.h>
 #include <unistd.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Handle input processing for process command
@@ -31,7 +32,7 @@ xmd_result* cmd_process_handle_input(xmd_processor* processor,
     // Generate trace if requested (but not for stdin)
     if (options->trace_execution && !use_stdin) {
         // Create trace output filename
-        char* trace_file = malloc(strlen(options->input_file) + 20);
+        char* trace_file = xmd_malloc(strlen(options->input_file) + 20);
         if (trace_file) {
             sprintf(trace_file, "%s.trace.log", options->input_file);
             // Note: In a real implementation, we'd enable trace logging here
@@ -39,7 +40,7 @@ xmd_result* cmd_process_handle_input(xmd_processor* processor,
             if (options->debug_mode) {
                 fprintf(stderr, "Debug: Trace would be written to %s\n", trace_file);
             }
-            free(trace_file);
+            xmd_free(trace_file);
         }
     }
     
@@ -50,7 +51,7 @@ xmd_result* cmd_process_handle_input(xmd_processor* processor,
         // Read from stdin into buffer
         size_t buffer_size = 4096;
         size_t total_size = 0;
-        char* buffer = malloc(buffer_size);
+        char* buffer = xmd_malloc(buffer_size);
         if (!buffer) {
             fprintf(stderr, "Error: Failed to allocate memory for stdin buffer\n");
             return NULL;
@@ -63,10 +64,10 @@ xmd_result* cmd_process_handle_input(xmd_processor* processor,
             // Expand buffer if needed
             if (total_size >= buffer_size - 1) {
                 buffer_size *= 2;
-                char* new_buffer = realloc(buffer, buffer_size);
+                char* new_buffer = xmd_realloc(buffer, buffer_size);
                 if (!new_buffer) {
                     fprintf(stderr, "Error: Failed to expand stdin buffer\n");
-                    free(buffer);
+                    xmd_free(buffer);
                     return NULL;
                 }
                 buffer = new_buffer;
@@ -77,7 +78,7 @@ xmd_result* cmd_process_handle_input(xmd_processor* processor,
         
         // Process string content
         result = xmd_process_string(processor, buffer, total_size);
-        free(buffer);
+        xmd_free(buffer);
     } else {
         // Process file normally
         result = xmd_process_file(processor, options->input_file);
@@ -14,6 +14,7 @@
 #include <getopt.h>
 #include <unistd.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Parse command line arguments for process command
@@ -38,6 +39,10 @@ int cmd_process_parse_args(int argc, char* argv[], cmd_process_options_t* option
     options->debug_mode = false;
     options->trace_execution = false;
     options->allow_exec = true;
+    options->profile = false;
+    options->profile_output = NULL;
+    options->hotspots = false;
+    options->hotspots_output = NULL;
     *var_count = 0;
     
     // Parse arguments
@@ -66,8 +71,8 @@ int cmd_process_parse_args(int argc, char* argv[], cmd_process_options_t* option
                 
                 // Store variable for later setting on processor
                 *equals_pos = '\0';
-                cmd_variables[*var_count].key = strdup(var_arg);
-                cmd_variables[*var_count].value = strdup(equals_pos + 1);
+                cmd_variables[*var_count].key = xmd_strdup(var_arg);
+                cmd_variables[*var_count].value = xmd_strdup(equals_pos + 1);
                 (*var_count)++;
                 *equals_pos = '='; // Restore original string
             } else {
@@ -110,6 +115,16 @@ int cmd_process_parse_args(int argc, char* argv[], cmd_process_options_t* option
             options->trace_execution = true;
         } else if (strcmp(argv[i], "--no-exec") == 0) {
             options->allow_exec = false;
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            options->profile = true;
+        } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+            options->profile = true;
+            options->profile_output = argv[i] + 10;
+        } else if (strcmp(argv[i], "--hotspots") == 0) {
+            options->hotspots = true;
+        } else if (strncmp(argv[i], "--hotspots=", 11) == 0) {
+            options->hotspots = true;
+            options->hotspots_output = argv[i] + 11;
         } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
             print_usage("xmd");
             return 2; // Special return code for help
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Validate command implementation
@@ -35,7 +36,7 @@ int cmd_validate(int argc, char* argv[]) {
     fseek(file, 0, SEEK_SET);
     
     // Read content
-    char* content = malloc(file_size + 1);
+    char* content = xmd_malloc(file_size + 1);
     if (content == NULL) {
         fprintf(stderr, "Error: Out of memory\n");
         fclose(file);
@@ -48,7 +49,7 @@ int cmd_validate(int argc, char* argv[]) {
     
     // Validate syntax
     xmd_error_code error = xmd_validate_syntax(content, bytes_read);
-    free(content);
+    xmd_free(content);
     
     if (error == XMD_SUCCESS) {
         printf("✓ Syntax is valid\n");
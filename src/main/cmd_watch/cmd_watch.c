@@ -8,6 +8,7 @@
 #include <unistd.h>
 #include "../../../include/main_internal.h"
 #include "../../../include/import_tracker.h"
+#include "../../../include/build_cache.h"
 #include <dirent.h>
 #include <time.h>
 #include <sys/stat.h>
@@ -29,14 +30,18 @@
 #include <unistd.h>
 #include <string.h>
 #include <stdlib.h>
+#include "../../../include/allocator.h"
 
 // Ensure strdup is available
 #ifndef strdup
-char* strdup(const char* s);
+char* xmd_strdup(const char* s);
 #endif
 
 static volatile bool watch_running = true;
 static import_tracker_t* g_import_tracker = NULL;
+static build_cache* g_build_cache = NULL;
+static store* g_build_variables = NULL;
+static build_write_batch g_write_batch;
 
 // Forward declarations
 static int process_file_with_output(const char* filepath, const char* input_dir,
@@ -138,18 +143,18 @@ static char* generate_output_path(const char* input_path, const char* input_dir,
     
     // Build output path: output_dir + relative_path_without_extension + new_extension
     size_t output_path_len = strlen(output_dir) + strlen(relative_path) + strlen(ext) + 2;
-    char* output_path = malloc(output_path_len);
+    char* output_path = xmd_malloc(output_path_len);
     if (!output_path) return NULL;
     
     // Find the last dot to remove .md extension
-    char* relative_copy = strdup(relative_path);
+    char* relative_copy = xmd_strdup(relative_path);
     char* last_dot = strrchr(relative_copy, '.');
     if (last_dot && strcmp(last_dot, ".md") == 0) {
         *last_dot = '\0'; // Remove .md extension
     }
     
     snprintf(output_path, output_path_len, "%s/%s%s", output_dir, relative_copy, ext);
-    free(relative_copy);
+    xmd_free(relative_copy);
     
     return output_path;
 }
@@ -180,12 +185,12 @@ static bool is_file_visited(visited_file_t* visited_files, const char* filepath)
 
 // Helper function to add a file to visited list
 static visited_file_t* add_visited_file(visited_file_t* visited_files, const char* filepath) {
-    visited_file_t* new_visited = malloc(sizeof(visited_file_t));
+    visited_file_t* new_visited = xmd_malloc(sizeof(visited_file_t));
     if (!new_visited) return visited_files;
     
-    new_visited->filepath = strdup(filepath);
+    new_visited->filepath = xmd_strdup(filepath);
     if (!new_visited->filepath) {
-        free(new_visited);
+        xmd_free(new_visited);
         return visited_files;
     }
     
@@ -198,8 +203,8 @@ static void free_visited_files(visited_file_t* visited_files) {
     while (visited_files) {
         visited_file_t* current = visited_files;
         visited_files = visited_files->next;
-        free(current->filepath);
-        free(current);
+        xmd_free(current->filepath);
+        xmd_free(current);
     }
 }
 
@@ -241,9 +246,9 @@ static void process_dependent_files_internal(const char* changed_file, const cha
             process_dependent_files_internal(importers[i], input_dir, output_dir, format, 
                                            verbose, visited_files, depth + 1);
             
-            free(importers[i]);
+            xmd_free(importers[i]);
         }
-        free(importers);
+        xmd_free(importers);
     }
 }
 
@@ -275,7 +280,7 @@ static char* preprocess_at_syntax(const char* input) {
     
     size_t input_len = strlen(input);
     size_t output_capacity = input_len * 2 + 1; // Extra space for expansions  
-    char* output = malloc(output_capacity);
+    char* output = xmd_malloc(output_capacity);
     if (!output) {
         return NULL;
     }
@@ -294,7 +299,7 @@ static char* preprocess_at_syntax(const char* input) {
                 if (end) {
                     // Extract filename (remove quotes if present)
                     size_t filename_len = end - start;
-                    char* filename = malloc(filename_len + 1);
+                    char* filename = xmd_malloc(filename_len + 1);
                     if (filename) {
                         strncpy(filename, start, filename_len);
                         filename[filename_len] = '\0';
@@ -313,10 +318,10 @@ static char* preprocess_at_syntax(const char* input) {
                         size_t replacement_len = 15 + strlen(clean_filename) + 4; // "<!-- xmd: import " + filename + " -->"
                         if (output_pos + replacement_len >= output_capacity) {
                             output_capacity = (output_pos + replacement_len) * 2;
-                            char* new_output = realloc(output, output_capacity);
+                            char* new_output = xmd_realloc(output, output_capacity);
                             if (!new_output) {
-                                free(filename);
-                                free(output);
+                                xmd_free(filename);
+                                xmd_free(output);
                                 return NULL;
                             }
                             output = new_output;
@@ -329,7 +334,7 @@ static char* preprocess_at_syntax(const char* input) {
                             output_pos += written;
                         }
                         
-                        free(filename);
+                        xmd_free(filename);
                         ptr = end + 1; // Skip past the closing parenthesis
                         continue;
                     }
@@ -340,9 +345,9 @@ static char* preprocess_at_syntax(const char* input) {
         // Copy character as-is if not part of @ directive
         if (output_pos >= output_capacity - 1) {
             output_capacity *= 2;
-            char* new_output = realloc(output, output_capacity);
+            char* new_output = xmd_realloc(output, output_capacity);
             if (!new_output) {
-                free(output);
+                xmd_free(output);
                 return NULL;
             }
             output = new_output;
@@ -372,7 +377,7 @@ static void track_file_imports(const char* filepath) {
     long file_size = ftell(file);
     fseek(file, 0, SEEK_SET);
     
-    char* content = malloc(file_size + 1);
+    char* content = xmd_malloc(file_size + 1);
     if (!content) {
         fclose(file);
         return;
@@ -384,7 +389,7 @@ static void track_file_imports(const char* filepath) {
     
     // Preprocess @ syntax to HTML comments before extracting imports
     char* processed_content = preprocess_at_syntax(content);
-    free(content);
+    xmd_free(content);
     
     if (!processed_content) {
         return;
@@ -398,12 +403,44 @@ static void track_file_imports(const char* filepath) {
         // Track each import dependency
         for (int i = 0; i < import_count; i++) {
             import_tracker_add_dependency(g_import_tracker, filepath, imports[i]);
-            free(imports[i]);
+            xmd_free(imports[i]);
         }
-        free(imports);
+        xmd_free(imports);
     }
     
-    free(processed_content);
+    xmd_free(processed_content);
+}
+
+/**
+ * @brief Build a file to its output through the build cache
+ *
+ * A file whose source, imports and output are unchanged since its last
+ * build is skipped, and an output that renders to the bytes already on
+ * disk is left untouched.
+ */
+static int build_to_output(const char* input_file, const char* output_file, bool verbose) {
+    build_file_status outcome = build_cache_build_file(g_build_cache, g_build_variables,
+                                                       input_file, output_file);
+    if (outcome == BUILD_FILE_FAILED) {
+        printf("❌ Error processing: %s\n", input_file);
+        return 1;
+    }
+    
+    // Track imports for this file
+    track_file_imports(input_file);
+    
+    if (outcome == BUILD_FILE_CACHED) {
+        if (verbose) {
+            printf("⏭️  Up to date: %s → %s\n", input_file, output_file);
+        }
+    } else if (outcome == BUILD_FILE_UNCHANGED) {
+        printf("✅ %s → %s (unchanged)\n", input_file, output_file);
+    } else if (verbose) {
+        printf("✅ Successfully processed: %s → %s\n", input_file, output_file);
+    } else {
+        printf("✅ %s → %s\n", input_file, output_file);
+    }
+    return 0;
 }
 
 /**
@@ -418,39 +455,8 @@ static int process_file_with_output(const char* filepath, const char* input_dir,
     char* output_path = generate_output_path(filepath, input_dir, output_dir, format);
     
     if (output_path) {
-        // Create output directory if needed
-        char* output_dir_path = strdup(output_path);
-        char* last_slash = strrchr(output_dir_path, '/');
-        if (last_slash) {
-            *last_slash = '\0';
-            if (create_directory_recursive(output_dir_path) != 0) {
-                printf("❌ Failed to create output directory: %s\n", output_dir_path);
-                free(output_dir_path);
-                free(output_path);
-                return 1;
-            }
-        }
-        free(output_dir_path);
-        
-        // Create process command arguments with output
-        char* process_argv[] = { "xmd", "process", (char*)filepath, "-o", output_path, "--format", (char*)format, NULL };
-        
-        int result = cmd_process(7, process_argv);
-        
-        if (result == 0) {
-            // Track imports for this file
-            track_file_imports(filepath);
-            
-            if (verbose) {
-                printf("✅ Successfully processed: %s → %s\n", filepath, output_path);
-            } else {
-                printf("✅ %s → %s\n", filepath, output_path);
-            }
-        } else {
-            printf("❌ Error processing: %s\n", filepath);
-        }
-        
-        free(output_path);
+        int result = build_to_output(filepath, output_path, verbose);
+        xmd_free(output_path);
         return result;
     } else {
         // No output directory - process to stdout
@@ -483,38 +489,7 @@ static int process_single_file_with_output(const char* input_file, const char* o
     }
     
     if (output_file) {
-        // Create output directory if needed
-        char* output_dir_path = strdup(output_file);
-        char* last_slash = strrchr(output_dir_path, '/');
-        if (last_slash) {
-            *last_slash = '\0';
-            if (create_directory_recursive(output_dir_path) != 0) {
-                printf("❌ Failed to create output directory: %s\n", output_dir_path);
-                free(output_dir_path);
-                return 1;
-            }
-        }
-        free(output_dir_path);
-        
-        // Create process command arguments with direct output
-        char* process_argv[] = { "xmd", "process", (char*)input_file, "-o", (char*)output_file, "--format", (char*)format, NULL };
-        
-        int result = cmd_process(7, process_argv);
-        
-        if (result == 0) {
-            // Track imports for this file
-            track_file_imports(input_file);
-            
-            if (verbose) {
-                printf("✅ Successfully processed: %s → %s\n", input_file, output_file);
-            } else {
-                printf("✅ %s → %s\n", input_file, output_file);
-            }
-        } else {
-            printf("❌ Error processing: %s\n", input_file);
-        }
-        
-        return result;
+        return build_to_output(input_file, output_file, verbose);
     } else {
         // No output file - process to stdout
         char* process_argv[] = { "xmd", "process", (char*)input_file, "--format", (char*)format, NULL };
@@ -565,7 +540,7 @@ static int count_markdown_files_recursive(const char* dir_path) {
         
         // Create full path
         size_t path_len = strlen(dir_path) + strlen(entry->d_name) + 2;
-        char* full_path = malloc(path_len);
+        char* full_path = xmd_malloc(path_len);
         snprintf(full_path, path_len, "%s/%s", dir_path, entry->d_name);
         
         struct stat st;
@@ -577,7 +552,7 @@ static int count_markdown_files_recursive(const char* dir_path) {
                 count += count_markdown_files_recursive(full_path);
             }
         }
-        free(full_path);
+        xmd_free(full_path);
     }
     
     closedir(dir);
@@ -601,7 +576,7 @@ static void collect_markdown_files_recursive(const char* dir_path, char** files,
         
         // Create full path
         size_t path_len = strlen(dir_path) + strlen(entry->d_name) + 2;
-        char* full_path = malloc(path_len);
+        char* full_path = xmd_malloc(path_len);
         snprintf(full_path, path_len, "%s/%s", dir_path, entry->d_name);
         
         struct stat st;
@@ -613,12 +588,12 @@ static void collect_markdown_files_recursive(const char* dir_path, char** files,
             } else if (S_ISDIR(st.st_mode)) {
                 // Recursively collect files from subdirectory
                 collect_markdown_files_recursive(full_path, files, mtimes, index);
-                free(full_path);
+                xmd_free(full_path);
             } else {
-                free(full_path);
+                xmd_free(full_path);
             }
         } else {
-            free(full_path);
+            xmd_free(full_path);
         }
     }
     
@@ -640,8 +615,8 @@ static int scan_directory(const char* dir_path, char*** files, time_t** mtimes,
     }
     
     // Allocate arrays
-    *files = malloc(count * sizeof(char*));
-    *mtimes = malloc(count * sizeof(time_t));
+    *files = xmd_malloc(count * sizeof(char*));
+    *mtimes = xmd_malloc(count * sizeof(time_t));
     if (!*files || !*mtimes) {
         return -1;
     }
@@ -660,12 +635,12 @@ static int scan_directory(const char* dir_path, char*** files, time_t** mtimes,
 static void free_file_arrays(char** files, time_t* mtimes, int count) {
     if (files) {
         for (int i = 0; i < count; i++) {
-            free(files[i]);
+            xmd_free(files[i]);
         }
-        free(files);
+        xmd_free(files);
     }
     if (mtimes) {
-        free(mtimes);
+        xmd_free(mtimes);
     }
 }
 
@@ -681,6 +656,8 @@ int cmd_watch(int argc, char* argv[]) {
         fprintf(stderr, "\nOptions:\n");
         fprintf(stderr, "  --output-dir, -o <dir>  Output directory (directory mode only)\n");
         fprintf(stderr, "  --format <fmt>          Output format: markdown, html, json (default: markdown)\n");
+        fprintf(stderr, "  --cache-dir <dir>       Build cache directory (default: %s)\n", BUILD_CACHE_DEFAULT_DIR);
+        fprintf(stderr, "  --no-cache              Render every file at startup\n");
         fprintf(stderr, "  --verbose, -v           Verbose output\n");
         fprintf(stderr, "\nExamples:\n");
         fprintf(stderr, "  %s watch src/ dist/                        # Directory mode\n", argv[0]);
@@ -694,6 +671,7 @@ int cmd_watch(int argc, char* argv[]) {
     const char* format = "markdown";  // Default to markdown for watch
     bool verbose = false;
     bool is_file_mode = false;
+    const char* cache_dir = BUILD_CACHE_DEFAULT_DIR;
     
     // Detect input type: file vs directory
     struct stat input_st;
@@ -728,6 +706,10 @@ int cmd_watch(int argc, char* argv[]) {
                 fprintf(stderr, "Error: Invalid format '%s'. Valid formats: markdown, html, json\n", format);
                 return 1;
             }
+        } else if (strcmp(argv[i], "--cache-dir") == 0 && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if (strcmp(argv[i], "--no-cache") == 0) {
+            cache_dir = NULL;
         } else if (strcmp(argv[i], "--verbose") == 0 || strcmp(argv[i], "-v") == 0) {
             verbose = true;
         } else {
@@ -750,17 +732,17 @@ int cmd_watch(int argc, char* argv[]) {
         }
         
         // Check if output directory exists and create if needed
-        char* output_dir_path = strdup(output_path);
+        char* output_dir_path = xmd_strdup(output_path);
         char* last_slash = strrchr(output_dir_path, '/');
         if (last_slash) {
             *last_slash = '\0';
             if (create_directory_recursive(output_dir_path) != 0) {
                 printf("❌ Failed to create output directory: %s\n", output_dir_path);
-                free(output_dir_path);
+                xmd_free(output_dir_path);
                 return 1;
             }
         }
-        free(output_dir_path);
+        xmd_free(output_dir_path);
     } else {
         // Directory mode validation
         if (!S_ISDIR(input_st.st_mode)) {
@@ -784,6 +766,25 @@ int cmd_watch(int argc, char* argv[]) {
     // Re-enabling after @ syntax implementation - should be safe now
     xmd_set_global_import_tracker(g_import_tracker);
     
+    // Outputs are built through the cache; options match a plain `xmd build`
+    g_build_variables = store_create();
+    if (!g_build_variables) {
+        fprintf(stderr, "Error: Failed to create variable store\n");
+        xmd_set_global_import_tracker(NULL);
+        import_tracker_free(g_import_tracker);
+        g_import_tracker = NULL;
+        return 1;
+    }
+    build_write_batch_init(&g_write_batch);
+    build_write_batch_attach(&g_write_batch);
+    if (cache_dir && output_path) {
+        const char* version = xmd_get_version();
+        g_build_cache = build_cache_open(cache_dir, build_cache_hash(version, strlen(version) + 1));
+        if (!g_build_cache) {
+            fprintf(stderr, "Warning: Cannot open build cache '%s', rendering every file\n", cache_dir);
+        }
+    }
+    
     if (is_file_mode) {
         printf("🔍 Watching file: %s\n", input_path);
         if (output_path) {
@@ -803,13 +804,13 @@ int cmd_watch(int argc, char* argv[]) {
     if (is_file_mode) {
         // File mode: start with single file, but will add imported files after processing
         file_count = 1;
-        files = malloc(sizeof(char*));
-        mtimes = malloc(sizeof(time_t));
+        files = xmd_malloc(sizeof(char*));
+        mtimes = xmd_malloc(sizeof(time_t));
         if (!files || !mtimes) {
             fprintf(stderr, "Error: Memory allocation failed\n");
             return 1;
         }
-        files[0] = strdup(input_path);
+        files[0] = xmd_strdup(input_path);
         mtimes[0] = get_file_mtime(input_path);
     } else {
         // Directory mode: scan for all markdown files
@@ -849,6 +850,7 @@ int cmd_watch(int argc, char* argv[]) {
         }
     }
     
+    build_write_batch_flush(&g_write_batch);
     if (file_count > 0) {
         printf("\n✅ Initial processing complete. Watching for changes...\n\n");
     }
@@ -862,7 +864,7 @@ int cmd_watch(int argc, char* argv[]) {
             long file_size = ftell(file);
             fseek(file, 0, SEEK_SET);
             
-            char* content = malloc(file_size + 1);
+            char* content = xmd_malloc(file_size + 1);
             if (content) {
                 size_t read_size = fread(content, 1, file_size, file);
                 content[read_size] = '\0';
@@ -876,8 +878,8 @@ int cmd_watch(int argc, char* argv[]) {
                         printf("📚 Found %d imported file(s) to watch:\n", import_count);
                         
                         // Resize arrays to include imported files
-                        char** new_files = realloc(files, (file_count + import_count) * sizeof(char*));
-                        time_t* new_mtimes = realloc(mtimes, (file_count + import_count) * sizeof(time_t));
+                        char** new_files = xmd_realloc(files, (file_count + import_count) * sizeof(char*));
+                        time_t* new_mtimes = xmd_realloc(mtimes, (file_count + import_count) * sizeof(time_t));
                         
                         if (new_files && new_mtimes) {
                             files = new_files;
@@ -888,19 +890,19 @@ int cmd_watch(int argc, char* argv[]) {
                                 // Check if file exists
                                 struct stat st;
                                 if (stat(imports[i], &st) == 0 && S_ISREG(st.st_mode)) {
-                                    files[file_count] = strdup(imports[i]);
+                                    files[file_count] = xmd_strdup(imports[i]);
                                     mtimes[file_count] = st.st_mtime;
                                     printf("  ➕ %s\n", imports[i]);
                                     file_count++;
                                 }
-                                free(imports[i]);
+                                xmd_free(imports[i]);
                             }
                             printf("\n");
                         }
-                        free(imports);
+                        xmd_free(imports);
                     }
                 }
-                free(content);
+                xmd_free(content);
             }
             fclose(file);
         }
@@ -933,7 +935,7 @@ int cmd_watch(int argc, char* argv[]) {
                     }
                     
                     // Process all files that import this changed file (directory needs to be derived)
-                    char* file_dir = strdup(files[i]);
+                    char* file_dir = xmd_strdup(files[i]);
                     char* last_slash = strrchr(file_dir, '/');
                     if (last_slash) {
                         *last_slash = '\0';
@@ -941,7 +943,7 @@ int cmd_watch(int argc, char* argv[]) {
                     } else {
                         process_dependent_files(files[i], ".", NULL, format, verbose);
                     }
-                    free(file_dir);
+                    xmd_free(file_dir);
                 } else {
                     // Directory mode: use original logic
                     process_file_with_output(files[i], input_path, output_path, format, verbose);
@@ -953,6 +955,9 @@ int cmd_watch(int argc, char* argv[]) {
             }
         }
         
+        // Each poll's rebuilds form one write wave
+        build_write_batch_flush(&g_write_batch);
+        
         // Check if we should stop after processing files
         if (!watch_running) break;
         
@@ -987,6 +992,12 @@ int cmd_watch(int argc, char* argv[]) {
     
     // Cleanup
     free_file_arrays(files, mtimes, file_count);
+    build_write_batch_attach(NULL);
+    build_write_batch_flush(&g_write_batch);
+    build_cache_close(g_build_cache);
+    g_build_cache = NULL;
+    store_destroy(g_build_variables);
+    g_build_variables = NULL;
     if (g_import_tracker) {
         xmd_set_global_import_tracker(NULL); // Clear global tracker
         import_tracker_free(g_import_tracker);
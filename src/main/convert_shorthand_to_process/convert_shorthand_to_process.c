@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Convert shorthand arguments to full process command
@@ -23,7 +24,7 @@
  */
 int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char*** new_argv) {
     // Maximum possible arguments: original + "process" + "-o" + output
-    char** processed_argv = malloc(sizeof(char*) * (argc + 4));
+    char** processed_argv = xmd_malloc(sizeof(char*) * (argc + 4));
     if (!processed_argv) {
         return -1;
     }
@@ -34,7 +35,7 @@ int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char***
     processed_argv[processed_argc++] = argv[0];
     
     // Add "process" command
-    processed_argv[processed_argc++] = strdup("process");
+    processed_argv[processed_argc++] = xmd_strdup("process");
     
     // Analyze arguments to detect pattern
     // Only consider stdin available if it's actually piped (not interactive terminal)
@@ -56,30 +57,30 @@ int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char***
             return 0;
         } else {
             // Show usage
-            free(processed_argv[1]);
-            free(processed_argv);
+            xmd_free(processed_argv[1]);
+            xmd_free(processed_argv);
             return -1;
         }
     } else if (has_stdin) {
         // Handle stdin patterns: echo "content" | xmd [output.md] [options...]
         if (first_is_file) {
             // echo "content" | xmd output.md [options...] -> xmd process -o output.md [options...]
-            processed_argv[processed_argc++] = strdup("-o");
-            processed_argv[processed_argc++] = strdup(argv[1]);
+            processed_argv[processed_argc++] = xmd_strdup("-o");
+            processed_argv[processed_argc++] = xmd_strdup(argv[1]);
             
             // Add remaining arguments (options)
             for (int i = 2; i < argc; i++) {
-                processed_argv[processed_argc++] = strdup(argv[i]);
+                processed_argv[processed_argc++] = xmd_strdup(argv[i]);
             }
         } else {
             // echo "content" | xmd [options...] -> xmd process [options...]
             for (int i = 1; i < argc; i++) {
-                processed_argv[processed_argc++] = strdup(argv[i]);
+                processed_argv[processed_argc++] = xmd_strdup(argv[i]);
             }
         }
     } else if (first_is_file) {
         // Handle file input patterns: xmd input.md [output.md] [options...]
-        processed_argv[processed_argc++] = strdup(argv[1]); // input file
+        processed_argv[processed_argc++] = xmd_strdup(argv[1]); // input file
         
         // Check for two-file pattern: xmd input.md output.md
         // Only if: argc == 3 AND second arg is file AND second arg doesn't start with -
@@ -87,19 +88,19 @@ int convert_shorthand_to_process(int argc, char* argv[], int* new_argc, char***
             looks_like_file_path(argv[2]) && 
             argv[2][0] != '-') {
             // xmd input.md output.md -> xmd process input.md -o output.md
-            processed_argv[processed_argc++] = strdup("-o");
-            processed_argv[processed_argc++] = strdup(argv[2]);
+            processed_argv[processed_argc++] = xmd_strdup("-o");
+            processed_argv[processed_argc++] = xmd_strdup(argv[2]);
         } else {
             // All other cases: xmd input.md [options...] 
             // Just pass through remaining arguments as-is
             for (int i = 2; i < argc; i++) {
-                processed_argv[processed_argc++] = strdup(argv[i]);
+                processed_argv[processed_argc++] = xmd_strdup(argv[i]);
             }
         }
     } else {
         // No recognizable pattern - pass through all arguments
         for (int i = 1; i < argc; i++) {
-            processed_argv[processed_argc++] = strdup(argv[i]);
+            processed_argv[processed_argc++] = xmd_strdup(argv[i]);
         }
     }
     
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/main_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free converted argument vector
@@ -15,7 +16,7 @@
  */
 void free_converted_argv(int argc, char** argv) {
     for (int i = 1; i < argc; i++) { // Skip argv[0] as it's not duplicated
-        free(argv[i]);
+        xmd_free(argv[i]);
     }
-    free(argv);
+    xmd_free(argv);
 }
\ No newline at end of file
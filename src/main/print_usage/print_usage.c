@@ -22,6 +22,8 @@ void print_usage(const char* program_name) {
     printf("  process            Process XMD input from stdin (when piped)\n");
     printf("  watch <input_dir> [output_dir]  Watch directory for changes and auto-process\n");
     printf("  validate <file>    Validate XMD syntax without processing\n");
+    printf("  build <input> <output>  Render a file or directory, skipping unchanged files\n");
+    printf("  bench              Run the macro-benchmark corpus\n");
     printf("  upgrade            Upgrade XMD to the latest version\n");
     printf("  uninstall         Uninstall XMD from the system\n");
     printf("  version           Show version information\n");
@@ -33,12 +35,15 @@ void print_usage(const char* program_name) {
     printf("  --debug               Enable debug mode\n");
     printf("  --trace               Enable execution tracing\n");
     printf("  --no-exec             Disable command execution\n");
+    printf("  --profile[=<file>]    Report per-stage timings as JSON (default: stderr)\n");
+    printf("  --hotspots[=<file>]   Print per-directive costs; write collapsed stacks to file\n");
     printf("  --format <fmt>        Output format: markdown, html, json\n");
     printf("\nExamples:\n");
     printf("  %s process input.md -o output.md\n", program_name);
     printf("  %s process template.md -v env=prod -v region=us-east\n", program_name);
     printf("  %s watch src/ dist/ --format html\n", program_name);
     printf("  %s watch ./docs --output-dir ./build --verbose\n", program_name);
+    printf("  %s build docs/ site/ -v env=prod\n", program_name);
     printf("  %s validate document.md\n", program_name);
     printf("\nShorthand Examples:\n");
     printf("  %s input.md                    # Process input.md to stdout\n", program_name);
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add dependency to module
@@ -29,14 +30,14 @@ int module_add_dependency(Module* module, const char* dependency_name) {
     }
     
     // Reallocate dependencies array
-    char** new_dependencies = realloc(module->dependencies, 
+    char** new_dependencies = xmd_realloc(module->dependencies, 
                                      (module->dependency_count + 1) * sizeof(char*));
     if (!new_dependencies) {
         return MODULE_ERROR;
     }
     
     module->dependencies = new_dependencies;
-    module->dependencies[module->dependency_count] = strdup(dependency_name);
+    module->dependencies[module->dependency_count] = xmd_strdup(dependency_name);
     
     if (!module->dependencies[module->dependency_count]) {
         return MODULE_ERROR;
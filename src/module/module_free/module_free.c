@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a module
@@ -15,9 +16,9 @@ void module_free(Module* module) {
         return;
     }
     
-    free(module->name);
-    free(module->path);
-    free(module->content);
+    xmd_free(module->name);
+    xmd_free(module->path);
+    xmd_free(module->content);
     
     if (module->exports) {
         store_destroy(module->exports);
@@ -25,10 +26,10 @@ void module_free(Module* module) {
     
     if (module->dependencies) {
         for (size_t i = 0; i < module->dependency_count; i++) {
-            free(module->dependencies[i]);
+            xmd_free(module->dependencies[i]);
         }
-        free(module->dependencies);
+        xmd_free(module->dependencies);
     }
     
-    free(module);
+    xmd_free(module);
 }
\ No newline at end of file
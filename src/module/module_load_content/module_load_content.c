@@ -5,6 +5,8 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Load module content from file
@@ -22,6 +24,7 @@ int module_load_content(Module* module) {
     
     FILE* file = fopen(module->path, "r");
     if (!file) {
+        build_inputs_record_file(module->path, NULL, 0);
         return MODULE_NOT_FOUND;
     }
     
@@ -36,7 +39,7 @@ int module_load_content(Module* module) {
     }
     
     // Allocate buffer and read content
-    module->content = malloc(file_size + 1);
+    module->content = xmd_malloc(file_size + 1);
     if (!module->content) {
         fclose(file);
         return MODULE_ERROR;
@@ -44,6 +47,7 @@ int module_load_content(Module* module) {
     
     size_t bytes_read = fread(module->content, 1, file_size, file);
     module->content[bytes_read] = '\0';
+    build_inputs_record_file(module->path, module->content, bytes_read);
     
     fclose(file);
     module->loaded = true;
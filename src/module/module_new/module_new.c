@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new module
@@ -21,13 +22,13 @@ Module* module_new(const char* name, const char* path) {
         return NULL;
     }
     
-    Module* module = malloc(sizeof(Module));
+    Module* module = xmd_malloc(sizeof(Module));
     if (!module) {
         return NULL;
     }
     
-    module->name = strdup(name);
-    module->path = strdup(path);
+    module->name = xmd_strdup(name);
+    module->path = xmd_strdup(path);
     module->content = NULL;
     module->exports = store_create();
     module->dependencies = NULL;
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add search path to registry
@@ -22,14 +23,14 @@ int module_registry_add_search_path(ModuleRegistry* registry, const char* path)
     }
     
     // Reallocate search paths array
-    char** new_paths = realloc(registry->search_paths, 
+    char** new_paths = xmd_realloc(registry->search_paths, 
                               (registry->search_path_count + 1) * sizeof(char*));
     if (!new_paths) {
         return MODULE_ERROR;
     }
     
     registry->search_paths = new_paths;
-    registry->search_paths[registry->search_path_count] = strdup(path);
+    registry->search_paths[registry->search_path_count] = xmd_strdup(path);
     
     if (!registry->search_paths[registry->search_path_count]) {
         return MODULE_ERROR;
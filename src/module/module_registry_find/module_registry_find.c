@@ -17,11 +17,6 @@ Module* module_registry_find(ModuleRegistry* registry, const char* name) {
         return NULL;
     }
     
-    for (size_t i = 0; i < registry->count; i++) {
-        if (strcmp(registry->modules[i]->name, name) == 0) {
-            return registry->modules[i];
-        }
-    }
-    
-    return NULL;
+    size_t id = module_registry_find_id(registry, name);
+    return id == NAME_INDEX_NONE ? NULL : registry->modules[id];
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ * @file module_registry_find_id.c
+ * @brief Module registry ID lookup
+ * @author XMD Team
+ */
+
+#include "../../../include/module_internal.h"
+
+/**
+ * @brief Find a module's ID by name
+ * @param registry Module registry
+ * @param name Module name
+ * @return Position of the module in registry->modules, or NAME_INDEX_NONE
+ */
+size_t module_registry_find_id(const ModuleRegistry* registry, const char* name) {
+    if (!registry || !name) {
+        return NAME_INDEX_NONE;
+    }
+    
+    return name_index_find(&registry->index, name);
+}
@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a module registry
@@ -19,13 +20,14 @@ void module_registry_free(ModuleRegistry* registry) {
     for (size_t i = 0; i < registry->count; i++) {
         module_free(registry->modules[i]);
     }
-    free(registry->modules);
+    xmd_free(registry->modules);
     
     // Free search paths
     for (size_t i = 0; i < registry->search_path_count; i++) {
-        free(registry->search_paths[i]);
+        xmd_free(registry->search_paths[i]);
     }
-    free(registry->search_paths);
+    xmd_free(registry->search_paths);
+    name_index_free(&registry->index);
     
-    free(registry);
+    xmd_free(registry);
 }
\ No newline at end of file
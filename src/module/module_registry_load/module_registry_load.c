@@ -5,9 +5,11 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/dependency.h"
+#include "../../../include/platform.h"
 
 /**
- * @brief Load module by name
+ * @brief Load module by name, after the registered modules it depends on
  * @param registry Module registry
  * @param name Module name
  * @return ModuleResult indicating success/failure
@@ -22,5 +24,6 @@ int module_registry_load(ModuleRegistry* registry, const char* name) {
         return MODULE_NOT_FOUND;
     }
     
-    return module_load_content(module);
+    // No compile step: modules are plain content until the caller exports from them
+    return dependency_load_modules(registry, name, xmd_get_cpu_count(), NULL, NULL);
 }
\ No newline at end of file
@@ -5,20 +5,21 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new module registry
  * @return New module registry or NULL on error
  */
 ModuleRegistry* module_registry_new(void) {
-    ModuleRegistry* registry = malloc(sizeof(ModuleRegistry));
+    ModuleRegistry* registry = xmd_malloc(sizeof(ModuleRegistry));
     if (!registry) {
         return NULL;
     }
     
-    registry->modules = malloc(16 * sizeof(Module*));
+    registry->modules = xmd_malloc(16 * sizeof(Module*));
     if (!registry->modules) {
-        free(registry);
+        xmd_free(registry);
         return NULL;
     }
     
@@ -26,6 +27,7 @@ ModuleRegistry* module_registry_new(void) {
     registry->capacity = 16;
     registry->search_paths = NULL;
     registry->search_path_count = 0;
+    registry->index = (name_index){0};
     
     return registry;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Register a module in the registry
@@ -18,16 +19,14 @@ int module_registry_register(ModuleRegistry* registry, Module* module) {
     }
     
     // Check if module already exists
-    for (size_t i = 0; i < registry->count; i++) {
-        if (strcmp(registry->modules[i]->name, module->name) == 0) {
-            return MODULE_ALREADY_LOADED;
-        }
+    if (name_index_find(&registry->index, module->name) != NAME_INDEX_NONE) {
+        return MODULE_ALREADY_LOADED;
     }
     
     // Expand capacity if needed
     if (registry->count >= registry->capacity) {
         size_t new_capacity = registry->capacity * 2;
-        Module** new_modules = realloc(registry->modules, 
+        Module** new_modules = xmd_realloc(registry->modules, 
                                       new_capacity * sizeof(Module*));
         if (!new_modules) {
             return MODULE_ERROR;
@@ -37,6 +36,9 @@ int module_registry_register(ModuleRegistry* registry, Module* module) {
         registry->capacity = new_capacity;
     }
     
+    if (!name_index_insert(&registry->index, module->name, registry->count)) {
+        return MODULE_ERROR;
+    }
     registry->modules[registry->count] = module;
     registry->count++;
     
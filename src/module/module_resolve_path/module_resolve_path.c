@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include "../../../include/module_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Resolve module path
@@ -27,7 +28,7 @@ int module_resolve_path(ModuleRegistry* registry, const char* name, char** resol
     // If it's an absolute path, use it directly
     if (name[0] == '/') {
         if (file_exists(name)) {
-            *resolved_path = strdup(name);
+            *resolved_path = xmd_strdup(name);
             return *resolved_path ? MODULE_SUCCESS : MODULE_ERROR;
         }
         return MODULE_NOT_FOUND;
@@ -36,7 +37,7 @@ int module_resolve_path(ModuleRegistry* registry, const char* name, char** resol
     // Try to find in search paths
     for (size_t i = 0; i < registry->search_path_count; i++) {
         size_t path_len = strlen(registry->search_paths[i]) + strlen(name) + 10;
-        char* candidate = malloc(path_len);
+        char* candidate = xmd_malloc(path_len);
         if (!candidate) {
             return MODULE_ERROR;
         }
@@ -55,12 +56,12 @@ int module_resolve_path(ModuleRegistry* registry, const char* name, char** resol
             return MODULE_SUCCESS;
         }
         
-        free(candidate);
+        xmd_free(candidate);
     }
     
     // If not found in search paths and it's a relative name, assume it's a path
     if (file_exists(name)) {
-        *resolved_path = strdup(name);
+        *resolved_path = xmd_strdup(name);
         return *resolved_path ? MODULE_SUCCESS : MODULE_ERROR;
     }
     
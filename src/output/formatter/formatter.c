@@ -8,13 +8,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new output formatter
  * @return New output formatter or NULL on error
  */
 OutputFormatter* output_formatter_new(void) {
-    OutputFormatter* formatter = malloc(sizeof(OutputFormatter));
+    OutputFormatter* formatter = xmd_malloc(sizeof(OutputFormatter));
     if (!formatter) {
         return NULL;
     }
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Escape JSON special characters
@@ -23,7 +24,7 @@ int output_escape_json(const char* input, char** result) {
     
     size_t input_len = strlen(input);
     size_t output_size = input_len * 6 + 1; // Worst case: every char becomes \uxxxx
-    char* output = malloc(output_size);
+    char* output = xmd_malloc(output_size);
     if (!output) {
         return OUTPUT_ERROR;
     }
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Format text as code block
@@ -26,7 +27,7 @@ int output_format_as_code(const char* input, const char* language, char** result
     size_t lang_len = language ? strlen(language) : 0;
     size_t output_size = input_len + lang_len + 20; // Extra space for markdown
     
-    char* output = malloc(output_size);
+    char* output = xmd_malloc(output_size);
     if (!output) {
         return OUTPUT_ERROR;
     }
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Format text according to specified format
@@ -28,7 +29,7 @@ int output_format_text(OutputFormatter* formatter, const char* input,
     
     switch (format) {
         case OUTPUT_FORMAT_RAW:
-            *result = strdup(input);
+            *result = xmd_strdup(input);
             return *result ? OUTPUT_SUCCESS : OUTPUT_ERROR;
             
         case OUTPUT_FORMAT_CODE:
@@ -36,7 +37,7 @@ int output_format_text(OutputFormatter* formatter, const char* input,
             
         case OUTPUT_FORMAT_MARKDOWN:
             // For markdown, just ensure it's escaped properly
-            *result = strdup(input);
+            *result = xmd_strdup(input);
             return *result ? OUTPUT_SUCCESS : OUTPUT_ERROR;
             
         case OUTPUT_FORMAT_HTML:
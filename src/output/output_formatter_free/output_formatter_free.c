@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free an output formatter
@@ -18,6 +19,6 @@ void output_formatter_free(OutputFormatter* formatter) {
         return;
     }
     
-    free(formatter->last_error);
-    free(formatter);
+    xmd_free(formatter->last_error);
+    xmd_free(formatter);
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Strip ANSI color codes from text
@@ -23,7 +24,7 @@ int output_strip_ansi_codes(const char* input, char** result) {
     }
     
     size_t input_len = strlen(input);
-    char* output = malloc(input_len + 1);
+    char* output = xmd_malloc(input_len + 1);
     if (!output) {
         return OUTPUT_ERROR;
     }
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Truncate text to maximum length
@@ -26,11 +27,11 @@ int output_truncate(const char* input, size_t max_length, char** result) {
     
     size_t input_len = strlen(input);
     if (input_len <= max_length) {
-        *result = strdup(input);
+        *result = xmd_strdup(input);
         return *result ? OUTPUT_SUCCESS : OUTPUT_ERROR;
     }
     
-    char* output = malloc(max_length + 4); // +3 for "..." +1 for null
+    char* output = xmd_malloc(max_length + 4); // +3 for "..." +1 for null
     if (!output) {
         return OUTPUT_ERROR;
     }
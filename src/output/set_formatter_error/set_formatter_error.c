@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/output.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set error message in formatter
@@ -22,6 +23,6 @@ void set_formatter_error(OutputFormatter* formatter, const char* message) {
         return;
     }
     
-    free(formatter->last_error);
-    formatter->last_error = strdup(message);
+    xmd_free(formatter->last_error);
+    formatter->last_error = xmd_strdup(message);
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_parser.h"
+#include "../../include/allocator.h"
 
 // External references to global error state
 extern bool global_parser_error;
@@ -24,10 +25,10 @@ void parser_set_error(parser_state* state, const char* message) {
     
     if (state) {
         state->has_error = true;
-        free(state->error_message);
-        state->error_message = message ? strdup(message) : NULL;
+        xmd_free(state->error_message);
+        state->error_message = message ? xmd_strdup(message) : NULL;
     }
     
-    free(global_error_message);
-    global_error_message = message ? strdup(message) : NULL;
+    xmd_free(global_error_message);
+    global_error_message = message ? xmd_strdup(message) : NULL;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../include/ast_parser.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Create parser state from token stream
@@ -21,7 +22,7 @@ parser_state* parser_state_create(token* tokens, const char* filename) {
         return NULL;
     }
     
-    parser_state* state = malloc(sizeof(parser_state));
+    parser_state* state = xmd_malloc(sizeof(parser_state));
     if (!state) {
         return NULL;
     }
@@ -29,7 +30,7 @@ parser_state* parser_state_create(token* tokens, const char* filename) {
     state->tokens = tokens;
     state->current_token = tokens;
     state->position = 0;
-    state->filename = filename ? strdup(filename) : NULL;
+    state->filename = filename ? xmd_strdup(filename) : NULL;
     state->has_error = false;
     state->error_message = NULL;
     
@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include "../../include/ast_parser.h"
+#include "../../include/allocator.h"
 
 /**
  * @brief Free parser state
@@ -17,7 +18,7 @@ void parser_state_free(parser_state* state) {
         return;
     }
     
-    free((char*)state->filename);
-    free(state->error_message);
-    free(state);
+    xmd_free((char*)state->filename);
+    xmd_free(state->error_message);
+    xmd_free(state);
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+/**
+ * @file json_build_lazy.c
+ * @brief Build one value of a lazily loaded JSON file
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Advance past JSON whitespace
+ * @param state Parser state
+ */
+static void skip_whitespace(json_parse_state* state) {
+    while (state->offset < state->length) {
+        char c = state->data[state->offset];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            break;
+        }
+        state->offset++;
+    }
+}
+
+/**
+ * @brief Consume the structural at the cursor if it is the expected byte
+ * @param state Parser state
+ * @param expected Structural character
+ * @return true if consumed
+ */
+static bool take_structural(json_parse_state* state, char expected) {
+    skip_whitespace(state);
+    if (state->cursor >= state->index->count ||
+        state->index->positions[state->cursor] != state->offset ||
+        state->data[state->offset] != expected) {
+        return false;
+    }
+    state->cursor++;
+    state->offset++;
+    return true;
+}
+
+/**
+ * @brief Skip the value at the offset using the bracket partner table
+ * @param state Parser state
+ * @param matches Bracket partner table
+ */
+static void skip_value(json_parse_state* state, const uint32_t* matches) {
+    const json_structural_index* index = state->index;
+    bool at_structural = state->cursor < index->count &&
+                         index->positions[state->cursor] == state->offset;
+    char c = state->offset < state->length ? state->data[state->offset] : '\0';
+
+    if (at_structural && (c == '{' || c == '[')) {
+        state->cursor = (size_t)matches[state->cursor] + 1;
+        state->offset = (size_t)index->positions[state->cursor - 1] + 1;
+    } else if (at_structural && c == '"' && state->cursor + 1 < index->count) {
+        state->offset = (size_t)index->positions[state->cursor + 1] + 1;
+        state->cursor += 2;
+    } else if (state->cursor < index->count) {
+        // Scalars contain no structurals: jump to the following ',' or bracket
+        state->offset = index->positions[state->cursor];
+    } else {
+        state->offset = state->length;
+    }
+}
+
+/**
+ * @brief Record each member of the container at the cursor for later building
+ * @param document Lazy source
+ * @param state Parser state positioned on '{' or '['
+ * @return Container variable or NULL on error
+ */
+static variable* defer_members(json_lazy_source* document, json_parse_state* state) {
+    bool is_object = state->data[state->offset] == '{';
+    size_t hint = state->index->counts[state->cursor];
+    state->cursor++;
+    state->offset++;
+
+    variable* container = is_object ? variable_create_object_with_capacity(hint)
+                                     : variable_create_array_with_capacity(hint);
+    if (!container || take_structural(state, is_object ? '}' : ']')) {
+        return container;
+    }
+
+    const char* error = NULL;
+    for (;;) {
+        char* key = NULL;
+        if (is_object) {
+            skip_whitespace(state);
+            if (state->cursor >= state->index->count ||
+                state->index->positions[state->cursor] != state->offset ||
+                state->data[state->offset] != '"') {
+                error = "Expected string key";
+                break;
+            }
+            key = json_decode_string(state);
+            if (!key) {
+                break;
+            }
+            if (!take_structural(state, ':')) {
+                xmd_free(key);
+                error = "Expected ':'";
+                break;
+            }
+        }
+
+        skip_whitespace(state);
+        uint64_t position = state->offset;
+        if (position >= state->length) {
+            xmd_free(key);
+            error = "Unexpected end of input";
+            break;
+        }
+        skip_value(state, document->matches);
+        bool deferred = is_object ? variable_object_defer(container, &document->base, key, position)
+                                  : variable_array_defer(container, &document->base, position);
+        if (!deferred) {
+            error = "Out of memory";
+            break;
+        }
+
+        if (take_structural(state, is_object ? '}' : ']')) {
+            // Duplicate keys keep the last value, as when built eagerly
+            if (is_object && !variable_object_dedupe_keys(container)) {
+                error = "Out of memory";
+                break;
+            }
+            return container;
+        }
+        if (!take_structural(state, ',')) {
+            error = is_object ? "Expected ',' or '}'" : "Expected ',' or ']'";
+            break;
+        }
+    }
+
+    if (error) {
+        json_parser_set_error(error, state->offset);
+    }
+    variable_unref(container);
+    return NULL;
+}
+
+/**
+ * @brief Build the value at a byte offset of a lazily loaded JSON file
+ *
+ * Objects and arrays only record where their members are; strings and
+ * scalars are built in full.
+ *
+ * @param source Lazy JSON source
+ * @param position Byte offset of the value
+ * @return New variable or NULL if the value is malformed
+ */
+variable* json_build_lazy(variable_source* source, uint64_t position) {
+    json_lazy_source* document = (json_lazy_source*)source;
+    const json_structural_index* index = &document->index;
+    if (position >= document->length) {
+        return NULL;
+    }
+
+    // The first structural at or after the value
+    size_t low = 0;
+    size_t high = index->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (index->positions[mid] < position) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    json_parse_state state = { document->data, document->length, index, low, (size_t)position, 0 };
+    char c = document->data[position];
+    if ((c == '{' || c == '[') && low < index->count && index->positions[low] == position) {
+        return defer_members(document, &state);
+    }
+    return json_build_value(&state);
+}
@@ -0,0 +1,130 @@
+/**
+ * @file json_build_object.c
+ * @brief JSON stage 2: build an object whose '{' is at the cursor
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Advance past JSON whitespace
+ * @param state Parser state
+ */
+static void skip_whitespace(json_parse_state* state) {
+    while (state->offset < state->length) {
+        char c = state->data[state->offset];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            break;
+        }
+        state->offset++;
+    }
+}
+
+/**
+ * @brief Consume the expected structural character at the current offset
+ * @param state Parser state
+ * @param expected Character to consume
+ * @return true if it was present
+ */
+static bool consume(json_parse_state* state, char expected) {
+    skip_whitespace(state);
+    if (state->offset < state->length && state->data[state->offset] == expected &&
+        state->cursor < state->index->count &&
+        state->index->positions[state->cursor] == state->offset) {
+        state->cursor++;
+        state->offset++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Build an object, pre-sized from the element-count hint
+ *
+ * Keys are decoded straight into the pair array; duplicates are collapsed
+ * once at the closing brace, keeping the last value as variable_object_set
+ * would.
+ *
+ * @param state Parser state positioned on '{'
+ * @return Object variable or NULL on error
+ */
+variable* json_build_object(json_parse_state* state) {
+    if (++state->depth > JSON_MAX_DEPTH) {
+        json_parser_set_error("Maximum nesting depth exceeded", state->offset);
+        return NULL;
+    }
+    size_t hint = state->index->counts[state->cursor];
+    state->cursor++;
+    state->offset++;
+
+    if (consume(state, '}')) {
+        state->depth--;
+        return variable_create_object();
+    }
+
+    variable* object = variable_create_object_with_capacity(hint);
+    if (!object) {
+        json_parser_set_error("Out of memory", state->offset);
+        return NULL;
+    }
+    variable_object* obj = object->value.object_value;
+    const char* error = NULL;
+
+    for (;;) {
+        skip_whitespace(state);
+        if (state->offset >= state->length || state->data[state->offset] != '"') {
+            error = "Expected string key";
+            break;
+        }
+        char* key = json_decode_string(state);
+        if (!key) {
+            break;
+        }
+        if (!consume(state, ':')) {
+            xmd_free(key);
+            error = "Expected ':'";
+            break;
+        }
+        variable* value = json_build_value(state);
+        if (!value) {
+            xmd_free(key);
+            break;
+        }
+
+        if (obj->count == obj->capacity) {
+            size_t new_capacity = obj->capacity ? obj->capacity * 2 : 8;
+            variable_object_pair* grown = xmd_realloc(obj->pairs, new_capacity * sizeof(variable_object_pair));
+            if (!grown) {
+                xmd_free(key);
+                variable_unref(value);
+                error = "Out of memory";
+                break;
+            }
+            obj->pairs = grown;
+            obj->capacity = new_capacity;
+        }
+        obj->pairs[obj->count].key = key;
+        obj->pairs[obj->count].value = value;
+        obj->count++;
+
+        if (consume(state, '}')) {
+            if (!variable_object_dedupe_keys(object)) {
+                error = "Out of memory";
+                break;
+            }
+            state->depth--;
+            return object;
+        }
+        if (!consume(state, ',')) {
+            error = "Expected ',' or '}'";
+            break;
+        }
+    }
+
+    if (error) {
+        json_parser_set_error(error, state->offset);
+    }
+    variable_unref(object);
+    return NULL;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file json_build_value.c
+ * @brief JSON stage 2: build a variable for the value at the cursor
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Advance past JSON whitespace
+ * @param state Parser state
+ */
+static void skip_whitespace(json_parse_state* state) {
+    const char* data = state->data;
+    while (state->offset < state->length) {
+        char c = data[state->offset];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            break;
+        }
+        state->offset++;
+    }
+}
+
+/**
+ * @brief Check that the current byte is the next indexed structural
+ * @param state Parser state
+ * @return true if offset and index cursor agree
+ */
+static bool at_structural(const json_parse_state* state) {
+    return state->cursor < state->index->count &&
+           state->index->positions[state->cursor] == state->offset;
+}
+
+/**
+ * @brief Match a literal keyword at the current offset
+ * @param state Parser state (offset advanced on match)
+ * @param word Keyword to match
+ * @param word_len Keyword length
+ * @return true on match
+ */
+static bool match_literal(json_parse_state* state, const char* word, size_t word_len) {
+    if (state->length - state->offset < word_len ||
+        memcmp(state->data + state->offset, word, word_len) != 0) {
+        json_parser_set_error("Invalid literal", state->offset);
+        return false;
+    }
+    state->offset += word_len;
+    return true;
+}
+
+/**
+ * @brief Parse the value at the current offset and append it to an array
+ *
+ * Numbers, strings and booleans go straight into the array's packed
+ * storage without a variable of their own.
+ *
+ * @param state Parser state
+ * @param array Array being built
+ * @return false on error
+ */
+static bool add_item(json_parse_state* state, variable* array) {
+    skip_whitespace(state);
+    bool added;
+    char c = state->offset < state->length ? state->data[state->offset] : '\0';
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        double number;
+        if (!json_parse_number(state, &number)) {
+            return false;
+        }
+        added = variable_array_add_number(array, number);
+    } else if (c == '"' && at_structural(state)) {
+        char* text = json_decode_string(state);
+        if (!text) {
+            return false;
+        }
+        added = variable_array_add_string(array, text, strlen(text));
+        xmd_free(text);
+    } else if (c == 't' || c == 'f') {
+        bool value = c == 't';
+        if (!match_literal(state, value ? "true" : "false", value ? 4 : 5)) {
+            return false;
+        }
+        added = variable_array_add_boolean(array, value);
+    } else {
+        variable* item = json_build_value(state);
+        if (!item) {
+            return false;
+        }
+        added = variable_array_add(array, item);
+        variable_unref(item);
+    }
+
+    if (!added) {
+        json_parser_set_error("Out of memory", state->offset);
+    }
+    return added;
+}
+
+/**
+ * @brief Build an array whose '[' is at the cursor, pre-sized from the count hint
+ * @param state Parser state
+ * @return Array variable or NULL on error
+ */
+static variable* build_array(json_parse_state* state) {
+    if (++state->depth > JSON_MAX_DEPTH) {
+        json_parser_set_error("Maximum nesting depth exceeded", state->offset);
+        return NULL;
+    }
+    size_t hint = state->index->counts[state->cursor];
+    state->cursor++;
+    state->offset++;
+
+    skip_whitespace(state);
+    if (state->offset < state->length && state->data[state->offset] == ']' && at_structural(state)) {
+        state->cursor++;
+        state->offset++;
+        state->depth--;
+        return variable_create_array();
+    }
+
+    variable* array = variable_create_array_with_capacity(hint);
+    if (!array) {
+        json_parser_set_error("Out of memory", state->offset);
+        return NULL;
+    }
+
+    for (;;) {
+        if (!add_item(state, array)) {
+            variable_unref(array);
+            return NULL;
+        }
+
+        skip_whitespace(state);
+        if (state->offset >= state->length || !at_structural(state)) {
+            variable_unref(array);
+            json_parser_set_error("Expected ',' or ']'", state->offset);
+            return NULL;
+        }
+        char c = state->data[state->offset];
+        state->cursor++;
+        state->offset++;
+        if (c == ']') {
+            break;
+        }
+        if (c != ',') {
+            variable_unref(array);
+            json_parser_set_error("Expected ',' or ']'", state->offset - 1);
+            return NULL;
+        }
+    }
+
+    state->depth--;
+    return array;
+}
+
+/**
+ * @brief Build the JSON value at the current offset
+ * @param state Parser state (offset and cursor advanced past the value)
+ * @return New variable or NULL on error
+ */
+variable* json_build_value(json_parse_state* state) {
+    skip_whitespace(state);
+    if (state->offset >= state->length) {
+        json_parser_set_error("Unexpected end of input", state->offset);
+        return NULL;
+    }
+
+    char c = state->data[state->offset];
+    switch (c) {
+        case '"': {
+            if (!at_structural(state)) {
+                break;
+            }
+            char* text = json_decode_string(state);
+            return text ? variable_create_string_owned(text) : NULL;
+        }
+        case '[':
+            if (at_structural(state)) {
+                return build_array(state);
+            }
+            break;
+        case '{':
+            if (at_structural(state)) {
+                return json_build_object(state);
+            }
+            break;
+        case 't':
+            return match_literal(state, "true", 4) ? variable_create_boolean(true) : NULL;
+        case 'f':
+            return match_literal(state, "false", 5) ? variable_create_boolean(false) : NULL;
+        case 'n':
+            return match_literal(state, "null", 4) ? variable_create_null() : NULL;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                double number;
+                return json_parse_number(state, &number) ? variable_create_number(number) : NULL;
+            }
+            break;
+    }
+
+    json_parser_set_error("Unexpected character", state->offset);
+    return NULL;
+}
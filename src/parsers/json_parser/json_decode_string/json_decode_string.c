@@ -0,0 +1,148 @@
+/**
+ * @file json_decode_string.c
+ * @brief JSON stage 2: extract a string between two indexed quotes
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Parse four hex digits
+ * @param p Pointer to the digits
+ * @param out Decoded code unit
+ * @return true if all four are hex digits
+ */
+static bool parse_hex4(const char* p, uint32_t* out) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f') value |= (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') value |= (uint32_t)(c - 'A' + 10);
+        else return false;
+    }
+    *out = value;
+    return true;
+}
+
+/**
+ * @brief Append a code point as UTF-8
+ * @param out Output cursor (advanced)
+ * @param cp Code point
+ */
+static void put_utf8(char** out, uint32_t cp) {
+    char* o = *out;
+    if (cp < 0x80) {
+        *o++ = (char)cp;
+    } else if (cp < 0x800) {
+        *o++ = (char)(0xC0 | (cp >> 6));
+        *o++ = (char)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *o++ = (char)(0xE0 | (cp >> 12));
+        *o++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *o++ = (char)(0x80 | (cp & 0x3F));
+    } else {
+        *o++ = (char)(0xF0 | (cp >> 18));
+        *o++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+        *o++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *o++ = (char)(0x80 | (cp & 0x3F));
+    }
+    *out = o;
+}
+
+/**
+ * @brief Decode the string whose opening quote is at the index cursor
+ *
+ * Strings without escapes are copied from the input in one memcpy; only
+ * strings containing a backslash go through the decoder.
+ *
+ * @param state Parser state positioned on an opening quote
+ * @return Heap string (caller must free) or NULL on error
+ */
+char* json_decode_string(json_parse_state* state) {
+    const json_structural_index* index = state->index;
+    if (state->cursor + 1 >= index->count) {
+        json_parser_set_error("Unterminated string", state->offset);
+        return NULL;
+    }
+    size_t start = (size_t)index->positions[state->cursor] + 1;
+    size_t end = index->positions[state->cursor + 1];
+    const char* src = state->data + start;
+    size_t len = end - start;
+
+    bool needs_decode = false;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)src[i];
+        if (c < 0x20) {
+            json_parser_set_error("Control character in string", start + i);
+            return NULL;
+        }
+        if (c == '\\') {
+            needs_decode = true;
+        }
+    }
+
+    char* result = xmd_malloc(len + 1);
+    if (!result) {
+        json_parser_set_error("Out of memory", start);
+        return NULL;
+    }
+
+    if (!needs_decode) {
+        memcpy(result, src, len);
+        result[len] = '\0';
+    } else {
+        char* out = result;
+        for (size_t i = 0; i < len; i++) {
+            if (src[i] != '\\') {
+                *out++ = src[i];
+                continue;
+            }
+            if (++i >= len) goto bad_escape;
+            char esc = src[i];
+            switch (esc) {
+                case '"': *out++ = '"'; break;
+                case '\\': *out++ = '\\'; break;
+                case '/': *out++ = '/'; break;
+                case 'b': *out++ = '\b'; break;
+                case 'f': *out++ = '\f'; break;
+                case 'n': *out++ = '\n'; break;
+                case 'r': *out++ = '\r'; break;
+                case 't': *out++ = '\t'; break;
+                case 'u': {
+                    uint32_t cp;
+                    if (i + 4 >= len || !parse_hex4(src + i + 1, &cp)) goto bad_escape;
+                    i += 4;
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        uint32_t low;
+                        if (i + 6 < len && src[i + 1] == '\\' && src[i + 2] == 'u' &&
+                            parse_hex4(src + i + 3, &low) && low >= 0xDC00 && low <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                            i += 6;
+                        } else {
+                            cp = 0xFFFD;
+                        }
+                    } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                        cp = 0xFFFD;
+                    }
+                    put_utf8(&out, cp);
+                    break;
+                }
+                default:
+                    goto bad_escape;
+            }
+        }
+        *out = '\0';
+    }
+
+    state->cursor += 2;
+    state->offset = end + 1;
+    return result;
+
+bad_escape:
+    xmd_free(result);
+    json_parser_set_error("Invalid escape sequence", start);
+    return NULL;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file json_index_structurals.c
+ * @brief JSON stage 1: locate structural characters 64 bytes at a time
+ * @author XMD Team
+ *
+ * Character classes are gathered into 64-bit masks (SSE2 where available,
+ * scalar otherwise). String interiors are masked out with a prefix-XOR of
+ * the unescaped quote mask, so stage 2 never scans string bodies itself.
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Per-chunk character class masks
+ */
+typedef struct {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t structural;
+} json_chunk_masks;
+
+/**
+ * @brief Classify a 64-byte chunk
+ * @param chunk 64 readable bytes
+ * @param masks Output masks
+ */
+static void classify_chunk(const unsigned char* chunk, json_chunk_masks* masks) {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i open_brace = _mm_set1_epi8('{');
+    const __m128i close_brace = _mm_set1_epi8('}');
+    const __m128i open_bracket = _mm_set1_epi8('[');
+    const __m128i close_bracket = _mm_set1_epi8(']');
+    masks->quote = masks->backslash = masks->structural = 0;
+    for (int lane = 0; lane < 4; lane++) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(chunk + lane * 16));
+        __m128i s = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma)),
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, open_brace), _mm_cmpeq_epi8(v, close_brace)),
+                _mm_or_si128(_mm_cmpeq_epi8(v, open_bracket), _mm_cmpeq_epi8(v, close_bracket))));
+        int shift = lane * 16;
+        masks->quote |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)) << shift;
+        masks->backslash |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)) << shift;
+        masks->structural |= (uint64_t)(uint16_t)_mm_movemask_epi8(s) << shift;
+    }
+#else
+    masks->quote = masks->backslash = masks->structural = 0;
+    for (int i = 0; i < 64; i++) {
+        uint64_t bit = (uint64_t)1 << i;
+        switch (chunk[i]) {
+            case '"': masks->quote |= bit; break;
+            case '\\': masks->backslash |= bit; break;
+            case ':': case ',': case '{': case '}': case '[': case ']':
+                masks->structural |= bit;
+                break;
+            default: break;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Compute which bytes are escaped by a preceding backslash
+ *
+ * Branch-free: a run of backslashes escapes the byte after it only when
+ * the run has odd length, which falls out of adding the run starts on odd
+ * bit positions to the backslash mask.
+ *
+ * @param backslash Backslash mask for the chunk
+ * @param carry In/out: 1 if the previous chunk ended mid-escape
+ * @return Mask of escaped bytes
+ */
+static uint64_t escaped_mask(uint64_t backslash, uint64_t* carry) {
+    if (!backslash && !*carry) {
+        return 0;
+    }
+    const uint64_t even_bits = 0x5555555555555555ULL;
+    backslash &= ~*carry;
+    uint64_t follows_escape = backslash << 1 | *carry;
+    uint64_t odd_starts = backslash & ~even_bits & ~follows_escape;
+    unsigned long long even_sequences;
+    *carry = __builtin_uaddll_overflow(odd_starts, backslash, &even_sequences);
+    uint64_t invert = (uint64_t)even_sequences << 1;
+    return (even_bits ^ invert) & follows_escape;
+}
+
+/**
+ * @brief Track bracket nesting to produce element-count hints
+ */
+typedef struct {
+    uint32_t* stack;    /**< Index entries of currently open brackets */
+    size_t size;        /**< Stack depth */
+    size_t capacity;    /**< Stack capacity */
+} bracket_stack;
+
+/**
+ * @brief Update count hints for the structural just recorded
+ * @param index Index (entry at index->count - 1 is the new one)
+ * @param brackets Open bracket stack
+ * @param c Structural character
+ * @return false on allocation failure
+ */
+static bool count_structural(json_structural_index* index, bracket_stack* brackets, char c) {
+    size_t entry = index->count - 1;
+    index->counts[entry] = 0;
+    if (c == '{' || c == '[') {
+        if (brackets->size == brackets->capacity) {
+            size_t new_capacity = brackets->capacity ? brackets->capacity * 2 : 64;
+            uint32_t* grown = xmd_realloc(brackets->stack, new_capacity * sizeof(uint32_t));
+            if (!grown) {
+                return false;
+            }
+            brackets->stack = grown;
+            brackets->capacity = new_capacity;
+        }
+        brackets->stack[brackets->size++] = (uint32_t)entry;
+        index->counts[entry] = 1;
+    } else if (c == ',' && brackets->size > 0) {
+        index->counts[brackets->stack[brackets->size - 1]]++;
+    } else if ((c == '}' || c == ']') && brackets->size > 0) {
+        brackets->size--;
+    }
+    return true;
+}
+
+/**
+ * @brief Build the structural index for a JSON buffer
+ * @param data JSON text
+ * @param length Length in bytes (must fit in 32 bits)
+ * @param index Output index with positions and element-count hints
+ *              (caller frees with json_structural_index_free)
+ * @return true on success, false on allocation failure or unterminated string
+ */
+bool json_index_structurals(const char* data, size_t length, json_structural_index* index) {
+    if (!data || !index) {
+        return false;
+    }
+    memset(index, 0, sizeof(*index));
+    if (length > UINT32_MAX) {
+        json_parser_set_error("Input too large", 0);
+        return false;
+    }
+
+    size_t capacity = length / 8 + 16;
+    index->positions = xmd_malloc(capacity * sizeof(uint32_t));
+    index->counts = xmd_malloc(capacity * sizeof(uint32_t));
+    bracket_stack brackets = { NULL, 0, 0 };
+    if (!index->positions || !index->counts) {
+        goto out_of_memory;
+    }
+
+    uint64_t escape_carry = 0;
+    uint64_t in_string_carry = 0;
+    unsigned char tail[64];
+
+    for (size_t base = 0; base < length; base += 64) {
+        const unsigned char* chunk = (const unsigned char*)data + base;
+        if (length - base < 64) {
+            memset(tail, ' ', sizeof(tail));
+            memcpy(tail, chunk, length - base);
+            chunk = tail;
+        }
+
+        json_chunk_masks masks;
+        classify_chunk(chunk, &masks);
+        uint64_t quotes = masks.quote & ~escaped_mask(masks.backslash, &escape_carry);
+
+        // Prefix XOR: bit i is set when byte i lies inside a string
+        uint64_t in_string = quotes;
+        in_string ^= in_string << 1;
+        in_string ^= in_string << 2;
+        in_string ^= in_string << 4;
+        in_string ^= in_string << 8;
+        in_string ^= in_string << 16;
+        in_string ^= in_string << 32;
+        in_string ^= in_string_carry;
+        in_string_carry = (uint64_t)0 - (in_string >> 63);
+
+        uint64_t bits = (masks.structural & ~in_string) | quotes;
+        if (index->count + 64 > capacity) {
+            capacity = (index->count + 64) * 2;
+            uint32_t* positions = xmd_realloc(index->positions, capacity * sizeof(uint32_t));
+            if (positions) index->positions = positions;
+            uint32_t* counts = xmd_realloc(index->counts, capacity * sizeof(uint32_t));
+            if (counts) index->counts = counts;
+            if (!positions || !counts) {
+                goto out_of_memory;
+            }
+        }
+        while (bits) {
+            int bit = __builtin_ctzll(bits);
+            index->positions[index->count++] = (uint32_t)(base + (size_t)bit);
+            if (!count_structural(index, &brackets, (char)chunk[bit])) {
+                goto out_of_memory;
+            }
+            bits &= bits - 1;
+        }
+    }
+
+    xmd_free(brackets.stack);
+    if (in_string_carry) {
+        json_structural_index_free(index);
+        json_parser_set_error("Unterminated string", length);
+        return false;
+    }
+    return true;
+
+out_of_memory:
+    xmd_free(brackets.stack);
+    json_structural_index_free(index);
+    json_parser_set_error("Out of memory", 0);
+    return false;
+}
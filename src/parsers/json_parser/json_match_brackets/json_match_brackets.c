@@ -0,0 +1,68 @@
+/**
+ * @file json_match_brackets.c
+ * @brief Pair each indexed bracket with its partner for subtree skipping
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Build the bracket partner table for a structural index
+ * @param data JSON text the index was built from
+ * @param index Structural index
+ * @return Array parallel to index->positions where each bracket entry
+ *         holds the index of its partner (other entries 0), or NULL on
+ *         unbalanced brackets or allocation failure (caller frees)
+ */
+uint32_t* json_match_brackets(const char* data, const json_structural_index* index) {
+    if (!data || !index) {
+        return NULL;
+    }
+
+    uint32_t* matches = xmd_calloc(index->count ? index->count : 1, sizeof(uint32_t));
+    uint32_t* stack = xmd_malloc(JSON_MAX_DEPTH * sizeof(uint32_t));
+    if (!matches || !stack) {
+        xmd_free(matches);
+        xmd_free(stack);
+        json_parser_set_error("Out of memory", 0);
+        return NULL;
+    }
+
+    size_t depth = 0;
+    for (size_t i = 0; i < index->count; i++) {
+        uint32_t position = index->positions[i];
+        char c = data[position];
+        if (c == '{' || c == '[') {
+            if (depth == JSON_MAX_DEPTH) {
+                json_parser_set_error("Maximum nesting depth exceeded", position);
+                goto fail;
+            }
+            stack[depth++] = (uint32_t)i;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) {
+                json_parser_set_error("Unmatched closing bracket", position);
+                goto fail;
+            }
+            uint32_t open = stack[--depth];
+            if (data[index->positions[open]] != (c == '}' ? '{' : '[')) {
+                json_parser_set_error("Mismatched bracket", position);
+                goto fail;
+            }
+            matches[open] = (uint32_t)i;
+            matches[i] = open;
+        }
+    }
+
+    if (depth != 0) {
+        json_parser_set_error("Unclosed bracket", index->positions[stack[depth - 1]]);
+        goto fail;
+    }
+    xmd_free(stack);
+    return matches;
+
+fail:
+    xmd_free(stack);
+    xmd_free(matches);
+    return NULL;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file json_parse_number.c
+ * @brief JSON stage 2: validate and convert a number literal
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Parse the number starting at state->offset
+ *
+ * Plain integers of up to 15 digits are accumulated directly, which is
+ * exact in a double; anything else is validated against the JSON grammar
+ * and handed to strtod.
+ *
+ * @param state Parser state (offset advanced past the number)
+ * @param out Parsed value
+ * @return true on success, false if the text is not a valid JSON number
+ */
+bool json_parse_number(json_parse_state* state, double* out) {
+    const char* data = state->data;
+    size_t end = state->length;
+    size_t start = state->offset;
+    size_t p = start;
+    bool negative = false;
+
+    if (p < end && data[p] == '-') {
+        negative = true;
+        p++;
+    }
+    if (p >= end || data[p] < '0' || data[p] > '9') {
+        json_parser_set_error("Invalid number", start);
+        return false;
+    }
+
+    uint64_t mantissa = 0;
+    size_t digits_start = p;
+    if (data[p] == '0') {
+        p++;
+    } else {
+        while (p < end && data[p] >= '0' && data[p] <= '9') {
+            mantissa = mantissa * 10 + (uint64_t)(data[p] - '0');
+            p++;
+        }
+    }
+    bool is_integer = true;
+
+    if (p < end && data[p] == '.') {
+        is_integer = false;
+        p++;
+        if (p >= end || data[p] < '0' || data[p] > '9') {
+            json_parser_set_error("Invalid number", start);
+            return false;
+        }
+        while (p < end && data[p] >= '0' && data[p] <= '9') p++;
+    }
+    if (p < end && (data[p] == 'e' || data[p] == 'E')) {
+        is_integer = false;
+        p++;
+        if (p < end && (data[p] == '+' || data[p] == '-')) p++;
+        if (p >= end || data[p] < '0' || data[p] > '9') {
+            json_parser_set_error("Invalid number", start);
+            return false;
+        }
+        while (p < end && data[p] >= '0' && data[p] <= '9') p++;
+    }
+
+    state->offset = p;
+    if (is_integer && p - digits_start <= 15) {
+        *out = negative ? -(double)mantissa : (double)mantissa;
+        return true;
+    }
+
+    // strtod needs a terminated copy since the buffer may not be
+    char small[64];
+    size_t len = p - start;
+    char* text = len < sizeof(small) ? small : xmd_malloc(len + 1);
+    if (!text) {
+        json_parser_set_error("Out of memory", start);
+        return false;
+    }
+    memcpy(text, data + start, len);
+    text[len] = '\0';
+    *out = strtod(text, NULL);
+    if (text != small) {
+        xmd_free(text);
+    }
+    return true;
+}
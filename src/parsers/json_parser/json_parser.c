@@ -1,418 +1,141 @@
 /**
  * @file json_parser.c
- * @brief JSON parser wrapper using json-c library
+ * @brief Native JSON parser entry points
  * @author XMD Implementation Team
  * @date 2025-01-29
+ *
+ * Parsing runs in two stages: json_index_structurals builds a structural
+ * index of the whole buffer, then json_build_value walks it and creates
+ * variables directly, with no intermediate DOM.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "variable.h"
-#include "xmd.h"
+#include "../../../include/json_parser_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
 
-#if 0 // Disable json-c library to force stub implementation
-// #ifdef HAVE_JSON_C
-#include <json-c/json.h>
-
-// DEBUG: Print if we're using the json-c path
-#pragma message "Using json-c library path"
+static XMD_THREAD_LOCAL char json_error[128] = "No error";
 
 /**
- * @brief Convert json-c object to XMD variable
- * @param json_obj JSON object from json-c
- * @return XMD variable or NULL on error
+ * @brief Record the last parse error for json_parser_get_error
+ * @param message Error description
+ * @param offset Byte offset in the input
  */
-static variable* json_object_to_variable(json_object* json_obj) {
-    if (json_obj == NULL) {
-        return variable_create_null();
-    }
-    
-    json_type type = json_object_get_type(json_obj);
-    
-    switch (type) {
-        case json_type_null:
-            return variable_create_null();
-            
-        case json_type_boolean: {
-            bool value = json_object_get_boolean(json_obj);
-            return variable_create_boolean(value);
-        }
-        
-        case json_type_int: {
-            int64_t value = json_object_get_int64(json_obj);
-            return variable_create_number((double)value);
-        }
-        
-        case json_type_double: {
-            double value = json_object_get_double(json_obj);
-            return variable_create_number(value);
-        }
-        
-        case json_type_string: {
-            const char* value = json_object_get_string(json_obj);
-            return variable_create_string(value);
-        }
-        
-        case json_type_array: {
-            int array_length = json_object_array_length(json_obj);
-            variable* array_var = variable_create_array();
-            
-            if (array_var == NULL) {
-                return NULL;
-            }
-            
-            for (int i = 0; i < array_length; i++) {
-                json_object* item = json_object_array_get_idx(json_obj, i);
-                variable* item_var = json_object_to_variable(item);
-                
-                if (item_var == NULL) {
-                    variable_unref(array_var);
-                    return NULL;
-                }
-                
-                if (variable_array_add(array_var, item_var) != 0) {
-                    variable_unref(item_var);
-                    variable_unref(array_var);
-                    return NULL;
-                }
-                
-                variable_unref(item_var); // array_add increments reference
-            }
-            
-            return array_var;
-        }
-        
-        case json_type_object: {
-            variable* object_var = variable_create_object();
-            
-            if (object_var == NULL) {
-                return NULL;
-            }
-            
-            json_object_object_foreach(json_obj, key, val) {
-                variable* value_var = json_object_to_variable(val);
-                
-                if (value_var == NULL) {
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                if (variable_object_set(object_var, key, value_var) != 0) {
-                    variable_unref(value_var);
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                variable_unref(value_var); // object_set increments reference
-            }
-            
-            return object_var;
-        }
-        
-        default:
-            return variable_create_null();
-    }
+void json_parser_set_error(const char* message, size_t offset) {
+    snprintf(json_error, sizeof(json_error), "%s at offset %zu", message, offset);
 }
 
 /**
- * @brief Parse JSON string and convert to XMD variable
- * @param json_string JSON string to parse
- * @return XMD variable containing parsed data or NULL on error
+ * @brief Parse a JSON buffer into an XMD variable
+ * @param data JSON text (need not be NUL-terminated)
+ * @param length Length of data in bytes
+ * @return Parsed variable or NULL on error
  */
-variable* json_parser_parse_string(const char* json_string) {
-    if (json_string == NULL) {
+variable* json_parser_parse_buffer(const char* data, size_t length) {
+    if (data == NULL) {
+        json_parser_set_error("No input", 0);
         return NULL;
     }
-    
-    json_object* root = json_tokener_parse(json_string);
-    if (root == NULL) {
-        return NULL; // Invalid JSON
-    }
-    
-    variable* result = json_object_to_variable(root);
-    
-    // Clean up json-c object
-    json_object_put(root);
-    
-    return result;
-}
 
-/**
- * @brief Parse JSON file and convert to XMD variable
- * @param file_path Path to JSON file
- * @return XMD variable containing parsed data or NULL on error
- */
-variable* json_parser_parse_file(const char* file_path) {
-    if (file_path == NULL) {
+    json_structural_index index;
+    if (!json_index_structurals(data, length, &index)) {
         return NULL;
     }
-    
-    json_object* root = json_object_from_file(file_path);
-    if (root == NULL) {
-        return NULL; // File not found or invalid JSON
+
+    json_parse_state state = { data, length, &index, 0, 0, 0 };
+    // Skip a UTF-8 byte order mark
+    if (length >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        state.offset = 3;
     }
-    
-    variable* result = json_object_to_variable(root);
-    
-    // Clean up json-c object
-    json_object_put(root);
-    
-    return result;
-}
 
-/**
- * @brief Convert XMD variable to JSON string
- * @param var XMD variable to convert
- * @return JSON string (must be freed) or NULL on error
- */
-char* json_parser_variable_to_string(variable* var) {
-    if (var == NULL) {
-        return NULL;
+    variable* result = json_build_value(&state);
+    if (result) {
+        while (state.offset < length &&
+               (data[state.offset] == ' ' || data[state.offset] == '\n' ||
+                data[state.offset] == '\r' || data[state.offset] == '\t')) {
+            state.offset++;
+        }
+        if (state.offset != length || state.cursor != index.count) {
+            json_parser_set_error("Unexpected trailing content", state.offset);
+            variable_unref(result);
+            result = NULL;
+        }
     }
-    
-    // This would require implementing the reverse conversion
-    // For now, return NULL to indicate not implemented
-    return NULL;
-}
 
-/**
- * @brief Get JSON parser error message
- * @return Error message string
- */
-const char* json_parser_get_error(void) {
-    return "JSON parsing error"; // Simple error message for now
+    json_structural_index_free(&index);
+    return result;
 }
 
-#else // !HAVE_JSON_C
-
-// DEBUG: Print if we're using the stub path
-#pragma message "Using stub JSON parser implementation"
-
 /**
- * @brief Parse JSON string and convert to XMD variable (basic implementation)
+ * @brief Parse JSON string and convert to XMD variable
  * @param json_string JSON string to parse
- * @return XMD variable with basic JSON support
+ * @return XMD variable containing parsed data or NULL on error
  */
 variable* json_parser_parse_string(const char* json_string) {
     if (json_string == NULL) {
+        json_parser_set_error("No input", 0);
         return NULL;
     }
-    
-    // DEBUG: Print the JSON string being parsed
-    printf("DEBUG JSON PARSER: Parsing [%s]\n", json_string);
-    fflush(stdout);
-    
-    // Check for invalid JSON patterns that should trigger error
-    if (strstr(json_string, "invalid json content")) {
-        printf("DEBUG JSON PARSER: Invalid JSON content detected\n");
-        fflush(stdout);
-        return NULL; // Invalid JSON - will trigger error handling
-    }
-    
-    // Basic JSON parsing for simple objects - minimal implementation to make tests pass
-    
-    // Handle nested object test case (check this FIRST - most specific)
-    if (strstr(json_string, "\"profile\"")) {
-        printf("DEBUG JSON PARSER: Detected nested profile structure\n");
-        variable* obj = variable_create_object();
-        variable* user = variable_create_object();
-        variable* profile = variable_create_object();
-        variable* settings = variable_create_object();
-        
-        if (obj && user && profile && settings) {
-            // Set profile data
-            variable* name = variable_create_string("Alice");
-            variable* email = variable_create_string("alice@example.com");
-            if (name && email) {
-                variable_object_set(profile, "name", name);
-                variable_object_set(profile, "email", email);
-                variable_unref(name);
-                variable_unref(email);
-            }
-            
-            // Set settings
-            variable* theme = variable_create_string("dark");
-            variable* notifications = variable_create_boolean(true);
-            if (theme && notifications) {
-                variable_object_set(settings, "theme", theme);
-                variable_object_set(settings, "notifications", notifications);
-                variable_unref(theme);
-                variable_unref(notifications);
-            }
-            
-            // Assemble nested structure
-            variable_object_set(user, "profile", profile);
-            variable_object_set(user, "settings", settings);
-            variable_object_set(obj, "user", user);
-            
-            printf("DEBUG JSON PARSER: Created nested object structure\n");
-            
-            variable_unref(profile);
-            variable_unref(settings);
-            variable_unref(user);
-            return obj;
-        }
-    }
-    
-    // Handle array test case (check this second)
-    if (strstr(json_string, "\"users\"") && strstr(json_string, "\"Alice\"") && strstr(json_string, "\"admin\"")) {
-        variable* obj = variable_create_object();
-        variable* users_array = variable_create_array();
-        if (obj && users_array) {
-            // Add Alice user
-            variable* alice = variable_create_object();
-            if (alice) {
-                variable* alice_name = variable_create_string("Alice");
-                variable* alice_role = variable_create_string("admin");
-                if (alice_name && alice_role) {
-                    variable_object_set(alice, "name", alice_name);
-                    variable_object_set(alice, "role", alice_role);
-                    variable_array_add(users_array, alice);
-                    variable_unref(alice_name);
-                    variable_unref(alice_role);
-                }
-                variable_unref(alice);
-            }
-            
-            // Add Bob user  
-            variable* bob = variable_create_object();
-            if (bob) {
-                variable* bob_name = variable_create_string("Bob");
-                variable* bob_role = variable_create_string("user");
-                if (bob_name && bob_role) {
-                    variable_object_set(bob, "name", bob_name);
-                    variable_object_set(bob, "role", bob_role);
-                    variable_array_add(users_array, bob);
-                    variable_unref(bob_name);
-                    variable_unref(bob_role);
-                }
-                variable_unref(bob);
-            }
-            
-            variable_object_set(obj, "users", users_array);
-            variable_unref(users_array);
-            return obj;
-        }
-    }
-    
-    // Handle the simple Alice test case (least specific - check last)
-    if (strstr(json_string, "\"name\"") && strstr(json_string, "\"Alice\"") && !strstr(json_string, "\"profile\"") && !strstr(json_string, "\"users\"")) {
-        variable* obj = variable_create_object();
-        if (obj) {
-            variable* name = variable_create_string("Alice");  
-            variable* age = variable_create_number(30.0);
-            variable* active = variable_create_boolean(true);
-            
-            if (name && age && active) {
-                variable_object_set(obj, "name", name);
-                variable_object_set(obj, "age", age); 
-                variable_object_set(obj, "active", active);
-                
-                // DEBUG: Print object contents
-                printf("DEBUG JSON PARSER: Created object with properties:\n");
-                printf("  name: %s\n", variable_to_string(name));
-                printf("  age: %s\n", variable_to_string(age));
-                printf("  active: %s\n", variable_to_string(active));
-                fflush(stdout);
-                
-                variable_unref(name);
-                variable_unref(age);
-                variable_unref(active);
-                return obj;
-            }
-        }
-    }
-    
-    
-    // Handle colors array test case
-    if (strstr(json_string, "\"colors\"")) {
-        variable* obj = variable_create_object();
-        variable* colors = variable_create_array();
-        if (obj && colors) {
-            variable* red = variable_create_string("red");
-            variable* green = variable_create_string("green"); 
-            variable* blue = variable_create_string("blue");
-            
-            if (red && green && blue) {
-                variable_array_add(colors, red);
-                variable_array_add(colors, green);
-                variable_array_add(colors, blue);
-                
-                variable_object_set(obj, "colors", colors);
-                
-                variable_unref(red);
-                variable_unref(green);
-                variable_unref(blue);
-                variable_unref(colors);
-                return obj;
-            }
-        }
-    }
-    
-    return NULL; // JSON support limited
+    return json_parser_parse_buffer(json_string, strlen(json_string));
 }
 
 /**
- * @brief Parse JSON file and convert to XMD variable (basic implementation)
+ * @brief Parse JSON file and convert to XMD variable
  * @param file_path Path to JSON file
- * @return XMD variable with basic JSON support
+ * @return XMD variable containing parsed data or NULL on error
  */
 variable* json_parser_parse_file(const char* file_path) {
     if (file_path == NULL) {
-        printf("DEBUG JSON FILE: file_path is NULL\n");
-        fflush(stdout);
+        json_parser_set_error("No file path", 0);
         return NULL;
     }
-    
-    printf("DEBUG JSON FILE: Opening file [%s]\n", file_path);
-    fflush(stdout);
-    
-    // Read file contents
-    FILE* file = fopen(file_path, "r");
+
+    FILE* file = fopen(file_path, "rb");
     if (!file) {
-        printf("DEBUG JSON FILE: Failed to open file\n");
-        fflush(stdout);
+        json_parser_set_error("Cannot open file", 0);
         return NULL;
     }
-    
+
     fseek(file, 0, SEEK_END);
     long file_size = ftell(file);
     fseek(file, 0, SEEK_SET);
-    
-    char* content = malloc(file_size + 1);
+    if (file_size < 0) {
+        fclose(file);
+        json_parser_set_error("Cannot read file", 0);
+        return NULL;
+    }
+
+    char* content = xmd_malloc((size_t)file_size + 1);
     if (!content) {
         fclose(file);
+        json_parser_set_error("Out of memory", 0);
         return NULL;
     }
-    
-    fread(content, 1, file_size, file);
-    content[file_size] = '\0';
+
+    size_t read = fread(content, 1, (size_t)file_size, file);
     fclose(file);
-    
-    // Use string parser
-    variable* result = json_parser_parse_string(content);
-    free(content);
-    
+
+    variable* result = json_parser_parse_buffer(content, read);
+    xmd_free(content);
     return result;
 }
 
 /**
- * @brief Convert XMD variable to JSON string (stub)
+ * @brief Convert XMD variable to JSON string
  * @param var XMD variable to convert
- * @return NULL (JSON support not compiled in)
+ * @return NULL (serialization is not implemented)
  */
 char* json_parser_variable_to_string(variable* var) {
-    (void)var; // Suppress unused parameter warning
-    return NULL; // JSON support not compiled in
+    (void)var;
+    return NULL;
 }
 
 /**
- * @brief Get JSON parser error message (stub)
+ * @brief Get the last JSON parse error on this thread
  * @return Error message string
  */
 const char* json_parser_get_error(void) {
-    return "JSON support not compiled in";
+    return json_error;
 }
-
-#endif // HAVE_JSON_C
\ No newline at end of file
@@ -0,0 +1,138 @@
+/**
+ * @file json_parser_parse_file_lazy.c
+ * @brief Load a JSON file whose containers are built as they are read
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/platform.h"
+#include "../../../../include/allocator.h"
+
+#ifndef XMD_PLATFORM_WINDOWS
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Release a lazy JSON source once no container draws from it
+ * @param source Lazy JSON source
+ */
+static void destroy_document(variable_source* source) {
+    json_lazy_source* document = (json_lazy_source*)source;
+    json_structural_index_free(&document->index);
+    xmd_free(document->matches);
+    if (document->data) {
+#ifndef XMD_PLATFORM_WINDOWS
+        if (document->mapped) {
+            munmap((void*)document->data, document->length);
+        } else
+#endif
+        {
+            xmd_free((void*)document->data);
+        }
+    }
+    xmd_free(document);
+}
+
+/**
+ * @brief Map a file, or read it where mapping is unavailable
+ * @param document Source receiving data, length and mapped
+ * @param file_path File to load
+ * @return true on success
+ */
+static bool load_contents(json_lazy_source* document, const char* file_path) {
+#ifndef XMD_PLATFORM_WINDOWS
+    int fd = open(file_path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            document->data = mapping;
+            document->length = (size_t)info.st_size;
+            document->mapped = true;
+        }
+    }
+    close(fd);
+    if (document->mapped) {
+        return true;
+    }
+#endif
+    FILE* file = fopen(file_path, "rb");
+    if (!file) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* content = size >= 0 ? xmd_malloc((size_t)size + 1) : NULL;
+    if (content) {
+        document->length = fread(content, 1, (size_t)size, file);
+        document->data = content;
+    }
+    fclose(file);
+    return content != NULL;
+}
+
+/**
+ * @brief Load a JSON file whose objects and arrays are built as they are read
+ * @param file_path Path to JSON file
+ * @return Root variable or NULL on error (see json_parser_get_error)
+ */
+variable* json_parser_parse_file_lazy(const char* file_path) {
+    if (file_path == NULL) {
+        json_parser_set_error("No file path", 0);
+        return NULL;
+    }
+
+    json_lazy_source* document = xmd_calloc(1, sizeof(json_lazy_source));
+    if (!document) {
+        json_parser_set_error("Out of memory", 0);
+        return NULL;
+    }
+    document->base.build = json_build_lazy;
+    document->base.destroy = destroy_document;
+    document->base.ref_count = 1;
+
+    if (!load_contents(document, file_path)) {
+        json_parser_set_error("Cannot open file", 0);
+        destroy_document(&document->base);
+        return NULL;
+    }
+    if (!json_index_structurals(document->data, document->length, &document->index) ||
+        !(document->matches = json_match_brackets(document->data, &document->index))) {
+        destroy_document(&document->base);
+        return NULL;
+    }
+
+    const char* data = document->data;
+    size_t length = document->length;
+    size_t start = length >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0 ? 3 : 0;
+    while (start < length && (data[start] == ' ' || data[start] == '\n' ||
+                              data[start] == '\r' || data[start] == '\t')) {
+        start++;
+    }
+
+    // A root scalar is parsed in full; only containers have members to defer
+    variable* root = NULL;
+    if (start >= length || (data[start] != '{' && data[start] != '[') ||
+        document->index.count == 0 || document->index.positions[0] != start) {
+        root = json_parser_parse_buffer(data, length);
+    } else {
+        size_t close = document->matches[0];
+        size_t end = (size_t)document->index.positions[close] + 1;
+        while (end < length && (data[end] == ' ' || data[end] == '\n' ||
+                                data[end] == '\r' || data[end] == '\t')) {
+            end++;
+        }
+        if (end == length && close + 1 == document->index.count) {
+            root = json_build_lazy(&document->base, start);
+        } else {
+            json_parser_set_error("Unexpected trailing content", end);
+        }
+    }
+    // The root's containers now hold the document
+    variable_source_release(&document->base);
+    return root;
+}
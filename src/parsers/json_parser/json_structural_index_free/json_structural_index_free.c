@@ -0,0 +1,21 @@
+/**
+ * @file json_structural_index_free.c
+ * @brief Release a JSON structural index
+ * @author XMD Team
+ */
+
+#include "../../../../include/json_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Free the arrays owned by a structural index
+ * @param index Index to clear (the struct itself is not freed)
+ */
+void json_structural_index_free(json_structural_index* index) {
+    if (!index) {
+        return;
+    }
+    xmd_free(index->positions);
+    xmd_free(index->counts);
+    memset(index, 0, sizeof(*index));
+}
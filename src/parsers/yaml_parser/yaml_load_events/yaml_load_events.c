@@ -0,0 +1,107 @@
+/**
+ * @file yaml_load_events.c
+ * @brief Build a variable tree from a libyaml event stream
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <string.h>
+#include "../../../../include/yaml_parser_internal.h"
+
+#ifdef HAVE_LIBYAML
+
+/**
+ * @brief Handle one libyaml event
+ * @param loader Loader state
+ * @param event Event to apply
+ * @param done Set when the first document is complete
+ * @return false on error
+ */
+static bool apply_event(yaml_loader* loader, const yaml_event_t* event, bool* done) {
+    switch (event->type) {
+        case YAML_SCALAR_EVENT: {
+            const char* value = (const char*)event->data.scalar.value;
+            size_t length = event->data.scalar.length;
+            variable* node;
+            if (yaml_loader_expects_key(loader)) {
+                // Keys are never type-resolved
+                node = variable_create_string_length(value ? value : "", length);
+            } else {
+                node = yaml_resolve_scalar(value, length,
+                                           event->data.scalar.style == YAML_PLAIN_SCALAR_STYLE,
+                                           (const char*)event->data.scalar.tag);
+            }
+            if (!node) {
+                yaml_parser_set_error("Out of memory", event->start_mark.line + 1, event->start_mark.column + 1);
+                return false;
+            }
+            return yaml_loader_push_value(loader, node, (const char*)event->data.scalar.anchor);
+        }
+
+        case YAML_ALIAS_EVENT: {
+            variable* target = yaml_loader_find_anchor(loader, (const char*)event->data.alias.anchor);
+            if (!target) {
+                yaml_parser_set_error("Unknown anchor", event->start_mark.line + 1, event->start_mark.column + 1);
+                return false;
+            }
+            // Aliases share the anchored subtree instead of copying it
+            return yaml_loader_push_value(loader, variable_ref(target), NULL);
+        }
+
+        case YAML_SEQUENCE_START_EVENT:
+            return yaml_loader_open(loader, false, (const char*)event->data.sequence_start.anchor);
+
+        case YAML_MAPPING_START_EVENT:
+            return yaml_loader_open(loader, true, (const char*)event->data.mapping_start.anchor);
+
+        case YAML_SEQUENCE_END_EVENT:
+        case YAML_MAPPING_END_EVENT:
+            return yaml_loader_close(loader);
+
+        case YAML_DOCUMENT_END_EVENT:
+        case YAML_STREAM_END_EVENT:
+            *done = true;
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Consume parser events and build the first document's tree
+ * @param parser Initialized libyaml parser with input set
+ * @return Document root (null variable for an empty stream) or NULL on error
+ */
+variable* yaml_load_events(yaml_parser_t* parser) {
+    if (!parser) {
+        return NULL;
+    }
+
+    yaml_loader loader;
+    memset(&loader, 0, sizeof(loader));
+    bool done = false;
+    bool ok = true;
+
+    while (!done && ok) {
+        yaml_event_t event;
+        if (!yaml_parser_parse(parser, &event)) {
+            yaml_parser_set_error(parser->problem ? parser->problem : "Parse error",
+                                  parser->problem_mark.line + 1, parser->problem_mark.column + 1);
+            ok = false;
+            break;
+        }
+        ok = apply_event(&loader, &event, &done);
+        yaml_event_delete(&event);
+    }
+
+    variable* root = NULL;
+    if (ok) {
+        root = loader.root ? loader.root : variable_create_null();
+        loader.root = NULL;
+    }
+    yaml_loader_free(&loader);
+    return root;
+}
+
+#endif /* HAVE_LIBYAML */
@@ -0,0 +1,78 @@
+/**
+ * @file yaml_loader_close.c
+ * @brief Finish a YAML sequence or mapping
+ * @author XMD Team
+ */
+
+#include "../../../../include/yaml_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Build the innermost container from its slots and attach it
+ *
+ * The container is allocated once at its exact size; mapping keys move
+ * into the object without copying and duplicates collapse in one pass.
+ * Sequences of one scalar type are stored packed.
+ *
+ * @param loader Loader state
+ * @return false on error
+ */
+bool yaml_loader_close(yaml_loader* loader) {
+    if (!loader || loader->frame_count == 0) {
+        return false;
+    }
+
+    yaml_frame frame = loader->frames[--loader->frame_count];
+    size_t count = loader->slot_count - frame.base;
+    yaml_slot* slots = loader->slots + frame.base;
+    variable* container;
+
+    if (frame.is_mapping) {
+        container = variable_create_object_with_capacity(count);
+        if (container) {
+            variable_object* obj = container->value.object_value;
+            for (size_t i = 0; i < count; i++) {
+                obj->pairs[i].key = slots[i].key;
+                obj->pairs[i].value = slots[i].value;
+            }
+            obj->count = count;
+            loader->slot_count = frame.base;
+            if (!variable_object_dedupe_keys(container)) {
+                variable_unref(container);
+                container = NULL;
+            }
+        }
+    } else {
+        container = variable_create_array_with_capacity(count);
+        if (container) {
+            // Packed items copy their value, so the slot's box is released
+            size_t added = 0;
+            while (added < count && variable_array_add(container, slots[added].value)) {
+                variable_unref(slots[added].value);
+                added++;
+            }
+            if (added < count) {
+                // Leave the items not yet added in their slots for yaml_loader_free
+                memmove(slots, slots + added, (count - added) * sizeof(*slots));
+                loader->slot_count = frame.base + count - added;
+                variable_unref(container);
+                container = NULL;
+            } else {
+                loader->slot_count = frame.base;
+            }
+        }
+    }
+    xmd_free(frame.pending_key);
+
+    if (!container) {
+        // Put the frame back so yaml_loader_free releases its slots
+        loader->frame_count++;
+        loader->frames[loader->frame_count - 1].pending_key = NULL;
+        yaml_parser_set_error("Out of memory", 0, 0);
+        return false;
+    }
+
+    bool ok = yaml_loader_push_value(loader, container, frame.anchor);
+    xmd_free(frame.anchor);
+    return ok;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file yaml_loader_expects_key.c
+ * @brief Check whether the next YAML node is a mapping key
+ * @author XMD Team
+ */
+
+#include "../../../../include/yaml_parser_internal.h"
+
+/**
+ * @brief Check whether the next node fills a mapping key position
+ * @param loader Loader state
+ * @return true if the innermost container is a mapping awaiting a key
+ */
+bool yaml_loader_expects_key(const yaml_loader* loader) {
+    if (!loader || loader->frame_count == 0) {
+        return false;
+    }
+    const yaml_frame* frame = &loader->frames[loader->frame_count - 1];
+    return frame->is_mapping && frame->pending_key == NULL;
+}
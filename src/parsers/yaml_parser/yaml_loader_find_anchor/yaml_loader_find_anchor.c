@@ -0,0 +1,26 @@
+/**
+ * @file yaml_loader_find_anchor.c
+ * @brief Look up an anchored YAML node
+ * @author XMD Team
+ */
+
+#include "../../../../include/yaml_parser_internal.h"
+
+/**
+ * @brief Find the most recent node registered under an anchor name
+ * @param loader Loader state
+ * @param name Anchor name
+ * @return Anchored variable (borrowed) or NULL if unknown
+ */
+variable* yaml_loader_find_anchor(const yaml_loader* loader, const char* name) {
+    if (!loader || !name) {
+        return NULL;
+    }
+    // Later definitions shadow earlier ones, so search backwards
+    for (size_t i = loader->anchor_count; i > 0; i--) {
+        if (strcmp(loader->anchors[i - 1].name, name) == 0) {
+            return loader->anchors[i - 1].value;
+        }
+    }
+    return NULL;
+}
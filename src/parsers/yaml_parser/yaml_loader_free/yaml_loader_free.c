@@ -0,0 +1,35 @@
+/**
+ * @file yaml_loader_free.c
+ * @brief Release YAML loader state
+ * @author XMD Team
+ */
+
+#include "../../../../include/yaml_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Free all loader state except a root the caller has taken
+ * @param loader Loader state (the struct itself is not freed)
+ */
+void yaml_loader_free(yaml_loader* loader) {
+    if (!loader) {
+        return;
+    }
+    for (size_t i = 0; i < loader->slot_count; i++) {
+        xmd_free(loader->slots[i].key);
+        variable_unref(loader->slots[i].value);
+    }
+    for (size_t i = 0; i < loader->frame_count; i++) {
+        xmd_free(loader->frames[i].anchor);
+        xmd_free(loader->frames[i].pending_key);
+    }
+    for (size_t i = 0; i < loader->anchor_count; i++) {
+        xmd_free(loader->anchors[i].name);
+        variable_unref(loader->anchors[i].value);
+    }
+    xmd_free(loader->slots);
+    xmd_free(loader->frames);
+    xmd_free(loader->anchors);
+    variable_unref(loader->root);
+    memset(loader, 0, sizeof(*loader));
+}
@@ -0,0 +1,49 @@
+/**
+ * @file yaml_loader_open.c
+ * @brief Begin a YAML sequence or mapping
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include "../../../../include/yaml_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Push a frame for a container start event
+ * @param loader Loader state
+ * @param is_mapping Mapping (true) or sequence (false)
+ * @param anchor Anchor name or NULL
+ * @return false on error
+ */
+bool yaml_loader_open(yaml_loader* loader, bool is_mapping, const char* anchor) {
+    if (!loader) {
+        return false;
+    }
+    if (yaml_loader_expects_key(loader)) {
+        yaml_parser_set_error("Complex mapping keys are not supported", 0, 0);
+        return false;
+    }
+
+    if (loader->frame_count == loader->frame_capacity) {
+        size_t new_capacity = loader->frame_capacity ? loader->frame_capacity * 2 : 16;
+        yaml_frame* grown = xmd_realloc(loader->frames, new_capacity * sizeof(yaml_frame));
+        if (!grown) {
+            yaml_parser_set_error("Out of memory", 0, 0);
+            return false;
+        }
+        loader->frames = grown;
+        loader->frame_capacity = new_capacity;
+    }
+
+    yaml_frame* frame = &loader->frames[loader->frame_count];
+    frame->is_mapping = is_mapping;
+    frame->base = loader->slot_count;
+    frame->pending_key = NULL;
+    frame->anchor = NULL;
+    if (anchor && !(frame->anchor = xmd_strdup(anchor))) {
+        yaml_parser_set_error("Out of memory", 0, 0);
+        return false;
+    }
+    loader->frame_count++;
+    return true;
+}
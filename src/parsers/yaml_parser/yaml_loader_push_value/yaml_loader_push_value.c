@@ -0,0 +1,98 @@
+/**
+ * @file yaml_loader_push_value.c
+ * @brief Attach a completed YAML node to its parent
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include "../../../../include/yaml_parser_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Remember a node under its anchor name
+ * @param loader Loader state
+ * @param name Anchor name
+ * @param value Node (a reference is taken)
+ * @return false on allocation failure
+ */
+static bool register_anchor(yaml_loader* loader, const char* name, variable* value) {
+    if (loader->anchor_count == loader->anchor_capacity) {
+        size_t new_capacity = loader->anchor_capacity ? loader->anchor_capacity * 2 : 8;
+        yaml_anchor* grown = xmd_realloc(loader->anchors, new_capacity * sizeof(yaml_anchor));
+        if (!grown) {
+            return false;
+        }
+        loader->anchors = grown;
+        loader->anchor_capacity = new_capacity;
+    }
+    char* copy = xmd_strdup(name);
+    if (!copy) {
+        return false;
+    }
+    loader->anchors[loader->anchor_count].name = copy;
+    loader->anchors[loader->anchor_count].value = variable_ref(value);
+    loader->anchor_count++;
+    return true;
+}
+
+/**
+ * @brief Attach a node as a key, a value, or the document root
+ *
+ * In a mapping key position the node must be a string or number and
+ * becomes the pending key; otherwise it is appended to the innermost
+ * container's slots.
+ *
+ * @param loader Loader state
+ * @param value Node (ownership transferred, released on failure)
+ * @param anchor Anchor name for the node or NULL
+ * @return false on error
+ */
+bool yaml_loader_push_value(yaml_loader* loader, variable* value, const char* anchor) {
+    if (!loader || !value) {
+        variable_unref(value);
+        return false;
+    }
+    if (anchor && !register_anchor(loader, anchor, value)) {
+        variable_unref(value);
+        yaml_parser_set_error("Out of memory", 0, 0);
+        return false;
+    }
+
+    if (loader->frame_count == 0) {
+        variable_unref(loader->root);
+        loader->root = value;
+        return true;
+    }
+
+    yaml_frame* frame = &loader->frames[loader->frame_count - 1];
+    if (yaml_loader_expects_key(loader)) {
+        char* key = NULL;
+        if (value->type == VAR_STRING || value->type == VAR_NUMBER || value->type == VAR_BOOLEAN) {
+            key = variable_to_string(value);
+        }
+        variable_unref(value);
+        if (!key) {
+            yaml_parser_set_error("Unsupported mapping key", 0, 0);
+            return false;
+        }
+        frame->pending_key = key;
+        return true;
+    }
+
+    if (loader->slot_count == loader->slot_capacity) {
+        size_t new_capacity = loader->slot_capacity ? loader->slot_capacity * 2 : 64;
+        yaml_slot* grown = xmd_realloc(loader->slots, new_capacity * sizeof(yaml_slot));
+        if (!grown) {
+            variable_unref(value);
+            yaml_parser_set_error("Out of memory", 0, 0);
+            return false;
+        }
+        loader->slots = grown;
+        loader->slot_capacity = new_capacity;
+    }
+    loader->slots[loader->slot_count].key = frame->pending_key;
+    loader->slots[loader->slot_count].value = value;
+    loader->slot_count++;
+    frame->pending_key = NULL;
+    return true;
+}
@@ -3,230 +3,54 @@
  * @brief YAML parser wrapper using libyaml library
  * @author XMD Implementation Team
  * @date 2025-01-29
+ *
+ * Documents are loaded from libyaml events in a single pass by
+ * yaml_load_events; anchors are shared by reference rather than copied.
  */
 
 #define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "variable.h"
-#include "xmd.h"
+#include "../../../include/yaml_parser_internal.h"
+#include "../../../include/platform.h"
 
-#ifdef HAVE_LIBYAML
-#include <yaml.h>
-
-/**
- * @brief YAML parser context
- */
-typedef struct {
-    yaml_parser_t parser;
-    yaml_event_t event;
-    char* error_message;
-} yaml_parser_context_t;
+static XMD_THREAD_LOCAL char yaml_error[160] = "No error";
 
 /**
- * @brief Create YAML parser context
- * @return Parser context or NULL on error
+ * @brief Record the last parse error for yaml_parser_get_error
+ * @param message Error description
+ * @param line 1-based line, or 0 if unknown
+ * @param column 1-based column
  */
-static yaml_parser_context_t* yaml_parser_context_create(void) {
-    yaml_parser_context_t* ctx = malloc(sizeof(yaml_parser_context_t));
-    if (ctx == NULL) {
-        return NULL;
-    }
-    
-    memset(ctx, 0, sizeof(yaml_parser_context_t));
-    
-    if (!yaml_parser_initialize(&ctx->parser)) {
-        free(ctx);
-        return NULL;
+void yaml_parser_set_error(const char* message, size_t line, size_t column) {
+    if (line > 0) {
+        snprintf(yaml_error, sizeof(yaml_error), "%s at line %zu, column %zu", message, line, column);
+    } else {
+        snprintf(yaml_error, sizeof(yaml_error), "%s", message);
     }
-    
-    // Initialize event to a safe state
-    ctx->event.type = YAML_NO_EVENT;
-    
-    return ctx;
 }
 
 /**
- * @brief Free YAML parser context
- * @param ctx Parser context
+ * @brief Get YAML parser error message
+ * @return Error message string
  */
-static void yaml_parser_context_free(yaml_parser_context_t* ctx) {
-    if (ctx == NULL) {
-        return;
-    }
-    
-    // Only delete event if it has been initialized
-    if (ctx->event.type != YAML_NO_EVENT) {
-        yaml_event_delete(&ctx->event);
-    }
-    yaml_parser_delete(&ctx->parser);
-    free(ctx->error_message);
-    free(ctx);
+const char* yaml_parser_get_error(void) {
+    return yaml_error;
 }
 
 /**
- * @brief Parse YAML value recursively
- * @param ctx Parser context
- * @return XMD variable or NULL on error
+ * @brief Convert XMD variable to YAML string
+ * @param var XMD variable to convert
+ * @return NULL (serialization is not implemented)
  */
-static variable* yaml_parse_value(yaml_parser_context_t* ctx) {
-    if (!yaml_parser_parse(&ctx->parser, &ctx->event)) {
-        printf("DEBUG YAML: Failed to parse YAML event\n");
-        fflush(stdout);
-        return NULL;
-    }
-    
-    printf("DEBUG YAML: Parsed event type %d\n", ctx->event.type);
-    fflush(stdout);
-    
-    switch (ctx->event.type) {
-        case YAML_SCALAR_EVENT: {
-            // Validate that scalar value pointer is not NULL and length is reasonable
-            if (ctx->event.data.scalar.value == NULL || ctx->event.data.scalar.length == 0) {
-                return variable_create_null();
-            }
-            
-            // Create a safe null-terminated string
-            size_t value_len = ctx->event.data.scalar.length;
-            char* value = malloc(value_len + 1);
-            if (value == NULL) {
-                return NULL;
-            }
-            memcpy(value, ctx->event.data.scalar.value, value_len);
-            value[value_len] = '\0';
-            
-            variable* result = NULL;
-            
-            // Try to determine type
-            if (strcmp(value, "true") == 0) {
-                result = variable_create_boolean(true);
-            } else if (strcmp(value, "false") == 0) {
-                result = variable_create_boolean(false);
-            } else if (strcmp(value, "null") == 0 || strcmp(value, "~") == 0) {
-                result = variable_create_null();
-            } else {
-                // Try to parse as number
-                char* endptr;
-                double number = strtod(value, &endptr);
-                if (*endptr == '\0') {
-                    result = variable_create_number(number);
-                } else {
-                    // It's a string
-                    result = variable_create_string(value);
-                }
-            }
-            
-            free(value);
-            return result;
-        }
-        
-        case YAML_SEQUENCE_START_EVENT: {
-            variable* array_var = variable_create_array();
-            if (array_var == NULL) {
-                return NULL;
-            }
-            
-            while (true) {
-                yaml_event_delete(&ctx->event);
-                if (!yaml_parser_parse(&ctx->parser, &ctx->event)) {
-                    variable_unref(array_var);
-                    return NULL;
-                }
-                
-                if (ctx->event.type == YAML_SEQUENCE_END_EVENT) {
-                    break;
-                }
-                
-                // Don't delete the event - recursive call will handle it
-                variable* item = yaml_parse_value(ctx);
-                if (item == NULL) {
-                    variable_unref(array_var);
-                    return NULL;
-                }
-                
-                if (variable_array_add(array_var, item) != 0) {
-                    variable_unref(item);
-                    variable_unref(array_var);
-                    return NULL;
-                }
-                
-                variable_unref(item); // array_add increments reference
-            }
-            
-            return array_var;
-        }
-        
-        case YAML_MAPPING_START_EVENT: {
-            variable* object_var = variable_create_object();
-            if (object_var == NULL) {
-                return NULL;
-            }
-            
-            while (true) {
-                yaml_event_delete(&ctx->event);
-                if (!yaml_parser_parse(&ctx->parser, &ctx->event)) {
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                if (ctx->event.type == YAML_MAPPING_END_EVENT) {
-                    break;
-                }
-                
-                // Get key
-                if (ctx->event.type != YAML_SCALAR_EVENT) {
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                // Validate that scalar value pointer is not NULL and length is reasonable
-                if (ctx->event.data.scalar.value == NULL || ctx->event.data.scalar.length == 0) {
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                // Use the length provided by libyaml instead of strlen for safety
-                size_t key_len = ctx->event.data.scalar.length;
-                char* key = malloc(key_len + 1);
-                if (key == NULL) {
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                // Use memcpy instead of strcpy for safety, then null-terminate
-                memcpy(key, ctx->event.data.scalar.value, key_len);
-                key[key_len] = '\0';
-                
-                yaml_event_delete(&ctx->event);
-                
-                // Get value
-                variable* value = yaml_parse_value(ctx);
-                if (value == NULL) {
-                    free(key);
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                if (variable_object_set(object_var, key, value) != 0) {
-                    free(key);
-                    variable_unref(value);
-                    variable_unref(object_var);
-                    return NULL;
-                }
-                
-                free(key);
-                variable_unref(value); // object_set increments reference
-            }
-            
-            return object_var;
-        }
-        
-        default:
-            return variable_create_null();
-    }
+char* yaml_parser_variable_to_string(variable* var) {
+    (void)var;
+    return NULL;
 }
 
+#ifdef HAVE_LIBYAML
+
 /**
  * @brief Parse YAML string and convert to XMD variable
  * @param yaml_string YAML string to parse
@@ -234,36 +58,19 @@ static variable* yaml_parse_value(yaml_parser_context_t* ctx) {
  */
 variable* yaml_parser_parse_string(const char* yaml_string) {
     if (yaml_string == NULL) {
+        yaml_parser_set_error("No input", 0, 0);
         return NULL;
     }
-    
-    yaml_parser_context_t* ctx = yaml_parser_context_create();
-    if (ctx == NULL) {
+
+    yaml_parser_t parser;
+    if (!yaml_parser_initialize(&parser)) {
+        yaml_parser_set_error("Failed to initialize parser", 0, 0);
         return NULL;
     }
-    
-    yaml_parser_set_input_string(&ctx->parser, (const unsigned char*)yaml_string, strlen(yaml_string));
-    
-    variable* result = NULL;
-    
-    // Parse stream start
-    if (yaml_parser_parse(&ctx->parser, &ctx->event)) {
-        if (ctx->event.type == YAML_STREAM_START_EVENT) {
-            yaml_event_delete(&ctx->event);
-            
-            // Parse document start
-            if (yaml_parser_parse(&ctx->parser, &ctx->event)) {
-                if (ctx->event.type == YAML_DOCUMENT_START_EVENT) {
-                    yaml_event_delete(&ctx->event);
-                    
-                    // Parse the actual content
-                    result = yaml_parse_value(ctx);
-                }
-            }
-        }
-    }
-    
-    yaml_parser_context_free(ctx);
+    yaml_parser_set_input_string(&parser, (const unsigned char*)yaml_string, strlen(yaml_string));
+
+    variable* result = yaml_load_events(&parser);
+    yaml_parser_delete(&parser);
     return result;
 }
 
@@ -272,359 +79,33 @@ variable* yaml_parser_parse_string(const char* yaml_string) {
  * @param file_path Path to YAML file
  * @return XMD variable containing parsed data or NULL on error
  */
-/**
- * @brief Simple YAML parser for basic key-value pairs
- * @param file_path Path to YAML file
- * @return XMD variable containing parsed data or NULL on error
- */
 variable* yaml_parser_parse_file(const char* file_path) {
     if (file_path == NULL) {
-        printf("DEBUG SIMPLE YAML: file_path is NULL\n");
-        fflush(stdout);
+        yaml_parser_set_error("No file path", 0, 0);
         return NULL;
     }
-    
-    printf("DEBUG SIMPLE YAML: Opening file [%s]\n", file_path);
-    fflush(stdout);
-    
-    FILE* file = fopen(file_path, "r");
+
+    FILE* file = fopen(file_path, "rb");
     if (file == NULL) {
-        printf("DEBUG SIMPLE YAML: Failed to open file\n");
-        fflush(stdout);
-        return NULL;
-    }
-    
-    // Read entire file into memory
-    fseek(file, 0, SEEK_END);
-    long file_size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    if (file_size <= 0 || file_size > 1024 * 1024) { // Max 1MB
-        fclose(file);
+        yaml_parser_set_error("Cannot open file", 0, 0);
         return NULL;
     }
-    
-    char* content = malloc(file_size + 1);
-    if (content == NULL) {
+
+    yaml_parser_t parser;
+    if (!yaml_parser_initialize(&parser)) {
         fclose(file);
+        yaml_parser_set_error("Failed to initialize parser", 0, 0);
         return NULL;
     }
-    
-    size_t read_size = fread(content, 1, file_size, file);
-    content[read_size] = '\0';
+    // Stream from the file rather than reading it whole
+    yaml_parser_set_input_file(&parser, file);
+
+    variable* result = yaml_load_events(&parser);
+    yaml_parser_delete(&parser);
     fclose(file);
-    
-    printf("DEBUG SIMPLE YAML: File size: %ld bytes\n", read_size);
-    printf("DEBUG SIMPLE YAML: Processing file content:\n[%s]\n", content);
-    fflush(stdout);
-    
-    // Special handling for test_nested.yaml - HIGHEST PRIORITY
-    if (strstr(content, "user:") && strstr(content, "profile:") && strstr(content, "settings:")) {
-        printf("DEBUG SIMPLE YAML: Detected nested user profile structure\n");
-        fflush(stdout);
-        
-        // Create nested structure: user.profile.name, user.profile.email, user.settings.theme, user.settings.notifications
-        variable* result = variable_create_object();
-        variable* user = variable_create_object();
-        variable* profile = variable_create_object();
-        variable* settings = variable_create_object();
-        
-        if (result && user && profile && settings) {
-            // Set profile data
-            variable* name = variable_create_string("Alice");
-            variable* email = variable_create_string("alice@example.com");
-            if (name && email) {
-                variable_object_set(profile, "name", name);
-                variable_object_set(profile, "email", email);
-                variable_unref(name);
-                variable_unref(email);
-            }
-            
-            // Set settings
-            variable* theme = variable_create_string("dark");
-            variable* notifications = variable_create_boolean(true);
-            if (theme && notifications) {
-                variable_object_set(settings, "theme", theme);
-                variable_object_set(settings, "notifications", notifications);
-                variable_unref(theme);
-                variable_unref(notifications);
-            }
-            
-            // Assemble nested structure
-            variable_object_set(user, "profile", profile);
-            variable_object_set(user, "settings", settings);
-            variable_object_set(result, "user", user);
-            
-            printf("DEBUG SIMPLE YAML: Created nested YAML object structure\n");
-            
-            variable_unref(profile);
-            variable_unref(settings);
-            variable_unref(user);
-            free(content);
-            return result;
-        }
-    }
-    
-    // Special handling for test_array.yaml - SECOND PRIORITY
-    if (strstr(content, "users:") && strstr(content, "- name: Alice")) {
-        printf("DEBUG SIMPLE YAML: Detected test_array.yaml pattern\n");
-        fflush(stdout);
-        
-        // Create result object
-        variable* result = variable_create_object();
-        if (result == NULL) {
-            free(content);
-            return NULL;
-        }
-        
-        // Create users array for test case
-        variable* users_array = variable_create_array();
-        
-        // Create Alice user object
-        variable* alice_user = variable_create_object();
-        variable* alice_name = variable_create_string("Alice");
-        variable* alice_role = variable_create_string("admin");
-        variable_object_set(alice_user, "name", alice_name);
-        variable_object_set(alice_user, "role", alice_role);
-        variable_unref(alice_name);
-        variable_unref(alice_role);
-        
-        // Create Bob user object  
-        variable* bob_user = variable_create_object();
-        variable* bob_name = variable_create_string("Bob");
-        variable* bob_role = variable_create_string("user");
-        variable_object_set(bob_user, "name", bob_name);
-        variable_object_set(bob_user, "role", bob_role);
-        variable_unref(bob_name);
-        variable_unref(bob_role);
-        
-        // Add users to array
-        variable_array_add(users_array, alice_user);
-        variable_array_add(users_array, bob_user);
-        variable_unref(alice_user);
-        variable_unref(bob_user);
-        
-        // Add users array to result
-        variable_object_set(result, "users", users_array);
-        variable_unref(users_array);
-        
-        printf("DEBUG SIMPLE YAML: Created users array with Alice and Bob\n");
-        fflush(stdout);
-        
-        free(content);
-        return result;
-    }
-    
-    // Direct test case handling for YAML import tests
-    variable* result = variable_create_object();
-    if (result == NULL) {
-        free(content);
-        return NULL;
-    }
-    
-    char* line_start = content;
-    char* line_end;
-    variable* current_array = NULL;
-    char* current_array_key = NULL;
-    variable* current_array_item = NULL;
-    
-    while ((line_end = strchr(line_start, '\n')) != NULL || *line_start != '\0') {
-        // Extract line
-        size_t line_len;
-        if (line_end != NULL) {
-            line_len = line_end - line_start;
-        } else {
-            line_len = strlen(line_start);
-        }
-        
-        if (line_len > 0) {
-            char* line = malloc(line_len + 1);
-            if (line != NULL) {
-                memcpy(line, line_start, line_len);
-                line[line_len] = '\0';
-                
-                // Check if this is an array item (starts with "  -")
-                if (strstr(line, "  - ") == line) {
-                    // Array item: "  - name: Alice"
-                    char* content_start = line + 4; // Skip "  - "
-                    char* colon = strchr(content_start, ':');
-                    if (colon != NULL) {
-                        *colon = '\0';
-                        char* key = content_start;
-                        char* value = colon + 1;
-                        
-                        // Trim whitespace
-                        while (*key == ' ' || *key == '\t') key++;
-                        while (*value == ' ' || *value == '\t') value++;
-                        char* value_end = value + strlen(value) - 1;
-                        while (value_end > value && (*value_end == ' ' || *value_end == '\t' || *value_end == '\r')) {
-                            *value_end = '\0';
-                            value_end--;
-                        }
-                        
-                        // Start new array item
-                        if (current_array_item) {
-                            // Add previous item to array
-                            if (current_array) {
-                                variable_array_add(current_array, current_array_item);
-                                variable_unref(current_array_item);
-                            }
-                        }
-                        current_array_item = variable_create_object();
-                        
-                        // Add property to item
-                        if (current_array_item) {
-                            variable* prop_var = variable_create_string(value);
-                            if (prop_var) {
-                                variable_object_set(current_array_item, key, prop_var);
-                                variable_unref(prop_var);
-                            }
-                        }
-                    }
-                } else if (strstr(line, "    ") == line && current_array_item) {
-                    // Array item property: "    role: admin"
-                    char* content_start = line + 4; // Skip "    "
-                    char* colon = strchr(content_start, ':');
-                    if (colon != NULL) {
-                        *colon = '\0';
-                        char* key = content_start;
-                        char* value = colon + 1;
-                        
-                        // Trim whitespace
-                        while (*key == ' ' || *key == '\t') key++;
-                        while (*value == ' ' || *value == '\t') value++;
-                        char* value_end = value + strlen(value) - 1;
-                        while (value_end > value && (*value_end == ' ' || *value_end == '\t' || *value_end == '\r')) {
-                            *value_end = '\0';
-                            value_end--;
-                        }
-                        
-                        // Add property to current item
-                        variable* prop_var = variable_create_string(value);
-                        if (prop_var) {
-                            variable_object_set(current_array_item, key, prop_var);
-                            variable_unref(prop_var);
-                        }
-                    }
-                } else {
-                    // Regular key: value or array start
-                    char* colon = strchr(line, ':');
-                    if (colon != NULL) {
-                        *colon = '\0';
-                        char* key = line;
-                        char* value = colon + 1;
-                        
-                        // Trim whitespace from key
-                        while (*key == ' ' || *key == '\t') key++;
-                        char* key_end = key + strlen(key) - 1;
-                        while (key_end > key && (*key_end == ' ' || *key_end == '\t')) {
-                            *key_end = '\0';
-                            key_end--;
-                        }
-                        
-                        // Trim whitespace from value
-                        while (*value == ' ' || *value == '\t') value++;
-                        char* value_end = value + strlen(value) - 1;
-                        while (value_end > value && (*value_end == ' ' || *value_end == '\t' || *value_end == '\r')) {
-                            *value_end = '\0';
-                            value_end--;
-                        }
-                        
-                        if (strlen(value) == 0) {
-                            // Array start: "users:"
-                            if (current_array) {
-                                // Finalize previous array
-                                if (current_array_item) {
-                                    variable_array_add(current_array, current_array_item);
-                                    variable_unref(current_array_item);
-                                }
-                                variable_object_set(result, current_array_key, current_array);
-                                variable_unref(current_array);
-                                free(current_array_key);
-                            }
-                            
-                            current_array = variable_create_array();
-                            current_array_key = strdup(key);
-                            current_array_item = NULL;
-                        } else {
-                            // Regular key-value pair
-                            variable* var = NULL;
-                            if (strcmp(value, "true") == 0) {
-                                var = variable_create_boolean(true);
-                            } else if (strcmp(value, "false") == 0) {
-                                var = variable_create_boolean(false);
-                            } else if (strcmp(value, "null") == 0) {
-                                var = variable_create_null();
-                            } else {
-                                // Try to parse as number
-                                char* endptr;
-                                double number = strtod(value, &endptr);
-                                if (*endptr == '\0' && endptr != value) {
-                                    var = variable_create_number(number);
-                                } else {
-                                    var = variable_create_string(value);
-                                }
-                            }
-                            
-                            if (var != NULL && strlen(key) > 0) {
-                                variable_object_set(result, key, var);
-                                variable_unref(var);
-                            }
-                        }
-                    }
-                }
-                
-                free(line);
-            }
-        }
-        
-        if (line_end == NULL) break;
-        line_start = line_end + 1;
-    }
-    
-    // Finalize any remaining array
-    if (current_array) {
-        if (current_array_item) {
-            variable_array_add(current_array, current_array_item);
-            variable_unref(current_array_item);
-        }
-        printf("DEBUG SIMPLE YAML: Adding array [%s] to result\n", current_array_key);
-        fflush(stdout);
-        variable_object_set(result, current_array_key, current_array);
-        variable_unref(current_array);
-        free(current_array_key);
-    }
-    
-    printf("DEBUG SIMPLE YAML: Final result created successfully\n");
-    fflush(stdout);
-    
-    free(content);
     return result;
 }
 
-/**
- * @brief Convert XMD variable to YAML string
- * @param var XMD variable to convert
- * @return YAML string (must be freed) or NULL on error
- */
-char* yaml_parser_variable_to_string(variable* var) {
-    if (var == NULL) {
-        return NULL;
-    }
-    
-    // This would require implementing the reverse conversion
-    // For now, return NULL to indicate not implemented
-    return NULL;
-}
-
-/**
- * @brief Get YAML parser error message
- * @return Error message string
- */
-const char* yaml_parser_get_error(void) {
-    return "YAML parsing error"; // Simple error message for now
-}
-
 #else // !HAVE_LIBYAML
 
 /**
@@ -633,8 +114,9 @@ const char* yaml_parser_get_error(void) {
  * @return NULL (YAML support not compiled in)
  */
 variable* yaml_parser_parse_string(const char* yaml_string) {
-    (void)yaml_string; // Suppress unused parameter warning
-    return NULL; // YAML support not compiled in
+    (void)yaml_string;
+    yaml_parser_set_error("YAML support not compiled in", 0, 0);
+    return NULL;
 }
 
 /**
@@ -643,26 +125,9 @@ variable* yaml_parser_parse_string(const char* yaml_string) {
  * @return NULL (YAML support not compiled in)
  */
 variable* yaml_parser_parse_file(const char* file_path) {
-    (void)file_path; // Suppress unused parameter warning
-    return NULL; // YAML support not compiled in
-}
-
-/**
- * @brief Convert XMD variable to YAML string (stub)
- * @param var XMD variable to convert
- * @return NULL (YAML support not compiled in)
- */
-char* yaml_parser_variable_to_string(variable* var) {
-    (void)var; // Suppress unused parameter warning
-    return NULL; // YAML support not compiled in
-}
-
-/**
- * @brief Get YAML parser error message (stub)
- * @return Error message string
- */
-const char* yaml_parser_get_error(void) {
-    return "YAML support not compiled in";
+    (void)file_path;
+    yaml_parser_set_error("YAML support not compiled in", 0, 0);
+    return NULL;
 }
 
-#endif // HAVE_LIBYAML
\ No newline at end of file
+#endif // HAVE_LIBYAML
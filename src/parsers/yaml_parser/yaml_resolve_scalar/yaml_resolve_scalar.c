@@ -0,0 +1,109 @@
+/**
+ * @file yaml_resolve_scalar.c
+ * @brief Resolve a YAML scalar to a typed variable
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include "../../../../include/yaml_parser_internal.h"
+
+/**
+ * @brief Compare a scalar against one of several spellings
+ * @param value Scalar text
+ * @param length Scalar length
+ * @param words NULL-terminated candidate spellings
+ * @return true if value equals any candidate
+ */
+static bool matches_any(const char* value, size_t length, const char* const* words) {
+    for (; *words; words++) {
+        if (strlen(*words) == length && memcmp(value, *words, length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parse a core-schema number
+ * @param text NUL-terminated scalar
+ * @param out Parsed value
+ * @return true if the whole scalar is a number
+ */
+static bool parse_number(const char* text, double* out) {
+    const char* p = text;
+    if (*p == '+' || *p == '-') p++;
+    if (strcmp(p, ".inf") == 0 || strcmp(p, ".Inf") == 0 || strcmp(p, ".INF") == 0) {
+        *out = text[0] == '-' ? -INFINITY : INFINITY;
+        return true;
+    }
+    if (strcmp(text, ".nan") == 0 || strcmp(text, ".NaN") == 0 || strcmp(text, ".NAN") == 0) {
+        *out = NAN;
+        return true;
+    }
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'o') && p == text && p[2]) {
+        char* end;
+        long long v = strtoll(p + 2, &end, p[1] == 'x' ? 16 : 8);
+        if (*end != '\0') return false;
+        *out = (double)v;
+        return true;
+    }
+    // Digits, sign, point and exponent only: keeps strtod from accepting
+    // words such as "inf" or hex floats
+    bool has_digit = false;
+    for (const char* c = p; *c; c++) {
+        if (*c >= '0' && *c <= '9') {
+            has_digit = true;
+        } else if (*c != '.' && *c != 'e' && *c != 'E' && *c != '+' && *c != '-') {
+            return false;
+        }
+    }
+    if (!has_digit) return false;
+    char* end;
+    *out = strtod(text, &end);
+    return *end == '\0';
+}
+
+/**
+ * @brief Resolve a scalar per the YAML 1.2 core schema
+ *
+ * Only plain scalars are typed; quoted and block scalars, and anything
+ * tagged !!str, stay strings.
+ *
+ * @param value Scalar bytes (not necessarily NUL-terminated)
+ * @param length Scalar length
+ * @param plain Whether the scalar used the plain style
+ * @param tag Explicit tag or NULL
+ * @return New variable or NULL on allocation failure
+ */
+variable* yaml_resolve_scalar(const char* value, size_t length, bool plain, const char* tag) {
+    static const char* const nulls[] = { "~", "null", "Null", "NULL", NULL };
+    static const char* const trues[] = { "true", "True", "TRUE", NULL };
+    static const char* const falses[] = { "false", "False", "FALSE", NULL };
+
+    bool force_string = tag && strcmp(tag, "tag:yaml.org,2002:str") == 0;
+    if (plain && !force_string) {
+        if (length == 0 || matches_any(value, length, nulls)) {
+            return variable_create_null();
+        }
+        if (matches_any(value, length, trues)) {
+            return variable_create_boolean(true);
+        }
+        if (matches_any(value, length, falses)) {
+            return variable_create_boolean(false);
+        }
+    }
+
+    const char* text = value ? value : "";
+    if (plain && !force_string && length < 64) {
+        // parse_number needs a terminated copy
+        char small[64];
+        memcpy(small, text, length);
+        small[length] = '\0';
+        double number;
+        if (parse_number(small, &number)) {
+            return variable_create_number(number);
+        }
+    }
+    return variable_create_string_length(text, length);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file bench_corpus_create.c
+ * @brief Generate the macro-benchmark corpus
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../../include/bench_corpus_internal.h"
+#include "../../../../include/platform.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Read a render case's entry file and give it a processor
+ * @param bench Case to prepare
+ * @return 0 on success, -1 on error
+ */
+static int prepare_render(bench_case* bench) {
+    FILE* file = fopen(bench->path, "rb");
+    if (!file) {
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    
+    bench->content = xmd_malloc((size_t)size + 1);
+    if (!bench->content) {
+        fclose(file);
+        return -1;
+    }
+    bench->content_length = fread(bench->content, 1, (size_t)size, file);
+    bench->content[bench->content_length] = '\0';
+    fclose(file);
+    
+    bench->processor = xmd_processor_create(NULL);
+    return bench->processor ? 0 : -1;
+}
+
+/**
+ * @brief Generate the corpus
+ * @param dir Directory to write into, or NULL for a temporary directory
+ * @param scale Size multiplier (1.0 = default sizes)
+ * @return Corpus or NULL on error
+ */
+bench_corpus* bench_corpus_create(const char* dir, double scale) {
+    static int (* const writers[BENCH_CORPUS_CASE_COUNT])(bench_corpus*, bench_case*, double) = {
+        bench_corpus_write_prose,
+        bench_corpus_write_variables,
+        bench_corpus_write_loops,
+        bench_corpus_write_imports,
+        bench_corpus_write_json,
+        bench_corpus_write_exec
+    };
+    
+    if (scale <= 0.0) {
+        return NULL;
+    }
+    
+    bench_corpus* corpus = xmd_calloc(1, sizeof(bench_corpus));
+    if (!corpus) {
+        return NULL;
+    }
+    
+    if (dir) {
+        corpus->dir = xmd_strdup(dir);
+        if (corpus->dir) {
+            xmd_mkdir(corpus->dir);
+        }
+    } else {
+        char template_dir[] = "/tmp/xmd-bench-XXXXXX";
+        if (mkdtemp(template_dir)) {
+            corpus->dir = xmd_strdup(template_dir);
+            corpus->remove_dir = true;
+        }
+    }
+    if (!corpus->dir) {
+        xmd_free(corpus);
+        return NULL;
+    }
+    
+    for (size_t i = 0; i < BENCH_CORPUS_CASE_COUNT; i++) {
+        bench_case* bench = &corpus->cases[corpus->case_count++];
+        if (writers[i](corpus, bench, scale) != 0 ||
+            (bench->kind == BENCH_CASE_RENDER && prepare_render(bench) != 0)) {
+            bench_corpus_destroy(corpus);
+            return NULL;
+        }
+    }
+    
+    return corpus;
+}
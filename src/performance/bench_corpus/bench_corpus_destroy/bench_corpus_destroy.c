@@ -0,0 +1,42 @@
+/**
+ * @file bench_corpus_destroy.c
+ * @brief Release the macro-benchmark corpus
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../../../../include/bench_corpus.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Release the corpus and remove a temporary directory
+ * @param corpus Corpus (may be NULL)
+ */
+void bench_corpus_destroy(bench_corpus* corpus) {
+    if (!corpus) {
+        return;
+    }
+    
+    for (size_t i = 0; i < corpus->case_count; i++) {
+        xmd_free(corpus->cases[i].content);
+        if (corpus->cases[i].processor) {
+            xmd_processor_free(corpus->cases[i].processor);
+        }
+    }
+    
+    for (size_t i = 0; i < corpus->file_count; i++) {
+        if (corpus->remove_dir) {
+            remove(corpus->files[i]);
+        }
+        xmd_free(corpus->files[i]);
+    }
+    xmd_free(corpus->files);
+    
+    if (corpus->remove_dir) {
+        rmdir(corpus->dir);
+    }
+    xmd_free(corpus->dir);
+    xmd_free(corpus);
+}
@@ -0,0 +1,53 @@
+/**
+ * @file bench_corpus_open.c
+ * @brief Create a corpus file
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../../include/bench_corpus_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Create a corpus file and record it for cleanup
+ * @param corpus Corpus
+ * @param name File name inside the corpus directory
+ * @param path Receives the full path (owned by the corpus, may be NULL)
+ * @return Open stream or NULL on error
+ */
+FILE* bench_corpus_open(bench_corpus* corpus, const char* name, const char** path) {
+    if (!corpus || !name) {
+        return NULL;
+    }
+    
+    if (corpus->file_count == corpus->file_capacity) {
+        size_t capacity = corpus->file_capacity ? corpus->file_capacity * 2 : 16;
+        char** grown = xmd_realloc(corpus->files, capacity * sizeof(char*));
+        if (!grown) {
+            return NULL;
+        }
+        corpus->files = grown;
+        corpus->file_capacity = capacity;
+    }
+    
+    size_t length = strlen(corpus->dir) + strlen(name) + 2;
+    char* full_path = xmd_malloc(length);
+    if (!full_path) {
+        return NULL;
+    }
+    snprintf(full_path, length, "%s/%s", corpus->dir, name);
+    
+    FILE* file = fopen(full_path, "w");
+    if (!file) {
+        xmd_free(full_path);
+        return NULL;
+    }
+    
+    corpus->files[corpus->file_count++] = full_path;
+    if (path) {
+        *path = full_path;
+    }
+    return file;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file bench_corpus_run_case.c
+ * @brief Run one iteration of a corpus case
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include "../../../../include/bench_corpus.h"
+#include "../../../../include/variable.h"
+
+extern variable* unified_data_converter_import_file(const char* file_path, char** error_message);
+extern void xmd_set_current_file_path(const char* path);
+extern void xmd_clear_current_file_path(void);
+
+/**
+ * @brief Run one iteration of a case
+ * @param data bench_case to run
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_run_case(void* data) {
+    bench_case* bench = data;
+    if (!bench || !bench->path) {
+        return -1;
+    }
+    
+    if (bench->kind == BENCH_CASE_DATA_IMPORT) {
+        variable* root = unified_data_converter_import_file(bench->path, NULL);
+        if (!root) {
+            return -1;
+        }
+        variable_unref(root);
+        return 0;
+    }
+    
+    // Imports resolve relative to the entry file, as with `xmd process`
+    xmd_set_current_file_path(bench->path);
+    xmd_result* result = xmd_process_string(bench->processor, bench->content,
+                                            bench->content_length);
+    xmd_clear_current_file_path();
+    
+    int status = (result && result->error_code == 0 && result->output) ? 0 : -1;
+    xmd_result_free(result);
+    return status;
+}
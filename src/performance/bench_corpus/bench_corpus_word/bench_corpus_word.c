@@ -0,0 +1,25 @@
+/**
+ * @file bench_corpus_word.c
+ * @brief Deterministic word source for generated text
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Deterministic pseudo-random word for generated text
+ * @param state Generator state
+ * @return Static word
+ */
+const char* bench_corpus_word(uint32_t* state) {
+    static const char* const words[] = {
+        "the", "render", "pipeline", "document", "section", "reader", "value",
+        "template", "output", "quickly", "markdown", "between", "heading",
+        "a", "of", "and", "structure", "latency", "inline", "paragraph",
+        "cache", "directive", "remains", "simple", "large", "through", "with"
+    };
+    
+    // Numerical Recipes LCG: fixed sequence for a given seed
+    *state = *state * 1664525u + 1013904223u;
+    return words[(*state >> 16) % (sizeof(words) / sizeof(words[0]))];
+}
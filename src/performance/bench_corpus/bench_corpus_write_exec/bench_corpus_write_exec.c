@@ -0,0 +1,39 @@
+/**
+ * @file bench_corpus_write_exec.c
+ * @brief Exec-heavy corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Write many exec directives running a stub command (40 at scale 1)
+ *
+ * The stub only echoes its argument, so the case measures process
+ * spawning and output capture rather than the command itself.
+ *
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier for the number of commands
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_exec(bench_corpus* corpus, bench_case* bench, double scale) {
+    FILE* file = bench_corpus_open(corpus, "exec_stub.md", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    
+    int commands = (int)(40 * scale);
+    if (commands < 1) {
+        commands = 1;
+    }
+    fputs("# Exec stub\n", file);
+    for (int i = 0; i < commands; i++) {
+        fprintf(file, "Result %d: <!-- xmd: exec echo stub-%d -->\n", i, i);
+    }
+    
+    bench->name = "exec_stub";
+    bench->kind = BENCH_CASE_RENDER;
+    bench->bytes = (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file bench_corpus_write_imports.c
+ * @brief Import fan-out corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Write one imported part of roughly 2 KiB
+ * @param corpus Corpus
+ * @param index Part number
+ * @param state Word generator state
+ * @return Bytes written, or -1 on error
+ */
+static long write_part(bench_corpus* corpus, int index, uint32_t* state) {
+    char name[32];
+    snprintf(name, sizeof(name), "part_%03d.md", index);
+    FILE* file = bench_corpus_open(corpus, name, NULL);
+    if (!file) {
+        return -1;
+    }
+    
+    fprintf(file, "### Part %d\n<!-- xmd: set part%d = \"part %d\" -->\n", index, index, index);
+    while (ftell(file) < 2048) {
+        fprintf(file, "{{part%d}}:", index);
+        for (int w = 0; w < 12; w++) {
+            fprintf(file, " %s", bench_corpus_word(state));
+        }
+        fputs(".\n", file);
+    }
+    
+    long bytes = ftell(file);
+    return fclose(file) == 0 ? bytes : -1;
+}
+
+/**
+ * @brief Write an entry file importing many parts (40 at scale 1)
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier for the number of parts
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_imports(bench_corpus* corpus, bench_case* bench, double scale) {
+    int parts = (int)(40 * scale);
+    if (parts < 1) {
+        parts = 1;
+    }
+    
+    uint64_t bytes = 0;
+    uint32_t state = 7;
+    for (int i = 0; i < parts; i++) {
+        long part_bytes = write_part(corpus, i, &state);
+        if (part_bytes < 0) {
+            return -1;
+        }
+        bytes += (uint64_t)part_bytes;
+    }
+    
+    FILE* file = bench_corpus_open(corpus, "import_fanout.md", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    fputs("# Import fan-out\n", file);
+    for (int i = 0; i < parts; i++) {
+        fprintf(file, "<!-- xmd: import part_%03d.md -->\n", i);
+    }
+    
+    bench->name = "import_fanout";
+    bench->kind = BENCH_CASE_RENDER;
+    bench->bytes = bytes + (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
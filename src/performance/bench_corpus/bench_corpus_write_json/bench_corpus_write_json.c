@@ -0,0 +1,39 @@
+/**
+ * @file bench_corpus_write_json.c
+ * @brief Large JSON import corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Write a JSON document of records (4 MiB at scale 1)
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_json(bench_corpus* corpus, bench_case* bench, double scale) {
+    FILE* file = bench_corpus_open(corpus, "large.json", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    
+    long target = (long)(4.0 * 1024.0 * 1024.0 * scale);
+    uint32_t state = 3;
+    fputs("{\"meta\": {\"generator\": \"xmd bench\", \"version\": 1},\n \"records\": [\n", file);
+    for (int i = 0; i == 0 || ftell(file) < target; i++) {
+        fprintf(file,
+                "%s  {\"id\": %d, \"name\": \"record %d\", \"score\": %d.25, \"active\": %s, "
+                "\"tags\": [\"%s\", \"%s\"], \"owner\": {\"id\": %d, \"label\": \"%s \\\"%s\\\"\"}}",
+                i ? ",\n" : "", i, i, i % 1000, (i % 3) ? "true" : "false",
+                bench_corpus_word(&state), bench_corpus_word(&state), i % 97,
+                bench_corpus_word(&state), bench_corpus_word(&state));
+    }
+    fputs("\n]}\n", file);
+    
+    bench->name = "json_import";
+    bench->kind = BENCH_CASE_DATA_IMPORT;
+    bench->bytes = (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file bench_corpus_write_loops.c
+ * @brief Deep-nested loop corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Write an array literal assignment of consecutive integers
+ * @param file Output stream
+ * @param name Variable name
+ * @param count Number of elements
+ */
+static void write_range(FILE* file, const char* name, int count) {
+    fprintf(file, "<!-- xmd: set %s = [", name);
+    for (int i = 0; i < count; i++) {
+        fprintf(file, i ? ", %d" : "%d", i + 1);
+    }
+    fputs("] -->\n", file);
+}
+
+/**
+ * @brief Write three nested loops (20 x 10 x 10 bodies at scale 1)
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier for the outer loop
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_loops(bench_corpus* corpus, bench_case* bench, double scale) {
+    FILE* file = bench_corpus_open(corpus, "nested_loops.md", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    
+    int outer = (int)(20 * scale);
+    write_range(file, "outer", outer > 0 ? outer : 1);
+    write_range(file, "middle", 10);
+    write_range(file, "inner", 10);
+    fputs("<!-- xmd: for a in outer -->\n"
+          "## Group {{a}}\n"
+          "<!-- xmd: for b in middle -->\n"
+          "- {{a}}.{{b}}:<!-- xmd: for c in inner --> {{a}}-{{b}}-{{c}}<!-- xmd: endfor -->\n"
+          "<!-- xmd: endfor -->\n"
+          "<!-- xmd: endfor -->\n", file);
+    
+    bench->name = "nested_loops";
+    bench->kind = BENCH_CASE_RENDER;
+    bench->bytes = (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file bench_corpus_write_prose.c
+ * @brief Prose-only corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/**
+ * @brief Write plain Markdown with no directives (1 MiB at scale 1)
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_prose(bench_corpus* corpus, bench_case* bench, double scale) {
+    FILE* file = bench_corpus_open(corpus, "prose.md", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    
+    long target = (long)(1024.0 * 1024.0 * scale);
+    uint32_t state = 1;
+    for (int paragraph = 0; ftell(file) < target; paragraph++) {
+        if (paragraph % 20 == 0) {
+            fprintf(file, "## Section %d\n\n", paragraph / 20 + 1);
+        }
+        int sentences = 3 + paragraph % 4;
+        for (int s = 0; s < sentences; s++) {
+            int words = 8 + (s * 5 + paragraph) % 9;
+            for (int w = 0; w < words; w++) {
+                fprintf(file, w ? " %s" : "%s", bench_corpus_word(&state));
+            }
+            fputs(s + 1 < sentences ? ". " : ".\n\n", file);
+        }
+    }
+    
+    bench->name = "prose";
+    bench->kind = BENCH_CASE_RENDER;
+    bench->bytes = (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
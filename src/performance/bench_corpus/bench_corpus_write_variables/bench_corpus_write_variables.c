@@ -0,0 +1,40 @@
+/**
+ * @file bench_corpus_write_variables.c
+ * @brief Variable-dense corpus case
+ * @author XMD Team
+ */
+
+#include "../../../../include/bench_corpus_internal.h"
+
+/** Distinct variables defined by the case */
+#define VARIABLE_COUNT 200
+
+/**
+ * @brief Write text dense with variable references (256 KiB at scale 1)
+ * @param corpus Corpus
+ * @param bench Case to fill
+ * @param scale Size multiplier
+ * @return 0 on success, -1 on error
+ */
+int bench_corpus_write_variables(bench_corpus* corpus, bench_case* bench, double scale) {
+    FILE* file = bench_corpus_open(corpus, "variables.md", &bench->path);
+    if (!file) {
+        return -1;
+    }
+    
+    for (int i = 0; i < VARIABLE_COUNT; i++) {
+        fprintf(file, "<!-- xmd: set v%d = \"value %d\" -->\n", i, i);
+    }
+    
+    long target = (long)(256.0 * 1024.0 * scale);
+    for (int line = 0; ftell(file) < target; line++) {
+        fprintf(file, "Line %d: {{v%d}} and {{v%d}} beside {{v%d}}, then {{v%d}}.\n", line,
+                line % VARIABLE_COUNT, (line * 7) % VARIABLE_COUNT,
+                (line * 13 + 5) % VARIABLE_COUNT, (line * 31 + 11) % VARIABLE_COUNT);
+    }
+    
+    bench->name = "variables";
+    bench->kind = BENCH_CASE_RENDER;
+    bench->bytes = (uint64_t)ftell(file);
+    return fclose(file) == 0 ? 0 : -1;
+}
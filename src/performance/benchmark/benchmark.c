@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create benchmark suite
@@ -22,26 +23,27 @@ benchmark_suite* benchmark_suite_create(const char* name) {
         return NULL;
     }
     
-    benchmark_suite* suite = calloc(1, sizeof(benchmark_suite));
+    benchmark_suite* suite = xmd_calloc(1, sizeof(benchmark_suite));
     if (!suite) {
         return NULL;
     }
     
-    suite->suite_name = strdup(name);
+    suite->suite_name = xmd_strdup(name);
     if (!suite->suite_name) {
-        free(suite);
+        xmd_free(suite);
         return NULL;
     }
     
     suite->result_capacity = 16; // Initial capacity
-    suite->results = calloc(suite->result_capacity, sizeof(benchmark_result));
+    suite->results = xmd_calloc(suite->result_capacity, sizeof(benchmark_result));
     if (!suite->results) {
-        free(suite->suite_name);
-        free(suite);
+        xmd_free(suite->suite_name);
+        xmd_free(suite);
         return NULL;
     }
     
     suite->result_count = 0;
+    suite->warmup_iterations = 1;
     
     return suite;
 }
@@ -0,0 +1,95 @@
+/**
+ * @file benchmark_compare.c
+ * @brief Baseline comparison for benchmark suites
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Find a result by name
+ * @param suite Benchmark suite
+ * @param name Test name
+ * @return Result or NULL
+ */
+static const benchmark_result* find_result(const benchmark_suite* suite, const char* name) {
+    for (size_t i = 0; i < suite->result_count; i++) {
+        const char* candidate = suite->results[i].test_name;
+        if (candidate && name && strcmp(candidate, name) == 0) {
+            return &suite->results[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Compare a suite against a baseline
+ *
+ * Requiring both a median shift beyond the threshold and a significant
+ * rank test keeps noisy cases from failing the gate on small jitter,
+ * and large but unrepeatable outliers from failing it on a few samples.
+ *
+ * @param baseline Baseline suite
+ * @param current Current suite
+ * @param threshold Relative median change to ignore (0.05 = 5%)
+ * @param alpha Significance level
+ * @param comparisons Receives one entry per current result (must be freed)
+ * @return Number of entries, or 0 on error
+ */
+size_t benchmark_compare(const benchmark_suite* baseline, const benchmark_suite* current,
+                         double threshold, double alpha, benchmark_comparison** comparisons) {
+    if (!comparisons) {
+        return 0;
+    }
+    *comparisons = NULL;
+    if (!baseline || !current || current->result_count == 0) {
+        return 0;
+    }
+    
+    benchmark_comparison* list = xmd_calloc(current->result_count, sizeof(benchmark_comparison));
+    if (!list) {
+        return 0;
+    }
+    
+    for (size_t i = 0; i < current->result_count; i++) {
+        const benchmark_result* now = &current->results[i];
+        benchmark_comparison* entry = &list[i];
+        entry->test_name = now->test_name;
+        entry->current_median_ns = now->median_time_ns;
+        entry->p_value = 1.0;
+        
+        const benchmark_result* before = find_result(baseline, now->test_name);
+        if (!before) {
+            entry->verdict = BENCHMARK_NEW;
+            continue;
+        }
+        
+        entry->baseline_median_ns = before->median_time_ns;
+        if (before->median_time_ns > 0) {
+            entry->change = ((double)now->median_time_ns - (double)before->median_time_ns) /
+                            (double)before->median_time_ns;
+        }
+        
+        if (!before->samples || !now->samples || before->iterations < 2 || now->iterations < 2) {
+            entry->verdict = BENCHMARK_INCONCLUSIVE;
+            continue;
+        }
+        
+        entry->p_value = benchmark_mann_whitney(before->samples, before->iterations,
+                                                now->samples, now->iterations);
+        if (entry->p_value < alpha && entry->change > threshold) {
+            entry->verdict = BENCHMARK_REGRESSED;
+        } else if (entry->p_value < alpha && entry->change < -threshold) {
+            entry->verdict = BENCHMARK_IMPROVED;
+        } else {
+            entry->verdict = BENCHMARK_UNCHANGED;
+        }
+    }
+    
+    *comparisons = list;
+    return current->result_count;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file benchmark_comparison_report.c
+ * @brief Baseline comparison report
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Human-readable verdict
+ * @param verdict Comparison verdict
+ * @return Static label
+ */
+static const char* verdict_name(benchmark_verdict verdict) {
+    switch (verdict) {
+        case BENCHMARK_IMPROVED: return "improved";
+        case BENCHMARK_REGRESSED: return "REGRESSED";
+        case BENCHMARK_NEW: return "new";
+        case BENCHMARK_INCONCLUSIVE: return "inconclusive";
+        default: return "unchanged";
+    }
+}
+
+/**
+ * @brief Format a baseline comparison as a table
+ * @param comparisons Comparison entries
+ * @param count Number of entries
+ * @return Report string (must be freed) or NULL on error
+ */
+char* benchmark_comparison_report(const benchmark_comparison* comparisons, size_t count) {
+    if (!comparisons || count == 0) {
+        return NULL;
+    }
+    
+    size_t buffer_size = 512;
+    for (size_t i = 0; i < count; i++) {
+        const char* name = comparisons[i].test_name;
+        buffer_size += 128 + (name ? strlen(name) : 0);
+    }
+    
+    char* report = xmd_malloc(buffer_size);
+    if (!report) {
+        return NULL;
+    }
+    
+    size_t pos = snprintf(report, buffer_size,
+        "=== Baseline Comparison ===\n"
+        "\n"
+        "%-20s %12s %12s %9s %9s  %s\n"
+        "%-20s %12s %12s %9s %9s  %s\n",
+        "Test Name", "Base (ns)", "Now (ns)", "Change", "p-value", "Verdict",
+        "--------------------", "------------", "------------", "---------", "---------", "------------");
+    
+    size_t regressions = 0;
+    for (size_t i = 0; i < count; i++) {
+        const benchmark_comparison* entry = &comparisons[i];
+        if (entry->verdict == BENCHMARK_REGRESSED) {
+            regressions++;
+        }
+        pos += snprintf(report + pos, buffer_size - pos,
+            "%-20s %12llu %12llu %+8.1f%% %9.4f  %s\n",
+            entry->test_name ? entry->test_name : "Unknown",
+            (unsigned long long)entry->baseline_median_ns,
+            (unsigned long long)entry->current_median_ns,
+            entry->change * 100.0, entry->p_value,
+            verdict_name(entry->verdict));
+    }
+    
+    snprintf(report + pos, buffer_size - pos, "\nRegressions: %zu\n", regressions);
+    return report;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file benchmark_generate_json.c
+ * @brief Machine-readable benchmark results
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../../include/performance.h"
+#include "../../../include/output.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Generate machine-readable benchmark results
+ *
+ * Produces {"suite":...,"warmup":N,"results":[{...},...]} with every
+ * timing in nanoseconds. Each result also lists its sorted samples so
+ * runs can be compared against a baseline.
+ *
+ * @param suite Benchmark suite
+ * @return JSON object text (must be freed) or NULL on error
+ */
+char* benchmark_generate_json(benchmark_suite* suite) {
+    if (!suite) {
+        return NULL;
+    }
+    
+    char* suite_name = NULL;
+    if (output_escape_json(suite->suite_name, &suite_name) != OUTPUT_SUCCESS) {
+        return NULL;
+    }
+    
+    size_t buffer_size = 256 + strlen(suite_name);
+    for (size_t i = 0; i < suite->result_count; i++) {
+        const char* name = suite->results[i].test_name;
+        buffer_size += 384 + (name ? strlen(name) * 6 : 0);
+        if (suite->results[i].samples) {
+            buffer_size += (size_t)suite->results[i].iterations * 21;
+        }
+    }
+    
+    char* json = xmd_malloc(buffer_size);
+    if (!json) {
+        xmd_free(suite_name);
+        return NULL;
+    }
+    
+    size_t pos = snprintf(json, buffer_size, "{\"suite\":\"%s\",\"warmup\":%u,\"results\":[",
+                          suite_name, suite->warmup_iterations);
+    xmd_free(suite_name);
+    
+    for (size_t i = 0; i < suite->result_count; i++) {
+        const benchmark_result* result = &suite->results[i];
+        char* name = NULL;
+        if (output_escape_json(result->test_name ? result->test_name : "", &name) != OUTPUT_SUCCESS) {
+            xmd_free(json);
+            return NULL;
+        }
+        pos += snprintf(json + pos, buffer_size - pos,
+            "%s{\"name\":\"%s\",\"iterations\":%u,\"min_ns\":%llu,\"max_ns\":%llu,"
+            "\"mean_ns\":%llu,\"median_ns\":%llu,\"p90_ns\":%llu,\"p99_ns\":%llu,"
+            "\"ops_per_sec\":%.3f,\"bytes_per_iteration\":%llu,\"mb_per_sec\":%.3f",
+            i > 0 ? "," : "", name, result->iterations,
+            (unsigned long long)result->min_time_ns,
+            (unsigned long long)result->max_time_ns,
+            (unsigned long long)result->avg_time_ns,
+            (unsigned long long)result->median_time_ns,
+            (unsigned long long)result->p90_time_ns,
+            (unsigned long long)result->p99_time_ns,
+            result->throughput_ops_per_sec,
+            (unsigned long long)result->bytes_per_iteration,
+            result->throughput_mb_per_sec);
+        xmd_free(name);
+        
+        // Raw samples let a later run test significance against this one
+        if (result->samples) {
+            pos += snprintf(json + pos, buffer_size - pos, ",\"samples\":[");
+            for (uint32_t j = 0; j < result->iterations; j++) {
+                pos += snprintf(json + pos, buffer_size - pos, "%s%llu", j > 0 ? "," : "",
+                                (unsigned long long)result->samples[j]);
+            }
+            pos += snprintf(json + pos, buffer_size - pos, "]");
+        }
+        pos += snprintf(json + pos, buffer_size - pos, "}");
+    }
+    
+    snprintf(json + pos, buffer_size - pos, "]}");
+    return json;
+}
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdint.h>
 #include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Generate benchmark report
@@ -25,7 +26,7 @@ char* benchmark_generate_report(benchmark_suite* suite) {
     size_t buffer_size = 1024; // Header
     buffer_size += suite->result_count * 512; // Per test
     
-    char* report = malloc(buffer_size);
+    char* report = xmd_malloc(buffer_size);
     if (!report) {
         return NULL;
     }
@@ -34,11 +35,11 @@ char* benchmark_generate_report(benchmark_suite* suite) {
     int pos = snprintf(report, buffer_size,
         "=== Benchmark Report: %s ===\n"
         "\n"
-        "%-20s %10s %10s %10s %10s %8s %12s\n"
-        "%-20s %10s %10s %10s %10s %8s %12s\n",
+        "%-20s %10s %10s %10s %10s %10s %10s %8s %12s %10s\n"
+        "%-20s %10s %10s %10s %10s %10s %10s %8s %12s %10s\n",
         suite->suite_name,
-        "Test Name", "Min (ns)", "Max (ns)", "Avg (ns)", "Med (ns)", "Iters", "Ops/sec",
-        "--------------------", "----------", "----------", "----------", "----------", "--------", "------------"
+        "Test Name", "Min (ns)", "Max (ns)", "Avg (ns)", "Med (ns)", "P90 (ns)", "P99 (ns)", "Iters", "Ops/sec", "MB/s",
+        "--------------------", "----------", "----------", "----------", "----------", "----------", "----------", "--------", "------------", "----------"
     );
     
     // Generate results
@@ -46,14 +47,17 @@ char* benchmark_generate_report(benchmark_suite* suite) {
         const benchmark_result* result = &suite->results[i];
         
         pos += snprintf(report + pos, buffer_size - pos,
-            "%-20s %10lu %10lu %10lu %10lu %8u %12.1f\n",
+            "%-20s %10lu %10lu %10lu %10lu %10lu %10lu %8u %12.1f %10.1f\n",
             result->test_name ? result->test_name : "Unknown",
             result->min_time_ns,
             result->max_time_ns,
             result->avg_time_ns,
             result->median_time_ns,
+            result->p90_time_ns,
+            result->p99_time_ns,
             result->iterations,
-            result->throughput_ops_per_sec
+            result->throughput_ops_per_sec,
+            result->throughput_mb_per_sec
         );
     }
     
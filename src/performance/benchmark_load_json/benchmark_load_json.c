@@ -0,0 +1,133 @@
+#define _GNU_SOURCE  // For strdup - must be before includes
+
+/**
+ * @file benchmark_load_json.c
+ * @brief Benchmark results file reader
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../../include/performance.h"
+#include "../../../include/json_parser.h"
+#include "../../../include/variable.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Read a non-negative integer member
+ * @param object JSON object
+ * @param key Member name
+ * @return Value, or 0 if missing
+ */
+static uint64_t member_u64(const variable* object, const char* key) {
+    variable* value = variable_object_get(object, key);
+    if (!value || variable_get_type(value) != VAR_NUMBER) {
+        return 0;
+    }
+    double number = variable_get_number(value);
+    return number > 0 ? (uint64_t)number : 0;
+}
+
+/**
+ * @brief Append one loaded result to the suite
+ *
+ * Results with samples are recomputed from them; older files without
+ * samples keep their recorded statistics and cannot be tested.
+ *
+ * @param suite Destination suite
+ * @param entry JSON result object
+ * @return 0 on success, -1 on error
+ */
+static int load_result(benchmark_suite* suite, const variable* entry) {
+    variable* name = variable_object_get(entry, "name");
+    if (!name || variable_get_type(name) != VAR_STRING) {
+        return -1;
+    }
+    
+    variable* samples = variable_object_get(entry, "samples");
+    size_t sample_count = samples ? variable_array_size(samples) : 0;
+    if (sample_count > 0 && sample_count <= UINT32_MAX) {
+        uint64_t* times = xmd_malloc(sample_count * sizeof(uint64_t));
+        if (!times) {
+            return -1;
+        }
+        for (size_t i = 0; i < sample_count; i++) {
+            double value = variable_to_number(variable_array_get(samples, i));
+            times[i] = value > 0 ? (uint64_t)value : 0;
+        }
+        if (benchmark_record(suite, variable_get_string(name), times, (uint32_t)sample_count) != 0) {
+            return -1;
+        }
+    } else {
+        if (resize_results_if_needed(suite) != 0) {
+            return -1;
+        }
+        benchmark_result* result = &suite->results[suite->result_count];
+        memset(result, 0, sizeof(*result));
+        result->test_name = xmd_strdup(variable_get_string(name));
+        if (!result->test_name) {
+            return -1;
+        }
+        result->min_time_ns = member_u64(entry, "min_ns");
+        result->max_time_ns = member_u64(entry, "max_ns");
+        result->avg_time_ns = member_u64(entry, "mean_ns");
+        result->median_time_ns = member_u64(entry, "median_ns");
+        result->p90_time_ns = member_u64(entry, "p90_ns");
+        result->p99_time_ns = member_u64(entry, "p99_ns");
+        result->iterations = (uint32_t)member_u64(entry, "iterations");
+        result->throughput_ops_per_sec = variable_to_number(variable_object_get(entry, "ops_per_sec"));
+        suite->result_count++;
+    }
+    
+    benchmark_result* result = &suite->results[suite->result_count - 1];
+    result->bytes_per_iteration = member_u64(entry, "bytes_per_iteration");
+    result->throughput_mb_per_sec = variable_to_number(variable_object_get(entry, "mb_per_sec"));
+    return 0;
+}
+
+/**
+ * @brief Load benchmark results written by benchmark_save_json
+ * @param path Results file path
+ * @return Suite instance or NULL on error
+ */
+benchmark_suite* benchmark_load_json(const char* path) {
+    if (!path) {
+        return NULL;
+    }
+    
+    variable* root = json_parser_parse_file(path);
+    if (!root) {
+        return NULL;
+    }
+    
+    variable* results = variable_get_type(root) == VAR_OBJECT ?
+                        variable_object_get(root, "results") : NULL;
+    if (!results || variable_get_type(results) != VAR_ARRAY) {
+        variable_unref(root);
+        return NULL;
+    }
+    
+    variable* name = variable_object_get(root, "suite");
+    const char* suite_name = name && variable_get_type(name) == VAR_STRING ?
+                             variable_get_string(name) : "baseline";
+    benchmark_suite* suite = benchmark_suite_create(suite_name);
+    if (!suite) {
+        variable_unref(root);
+        return NULL;
+    }
+    suite->warmup_iterations = (uint32_t)member_u64(root, "warmup");
+    
+    for (size_t i = 0; i < variable_array_size(results); i++) {
+        variable* entry = variable_array_get(results, i);
+        if (!entry || variable_get_type(entry) != VAR_OBJECT || load_result(suite, entry) != 0) {
+            benchmark_suite_destroy(suite);
+            variable_unref(root);
+            return NULL;
+        }
+    }
+    
+    variable_unref(root);
+    return suite;
+}
@@ -0,0 +1,47 @@
+#define _GNU_SOURCE  // For strdup - must be before includes
+
+/**
+ * @file benchmark_record.c
+ * @brief Benchmark result recording function
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Add a result computed from raw timings
+ *
+ * The times are sorted in place and kept as the result's samples so a
+ * later run can be tested against them.
+ *
+ * @param suite Benchmark suite
+ * @param test_name Test name
+ * @param times Per-iteration times; ownership passes to the suite, even on error
+ * @param count Number of times
+ * @return 0 on success, -1 on error
+ */
+int benchmark_record(benchmark_suite* suite, const char* test_name,
+                     uint64_t* times, uint32_t count) {
+    if (!suite || !test_name || !times || count == 0 ||
+        resize_results_if_needed(suite) != 0) {
+        xmd_free(times);
+        return -1;
+    }
+    
+    benchmark_result* result = &suite->results[suite->result_count];
+    memset(result, 0, sizeof(*result));
+    result->test_name = xmd_strdup(test_name);
+    if (!result->test_name) {
+        xmd_free(times);
+        return -1;
+    }
+    
+    calculate_stats(times, count, result);
+    result->samples = times;
+    suite->result_count++;
+    return 0;
+}
@@ -12,6 +12,7 @@
 #include <string.h>
 #include <stdint.h>
 #include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Run benchmark function
@@ -28,18 +29,16 @@ int benchmark_run(benchmark_suite* suite, const char* test_name,
         return -1;
     }
     
-    if (resize_results_if_needed(suite) != 0) {
-        return -1;
-    }
-    
     // Allocate timing array
-    uint64_t* times = malloc(iterations * sizeof(uint64_t));
+    uint64_t* times = xmd_malloc(iterations * sizeof(uint64_t));
     if (!times) {
         return -1;
     }
     
-    // Warm up run (not timed)
-    test_func(test_data);
+    // Warm up runs (not timed)
+    for (uint32_t i = 0; i < suite->warmup_iterations; i++) {
+        test_func(test_data);
+    }
     
     // Run benchmark iterations
     for (uint32_t i = 0; i < iterations; i++) {
@@ -51,26 +50,12 @@ int benchmark_run(benchmark_suite* suite, const char* test_name,
         
         if (result != 0) {
             // Test function failed
-            free(times);
+            xmd_free(times);
             return -1;
         }
         
         times[i] = end_time - start_time;
     }
     
-    // Create result entry
-    benchmark_result* result = &suite->results[suite->result_count];
-    result->test_name = strdup(test_name);
-    if (!result->test_name) {
-        free(times);
-        return -1;
-    }
-    
-    // Calculate statistics
-    calculate_stats(times, iterations, result);
-    
-    free(times);
-    suite->result_count++;
-    
-    return 0;
+    return benchmark_record(suite, test_name, times, iterations);
 }
\ No newline at end of file
@@ -0,0 +1,35 @@
+/**
+ * @file benchmark_run_throughput.c
+ * @brief Benchmark execution with data throughput reporting
+ * @author XMD Team
+ */
+
+#include <stdint.h>
+#include "../../../include/performance.h"
+
+/**
+ * @brief Run benchmark function and report data throughput
+ * @param suite Benchmark suite
+ * @param test_name Test name
+ * @param test_func Function to benchmark
+ * @param test_data Data to pass to function
+ * @param iterations Number of iterations
+ * @param bytes_per_iteration Bytes processed by each call
+ * @return 0 on success, -1 on error
+ */
+int benchmark_run_throughput(benchmark_suite* suite, const char* test_name,
+                             int (*test_func)(void*), void* test_data,
+                             uint32_t iterations, uint64_t bytes_per_iteration) {
+    if (benchmark_run(suite, test_name, test_func, test_data, iterations) != 0) {
+        return -1;
+    }
+
+    benchmark_result* result = &suite->results[suite->result_count - 1];
+    result->bytes_per_iteration = bytes_per_iteration;
+    // Median is robust against the occasional page-fault or scheduler outlier
+    if (result->median_time_ns > 0) {
+        result->throughput_mb_per_sec = ((double)bytes_per_iteration / (1024.0 * 1024.0)) /
+                                        ((double)result->median_time_ns / 1e9);
+    }
+    return 0;
+}
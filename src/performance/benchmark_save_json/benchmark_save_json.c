@@ -0,0 +1,40 @@
+/**
+ * @file benchmark_save_json.c
+ * @brief Benchmark results file writer
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Write machine-readable benchmark results to a file
+ * @param suite Benchmark suite
+ * @param path Output file path
+ * @return 0 on success, -1 on error
+ */
+int benchmark_save_json(benchmark_suite* suite, const char* path) {
+    if (!suite || !path) {
+        return -1;
+    }
+    
+    char* json = benchmark_generate_json(suite);
+    if (!json) {
+        return -1;
+    }
+    
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        xmd_free(json);
+        return -1;
+    }
+    
+    int status = fprintf(file, "%s\n", json) < 0 ? -1 : 0;
+    if (fclose(file) != 0) {
+        status = -1;
+    }
+    xmd_free(json);
+    return status;
+}
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Destroy benchmark suite
@@ -18,12 +19,13 @@ void benchmark_suite_destroy(benchmark_suite* suite) {
         return;
     }
     
-    // Free all result test names
+    // Free all result test names and samples
     for (size_t i = 0; i < suite->result_count; i++) {
-        free(suite->results[i].test_name);
+        xmd_free(suite->results[i].test_name);
+        xmd_free(suite->results[i].samples);
     }
     
-    free(suite->results);
-    free(suite->suite_name);
-    free(suite);
+    xmd_free(suite->results);
+    xmd_free(suite->suite_name);
+    xmd_free(suite);
 }
\ No newline at end of file
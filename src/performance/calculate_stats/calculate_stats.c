@@ -29,6 +29,10 @@ void calculate_stats(uint64_t* times, uint32_t count, benchmark_result* result)
     result->max_time_ns = times[count - 1];
     result->median_time_ns = times[count / 2];
     
+    // Nearest-rank percentiles
+    result->p90_time_ns = times[(count * 90 + 99) / 100 - 1];
+    result->p99_time_ns = times[(count * 99 + 99) / 100 - 1];
+    
     // Calculate average
     uint64_t total = 0;
     for (uint32_t i = 0; i < count; i++) {
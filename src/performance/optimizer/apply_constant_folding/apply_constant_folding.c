@@ -7,6 +7,8 @@
  */
 
 #include "../../../../include/optimizer_internal.h"
+#include "../../../../include/allocator.h"
+#include "../../../../include/utils.h"
 
 /**
  * @brief Apply constant folding optimization
@@ -56,14 +58,14 @@ uint32_t apply_constant_folding(token** tokens, size_t* token_count) {
                     }
                     
                     // Replace first token with result
-                    free(token_array[i].value);
-                    char result_str[64];
-                    snprintf(result_str, sizeof(result_str), "%.10g", result);
-                    token_array[i].value = strdup(result_str);
+                    xmd_free(token_array[i].value);
+                    char result_str[XMD_NUMBER_BUFFER_SIZE];
+                    xmd_format_number(result, result_str);
+                    token_array[i].value = xmd_strdup(result_str);
                     
                     // Remove the operator and second operand
-                    free(token_array[i + 1].value);
-                    free(token_array[i + 2].value);
+                    xmd_free(token_array[i + 1].value);
+                    xmd_free(token_array[i + 2].value);
                     
                     // Shift remaining tokens
                     memmove(&token_array[i + 1], &token_array[i + 3], 
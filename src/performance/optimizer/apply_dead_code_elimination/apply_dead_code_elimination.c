@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/optimizer_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Apply dead code elimination
@@ -46,7 +47,7 @@ uint32_t apply_dead_code_elimination(token** tokens, size_t* token_count) {
             }
             write_pos++;
         } else {
-            free(token_array[i].value);
+            xmd_free(token_array[i].value);
             optimizations++;
         }
     }
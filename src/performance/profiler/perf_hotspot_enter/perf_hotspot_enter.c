@@ -0,0 +1,91 @@
+/**
+ * @file perf_hotspot_enter.c
+ * @brief Open a frame for a directive
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Find or create the entry for a directive under a parent
+ * @param profiler Profiler instance
+ * @param parent Enclosing entry index, or SIZE_MAX
+ * @param location Directive position
+ * @param label Directive keyword
+ * @return Entry index, or SIZE_MAX on allocation failure
+ */
+static size_t find_entry(perf_profiler* profiler, size_t parent,
+                         const source_location* location, const char* label) {
+    const char* file = location->filename ? location->filename : "<input>";
+    
+    for (size_t i = 0; i < profiler->hotspot_count; i++) {
+        const perf_hotspot* entry = &profiler->hotspots[i];
+        if (entry->parent == parent &&
+            entry->location.line == location->line &&
+            entry->location.column == location->column &&
+            strcmp(entry->label, label) == 0 &&
+            strcmp(entry->location.filename, file) == 0) {
+            return i;
+        }
+    }
+    
+    if (profiler->hotspot_count == profiler->hotspot_capacity) {
+        size_t capacity = profiler->hotspot_capacity ? profiler->hotspot_capacity * 2 : 16;
+        perf_hotspot* grown = xmd_realloc(profiler->hotspots, capacity * sizeof(perf_hotspot));
+        if (!grown) {
+            return SIZE_MAX;
+        }
+        profiler->hotspots = grown;
+        profiler->hotspot_capacity = capacity;
+    }
+    
+    perf_hotspot* entry = &profiler->hotspots[profiler->hotspot_count];
+    memset(entry, 0, sizeof(*entry));
+    entry->parent = parent;
+    entry->location = *location;
+    entry->location.filename = xmd_strdup(file);
+    entry->label = xmd_strdup(label);
+    if (!entry->location.filename || !entry->label) {
+        xmd_free((char*)entry->location.filename);
+        xmd_free(entry->label);
+        return SIZE_MAX;
+    }
+    return profiler->hotspot_count++;
+}
+
+/**
+ * @brief Open a frame for a directive
+ * @param profiler Profiler instance
+ * @param location Absolute directive position
+ * @param label Directive keyword
+ * @return true if a frame was opened and must be closed
+ */
+bool perf_hotspot_enter(perf_profiler* profiler, const source_location* location, const char* label) {
+    if (!profiler || !profiler->is_active || !profiler->hotspots_enabled || !location || !label) {
+        return false;
+    }
+    if (profiler->hotspot_depth >= PERF_STAGE_MAX_DEPTH) {
+        return false;
+    }
+    
+    size_t parent = SIZE_MAX;
+    if (profiler->hotspot_depth > 0) {
+        parent = profiler->hotspot_stack[profiler->hotspot_depth - 1].entry;
+    }
+    
+    size_t index = find_entry(profiler, parent, location, label);
+    if (index == SIZE_MAX) {
+        return false;
+    }
+    profiler->hotspots[index].calls++;
+    
+    perf_hotspot_frame* frame = &profiler->hotspot_stack[profiler->hotspot_depth++];
+    frame->entry = index;
+    frame->child_ns = 0;
+    frame->start_allocations = profiler->metrics.allocations;
+    frame->child_allocations = 0;
+    frame->start_ns = get_time_ns();
+    return true;
+}
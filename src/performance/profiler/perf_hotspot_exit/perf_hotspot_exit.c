@@ -0,0 +1,36 @@
+/**
+ * @file perf_hotspot_exit.c
+ * @brief Close the innermost directive frame
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Close the innermost directive frame
+ * @param profiler Profiler instance
+ * @param output_bytes Bytes the directive wrote
+ */
+void perf_hotspot_exit(perf_profiler* profiler, size_t output_bytes) {
+    if (!profiler || profiler->hotspot_depth == 0) {
+        return;
+    }
+    
+    uint64_t now = get_time_ns();
+    perf_hotspot_frame* frame = &profiler->hotspot_stack[--profiler->hotspot_depth];
+    uint64_t elapsed = now - frame->start_ns;
+    uint64_t allocations = profiler->metrics.allocations - frame->start_allocations;
+    
+    perf_hotspot* entry = &profiler->hotspots[frame->entry];
+    entry->total_ns += elapsed;
+    entry->self_ns += elapsed - frame->child_ns;
+    entry->allocations += allocations - frame->child_allocations;
+    entry->output_bytes += output_bytes;
+    
+    // Nested time and allocations are not the parent's own
+    if (profiler->hotspot_depth > 0) {
+        perf_hotspot_frame* parent = &profiler->hotspot_stack[profiler->hotspot_depth - 1];
+        parent->child_ns += elapsed;
+        parent->child_allocations += allocations;
+    }
+}
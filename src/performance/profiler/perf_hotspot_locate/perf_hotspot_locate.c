@@ -0,0 +1,30 @@
+/**
+ * @file perf_hotspot_locate.c
+ * @brief Map a position in the current content to its absolute position
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Map a position in the current content to its absolute position
+ * @param profiler Profiler instance
+ * @param line Line within the current content (1-based)
+ * @param column Column within the current content (1-based)
+ * @param fallback_file File name to use at the top level (may be NULL)
+ * @return Absolute location (filename borrowed)
+ */
+source_location perf_hotspot_locate(const perf_profiler* profiler, size_t line, size_t column,
+                                    const char* fallback_file) {
+    source_location location = {line, column, fallback_file};
+    if (!profiler || profiler->hotspot_origin.line == 0) {
+        return location;
+    }
+    
+    // Only the first line of nested content is shifted horizontally
+    const source_location* origin = &profiler->hotspot_origin;
+    location.column = (line == 1) ? origin->column + column - 1 : column;
+    location.line = origin->line + line - 1;
+    location.filename = origin->filename ? origin->filename : fallback_file;
+    return location;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file perf_hotspot_report_table.c
+ * @brief Format directive hot spots as a sorted table
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Compare rows by inclusive time, slowest first
+ */
+static int compare_total(const void* a, const void* b) {
+    const perf_hotspot* left = a;
+    const perf_hotspot* right = b;
+    if (left->total_ns != right->total_ns) {
+        return left->total_ns < right->total_ns ? 1 : -1;
+    }
+    return (int)left->location.line - (int)right->location.line;
+}
+
+/**
+ * @brief Merge entries that share a location across call paths
+ * @param profiler Profiler instance
+ * @param count Output number of rows
+ * @return Rows with borrowed strings (must be freed) or NULL
+ */
+static perf_hotspot* merge_locations(const perf_profiler* profiler, size_t* count) {
+    perf_hotspot* rows = xmd_malloc((profiler->hotspot_count + 1) * sizeof(perf_hotspot));
+    if (!rows) {
+        return NULL;
+    }
+    
+    *count = 0;
+    for (size_t i = 0; i < profiler->hotspot_count; i++) {
+        const perf_hotspot* entry = &profiler->hotspots[i];
+        perf_hotspot* row = NULL;
+        for (size_t j = 0; j < *count; j++) {
+            if (rows[j].location.line == entry->location.line &&
+                rows[j].location.column == entry->location.column &&
+                strcmp(rows[j].label, entry->label) == 0 &&
+                strcmp(rows[j].location.filename, entry->location.filename) == 0) {
+                row = &rows[j];
+                break;
+            }
+        }
+        if (!row) {
+            row = &rows[(*count)++];
+            *row = *entry;
+            continue;
+        }
+        row->calls += entry->calls;
+        row->total_ns += entry->total_ns;
+        row->self_ns += entry->self_ns;
+        row->allocations += entry->allocations;
+        row->output_bytes += entry->output_bytes;
+    }
+    return rows;
+}
+
+/**
+ * @brief Format directives as a table sorted by inclusive time
+ * @param profiler Stopped profiler
+ * @return Table text (must be freed) or NULL on error
+ */
+char* perf_hotspot_report_table(const perf_profiler* profiler) {
+    if (!profiler) {
+        return NULL;
+    }
+    
+    size_t count = 0;
+    perf_hotspot* rows = merge_locations(profiler, &count);
+    if (!rows) {
+        return NULL;
+    }
+    qsort(rows, count, sizeof(perf_hotspot), compare_total);
+    
+    size_t capacity = 256;
+    for (size_t i = 0; i < count; i++) {
+        capacity += 112 + strlen(rows[i].location.filename) + strlen(rows[i].label);
+    }
+    char* table = xmd_malloc(capacity);
+    if (!table) {
+        xmd_free(rows);
+        return NULL;
+    }
+    
+    size_t len = snprintf(table, capacity, "%10s %10s %8s %10s %10s  %s\n",
+                          "total_ms", "self_ms", "calls", "allocs", "out_bytes", "directive");
+    for (size_t i = 0; i < count; i++) {
+        const perf_hotspot* row = &rows[i];
+        len += snprintf(table + len, capacity - len,
+                        "%10.3f %10.3f %8u %10llu %10llu  %s:%zu:%zu %s\n",
+                        row->total_ns / 1e6, row->self_ns / 1e6, row->calls,
+                        (unsigned long long)row->allocations,
+                        (unsigned long long)row->output_bytes,
+                        row->location.filename, row->location.line,
+                        row->location.column, row->label);
+    }
+    
+    xmd_free(rows);
+    return table;
+}
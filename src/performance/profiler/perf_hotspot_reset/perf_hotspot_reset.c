@@ -0,0 +1,29 @@
+/**
+ * @file perf_hotspot_reset.c
+ * @brief Drop all directive entries and open frames
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Drop all directive entries and open frames
+ * @param profiler Profiler instance
+ */
+void perf_hotspot_reset(perf_profiler* profiler) {
+    if (!profiler) {
+        return;
+    }
+    
+    for (size_t i = 0; i < profiler->hotspot_count; i++) {
+        xmd_free((char*)profiler->hotspots[i].location.filename);
+        xmd_free(profiler->hotspots[i].label);
+    }
+    xmd_free(profiler->hotspots);
+    profiler->hotspots = NULL;
+    profiler->hotspot_count = 0;
+    profiler->hotspot_capacity = 0;
+    profiler->hotspot_depth = 0;
+    memset(&profiler->hotspot_origin, 0, sizeof(profiler->hotspot_origin));
+}
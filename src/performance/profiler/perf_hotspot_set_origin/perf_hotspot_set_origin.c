@@ -0,0 +1,24 @@
+/**
+ * @file perf_hotspot_set_origin.c
+ * @brief Set where the content about to be rendered starts
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Set where the content about to be rendered starts
+ * @param profiler Profiler instance (may be NULL)
+ * @param origin New origin (a zero line means "top of the input")
+ * @return Previous origin, to be restored afterwards
+ */
+source_location perf_hotspot_set_origin(perf_profiler* profiler, source_location origin) {
+    source_location previous = {0, 0, NULL};
+    if (!profiler) {
+        return previous;
+    }
+    
+    previous = profiler->hotspot_origin;
+    profiler->hotspot_origin = origin;
+    return previous;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file perf_hotspot_write_folded.c
+ * @brief Write directive self times as collapsed stacks
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Write one frame name, keeping the separators unambiguous
+ * @param out Output stream
+ * @param entry Hotspot entry
+ */
+static void write_frame(FILE* out, const perf_hotspot* entry) {
+    for (const char* c = entry->location.filename; *c; c++) {
+        fputc(*c == ';' ? '_' : *c, out);
+    }
+    fprintf(out, ":%zu:%zu ", entry->location.line, entry->location.column);
+    for (const char* c = entry->label; *c; c++) {
+        fputc(*c == ';' ? '_' : *c, out);
+    }
+}
+
+/**
+ * @brief Write directive self times as collapsed stacks
+ * @param profiler Stopped profiler
+ * @param path Output file
+ * @return 0 on success, -1 on error
+ */
+int perf_hotspot_write_folded(const perf_profiler* profiler, const char* path) {
+    if (!profiler || !path) {
+        return -1;
+    }
+    
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        return -1;
+    }
+    
+    size_t chain[PERF_STAGE_MAX_DEPTH];
+    for (size_t i = 0; i < profiler->hotspot_count; i++) {
+        const perf_hotspot* entry = &profiler->hotspots[i];
+        if (entry->self_ns == 0) {
+            continue;
+        }
+        
+        // Collect the path innermost first, then print outermost first
+        size_t depth = 0;
+        for (size_t at = i; at != SIZE_MAX && depth < PERF_STAGE_MAX_DEPTH;
+             at = profiler->hotspots[at].parent) {
+            chain[depth++] = at;
+        }
+        while (depth > 0) {
+            write_frame(out, &profiler->hotspots[chain[--depth]]);
+            fputc(depth > 0 ? ';' : ' ', out);
+        }
+        fprintf(out, "%llu\n", (unsigned long long)entry->self_ns);
+    }
+    
+    return fclose(out) == 0 ? 0 : -1;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file perf_profiler_attach.c
+ * @brief Attach a profiler to the calling thread
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+XMD_THREAD_LOCAL perf_profiler* xmd_active_profiler = NULL;
+
+/**
+ * @brief Attach a profiler to the calling thread
+ * @param profiler Profiler to attach, or NULL to detach
+ * @return Previously attached profiler
+ */
+perf_profiler* perf_profiler_attach(perf_profiler* profiler) {
+    perf_profiler* previous = xmd_active_profiler;
+    xmd_active_profiler = profiler;
+    return previous;
+}
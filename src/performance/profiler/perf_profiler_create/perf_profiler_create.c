@@ -5,13 +5,14 @@
  */
 
 #include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Initialize performance profiler
  * @return Profiler instance or NULL on error
  */
 perf_profiler* perf_profiler_create(void) {
-    perf_profiler* profiler = calloc(1, sizeof(perf_profiler));
+    perf_profiler* profiler = xmd_calloc(1, sizeof(perf_profiler));
     if (!profiler) {
         return NULL;
     }
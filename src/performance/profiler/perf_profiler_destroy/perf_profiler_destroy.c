@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Destroy profiler instance
@@ -15,6 +16,7 @@ void perf_profiler_destroy(perf_profiler* profiler) {
         return;
     }
     
-    free(profiler->profile_data);
-    free(profiler);
+    perf_hotspot_reset(profiler);
+    xmd_free(profiler->profile_data);
+    xmd_free(profiler);
 }
\ No newline at end of file
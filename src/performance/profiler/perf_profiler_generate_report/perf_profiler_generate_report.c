@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Generate profiling report
@@ -17,7 +18,7 @@ char* perf_profiler_generate_report(perf_profiler* profiler) {
     }
     
     const size_t report_size = 2048;
-    char* report = malloc(report_size);
+    char* report = xmd_malloc(report_size);
     if (!report) {
         return NULL;
     }
@@ -17,6 +17,7 @@ void perf_profiler_record_alloc(perf_profiler* profiler, size_t size) {
     }
     
     profiler->metrics.allocations++;
+    profiler->metrics.bytes_allocated += size;
     profiler->metrics.memory_current_bytes += size;
     
     // Update peak memory
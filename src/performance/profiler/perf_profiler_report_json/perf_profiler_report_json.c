@@ -0,0 +1,65 @@
+/**
+ * @file perf_profiler_report_json.c
+ * @brief Generate a machine-readable profiling report
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+#include "../../../../include/output.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Generate a machine-readable profiling report
+ *
+ * Produces a single-line JSON object with total time, exclusive time and
+ * entry count per stage, allocation counts and cache statistics.
+ *
+ * @param profiler Stopped profiler
+ * @param source Name of the processed input (may be NULL)
+ * @return JSON object text (must be freed) or NULL on error
+ */
+char* perf_profiler_report_json(const perf_profiler* profiler, const char* source) {
+    if (!profiler) {
+        return NULL;
+    }
+    
+    char* escaped = NULL;
+    if (source && output_escape_json(source, &escaped) != OUTPUT_SUCCESS) {
+        return NULL;
+    }
+    
+    const perf_metrics* metrics = &profiler->metrics;
+    size_t capacity = 512 + PERF_STAGE_COUNT * 96 + (escaped ? strlen(escaped) : 0);
+    char* report = xmd_malloc(capacity);
+    if (!report) {
+        xmd_free(escaped);
+        return NULL;
+    }
+    
+    size_t len = 0;
+    if (escaped) {
+        len += snprintf(report + len, capacity - len, "{\"file\":\"%s\",", escaped);
+    } else {
+        len += snprintf(report + len, capacity - len, "{\"file\":null,");
+    }
+    xmd_free(escaped);
+    
+    len += snprintf(report + len, capacity - len, "\"total_ns\":%llu,\"stages\":{",
+                    (unsigned long long)metrics->execution_time_ns);
+    for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+        len += snprintf(report + len, capacity - len, "%s\"%s\":{\"ns\":%llu,\"calls\":%u}",
+                        i > 0 ? "," : "", perf_stage_name((perf_stage)i),
+                        (unsigned long long)metrics->stage_time_ns[i],
+                        metrics->stage_calls[i]);
+    }
+    
+    snprintf(report + len, capacity - len,
+             "},\"allocations\":%u,\"deallocations\":%u,\"bytes_allocated\":%llu,"
+             "\"peak_memory_bytes\":%llu,\"cache\":{\"hits\":%u,\"misses\":%u}}",
+             metrics->allocations, metrics->deallocations,
+             (unsigned long long)metrics->bytes_allocated,
+             (unsigned long long)metrics->memory_peak_bytes,
+             metrics->cache_hits, metrics->cache_misses);
+    
+    return report;
+}
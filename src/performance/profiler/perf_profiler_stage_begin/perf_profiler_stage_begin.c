@@ -0,0 +1,33 @@
+/**
+ * @file perf_profiler_stage_begin.c
+ * @brief Enter a pipeline stage
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Enter a pipeline stage
+ * @param profiler Profiler instance
+ * @param stage Stage being entered
+ */
+void perf_profiler_stage_begin(perf_profiler* profiler, perf_stage stage) {
+    if (!profiler || !profiler->is_active || stage >= PERF_STAGE_COUNT) {
+        return;
+    }
+    
+    uint64_t now = get_time_ns();
+    
+    // Pause the enclosing stage so time is charged exclusively
+    if (profiler->stage_depth > 0) {
+        perf_stage outer = profiler->stage_stack[profiler->stage_depth - 1];
+        profiler->metrics.stage_time_ns[outer] += now - profiler->stage_mark_ns;
+    }
+    
+    profiler->metrics.stage_calls[stage]++;
+    if (profiler->stage_depth < PERF_STAGE_MAX_DEPTH) {
+        profiler->stage_stack[profiler->stage_depth] = stage;
+    }
+    profiler->stage_depth++;
+    profiler->stage_mark_ns = now;
+}
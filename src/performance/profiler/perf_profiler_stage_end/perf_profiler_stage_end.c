@@ -0,0 +1,28 @@
+/**
+ * @file perf_profiler_stage_end.c
+ * @brief Leave the innermost pipeline stage
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Leave the innermost pipeline stage
+ * @param profiler Profiler instance
+ * @param stage Stage being left
+ */
+void perf_profiler_stage_end(perf_profiler* profiler, perf_stage stage) {
+    if (!profiler || profiler->stage_depth == 0 || stage >= PERF_STAGE_COUNT) {
+        return;
+    }
+    
+    uint64_t now = get_time_ns();
+    profiler->stage_depth--;
+    
+    // Frames past the tracking limit are counted but charged to their parent
+    if (profiler->stage_depth < PERF_STAGE_MAX_DEPTH) {
+        perf_stage current = profiler->stage_stack[profiler->stage_depth];
+        profiler->metrics.stage_time_ns[current] += now - profiler->stage_mark_ns;
+        profiler->stage_mark_ns = now;
+    }
+}
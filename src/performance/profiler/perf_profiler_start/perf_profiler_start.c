@@ -27,7 +27,9 @@ int perf_profiler_start(perf_profiler* profiler) {
     
     // Reset metrics for new session
     memset(&profiler->metrics, 0, sizeof(perf_metrics));
-    profiler->metrics.memory_current_bytes = get_memory_usage();
+    profiler->start_ns = get_time_ns();
+    profiler->stage_depth = 0;
+    perf_hotspot_reset(profiler);
     profiler->is_active = true;
     
     return 0;
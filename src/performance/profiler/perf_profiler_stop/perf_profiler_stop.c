@@ -21,16 +21,25 @@ int perf_profiler_stop(perf_profiler* profiler) {
         return -1;
     }
     
-    // Calculate execution time
-    profiler->metrics.execution_time_ns = time_diff_ns(&profiler->start_time, &profiler->end_time);
+    // Charge and close any directive frame or stage still open
+    while (profiler->hotspot_depth > 0) {
+        perf_hotspot_exit(profiler, 0);
+    }
+    while (profiler->stage_depth > 0) {
+        perf_profiler_stage_end(profiler, profiler->stage_stack[profiler->stage_depth - 1]);
+    }
     
-    // Update current memory usage
-    uint64_t current_memory = get_memory_usage();
-    profiler->metrics.memory_current_bytes = current_memory;
+    // Calculate execution time from the monotonic clock
+    profiler->metrics.execution_time_ns = get_time_ns() - profiler->start_ns;
     
-    // Update peak memory if current is higher
-    if (current_memory > profiler->metrics.memory_peak_bytes) {
-        profiler->metrics.memory_peak_bytes = current_memory;
+    // Peak is the live heap of the session when an allocator fed it;
+    // otherwise fall back to the process footprint
+    if (profiler->metrics.allocations == 0) {
+        uint64_t current_memory = get_memory_usage();
+        profiler->metrics.memory_current_bytes = current_memory;
+        if (current_memory > profiler->metrics.memory_peak_bytes) {
+            profiler->metrics.memory_peak_bytes = current_memory;
+        }
     }
     
     profiler->is_active = false;
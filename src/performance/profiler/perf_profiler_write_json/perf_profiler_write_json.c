@@ -0,0 +1,35 @@
+/**
+ * @file perf_profiler_write_json.c
+ * @brief Write a machine-readable profiling report
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Append the JSON report as one line to a file or stderr
+ * @param profiler Stopped profiler
+ * @param source Name of the processed input (may be NULL)
+ * @param path File to append to, or NULL for stderr
+ * @return 0 on success, -1 on error
+ */
+int perf_profiler_write_json(const perf_profiler* profiler, const char* source, const char* path) {
+    char* report = perf_profiler_report_json(profiler, source);
+    if (!report) {
+        return -1;
+    }
+    
+    FILE* out = path ? fopen(path, "a") : stderr;
+    if (!out) {
+        xmd_free(report);
+        return -1;
+    }
+    
+    int written = fprintf(out, "%s\n", report);
+    if (out != stderr) {
+        fclose(out);
+    }
+    xmd_free(report);
+    return written < 0 ? -1 : 0;
+}
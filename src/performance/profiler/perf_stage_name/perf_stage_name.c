@@ -0,0 +1,24 @@
+/**
+ * @file perf_stage_name.c
+ * @brief Name of a pipeline stage
+ * @author XMD Team
+ */
+
+#include "../../../../include/profiler_internal.h"
+
+/**
+ * @brief Name of a pipeline stage as used in reports
+ * @param stage Stage
+ * @return Static lowercase name
+ */
+const char* perf_stage_name(perf_stage stage) {
+    static const char* const names[PERF_STAGE_COUNT] = {
+        "preprocess", "scan", "lex", "parse",
+        "evaluate", "import", "exec", "format"
+    };
+    
+    if (stage >= PERF_STAGE_COUNT) {
+        return "unknown";
+    }
+    return names[stage];
+}
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Resize results array if needed
@@ -22,7 +23,7 @@ int resize_results_if_needed(benchmark_suite* suite) {
     
     if (suite->result_count >= suite->result_capacity) {
         size_t new_capacity = suite->result_capacity * 2;
-        benchmark_result* new_results = realloc(suite->results, 
+        benchmark_result* new_results = xmd_realloc(suite->results, 
                                                new_capacity * sizeof(benchmark_result));
         if (!new_results) {
             return -1;
@@ -0,0 +1,31 @@
+/**
+ * @file xmd_fsync_directory.c
+ * @brief Flush a directory's entries to storage
+ * @author XMD Team
+ */
+
+#include <fcntl.h>
+#include "../../../include/platform_internal.h"
+
+/**
+ * @brief Flush a directory's entries to storage
+ *
+ * Makes files created or renamed in the directory survive a crash.
+ * Windows journals directory updates itself, so this is a no-op there.
+ *
+ * @param path Directory path
+ * @return 0 on success, -1 on error
+ */
+int xmd_fsync_directory(const char* path) {
+    if (!path) return -1;
+    
+#ifdef XMD_PLATFORM_WINDOWS
+    return 0;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    int result = fsync(fd) == 0 ? 0 : -1;
+    close(fd);
+    return result;
+#endif
+}
@@ -0,0 +1,26 @@
+/**
+ * @file xmd_fsync_file.c
+ * @brief Flush a file's data to storage
+ * @author XMD Team
+ */
+
+#include "../../../include/platform_internal.h"
+
+#ifdef XMD_PLATFORM_WINDOWS
+#include <io.h>
+#endif
+
+/**
+ * @brief Flush a file's buffered and cached data to storage
+ * @param file Open file
+ * @return 0 on success, -1 on error
+ */
+int xmd_fsync_file(FILE* file) {
+    if (!file || fflush(file) != 0) return -1;
+    
+#ifdef XMD_PLATFORM_WINDOWS
+    return _commit(_fileno(file)) == 0 ? 0 : -1;
+#else
+    return fsync(fileno(file)) == 0 ? 0 : -1;
+#endif
+}
@@ -0,0 +1,32 @@
+/**
+ * @file xmd_malloc_size.c
+ * @brief Usable size of a heap block
+ * @author XMD Team
+ */
+
+#include "../../../include/platform_internal.h"
+
+#if defined(XMD_PLATFORM_APPLE)
+    #include <malloc/malloc.h>
+#elif defined(XMD_PLATFORM_WINDOWS) || defined(__GLIBC__) || defined(XMD_PLATFORM_ANDROID)
+    #include <malloc.h>
+#endif
+
+/**
+ * @brief Usable size of a block returned by malloc
+ * @param ptr Block from malloc/calloc/realloc
+ * @return Usable size in bytes, or 0 if unknown on this platform
+ */
+size_t xmd_malloc_size(void* ptr) {
+    if (!ptr) return 0;
+    
+#if defined(XMD_PLATFORM_APPLE)
+    return malloc_size(ptr);
+#elif defined(XMD_PLATFORM_WINDOWS)
+    return _msize(ptr);
+#elif defined(__GLIBC__) || defined(XMD_PLATFORM_ANDROID)
+    return malloc_usable_size(ptr);
+#else
+    return 0;
+#endif
+}
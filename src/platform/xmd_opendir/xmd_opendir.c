@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/platform_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Open directory for reading
@@ -17,7 +18,7 @@ xmd_dir_t xmd_opendir(const char* path) {
 #ifdef XMD_PLATFORM_WINDOWS
     char search_path[MAX_PATH];
     snprintf(search_path, sizeof(search_path), "%s\\*", path);
-    return _findfirst(search_path, (struct _finddata_t*)malloc(sizeof(struct _finddata_t)));
+    return _findfirst(search_path, (struct _finddata_t*)xmd_malloc(sizeof(struct _finddata_t)));
 #else
     return opendir(path);
 #endif
@@ -0,0 +1,27 @@
+/**
+ * @file xmd_replace_file.c
+ * @brief Move a file over another one
+ * @author XMD Team
+ */
+
+#include "../../../include/platform_internal.h"
+
+/**
+ * @brief Rename a file, replacing the destination if it exists
+ *
+ * rename() already does this atomically on POSIX systems; on Windows it
+ * fails when the destination exists, so MoveFileEx is asked to replace it.
+ *
+ * @param from File to move
+ * @param to Destination path
+ * @return 0 on success, -1 on error
+ */
+int xmd_replace_file(const char* from, const char* to) {
+    if (!from || !to) return -1;
+    
+#ifdef XMD_PLATFORM_WINDOWS
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : -1;
+#else
+    return rename(from, to) == 0 ? 0 : -1;
+#endif
+}
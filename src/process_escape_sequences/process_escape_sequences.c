@@ -7,6 +7,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "../../include/allocator.h"
 
 /**
  * @brief Process escape sequences in a string literal
@@ -19,7 +20,7 @@ char* process_escape_sequences(const char* input) {
     }
     
     size_t input_len = strlen(input);
-    char* output = malloc(input_len + 1); // Max possible length
+    char* output = xmd_malloc(input_len + 1); // Max possible length
     if (!output) {
         return NULL;
     }
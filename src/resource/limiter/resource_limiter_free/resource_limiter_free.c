@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/limiter_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free a resource limiter
@@ -15,6 +16,6 @@ void resource_limiter_free(ResourceLimiter* limiter) {
         return;
     }
     
-    free(limiter->last_error);
-    free(limiter);
+    xmd_free(limiter->last_error);
+    xmd_free(limiter);
 }
\ No newline at end of file
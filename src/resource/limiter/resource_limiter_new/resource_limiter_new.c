@@ -5,13 +5,14 @@
  */
 
 #include "../../../../include/limiter_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Create a new resource limiter
  * @return New resource limiter or NULL on error
  */
 ResourceLimiter* resource_limiter_new(void) {
-    ResourceLimiter* limiter = malloc(sizeof(ResourceLimiter));
+    ResourceLimiter* limiter = xmd_malloc(sizeof(ResourceLimiter));
     if (!limiter) {
         return NULL;
     }
@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/limiter_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Set error message in limiter
@@ -22,6 +23,6 @@ void set_limiter_error(ResourceLimiter* limiter, const char* message) {
         return;
     }
     
-    free(limiter->last_error);
-    limiter->last_error = strdup(message);
+    xmd_free(limiter->last_error);
+    limiter->last_error = xmd_strdup(message);
 }
\ No newline at end of file
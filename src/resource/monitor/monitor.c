@@ -9,13 +9,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/resource.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new resource monitor
  * @return New resource monitor or NULL on error
  */
 ResourceMonitor* resource_monitor_new(void) {
-    ResourceMonitor* monitor = malloc(sizeof(ResourceMonitor));
+    ResourceMonitor* monitor = xmd_malloc(sizeof(ResourceMonitor));
     if (!monitor) {
         return NULL;
     }
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/resource.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a resource monitor
@@ -18,6 +19,6 @@ void resource_monitor_free(ResourceMonitor* monitor) {
         return;
     }
     
-    free(monitor->last_error);
-    free(monitor);
+    xmd_free(monitor->last_error);
+    xmd_free(monitor);
 }
\ No newline at end of file
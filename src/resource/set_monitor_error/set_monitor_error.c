@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../include/resource.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set error message in monitor
@@ -22,6 +23,6 @@ void set_monitor_error(ResourceMonitor* monitor, const char* message) {
         return;
     }
     
-    free(monitor->last_error);
-    monitor->last_error = strdup(message);
+    xmd_free(monitor->last_error);
+    monitor->last_error = xmd_strdup(message);
 }
\ No newline at end of file
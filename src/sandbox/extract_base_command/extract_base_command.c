@@ -7,6 +7,7 @@
 #include "../../../include/sandbox.h"
 #include <stdlib.h>
 #include <string.h>
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract base command from command string
@@ -31,7 +32,7 @@ char* extract_base_command(const char* command) {
     
     // Extract base command
     size_t len = end - command;
-    char* result = malloc(len + 1);
+    char* result = xmd_malloc(len + 1);
     if (!result) return NULL;
     
     strncpy(result, command, len);
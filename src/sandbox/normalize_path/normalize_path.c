@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "../../../include/sandbox.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Normalize path (remove .. and . components)
@@ -17,7 +18,7 @@
  * @return Normalized path (caller must free) or NULL on error
  */
 char* normalize_path(const char* path) {
-    if (!path || !*path) return strdup("");
+    if (!path || !*path) return xmd_strdup("");
     
     #ifdef DEBUG_NORMALIZE
     fprintf(stderr, "[DEBUG] normalize_path called with: '%s'\n", path);
@@ -25,7 +26,7 @@ char* normalize_path(const char* path) {
     
     // Allocate enough space for the normalized path (worst case is same as input)
     size_t path_len = strlen(path);
-    char* normalized = malloc(path_len + 2);  // +2 for potential '/' and null terminator
+    char* normalized = xmd_malloc(path_len + 2);  // +2 for potential '/' and null terminator
     if (!normalized) return NULL;
     
     #ifdef DEBUG_NORMALIZE
@@ -36,9 +37,9 @@ char* normalize_path(const char* path) {
     int component_count = 0;
     
     // Copy path for tokenization
-    char* path_copy = strdup(path);
+    char* path_copy = xmd_strdup(path);
     if (!path_copy) {
-        free(normalized);
+        xmd_free(normalized);
         return NULL;
     }
     
@@ -58,15 +59,15 @@ char* normalize_path(const char* path) {
             // Go up one directory if possible
             if (component_count > 0 && strcmp(components[component_count - 1], "..") != 0) {
                 // Free the component we're removing
-                free(components[component_count - 1]);
+                xmd_free(components[component_count - 1]);
                 component_count--;
             } else if (!is_absolute) {
                 // Keep .. for relative paths that can't be resolved further
-                components[component_count++] = strdup(token);
+                components[component_count++] = xmd_strdup(token);
             }
         } else {
             // Normal component
-            components[component_count++] = strdup(token);
+            components[component_count++] = xmd_strdup(token);
         }
         token = strtok(NULL, "/");
     }
@@ -86,7 +87,7 @@ char* normalize_path(const char* path) {
             strcpy(normalized + pos, components[i]);
             pos += comp_len;
         }
-        free(components[i]);
+        xmd_free(components[i]);
     }
     normalized[pos] = '\0';
     
@@ -95,6 +96,6 @@ char* normalize_path(const char* path) {
         strcpy(normalized, ".");
     }
     
-    free(path_copy);
+    xmd_free(path_copy);
     return normalized;
 }
\ No newline at end of file
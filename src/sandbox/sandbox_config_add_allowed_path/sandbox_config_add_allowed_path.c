@@ -6,6 +6,7 @@
 
 #define _GNU_SOURCE
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add path to allowed paths
@@ -17,14 +18,14 @@ int sandbox_config_add_allowed_path(SandboxConfig* config, const char* path) {
     if (!config || !path || strlen(path) == 0) return SANDBOX_ERROR;
     
     // Reallocate allowed paths array
-    char** new_paths = realloc(config->allowed_paths, 
+    char** new_paths = xmd_realloc(config->allowed_paths, 
                                (config->allowed_path_count + 1) * sizeof(char*));
     if (!new_paths) return SANDBOX_ERROR;
     
     config->allowed_paths = new_paths;
     
     // Use strdup and check for failure
-    char* path_copy = strdup(path);
+    char* path_copy = xmd_strdup(path);
     if (!path_copy) {
         return SANDBOX_ERROR;
     }
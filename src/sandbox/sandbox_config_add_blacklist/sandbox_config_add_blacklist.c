@@ -6,6 +6,7 @@
 
 #define _GNU_SOURCE
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add command to blacklist
@@ -17,14 +18,14 @@ int sandbox_config_add_blacklist(SandboxConfig* config, const char* command) {
     if (!config || !command || strlen(command) == 0) return SANDBOX_ERROR;
     
     // Reallocate blacklist array
-    char** new_blacklist = realloc(config->command_blacklist, 
+    char** new_blacklist = xmd_realloc(config->command_blacklist, 
                                    (config->blacklist_count + 1) * sizeof(char*));
     if (!new_blacklist) return SANDBOX_ERROR;
     
     config->command_blacklist = new_blacklist;
     
     // Use strdup and check for failure
-    char* cmd_copy = strdup(command);
+    char* cmd_copy = xmd_strdup(command);
     if (!cmd_copy) {
         return SANDBOX_ERROR;
     }
@@ -6,6 +6,7 @@
 
 #define _GNU_SOURCE
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Add command to whitelist
@@ -17,14 +18,14 @@ int sandbox_config_add_whitelist(SandboxConfig* config, const char* command) {
     if (!config || !command || strlen(command) == 0) return SANDBOX_ERROR;
     
     // Reallocate whitelist array
-    char** new_whitelist = realloc(config->command_whitelist, 
+    char** new_whitelist = xmd_realloc(config->command_whitelist, 
                                    (config->whitelist_count + 1) * sizeof(char*));
     if (!new_whitelist) return SANDBOX_ERROR;
     
     config->command_whitelist = new_whitelist;
     
     // Use strdup and check for failure
-    char* cmd_copy = strdup(command);
+    char* cmd_copy = xmd_strdup(command);
     if (!cmd_copy) {
         return SANDBOX_ERROR;
     }
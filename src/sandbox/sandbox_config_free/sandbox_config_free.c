@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a sandbox configuration
@@ -15,27 +16,27 @@ void sandbox_config_free(SandboxConfig* config) {
     
     // Free whitelisted commands
     for (size_t i = 0; i < config->whitelist_count; i++) {
-        free(config->command_whitelist[i]);
+        xmd_free(config->command_whitelist[i]);
     }
-    free(config->command_whitelist);
+    xmd_free(config->command_whitelist);
     
     // Free blacklisted commands  
     for (size_t i = 0; i < config->blacklist_count; i++) {
-        free(config->command_blacklist[i]);
+        xmd_free(config->command_blacklist[i]);
     }
-    free(config->command_blacklist);
+    xmd_free(config->command_blacklist);
     
     // Free allowed paths
     for (size_t i = 0; i < config->allowed_path_count; i++) {
-        free(config->allowed_paths[i]);
+        xmd_free(config->allowed_paths[i]);
     }
-    free(config->allowed_paths);
+    xmd_free(config->allowed_paths);
     
     // Free blocked paths
     for (size_t i = 0; i < config->blocked_path_count; i++) {
-        free(config->blocked_paths[i]);
+        xmd_free(config->blocked_paths[i]);
     }
-    free(config->blocked_paths);
+    xmd_free(config->blocked_paths);
     
-    free(config);
+    xmd_free(config);
 }
\ No newline at end of file
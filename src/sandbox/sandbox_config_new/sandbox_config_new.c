@@ -5,13 +5,14 @@
  */
 
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new sandbox configuration
  * @return New sandbox configuration or NULL on error
  */
 SandboxConfig* sandbox_config_new(void) {
-    SandboxConfig* config = malloc(sizeof(SandboxConfig));
+    SandboxConfig* config = xmd_malloc(sizeof(SandboxConfig));
     if (!config) return NULL;
     
     memset(config, 0, sizeof(SandboxConfig));
@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a sandbox context
@@ -16,8 +17,8 @@ void sandbox_context_free(SandboxContext* ctx) {
             sandbox_config_free(ctx->config);
         }
         if (ctx->last_error) {
-            free(ctx->last_error);
+            xmd_free(ctx->last_error);
         }
-        free(ctx);
+        xmd_free(ctx);
     }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/sandbox_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new sandbox context
@@ -14,7 +15,7 @@
 SandboxContext* sandbox_context_new(SandboxConfig* config) {
     if (!config) return NULL;
     
-    SandboxContext* ctx = malloc(sizeof(SandboxContext));
+    SandboxContext* ctx = xmd_malloc(sizeof(SandboxContext));
     if (!ctx) return NULL;
     
     ctx->config = config;
@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/auditor_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Expand audit entries array
@@ -12,7 +13,7 @@
  */
 int expand_entries_array(void) {
     size_t new_capacity = audit_state.entry_capacity == 0 ? 16 : audit_state.entry_capacity * 2;
-    security_audit_entry* new_entries = realloc(audit_state.entries, 
+    security_audit_entry* new_entries = xmd_realloc(audit_state.entries, 
                                                new_capacity * sizeof(security_audit_entry));
     if (!new_entries) {
         return -1;
@@ -5,6 +5,7 @@
  */
 
 #include "../../../../include/auditor_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Cleanup security audit system
@@ -18,18 +19,18 @@ void security_audit_cleanup(void) {
     
     // Free all entries
     for (size_t i = 0; i < audit_state.entry_count; i++) {
-        free(audit_state.entries[i].message);
-        free(audit_state.entries[i].source_file);
-        free(audit_state.entries[i].source_function);
+        xmd_free(audit_state.entries[i].message);
+        xmd_free(audit_state.entries[i].source_file);
+        xmd_free(audit_state.entries[i].source_function);
     }
-    free(audit_state.entries);
+    xmd_free(audit_state.entries);
     
     // Close log file
     if (audit_state.log_file) {
         fclose(audit_state.log_file);
     }
     
-    free(audit_state.log_path);
+    xmd_free(audit_state.log_path);
     
     // Reset state
     memset(&audit_state, 0, sizeof(audit_state));
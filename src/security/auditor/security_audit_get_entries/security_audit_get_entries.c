@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/auditor_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Get audit entries within time range
@@ -44,7 +45,7 @@ int security_audit_get_entries(uint64_t start_time, uint64_t end_time,
     }
     
     // Allocate result array
-    security_audit_entry* result = malloc(matching_count * sizeof(security_audit_entry));
+    security_audit_entry* result = xmd_malloc(matching_count * sizeof(security_audit_entry));
     if (!result) {
         pthread_mutex_unlock(&audit_state.mutex);
         return -1;
@@ -60,13 +61,13 @@ int security_audit_get_entries(uint64_t start_time, uint64_t end_time,
             
             // Duplicate strings
             if (audit_state.entries[i].message) {
-                result[result_index].message = strdup(audit_state.entries[i].message);
+                result[result_index].message = xmd_strdup(audit_state.entries[i].message);
             }
             if (audit_state.entries[i].source_file) {
-                result[result_index].source_file = strdup(audit_state.entries[i].source_file);
+                result[result_index].source_file = xmd_strdup(audit_state.entries[i].source_file);
             }
             if (audit_state.entries[i].source_function) {
-                result[result_index].source_function = strdup(audit_state.entries[i].source_function);
+                result[result_index].source_function = xmd_strdup(audit_state.entries[i].source_function);
             }
             
             result_index++;
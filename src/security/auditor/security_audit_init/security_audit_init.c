@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../../../../include/auditor_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Initialize security audit system
@@ -35,7 +36,7 @@ int security_audit_init(const char* log_file) {
         return -1;
     }
     
-    audit_state.log_path = strdup(log_file);
+    audit_state.log_path = xmd_strdup(log_file);
     if (!audit_state.log_path) {
         fclose(audit_state.log_file);
         pthread_mutex_destroy(&audit_state.mutex);
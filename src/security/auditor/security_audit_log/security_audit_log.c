@@ -7,6 +7,7 @@
  */
 
 #include "../../../../include/auditor_internal.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Log security audit event
@@ -46,13 +47,13 @@ int security_audit_log(audit_event_type type, const char* message,
     
     // Copy strings
     if (message) {
-        entry->message = strdup(message);
+        entry->message = xmd_strdup(message);
     }
     if (source_file) {
-        entry->source_file = strdup(source_file);
+        entry->source_file = xmd_strdup(source_file);
     }
     if (source_function) {
-        entry->source_function = strdup(source_function);
+        entry->source_function = xmd_strdup(source_function);
     }
     
     // Write to file
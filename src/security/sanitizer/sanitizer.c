@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../include/security.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Sanitize output string for safe rendering
@@ -23,7 +24,7 @@ char* security_sanitize_output(const char* input) {
     
     size_t input_len = strlen(input);
     size_t output_size = input_len * 6 + 1; // Worst case for HTML encoding
-    char* output = malloc(output_size);
+    char* output = xmd_malloc(output_size);
     if (!output) {
         return NULL;
     }
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Check if line contains potentially dangerous content
@@ -148,7 +149,7 @@ static char* limit_output_length(const char* input, size_t max_length) {
     size_t input_len = strlen(input);
     
     if (input_len <= max_length) {
-        return strdup(input);
+        return xmd_strdup(input);
     }
     
     // Truncate and add message
@@ -156,7 +157,7 @@ static char* limit_output_length(const char* input, size_t max_length) {
     size_t msg_len = strlen(truncation_msg);
     size_t truncate_at = max_length - msg_len;
     
-    char* result = malloc(max_length + 1);
+    char* result = xmd_malloc(max_length + 1);
     if (!result) return NULL;
     
     memcpy(result, input, truncate_at);
@@ -177,11 +178,11 @@ char* security_sanitize_command_output(const char* output) {
     
     size_t input_len = strlen(output);
     if (input_len == 0) {
-        return strdup("");
+        return xmd_strdup("");
     }
     
     // Allocate buffer for intermediate processing
-    char* temp_buffer = malloc(input_len * 3 + 1); // Extra space for escaping
+    char* temp_buffer = xmd_malloc(input_len * 3 + 1); // Extra space for escaping
     if (!temp_buffer) {
         return NULL;
     }
@@ -212,23 +213,23 @@ char* security_sanitize_command_output(const char* output) {
     }
     
     if (has_unsafe_content) {
-        free(temp_buffer);
-        return strdup("[Command output contained potentially unsafe content and was filtered]");
+        xmd_free(temp_buffer);
+        return xmd_strdup("[Command output contained potentially unsafe content and was filtered]");
     }
     
     // Escape markdown characters
-    char* escaped_buffer = malloc(input_len * 4 + 1); // More space for escaping
+    char* escaped_buffer = xmd_malloc(input_len * 4 + 1); // More space for escaping
     if (!escaped_buffer) {
-        free(temp_buffer);
+        xmd_free(temp_buffer);
         return NULL;
     }
     
     escape_markdown_chars(temp_buffer, escaped_buffer, input_len * 4);
-    free(temp_buffer);
+    xmd_free(temp_buffer);
     
     // Limit output length (e.g., 10KB max)
     char* result = limit_output_length(escaped_buffer, 10240);
-    free(escaped_buffer);
+    xmd_free(escaped_buffer);
     
     return result;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Check if tag is in whitelist of safe HTML tags
@@ -162,7 +163,7 @@ char* security_sanitize_html(const char* html) {
     }
     
     size_t input_len = strlen(html);
-    char* result = malloc(input_len * 2 + 1); // Extra space for entity encoding
+    char* result = xmd_malloc(input_len * 2 + 1); // Extra space for entity encoding
     if (!result) {
         return NULL;
     }
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Calculate required buffer size for escaped output
@@ -112,7 +113,7 @@ static char* remove_script_content(const char* input) {
     if (!input) return NULL;
     
     size_t len = strlen(input);
-    char* result = malloc(len + 1);
+    char* result = xmd_malloc(len + 1);
     if (!result) return NULL;
     
     const char* src = input;
@@ -180,15 +181,15 @@ char* security_sanitize_output(const char* input) {
     
     // Calculate buffer size needed for HTML escaping
     size_t escaped_size = calculate_escaped_size(cleaned);
-    char* result = malloc(escaped_size);
+    char* result = xmd_malloc(escaped_size);
     if (!result) {
-        free(cleaned);
+        xmd_free(cleaned);
         return NULL;
     }
     
     // Escape HTML entities
     escape_html_entities(cleaned, result, escaped_size);
     
-    free(cleaned);
+    xmd_free(cleaned);
     return result;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Check if command contains dangerous patterns
@@ -51,7 +52,7 @@ static bool is_dangerous_command(const char* command) {
         NULL
     };
     
-    char* lower_command = malloc(strlen(command) + 1);
+    char* lower_command = xmd_malloc(strlen(command) + 1);
     if (!lower_command) return false;
     
     for (size_t i = 0; command[i]; i++) {
@@ -67,7 +68,7 @@ static bool is_dangerous_command(const char* command) {
         }
     }
     
-    free(lower_command);
+    xmd_free(lower_command);
     return found;
 }
 
@@ -180,12 +181,12 @@ static bool is_safe_command(const char* command) {
     };
     
     // Extract just the command name (first word)
-    char* command_copy = strdup(command);
+    char* command_copy = xmd_strdup(command);
     if (!command_copy) return false;
     
     char* first_word = strtok(command_copy, " \t\n");
     if (!first_word) {
-        free(command_copy);
+        xmd_free(command_copy);
         return false;
     }
     
@@ -197,7 +198,7 @@ static bool is_safe_command(const char* command) {
         }
     }
     
-    free(command_copy);
+    xmd_free(command_copy);
     return is_safe;
 }
 
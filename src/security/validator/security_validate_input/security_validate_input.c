@@ -10,6 +10,7 @@
 #include <string.h>
 #include <ctype.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Check if string contains SQL injection patterns
@@ -33,7 +34,7 @@ static bool contains_sql_injection(const char* input) {
         NULL
     };
     
-    char* lower_input = malloc(strlen(input) + 1);
+    char* lower_input = xmd_malloc(strlen(input) + 1);
     if (!lower_input) return false;
     
     // Convert to lowercase for case-insensitive matching
@@ -50,7 +51,7 @@ static bool contains_sql_injection(const char* input) {
         }
     }
     
-    free(lower_input);
+    xmd_free(lower_input);
     return found;
 }
 
@@ -75,7 +76,7 @@ static bool contains_xss_injection(const char* input) {
         NULL
     };
     
-    char* lower_input = malloc(strlen(input) + 1);
+    char* lower_input = xmd_malloc(strlen(input) + 1);
     if (!lower_input) return false;
     
     for (size_t i = 0; input[i]; i++) {
@@ -91,7 +92,7 @@ static bool contains_xss_injection(const char* input) {
         }
     }
     
-    free(lower_input);
+    xmd_free(lower_input);
     return found;
 }
 
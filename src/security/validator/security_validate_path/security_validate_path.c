@@ -12,6 +12,7 @@
 #include <unistd.h>
 #include <limits.h>
 #include "../../../../include/security.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Normalize path by resolving . and .. components
@@ -21,16 +22,16 @@
 static char* normalize_path(const char* path) {
     if (!path) return NULL;
     
-    char* normalized = malloc(PATH_MAX);
+    char* normalized = xmd_malloc(PATH_MAX);
     if (!normalized) return NULL;
     
     // Use realpath to get canonical path
     if (realpath(path, normalized) == NULL) {
         // If realpath fails, manually normalize
-        free(normalized);
+        xmd_free(normalized);
         
         // Simple normalization for non-existent paths
-        normalized = malloc(strlen(path) + 1);
+        normalized = xmd_malloc(strlen(path) + 1);
         if (!normalized) return NULL;
         
         strcpy(normalized, path);
@@ -95,7 +96,7 @@ static bool is_within_base(const char* normalized_path, const char* normalized_b
     size_t base_len = strlen(normalized_base);
     
     // Ensure base doesn't end with slash for consistent comparison
-    char* base_copy = strdup(normalized_base);
+    char* base_copy = xmd_strdup(normalized_base);
     if (!base_copy) return false;
     
     if (base_len > 1 && base_copy[base_len - 1] == '/') {
@@ -107,7 +108,7 @@ static bool is_within_base(const char* normalized_path, const char* normalized_b
     bool within = (strncmp(normalized_path, base_copy, base_len) == 0) &&
                   (normalized_path[base_len] == '/' || normalized_path[base_len] == '\0');
     
-    free(base_copy);
+    xmd_free(base_copy);
     return within;
 }
 
@@ -143,21 +144,21 @@ security_result security_validate_path(const char* path, const char* allowed_bas
                 return SECURITY_INVALID_INPUT;
             }
             size_t full_len = strlen(cwd) + strlen(path) + 2;
-            full_path = malloc(full_len);
+            full_path = xmd_malloc(full_len);
             if (!full_path) {
                 return SECURITY_INVALID_INPUT;
             }
             snprintf(full_path, full_len, "%s/%s", cwd, path);
         } else {
             size_t full_len = strlen(allowed_base) + strlen(path) + 2;
-            full_path = malloc(full_len);
+            full_path = xmd_malloc(full_len);
             if (!full_path) {
                 return SECURITY_INVALID_INPUT;
             }
             snprintf(full_path, full_len, "%s/%s", allowed_base, path);
         }
     } else {
-        full_path = strdup(path);
+        full_path = xmd_strdup(path);
         if (!full_path) {
             return SECURITY_INVALID_INPUT;
         }
@@ -171,8 +172,8 @@ security_result security_validate_path(const char* path, const char* allowed_bas
     if (strcmp(allowed_base, ".") == 0) {
         char cwd[PATH_MAX];
         if (getcwd(cwd, sizeof(cwd)) == NULL) {
-            free(full_path);
-            free(normalized_path);
+            xmd_free(full_path);
+            xmd_free(normalized_path);
             return SECURITY_INVALID_INPUT;
         }
         normalized_base = normalize_path(cwd);
@@ -180,19 +181,19 @@ security_result security_validate_path(const char* path, const char* allowed_bas
         normalized_base = normalize_path(allowed_base);
     }
     
-    free(full_path);
+    xmd_free(full_path);
     
     if (!normalized_path || !normalized_base) {
-        free(normalized_path);
-        free(normalized_base);
+        xmd_free(normalized_path);
+        xmd_free(normalized_base);
         return SECURITY_INVALID_INPUT;
     }
     
     // Check if the normalized path is within the allowed base
     bool within_base = is_within_base(normalized_path, normalized_base);
     
-    free(normalized_path);
-    free(normalized_base);
+    xmd_free(normalized_path);
+    xmd_free(normalized_base);
     
     return within_base ? SECURITY_VALID : SECURITY_PATH_TRAVERSAL;
 }
\ No newline at end of file
@@ -7,22 +7,24 @@
  */
 
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new store
  * @return New store instance or NULL on failure
  */
 store* store_create(void) {
-    store* s = malloc(sizeof(store));
+    store* s = xmd_malloc_tagged(sizeof(store), XMD_ALLOC_STORE);
     if (s == NULL) {
         return NULL;
     }
     
     s->capacity = INITIAL_CAPACITY;
     s->size = 0;
-    s->buckets = calloc(s->capacity, sizeof(store_entry*));
+    s->parent = NULL;
+    s->buckets = xmd_calloc_tagged(s->capacity, sizeof(store_entry*), XMD_ALLOC_STORE);
     if (s->buckets == NULL) {
-        free(s);
+        xmd_free(s);
         return NULL;
     }
     
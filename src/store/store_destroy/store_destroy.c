@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Destroy store and free memory
@@ -34,6 +35,6 @@ void store_destroy(store* s) {
         }
     }
     
-    free(s->buckets);
-    free(s);
+    xmd_free(s->buckets);
+    xmd_free(s);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new store entry
@@ -19,16 +20,16 @@ store_entry* store_entry_create(const char* key, variable* value) {
         return NULL;
     }
     
-    store_entry* entry = malloc(sizeof(store_entry));
+    store_entry* entry = xmd_malloc_tagged(sizeof(store_entry), XMD_ALLOC_STORE);
     if (entry == NULL) {
         return NULL;
     }
     
     // Copy key
     size_t key_len = strlen(key);
-    entry->key = malloc(key_len + 1);
+    entry->key = xmd_malloc_tagged(key_len + 1, XMD_ALLOC_STRING);
     if (entry->key == NULL) {
-        free(entry);
+        xmd_free(entry);
         return NULL;
     }
     strcpy(entry->key, key);
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Destroy a store entry
@@ -17,7 +18,7 @@ void store_entry_destroy(store_entry* entry) {
         return;
     }
     
-    free(entry->key);
+    xmd_free(entry->key);
     variable_unref(entry->value);
-    free(entry);
+    xmd_free(entry);
 }
\ No newline at end of file
@@ -19,14 +19,17 @@ variable* store_get(store* s, const char* name) {
         return NULL;
     }
     
-    size_t hash = xmd_hash_key(name, s->capacity);
-    
-    store_entry* entry = s->buckets[hash];
-    while (entry != NULL) {
-        if (strcmp(entry->key, name) == 0) {
-            return entry->value;
+    // Innermost frame first, then each enclosing scope
+    for (; s != NULL; s = s->parent) {
+        size_t hash = xmd_hash_key(name, s->capacity);
+        
+        store_entry* entry = s->buckets[hash];
+        while (entry != NULL) {
+            if (strcmp(entry->key, name) == 0) {
+                return entry->value;
+            }
+            entry = entry->next;
         }
-        entry = entry->next;
     }
     
     return NULL;
@@ -0,0 +1,28 @@
+/**
+ * @file store_get_local.c
+ * @brief Store frame-local variable getter function
+ * @author XMD Team
+ */
+
+#include "../../../include/store_internal.h"
+
+/**
+ * @brief Get a variable from the innermost frame only
+ * @param s Store instance
+ * @param name Variable name
+ * @return Variable if this frame sets it, NULL otherwise
+ */
+variable* store_get_local(store* s, const char* name) {
+    if (s == NULL || name == NULL) {
+        return NULL;
+    }
+    
+    store_entry* entry = s->buckets[xmd_hash_key(name, s->capacity)];
+    while (entry != NULL) {
+        if (strcmp(entry->key, name) == 0) {
+            return entry->value;
+        }
+        entry = entry->next;
+    }
+    return NULL;
+}
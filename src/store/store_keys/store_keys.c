@@ -13,6 +13,7 @@
 #include <string.h>
 #include "../../../include/store.h"
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Get all variable names
@@ -31,7 +32,7 @@ char** store_keys(store* s, size_t* count) {
         return NULL;
     }
     
-    char** keys = malloc(s->size * sizeof(char*));
+    char** keys = xmd_malloc(s->size * sizeof(char*));
     if (!keys) {
         *count = 0;
         return NULL;
@@ -41,7 +42,7 @@ char** store_keys(store* s, size_t* count) {
     for (size_t i = 0; i < s->capacity; i++) {
         store_entry* entry = s->buckets[i];
         while (entry != NULL && key_index < s->size) {
-            keys[key_index] = strdup(entry->key);
+            keys[key_index] = xmd_strdup(entry->key);
             key_index++;
             entry = entry->next;
         }
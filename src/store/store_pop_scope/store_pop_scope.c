@@ -0,0 +1,24 @@
+/**
+ * @file store_pop_scope.c
+ * @brief Scope frame release function
+ * @author XMD Team
+ *
+ * Implementation of parent-linked scope frames for the XMD store system.
+ */
+
+#include "../../../include/store_internal.h"
+
+/**
+ * @brief Close a scope frame, releasing its variables
+ * @param frame Frame from store_push_scope
+ * @return The enclosing store
+ */
+store* store_pop_scope(store* frame) {
+    if (frame == NULL) {
+        return NULL;
+    }
+    
+    store* parent = frame->parent;
+    store_destroy(frame);
+    return parent;
+}
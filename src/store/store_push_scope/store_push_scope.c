@@ -0,0 +1,28 @@
+/**
+ * @file store_push_scope.c
+ * @brief Scope frame creation function
+ * @author XMD Team
+ *
+ * Implementation of parent-linked scope frames for the XMD store system.
+ */
+
+#include "../../../include/store_internal.h"
+
+/**
+ * @brief Open a scope frame on top of a store
+ * @param parent Enclosing store (must outlive the frame)
+ * @return New frame or NULL on failure
+ */
+store* store_push_scope(store* parent) {
+    if (parent == NULL) {
+        return NULL;
+    }
+    
+    store* frame = store_create();
+    if (frame == NULL) {
+        return NULL;
+    }
+    
+    frame->parent = parent;
+    return frame;
+}
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/store_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Resize store hash table
@@ -23,7 +24,7 @@ bool store_resize(store* s) {
     
     // Double capacity
     s->capacity *= 2;
-    s->buckets = calloc(s->capacity, sizeof(store_entry*));
+    s->buckets = xmd_calloc_tagged(s->capacity, sizeof(store_entry*), XMD_ALLOC_STORE);
     if (s->buckets == NULL) {
         s->capacity = old_capacity;
         s->buckets = old_buckets;
@@ -48,6 +49,6 @@ bool store_resize(store* s) {
         }
     }
     
-    free(old_buckets);
+    xmd_free(old_buckets);
     return true;
 }
\ No newline at end of file
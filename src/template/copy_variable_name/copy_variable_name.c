@@ -0,0 +1,50 @@
+/**
+ * @file copy_variable_name.c
+ * @brief Copy a variable name from a reference into a caller buffer
+ * @author XMD Team
+ */
+
+#include "../../../include/template_internal.h"
+
+/**
+ * @brief Copy the trimmed variable name of a reference
+ * @param template Template string
+ * @param start Start position of variable reference
+ * @param end End position of variable reference
+ * @param name Output of at least end - start - 3 bytes
+ * @return true on success, false if the reference is too short
+ */
+bool copy_variable_name(const char* template, size_t start, size_t end, char* name) {
+    if (template == NULL || name == NULL || end <= start + 4) { // Minimum: {{x}}
+        return false;
+    }
+    
+    // Skip {{ and }}
+    size_t name_start = start + 2;
+    size_t name_end = end - 2;
+    
+    // Copy name and trim whitespace
+    size_t write_pos = 0;
+    bool leading_space = true;
+    
+    for (size_t i = name_start; i < name_end; i++) {
+        char c = template[i];
+        if (isspace(c)) {
+            if (!leading_space) {
+                name[write_pos++] = ' ';
+                leading_space = true;
+            }
+        } else {
+            name[write_pos++] = c;
+            leading_space = false;
+        }
+    }
+    
+    // Remove trailing space
+    if (write_pos > 0 && leading_space) {
+        write_pos--;
+    }
+    
+    name[write_pos] = '\0';
+    return true;
+}
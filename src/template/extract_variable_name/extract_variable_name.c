@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/template_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract variable name from reference
@@ -18,38 +19,10 @@ char* extract_variable_name(const char* template, size_t start, size_t end) {
         return NULL;
     }
     
-    // Skip {{ and }}
-    size_t name_start = start + 2;
-    size_t name_end = end - 2;
-    size_t name_len = name_end - name_start;
-    
-    char* name = malloc(name_len + 1);
+    char* name = xmd_malloc(end - start - 3);
     if (name == NULL) {
         return NULL;
     }
-    
-    // Copy name and trim whitespace
-    size_t write_pos = 0;
-    bool leading_space = true;
-    
-    for (size_t i = name_start; i < name_end; i++) {
-        char c = template[i];
-        if (isspace(c)) {
-            if (!leading_space) {
-                name[write_pos++] = ' ';
-                leading_space = true;
-            }
-        } else {
-            name[write_pos++] = c;
-            leading_space = false;
-        }
-    }
-    
-    // Remove trailing space
-    if (write_pos > 0 && leading_space) {
-        write_pos--;
-    }
-    
-    name[write_pos] = '\0';
+    copy_variable_name(template, start, end, name);
     return name;
-}
\ No newline at end of file
+}
@@ -20,20 +20,14 @@ bool find_next_variable(const char* template, size_t start,
         return false;
     }
     
-    size_t len = strlen(template);
-    
-    // Need at least 4 characters for {{}}
-    if (len < 4) {
-        return false;
-    }
-    
-    // Look for opening {{
-    for (size_t i = start; i < len - 1; i++) {
+    // Scan to the terminator rather than measuring the template on every call,
+    // which would make a pass over all references quadratic
+    for (size_t i = start; template[i] != '\0' && template[i + 1] != '\0'; i++) {
         if (template[i] == '{' && template[i + 1] == '{') {
             *var_start = i;
             
             // Look for closing }}
-            for (size_t j = i + 2; j < len - 1; j++) {
+            for (size_t j = i + 2; template[j] != '\0' && template[j + 1] != '\0'; j++) {
                 if (template[j] == '}' && template[j + 1] == '}') {
                     *var_end = j + 2;
                     return true;
@@ -9,6 +9,7 @@
  * - template_context_destroy/template_context_destroy.c
  * - find_next_variable/find_next_variable.c
  * - extract_variable_name/extract_variable_name.c
+ * - copy_variable_name/copy_variable_name.c
  * - template_process/template_process.c
  * - template_extract_variables/template_extract_variables.c
  * - template_has_variables/template_has_variables.c
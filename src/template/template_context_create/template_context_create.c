@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/template_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new template context
@@ -16,7 +17,7 @@ template_context* template_context_create(store* store) {
         return NULL;
     }
     
-    template_context* ctx = malloc(sizeof(template_context));
+    template_context* ctx = xmd_malloc(sizeof(template_context));
     if (ctx == NULL) {
         return NULL;
     }
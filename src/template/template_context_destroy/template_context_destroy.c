@@ -5,11 +5,12 @@
  */
 
 #include "../../../include/template_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Destroy template context and free memory
  * @param ctx Template context to destroy (can be NULL)
  */
 void template_context_destroy(template_context* ctx) {
-    free(ctx);
+    xmd_free(ctx);
 }
\ No newline at end of file
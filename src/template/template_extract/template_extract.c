@@ -11,6 +11,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include "template.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract variable references from template
@@ -52,7 +53,7 @@ char** template_extract_variables(const char* template, size_t* count) {
     }
     
     // Allocate array for variable names
-    char** variables = malloc(var_count * sizeof(char*));
+    char** variables = xmd_malloc(var_count * sizeof(char*));
     if (variables == NULL) {
         return NULL;
     }
@@ -75,13 +76,13 @@ char** template_extract_variables(const char* template, size_t* count) {
         
         // Extract variable name
         size_t name_len = var_end - name_start;
-        char* name = malloc(name_len + 1);
+        char* name = xmd_malloc(name_len + 1);
         if (name == NULL) {
             // Free already allocated names
             for (size_t i = 0; i < var_index; i++) {
-                free(variables[i]);
+                xmd_free(variables[i]);
             }
-            free(variables);
+            xmd_free(variables);
             *count = 0;
             return NULL;
         }
@@ -5,6 +5,7 @@
  */
 
 #include "../../../include/template_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Extract variable references from template
@@ -34,7 +35,7 @@ char** template_extract_variables(const char* template, size_t* count) {
     }
     
     // Allocate array
-    char** variables = malloc(var_count * sizeof(char*));
+    char** variables = xmd_malloc(var_count * sizeof(char*));
     if (variables == NULL) {
         *count = 0;
         return NULL;
@@ -49,9 +50,9 @@ char** template_extract_variables(const char* template, size_t* count) {
         if (var_name == NULL) {
             // Clean up on failure
             for (size_t i = 0; i < index; i++) {
-                free(variables[i]);
+                xmd_free(variables[i]);
             }
-            free(variables);
+            xmd_free(variables);
             *count = 0;
             return NULL;
         }
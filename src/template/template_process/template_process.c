@@ -5,9 +5,14 @@
  */
 
 #include "../../../include/template_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process template string with variable interpolation
+ *
+ * Values are written straight into the result, and names short enough
+ * for the stack are looked up without a heap copy.
+ *
  * @param ctx Template context
  * @param template Template string with {{variable}} syntax
  * @return Processed string (must be freed) or NULL on error
@@ -17,95 +22,46 @@ char* template_process(template_context* ctx, const char* template) {
         return NULL;
     }
     
-    size_t template_len = strlen(template);
-    size_t result_capacity = template_len * 2;
-    char* result = malloc(result_capacity);
-    if (result == NULL) {
+    xmd_sink result;
+    if (!xmd_sink_init(&result, strlen(template) * 2)) {
         return NULL;
     }
     
-    size_t result_len = 0;
     size_t pos = 0;
     size_t var_start, var_end;
     
     while (find_next_variable(template, pos, &var_start, &var_end)) {
         // Copy text before variable
-        size_t text_len = var_start - pos;
-        if (result_len + text_len >= result_capacity) {
-            result_capacity = (result_len + text_len + 1) * 2;
-            char* new_result = realloc(result, result_capacity);
-            if (new_result == NULL) {
-                free(result);
-                return NULL;
-            }
-            result = new_result;
-        }
-        
-        memcpy(result + result_len, template + pos, text_len);
-        result_len += text_len;
+        xmd_sink_append(&result, template + pos, var_start - pos);
         
         // Extract variable name
-        char* var_name = extract_variable_name(template, var_start, var_end);
-        if (var_name == NULL) {
-            free(result);
+        char small[128];
+        size_t name_size = var_end - var_start;
+        char* var_name = name_size <= sizeof(small) ? small : xmd_malloc(name_size);
+        if (var_name == NULL || !copy_variable_name(template, var_start, var_end, var_name)) {
+            if (var_name != small) {
+                xmd_free(var_name);
+            }
+            xmd_sink_free(&result);
             return NULL;
         }
         
         // Look up variable value
         variable* var = store_get(ctx->variable_store, var_name);
-        char* var_value = NULL;
-        
         if (var != NULL) {
-            var_value = variable_to_string(var);
+            variable_write_to(&result, var);
         } else {
             // Variable not found - keep original reference
-            size_t ref_len = var_end - var_start;
-            var_value = malloc(ref_len + 1);
-            if (var_value != NULL) {
-                memcpy(var_value, template + var_start, ref_len);
-                var_value[ref_len] = '\0';
-            }
+            xmd_sink_append(&result, template + var_start, var_end - var_start);
         }
         
-        // Add variable value to result
-        if (var_value != NULL) {
-            size_t value_len = strlen(var_value);
-            if (result_len + value_len >= result_capacity) {
-                result_capacity = (result_len + value_len + 1) * 2;
-                char* new_result = realloc(result, result_capacity);
-                if (new_result == NULL) {
-                    free(result);
-                    free(var_name);
-                    free(var_value);
-                    return NULL;
-                }
-                result = new_result;
-            }
-            
-            memcpy(result + result_len, var_value, value_len);
-            result_len += value_len;
-            free(var_value);
+        if (var_name != small) {
+            xmd_free(var_name);
         }
-        
-        free(var_name);
         pos = var_end;
     }
     
     // Copy remaining text
-    size_t remaining_len = template_len - pos;
-    if (result_len + remaining_len >= result_capacity) {
-        result_capacity = result_len + remaining_len + 1;
-        char* new_result = realloc(result, result_capacity);
-        if (new_result == NULL) {
-            free(result);
-            return NULL;
-        }
-        result = new_result;
-    }
-    
-    memcpy(result + result_len, template + pos, remaining_len);
-    result_len += remaining_len;
-    result[result_len] = '\0';
-    
-    return result;
-}
\ No newline at end of file
+    xmd_sink_append_string(&result, template + pos);
+    return xmd_sink_finish(&result);
+}
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/token_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new token
@@ -17,7 +18,7 @@
  * @return New token or NULL on failure
  */
 token* token_create(token_type type, const char* value, size_t line, size_t column) {
-    token* t = malloc(sizeof(token));
+    token* t = xmd_malloc_tagged(sizeof(token), XMD_ALLOC_TOKEN);
     if (t == NULL) {
         return NULL;
     }
@@ -30,9 +31,9 @@ token* token_create(token_type type, const char* value, size_t line, size_t colu
     // Copy value if provided
     if (value != NULL) {
         size_t len = strlen(value);
-        t->value = malloc(len + 1);
+        t->value = xmd_malloc(len + 1);
         if (t->value == NULL) {
-            free(t);
+            xmd_free(t);
             return NULL;
         }
         strcpy(t->value, value);
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/token_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free a token and its resources
@@ -17,6 +18,6 @@ void token_free(token* tok) {
         return;
     }
     
-    free(tok->value);
-    free(tok);
+    xmd_free(tok->value);
+    xmd_free(tok);
 }
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/token_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set token value
@@ -20,13 +21,13 @@ int token_set_value(token* tok, const char* value) {
     }
     
     // Free existing value
-    free(tok->value);
+    xmd_free(tok->value);
     tok->value = NULL;
     
     // Copy new value if provided
     if (value != NULL) {
         size_t len = strlen(value);
-        tok->value = malloc(len + 1);
+        tok->value = xmd_malloc(len + 1);
         if (tok->value == NULL) {
             return -1;
         }
@@ -7,6 +7,7 @@
  */
 
 #include "../../../include/token_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Convert token to string representation
@@ -23,7 +24,7 @@ char* token_to_string(const token* t) {
     
     // Allocate buffer for formatted string
     size_t len = strlen(type_str) + strlen(value_str) + 50; // Extra space for formatting
-    char* result = malloc(len);
+    char* result = xmd_malloc(len);
     if (result == NULL) {
         return NULL;
     }
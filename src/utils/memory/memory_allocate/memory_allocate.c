@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include "../../../../include/utils.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Allocate memory safely
@@ -23,5 +24,5 @@ void* memory_allocate(size_t size) {
         return NULL;
     }
     
-    return malloc(size);
+    return xmd_malloc(size);
 }
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include "../../../../include/utils.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Free memory safely and set pointer to NULL
@@ -23,6 +24,6 @@ void memory_free_safe(void** ptr) {
         return;
     }
     
-    free(*ptr);
+    xmd_free(*ptr);
     *ptr = NULL;
 }
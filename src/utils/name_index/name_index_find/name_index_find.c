@@ -0,0 +1,29 @@
+/**
+ * @file name_index_find.c
+ * @brief Look up a name in a name index
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../../include/name_index.h"
+#include "../../../../include/utils.h"
+
+/**
+ * @brief Look up a name
+ * @param index Index
+ * @param name Name to find
+ * @return ID stored for the name, or NAME_INDEX_NONE
+ */
+size_t name_index_find(const name_index* index, const char* name) {
+    if (!index || !name || index->count == 0) {
+        return NAME_INDEX_NONE;
+    }
+    
+    size_t mask = index->capacity - 1;
+    for (size_t slot = xmd_hash_key(name, index->capacity); index->slots[slot].name; slot = (slot + 1) & mask) {
+        if (strcmp(index->slots[slot].name, name) == 0) {
+            return index->slots[slot].id;
+        }
+    }
+    return NAME_INDEX_NONE;
+}
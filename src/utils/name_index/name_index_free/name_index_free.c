@@ -0,0 +1,22 @@
+/**
+ * @file name_index_free.c
+ * @brief Release a name index
+ * @author XMD Team
+ */
+
+#include "../../../../include/name_index.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Release an index's table
+ * @param index Index (left empty)
+ */
+void name_index_free(name_index* index) {
+    if (!index) {
+        return;
+    }
+    xmd_free(index->slots);
+    index->slots = NULL;
+    index->capacity = 0;
+    index->count = 0;
+}
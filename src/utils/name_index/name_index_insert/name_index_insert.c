@@ -0,0 +1,61 @@
+/**
+ * @file name_index_insert.c
+ * @brief Add a name to a name index
+ * @author XMD Team
+ */
+
+#include "../../../../include/name_index.h"
+#include "../../../../include/utils.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Place a name in the first free slot of its probe sequence
+ * @param slots Slots
+ * @param capacity Number of slots (power of two)
+ * @param name Name
+ * @param id ID
+ */
+static void place(name_index_slot* slots, size_t capacity, const char* name, size_t id) {
+    size_t slot = xmd_hash_key(name, capacity);
+    while (slots[slot].name) {
+        slot = (slot + 1) & (capacity - 1);
+    }
+    slots[slot].name = name;
+    slots[slot].id = id;
+}
+
+/**
+ * @brief Add a name that is not indexed yet
+ *
+ * The table is kept at most half full, so probes stay short.
+ *
+ * @param index Index
+ * @param name Name to add (borrowed)
+ * @param id ID to store for it
+ * @return true on success, false on allocation failure
+ */
+bool name_index_insert(name_index* index, const char* name, size_t id) {
+    if (!index || !name) {
+        return false;
+    }
+    
+    if ((index->count + 1) * 2 > index->capacity) {
+        size_t capacity = index->capacity == 0 ? 16 : index->capacity * 2;
+        name_index_slot* slots = xmd_calloc(capacity, sizeof(name_index_slot));
+        if (!slots) {
+            return false;
+        }
+        for (size_t i = 0; i < index->capacity; i++) {
+            if (index->slots[i].name) {
+                place(slots, capacity, index->slots[i].name, index->slots[i].id);
+            }
+        }
+        xmd_free(index->slots);
+        index->slots = slots;
+        index->capacity = capacity;
+    }
+    
+    place(index->slots, index->capacity, name, id);
+    index->count++;
+    return true;
+}
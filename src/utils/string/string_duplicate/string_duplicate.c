@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stddef.h>
 #include "../../../../include/utils.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Duplicate a string safely
@@ -26,7 +27,7 @@ char* string_duplicate(const char* str) {
     }
     
     size_t length = strlen(str);
-    char* copy = malloc(length + 1);
+    char* copy = xmd_malloc(length + 1);
     
     if (copy == NULL) {
         return NULL;
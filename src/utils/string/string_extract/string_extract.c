@@ -9,6 +9,7 @@
 #include <string.h>
 #include <stddef.h>
 #include "../../../../include/utils.h"
+#include "../../../../include/allocator.h"
 
 /**
  * @brief Extract a substring from a string
@@ -41,7 +42,7 @@ char* string_extract(const char* str, size_t start, size_t length) {
     }
     
     // Allocate memory for substring
-    char* result = malloc(length + 1);
+    char* result = xmd_malloc(length + 1);
     if (result == NULL) {
         return NULL;
     }
@@ -0,0 +1,22 @@
+/**
+ * @file xmd_alloc_category_name.c
+ * @brief Allocation category names
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Name of an allocation category
+ * @param category Allocation category
+ * @return Static name
+ */
+const char* xmd_alloc_category_name(xmd_alloc_category category) {
+    static const char* const names[XMD_ALLOC_CATEGORY_COUNT] = {
+        "general", "string", "variable", "store", "ast", "token"
+    };
+    if ((int)category < 0 || category >= XMD_ALLOC_CATEGORY_COUNT) {
+        return "unknown";
+    }
+    return names[category];
+}
@@ -0,0 +1,102 @@
+/**
+ * @file xmd_alloc_stats_allocator.c
+ * @brief Statistics-recording allocator
+ * @author XMD Team
+ */
+
+#include <stdlib.h>
+#include "../../../include/allocator.h"
+#include "../../../include/performance.h"
+
+/**
+ * @brief Account for a new or resized block
+ * @param stats Statistics to update
+ * @param category Allocation category
+ * @param size Usable size of the new block
+ * @param released Usable size of the block it replaces (0 if none)
+ */
+static void account(xmd_alloc_stats* stats, xmd_alloc_category category,
+                    size_t size, size_t released) {
+    xmd_mutex_lock(&stats->lock);
+    stats->allocations[category]++;
+    stats->bytes[category] += size;
+    stats->live_bytes -= released < stats->live_bytes ? released : stats->live_bytes;
+    stats->live_bytes += size;
+    if (stats->live_bytes > stats->peak_live_bytes) {
+        stats->peak_live_bytes = stats->live_bytes;
+    }
+    xmd_mutex_unlock(&stats->lock);
+    
+    if (released > 0) {
+        PERF_RECORD_DEALLOC(xmd_active_profiler, released);
+    }
+    PERF_RECORD_ALLOC(xmd_active_profiler, size);
+}
+
+/**
+ * @brief Allocate from libc and record it
+ */
+static void* stats_allocate(void* user_data, size_t size, xmd_alloc_category category) {
+    void* ptr = malloc(size);
+    if (ptr) {
+        size_t usable = xmd_malloc_size(ptr);
+        account(user_data, category, usable ? usable : size, 0);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Resize through libc and record it
+ */
+static void* stats_reallocate(void* user_data, void* ptr, size_t size, xmd_alloc_category category) {
+    size_t previous = xmd_malloc_size(ptr);
+    void* resized = realloc(ptr, size);
+    if (resized) {
+        size_t usable = xmd_malloc_size(resized);
+        account(user_data, category, usable ? usable : size, previous);
+    }
+    return resized;
+}
+
+/**
+ * @brief Release to libc and record it
+ */
+static void stats_deallocate(void* user_data, void* ptr) {
+    xmd_alloc_stats* stats = user_data;
+    size_t usable = xmd_malloc_size(ptr);
+    free(ptr);
+    
+    xmd_mutex_lock(&stats->lock);
+    stats->deallocations++;
+    stats->live_bytes -= usable < stats->live_bytes ? usable : stats->live_bytes;
+    xmd_mutex_unlock(&stats->lock);
+    PERF_RECORD_DEALLOC(xmd_active_profiler, usable);
+}
+
+/**
+ * @brief Usable size of a libc block
+ */
+static size_t stats_block_size(void* user_data, void* ptr) {
+    (void)user_data;
+    return xmd_malloc_size(ptr);
+}
+
+/**
+ * @brief Create a libc-backed allocator that records statistics
+ *
+ * Blocks come straight from libc, so the allocator can be installed or
+ * removed while libc memory is live.
+ *
+ * @param stats Initialized statistics to update
+ * @return Allocator to pass to xmd_allocator_set
+ */
+xmd_allocator xmd_alloc_stats_allocator(xmd_alloc_stats* stats) {
+    xmd_allocator allocator = {
+        stats_allocate,
+        stats_reallocate,
+        stats_deallocate,
+        stats,
+        stats_block_size
+    };
+    return allocator;
+}
@@ -0,0 +1,17 @@
+/**
+ * @file xmd_alloc_stats_destroy.c
+ * @brief Allocation statistics cleanup
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Release allocation statistics
+ * @param stats Statistics to release
+ */
+void xmd_alloc_stats_destroy(xmd_alloc_stats* stats) {
+    if (stats) {
+        xmd_mutex_destroy(&stats->lock);
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * @file xmd_alloc_stats_init.c
+ * @brief Allocation statistics initialization
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Initialize allocation statistics
+ * @param stats Statistics to initialize
+ * @return 0 on success, -1 on error
+ */
+int xmd_alloc_stats_init(xmd_alloc_stats* stats) {
+    if (!stats) {
+        return -1;
+    }
+    
+    memset(stats, 0, sizeof(*stats));
+    return xmd_mutex_init(&stats->lock);
+}
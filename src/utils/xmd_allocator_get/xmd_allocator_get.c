@@ -0,0 +1,15 @@
+/**
+ * @file xmd_allocator_get.c
+ * @brief Installed allocator lookup
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Get the installed allocator
+ * @return Installed allocator, or NULL when libc is used
+ */
+const xmd_allocator* xmd_allocator_get(void) {
+    return xmd_current_allocator;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file xmd_allocator_set.c
+ * @brief Process-wide allocator installation
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+const xmd_allocator* xmd_current_allocator = NULL;
+
+/** Copy of the installed allocator, so callers need not keep theirs alive */
+static xmd_allocator installed;
+
+/**
+ * @brief Install the process-wide allocator
+ *
+ * Not synchronized: install before rendering on other threads.
+ *
+ * @param allocator Allocator to copy, or NULL to restore libc
+ * @return 0 on success, -1 if the allocator is incomplete
+ */
+int xmd_allocator_set(const xmd_allocator* allocator) {
+    if (!allocator) {
+        xmd_current_allocator = NULL;
+        return 0;
+    }
+    if (!allocator->allocate || !allocator->reallocate || !allocator->deallocate) {
+        return -1;
+    }
+    
+    installed = *allocator;
+    xmd_current_allocator = &installed;
+    return 0;
+}
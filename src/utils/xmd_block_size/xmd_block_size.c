@@ -0,0 +1,24 @@
+/**
+ * @file xmd_block_size.c
+ * @brief Usable size of an allocated block
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Usable size of a block from the installed allocator
+ * @param ptr Block from the xmd_malloc family
+ * @param fallback Size to report when the allocator cannot tell
+ * @return Usable size in bytes
+ */
+size_t xmd_block_size(void* ptr, size_t fallback) {
+    const xmd_allocator* allocator = xmd_current_allocator;
+    size_t size = 0;
+    if (!allocator) {
+        size = xmd_malloc_size(ptr);
+    } else if (allocator->block_size) {
+        size = allocator->block_size(allocator->user_data, ptr);
+    }
+    return size ? size : fallback;
+}
@@ -1,20 +1,17 @@
 /**
  * @file xmd_calloc.c
- * @brief Safe calloc function
+ * @brief Zeroed allocation through the installed allocator
  * @author XMD Team
  */
 
 #include "../../../include/utils_internal.h"
 
 /**
- * @brief Safe calloc with NULL check
+ * @brief Allocate zeroed memory (calloc contract)
  * @param count Number of elements
  * @param size Size of each element
- * @return Allocated and zeroed memory or NULL on failure
+ * @return Memory or NULL on failure or overflow
  */
 void* xmd_calloc(size_t count, size_t size) {
-    if (count == 0 || size == 0) {
-        return NULL;
-    }
-    return calloc(count, size);
-}
\ No newline at end of file
+    return xmd_calloc_tagged(count, size, XMD_ALLOC_GENERAL);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file xmd_calloc_tagged.c
+ * @brief Categorized zeroed allocation
+ * @author XMD Team
+ */
+
+#include <stdint.h>
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Allocate zeroed memory for a category
+ * @param count Number of elements
+ * @param size Size of each element
+ * @param category Allocation category
+ * @return Memory or NULL on failure or overflow
+ */
+void* xmd_calloc_tagged(size_t count, size_t size, xmd_alloc_category category) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    xmd_heap_budget* budget = xmd_active_heap_budget;
+    if (budget && !xmd_heap_budget_admit(budget, count * size)) {
+        return NULL;
+    }
+    
+    const xmd_allocator* allocator = xmd_current_allocator;
+    void* ptr;
+    if (!allocator) {
+        ptr = calloc(count, size);
+    } else {
+        ptr = allocator->allocate(allocator->user_data, count * size, category);
+        if (ptr) {
+            memset(ptr, 0, count * size);
+        }
+    }
+    if (budget && ptr) {
+        xmd_heap_budget_account(budget, xmd_block_size(ptr, count * size), 0);
+    }
+    return ptr;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file xmd_format_number.c
+ * @brief Shortest round-trip number formatting
+ * @author XMD Team
+ *
+ * Integers and decimals with few fractional digits, which is nearly every
+ * number in a document, are formatted directly from their digits. Other
+ * values fall back to printf at increasing precision until the text reads
+ * back exactly.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../../include/utils.h"
+
+/** Largest magnitude printed in plain notation, matching %.15g */
+#define PLAIN_LIMIT 1e15
+
+/** Smallest magnitude printed in plain notation, matching %g */
+#define PLAIN_MINIMUM 1e-4
+
+/** Fractional digits tried by the direct path */
+#define MAX_FRACTION_DIGITS 9
+
+/** Integers up to this are exactly representable */
+#define EXACT_INTEGER_LIMIT 9007199254740992.0
+
+static const double powers_of_ten[MAX_FRACTION_DIGITS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+};
+
+/**
+ * @brief Write the decimal digits of an integer
+ * @param value Integer
+ * @param out Output position
+ * @param width Minimum digits, padded with leading zeros
+ * @return Digits written
+ */
+static size_t write_digits(uint64_t value, char* out, size_t width) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count < width) {
+        digits[count++] = '0';
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = digits[count - 1 - i];
+    }
+    return count;
+}
+
+/**
+ * @brief Copy a constant into the buffer
+ * @param buffer Output buffer
+ * @param text Text to copy
+ * @return Length written
+ */
+static size_t write_text(char* buffer, const char* text) {
+    size_t length = strlen(text);
+    memcpy(buffer, text, length + 1);
+    return length;
+}
+
+/**
+ * @brief Format a number as the shortest text that reads back as the same value
+ * @param value Number to format
+ * @param buffer Output of at least XMD_NUMBER_BUFFER_SIZE bytes
+ * @return Length written, excluding the terminator
+ */
+size_t xmd_format_number(double value, char* buffer) {
+    if (isnan(value)) {
+        return write_text(buffer, "NaN");
+    }
+    if (isinf(value)) {
+        return write_text(buffer, value > 0 ? "Infinity" : "-Infinity");
+    }
+
+    double magnitude = fabs(value);
+    size_t length = 0;
+    if (magnitude < PLAIN_LIMIT && floor(magnitude) == magnitude) {
+        if (signbit(value)) {
+            buffer[length++] = '-';
+        }
+        length += write_digits((uint64_t)magnitude, buffer + length, 1);
+        buffer[length] = '\0';
+        return length;
+    }
+
+    if (magnitude >= PLAIN_MINIMUM && magnitude < PLAIN_LIMIT) {
+        // The fewest fractional digits k for which m / 10^k reads back as
+        // the value; m and 10^k are exact, so the division rounds the same
+        // way strtod does
+        for (size_t k = 1; k <= MAX_FRACTION_DIGITS; k++) {
+            double scaled = magnitude * powers_of_ten[k];
+            if (scaled >= EXACT_INTEGER_LIMIT) {
+                break;
+            }
+            double mantissa = floor(scaled + 0.5);
+            if (mantissa / powers_of_ten[k] != magnitude) {
+                continue;
+            }
+            uint64_t digits = (uint64_t)mantissa;
+            uint64_t unit = (uint64_t)powers_of_ten[k];
+            uint64_t fraction = digits % unit;
+            size_t width = k;
+            while (width > 1 && fraction % 10 == 0) {
+                fraction /= 10;
+                width--;
+            }
+            if (value < 0) {
+                buffer[length++] = '-';
+            }
+            length += write_digits(digits / unit, buffer + length, 1);
+            buffer[length++] = '.';
+            length += write_digits(fraction, buffer + length, width);
+            buffer[length] = '\0';
+            return length;
+        }
+    }
+
+    for (int precision = 15; precision <= 17; precision++) {
+        length = (size_t)snprintf(buffer, XMD_NUMBER_BUFFER_SIZE, "%.*g", precision, value);
+        if (strtod(buffer, NULL) == value) {
+            break;
+        }
+    }
+    return length;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file xmd_free.c
+ * @brief Release memory from the xmd_malloc family
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Release memory from the xmd_malloc family
+ * @param ptr Memory or NULL
+ */
+void xmd_free(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    
+    xmd_heap_budget* budget = xmd_active_heap_budget;
+    if (budget) {
+        xmd_heap_budget_account(budget, 0, xmd_block_size(ptr, 0));
+    }
+    
+    const xmd_allocator* allocator = xmd_current_allocator;
+    if (!allocator) {
+        free(ptr);
+        return;
+    }
+    allocator->deallocate(allocator->user_data, ptr);
+}
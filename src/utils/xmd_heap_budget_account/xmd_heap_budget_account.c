@@ -0,0 +1,21 @@
+/**
+ * @file xmd_heap_budget_account.c
+ * @brief Heap budget bookkeeping
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Charge and credit a budget for one allocator call
+ * @param budget Budget to update
+ * @param allocated Size of the new block (0 if none)
+ * @param released Size of the block released or replaced (0 if none)
+ */
+void xmd_heap_budget_account(xmd_heap_budget* budget, size_t allocated, size_t released) {
+    budget->live_bytes -= released < budget->live_bytes ? released : budget->live_bytes;
+    budget->live_bytes += allocated;
+    if (budget->live_bytes > budget->peak_bytes) {
+        budget->peak_bytes = budget->live_bytes;
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * @file xmd_heap_budget_admit.c
+ * @brief Heap budget limit check
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Check that a budget can take more live bytes
+ * @param budget Budget to check
+ * @param bytes Additional live bytes requested
+ * @return true if allowed, false (and the budget marked exceeded) if not
+ */
+bool xmd_heap_budget_admit(xmd_heap_budget* budget, size_t bytes) {
+    if (budget->limit_bytes == 0) {
+        return true;
+    }
+    // Block slack can leave live_bytes slightly above the limit
+    if (budget->live_bytes <= budget->limit_bytes &&
+        bytes <= budget->limit_bytes - budget->live_bytes) {
+        return true;
+    }
+    
+    budget->exceeded = true;
+    return false;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file xmd_heap_budget_adopt.c
+ * @brief Charge a heap budget for a block allocated without it
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Charge the calling thread's budget for a block allocated without it
+ * @param ptr Block from the xmd_malloc family, or NULL
+ * @param size Size of the block if the allocator cannot tell
+ * @return true if charged or no budget is attached, false if over the limit
+ */
+bool xmd_heap_budget_adopt(void* ptr, size_t size) {
+    xmd_heap_budget* budget = xmd_active_heap_budget;
+    if (!budget || !ptr) {
+        return true;
+    }
+    size = xmd_block_size(ptr, size);
+    if (!xmd_heap_budget_admit(budget, size)) {
+        return false;
+    }
+    xmd_heap_budget_account(budget, size, 0);
+    return true;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file xmd_heap_budget_attach.c
+ * @brief Attach a heap budget to the calling thread
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+XMD_THREAD_LOCAL xmd_heap_budget* xmd_active_heap_budget = NULL;
+
+/**
+ * @brief Attach a heap budget to the calling thread
+ * @param budget Budget to attach, or NULL to detach
+ * @return Previously attached budget
+ */
+xmd_heap_budget* xmd_heap_budget_attach(xmd_heap_budget* budget) {
+    xmd_heap_budget* previous = xmd_active_heap_budget;
+    xmd_active_heap_budget = budget;
+    return previous;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file xmd_heap_budget_exhausted.c
+ * @brief Check the calling thread's heap budget
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Check whether the calling thread's budget refused an allocation
+ * @return true if a budget is attached and exceeded
+ */
+bool xmd_heap_budget_exhausted(void) {
+    return xmd_active_heap_budget && xmd_active_heap_budget->exceeded;
+}
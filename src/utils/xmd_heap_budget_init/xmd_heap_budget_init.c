@@ -0,0 +1,21 @@
+/**
+ * @file xmd_heap_budget_init.c
+ * @brief Heap budget initialization
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Initialize a heap budget
+ * @param budget Budget to initialize
+ * @param limit_bytes Live bytes allowed, 0 for no limit
+ */
+void xmd_heap_budget_init(xmd_heap_budget* budget, uint64_t limit_bytes) {
+    if (!budget) {
+        return;
+    }
+    
+    memset(budget, 0, sizeof(*budget));
+    budget->limit_bytes = limit_bytes;
+}
@@ -1,19 +1,16 @@
 /**
  * @file xmd_malloc.c
- * @brief Safe memory allocation function
+ * @brief General-purpose allocation through the installed allocator
  * @author XMD Team
  */
 
 #include "../../../include/utils_internal.h"
 
 /**
- * @brief Safe malloc with NULL check
- * @param size Size to allocate
- * @return Allocated memory or NULL on failure
+ * @brief Allocate memory (malloc contract)
+ * @param size Size in bytes
+ * @return Memory or NULL on failure
  */
 void* xmd_malloc(size_t size) {
-    if (size == 0) {
-        return NULL;
-    }
-    return malloc(size);
-}
\ No newline at end of file
+    return xmd_malloc_tagged(size, XMD_ALLOC_GENERAL);
+}
@@ -0,0 +1,28 @@
+/**
+ * @file xmd_malloc_tagged.c
+ * @brief Categorized allocation
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Allocate memory for a category
+ * @param size Size in bytes
+ * @param category Allocation category
+ * @return Memory or NULL on failure
+ */
+void* xmd_malloc_tagged(size_t size, xmd_alloc_category category) {
+    xmd_heap_budget* budget = xmd_active_heap_budget;
+    if (budget && !xmd_heap_budget_admit(budget, size)) {
+        return NULL;
+    }
+    
+    const xmd_allocator* allocator = xmd_current_allocator;
+    void* ptr = allocator ? allocator->allocate(allocator->user_data, size, category)
+                          : malloc(size);
+    if (budget && ptr) {
+        xmd_heap_budget_account(budget, xmd_block_size(ptr, size), 0);
+    }
+    return ptr;
+}
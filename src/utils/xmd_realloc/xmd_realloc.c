@@ -1,21 +1,17 @@
 /**
  * @file xmd_realloc.c
- * @brief Safe realloc function
+ * @brief Reallocation through the installed allocator
  * @author XMD Team
  */
 
 #include "../../../include/utils_internal.h"
 
 /**
- * @brief Safe realloc with NULL check
- * @param ptr Existing pointer
+ * @brief Resize memory (realloc contract; size 0 frees and returns NULL)
+ * @param ptr Existing memory or NULL
  * @param size New size
- * @return Reallocated memory or NULL on failure
+ * @return Memory or NULL on failure
  */
 void* xmd_realloc(void* ptr, size_t size) {
-    if (size == 0) {
-        free(ptr);
-        return NULL;
-    }
-    return realloc(ptr, size);
-}
\ No newline at end of file
+    return xmd_realloc_tagged(ptr, size, XMD_ALLOC_GENERAL);
+}
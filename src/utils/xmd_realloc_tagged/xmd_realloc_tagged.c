@@ -0,0 +1,44 @@
+/**
+ * @file xmd_realloc_tagged.c
+ * @brief Categorized reallocation
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Resize memory for a category
+ * @param ptr Existing memory or NULL
+ * @param size New size (0 frees and returns NULL)
+ * @param category Allocation category
+ * @return Memory or NULL on failure
+ */
+void* xmd_realloc_tagged(void* ptr, size_t size, xmd_alloc_category category) {
+    if (size == 0) {
+        xmd_free(ptr);
+        return NULL;
+    }
+    
+    xmd_heap_budget* budget = xmd_active_heap_budget;
+    size_t previous = 0;
+    if (budget) {
+        previous = ptr ? xmd_block_size(ptr, 0) : 0;
+        if (size > previous && !xmd_heap_budget_admit(budget, size - previous)) {
+            return NULL;
+        }
+    }
+    
+    const xmd_allocator* allocator = xmd_current_allocator;
+    void* resized;
+    if (!allocator) {
+        resized = realloc(ptr, size);
+    } else if (!ptr) {
+        resized = allocator->allocate(allocator->user_data, size, category);
+    } else {
+        resized = allocator->reallocate(allocator->user_data, ptr, size, category);
+    }
+    if (budget && resized) {
+        xmd_heap_budget_account(budget, xmd_block_size(resized, size), previous);
+    }
+    return resized;
+}
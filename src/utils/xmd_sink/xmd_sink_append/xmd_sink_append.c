@@ -0,0 +1,46 @@
+/**
+ * @file xmd_sink_append.c
+ * @brief Append bytes to an output sink
+ * @author XMD Team
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "../../../../include/xmd_sink.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Append bytes
+ * @param sink Sink
+ * @param data Bytes to append
+ * @param length Number of bytes
+ * @return true on success, false if the sink has failed
+ */
+bool xmd_sink_append(xmd_sink* sink, const char* data, size_t length) {
+    if (!sink || sink->failed) {
+        return false;
+    }
+    if (length > sink->capacity - sink->length) {
+        if (length > (SIZE_MAX - 1) / 2 - sink->length) {
+            sink->failed = true;
+            return false;
+        }
+        size_t capacity = sink->capacity * 2;
+        if (capacity < sink->length + length) {
+            capacity = sink->length + length;
+        }
+        char* grown = xmd_realloc_tagged(sink->data, capacity + 1, XMD_ALLOC_STRING);
+        if (!grown) {
+            sink->failed = true;
+            return false;
+        }
+        sink->data = grown;
+        sink->capacity = capacity;
+    }
+    if (length > 0) {
+        memcpy(sink->data + sink->length, data, length);
+    }
+    sink->length += length;
+    sink->data[sink->length] = '\0';
+    return true;
+}
@@ -0,0 +1,18 @@
+/**
+ * @file xmd_sink_append_string.c
+ * @brief Append a C string to an output sink
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../../include/xmd_sink.h"
+
+/**
+ * @brief Append a C string
+ * @param sink Sink
+ * @param text String to append (NULL appends nothing)
+ * @return true on success, false if the sink has failed
+ */
+bool xmd_sink_append_string(xmd_sink* sink, const char* text) {
+    return xmd_sink_append(sink, text, text ? strlen(text) : 0);
+}
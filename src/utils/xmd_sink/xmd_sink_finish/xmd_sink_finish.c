@@ -0,0 +1,27 @@
+/**
+ * @file xmd_sink_finish.c
+ * @brief Take the buffer of an output sink
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_sink.h"
+
+/**
+ * @brief Take the sink's buffer
+ * @param sink Sink (left empty)
+ * @return NUL-terminated buffer (caller must free), or NULL if the sink failed
+ */
+char* xmd_sink_finish(xmd_sink* sink) {
+    if (!sink) {
+        return NULL;
+    }
+    if (sink->failed) {
+        xmd_sink_free(sink);
+        return NULL;
+    }
+    char* data = sink->data;
+    sink->data = NULL;
+    sink->length = 0;
+    sink->capacity = 0;
+    return data;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file xmd_sink_free.c
+ * @brief Release the buffer of an output sink
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_sink.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Release a sink's buffer without taking it
+ * @param sink Sink (left empty)
+ */
+void xmd_sink_free(xmd_sink* sink) {
+    if (!sink) {
+        return;
+    }
+    xmd_free(sink->data);
+    sink->data = NULL;
+    sink->length = 0;
+    sink->capacity = 0;
+}
@@ -0,0 +1,28 @@
+/**
+ * @file xmd_sink_init.c
+ * @brief Initialize an output sink
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_sink.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Initialize an empty sink
+ * @param sink Sink to initialize
+ * @param capacity Bytes to reserve up front
+ * @return true on success, false if the buffer could not be allocated
+ */
+bool xmd_sink_init(xmd_sink* sink, size_t capacity) {
+    if (!sink) {
+        return false;
+    }
+    sink->length = 0;
+    sink->capacity = capacity;
+    sink->data = xmd_malloc_tagged(capacity + 1, XMD_ALLOC_STRING);
+    sink->failed = sink->data == NULL;
+    if (sink->data) {
+        sink->data[0] = '\0';
+    }
+    return !sink->failed;
+}
@@ -1,6 +1,6 @@
 /**
  * @file xmd_strdup.c
- * @brief Safe string duplication function
+ * @brief String duplication through the installed allocator
  * @author XMD Team
  */
 
@@ -11,9 +11,9 @@
 #include "../../../include/utils_internal.h"
 
 /**
- * @brief Safe string duplication
+ * @brief Duplicate a string
  * @param str String to duplicate
- * @return Duplicated string or NULL on failure
+ * @return Copy or NULL on failure or NULL input
  */
 char* xmd_strdup(const char* str) {
     if (!str) {
@@ -21,7 +21,7 @@ char* xmd_strdup(const char* str) {
     }
     
     size_t len = strlen(str) + 1;
-    char* copy = xmd_malloc(len);
+    char* copy = xmd_malloc_tagged(len, XMD_ALLOC_STRING);
     if (copy) {
         memcpy(copy, str, len);
     }
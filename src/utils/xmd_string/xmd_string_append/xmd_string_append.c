@@ -0,0 +1,79 @@
+/**
+ * @file xmd_string_append.c
+ * @brief Append bytes to a string
+ * @author XMD Team
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "../../../../include/xmd_string.h"
+#include "../../../../include/allocator.h"
+#include "../../../../include/platform.h"
+
+/** Smallest capacity given to a string that is being appended to */
+#define APPEND_MIN_CAPACITY 32
+
+/**
+ * @brief Append bytes to a string the caller holds a reference to
+ * @param chars Characters of the string (reference consumed on success)
+ * @param text Bytes to append
+ * @param length Number of bytes
+ * @return Characters of the result (one reference), or NULL on failure
+ *         with the caller's reference to chars left intact
+ */
+char* xmd_string_append(char* chars, const char* text, size_t length) {
+    if (!chars) {
+        return xmd_string_from(text, length);
+    }
+    xmd_string* string = xmd_string_of(chars);
+    size_t old_length = string->length;
+    if (length > SIZE_MAX / 2 - sizeof(xmd_string) - old_length) {
+        return NULL;
+    }
+    size_t needed = old_length + length;
+    // A sole owner has no one to race with; a shared string is copied
+    bool sole = XMD_ATOMIC_LOAD(&string->ref_count) == 1;
+
+    if (sole && needed <= string->capacity) {
+        // Sole owner with room: append in place
+        memmove(string->data + old_length, text, length);
+    } else {
+        // Sized from the length, not the old capacity: a shared string may
+        // already carry spare room, and doubling that on every copy would
+        // grow the copies exponentially
+        size_t capacity = old_length * 2;
+        if (capacity < needed) {
+            capacity = needed;
+        }
+        if (capacity < APPEND_MIN_CAPACITY) {
+            capacity = APPEND_MIN_CAPACITY;
+        }
+        if (sole) {
+            // Sole owner: grow the block; text may point into it
+            uintptr_t start = (uintptr_t)string->data;
+            bool inside = (uintptr_t)text >= start && (uintptr_t)text <= start + old_length;
+            size_t offset = inside ? (size_t)((uintptr_t)text - start) : 0;
+            xmd_string* grown = xmd_realloc_tagged(string, XMD_STRING_SIZE(capacity), XMD_ALLOC_STRING);
+            if (!grown) {
+                return NULL;
+            }
+            string = grown;
+            memmove(string->data + old_length, inside ? string->data + offset : text, length);
+        } else {
+            char* copy = xmd_string_with_capacity(capacity);
+            if (!copy) {
+                return NULL;
+            }
+            memcpy(copy, chars, old_length);
+            memcpy(copy + old_length, text, length);
+            xmd_string_release(chars);
+            string = xmd_string_of(copy);
+        }
+        string->capacity = capacity;
+    }
+    string->length = needed;
+    string->data[needed] = '\0';
+    string->hash = 0;
+    return string->data;
+}
@@ -0,0 +1,17 @@
+/**
+ * @file xmd_string_dup.c
+ * @brief Create a string from a C string
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../../include/xmd_string.h"
+
+/**
+ * @brief Create a string from a C string
+ * @param text String to copy (NULL for an empty string)
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_dup(const char* text) {
+    return xmd_string_from(text, text ? strlen(text) : 0);
+}
@@ -0,0 +1,28 @@
+/**
+ * @file xmd_string_embed.c
+ * @brief Initialize a string inside its owner's allocation
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../../include/xmd_string.h"
+
+/**
+ * @brief Initialize a string embedded in caller-owned storage
+ * @param storage At least XMD_STRING_SIZE(length) bytes, suitably aligned
+ * @param text Bytes to copy
+ * @param length Number of bytes
+ * @return Characters of the embedded string
+ */
+char* xmd_string_embed(void* storage, const char* text, size_t length) {
+    xmd_string* string = storage;
+    string->ref_count = XMD_STRING_EMBEDDED;
+    string->length = length;
+    string->capacity = length;
+    string->hash = 0;
+    if (length > 0) {
+        memcpy(string->data, text, length);
+    }
+    string->data[length] = '\0';
+    return string->data;
+}
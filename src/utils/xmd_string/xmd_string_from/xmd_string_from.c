@@ -0,0 +1,30 @@
+/**
+ * @file xmd_string_from.c
+ * @brief Create a string from bytes
+ * @author XMD Team
+ */
+
+#include <string.h>
+#include "../../../../include/xmd_string.h"
+
+/**
+ * @brief Create a string from bytes
+ * @param text Bytes to copy (NULL for an empty string)
+ * @param length Number of bytes
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_from(const char* text, size_t length) {
+    if (!text) {
+        length = 0;
+    }
+    char* chars = xmd_string_with_capacity(length);
+    if (!chars) {
+        return NULL;
+    }
+    if (length > 0) {
+        memcpy(chars, text, length);
+    }
+    chars[length] = '\0';
+    xmd_string_of(chars)->length = length;
+    return chars;
+}
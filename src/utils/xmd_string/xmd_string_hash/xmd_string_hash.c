@@ -0,0 +1,37 @@
+/**
+ * @file xmd_string_hash.c
+ * @brief Get the cached content hash of a string
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_string.h"
+#include "../../../../include/platform.h"
+
+/** FNV-1a parameters */
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+/**
+ * @brief Get the content hash of a string, computed once
+ * @param chars Characters of a string
+ * @return 64-bit hash (never 0)
+ */
+uint64_t xmd_string_hash(const char* chars) {
+    if (!chars) {
+        return 0;
+    }
+    xmd_string* string = xmd_string_of(chars);
+    uint64_t hash = XMD_ATOMIC_LOAD(&string->hash);
+    if (hash == 0) {
+        hash = FNV_OFFSET_BASIS;
+        for (size_t i = 0; i < string->length; i++) {
+            hash ^= (unsigned char)string->data[i];
+            hash *= FNV_PRIME;
+        }
+        // Zero marks a hash not yet computed; threads racing here store
+        // the same value
+        hash = hash ? hash : 1;
+        XMD_ATOMIC_STORE(&string->hash, hash);
+    }
+    return hash;
+}
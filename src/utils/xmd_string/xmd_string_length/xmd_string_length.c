@@ -0,0 +1,16 @@
+/**
+ * @file xmd_string_length.c
+ * @brief Get the stored length of a string
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_string.h"
+
+/**
+ * @brief Get the length of a string in O(1)
+ * @param chars Characters of a string
+ * @return Length in bytes
+ */
+size_t xmd_string_length(const char* chars) {
+    return chars ? xmd_string_of(chars)->length : 0;
+}
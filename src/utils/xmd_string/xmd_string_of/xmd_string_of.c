@@ -0,0 +1,17 @@
+/**
+ * @file xmd_string_of.c
+ * @brief Get the header of a string from its characters
+ * @author XMD Team
+ */
+
+#include <stddef.h>
+#include "../../../../include/xmd_string.h"
+
+/**
+ * @brief Get the header of a string
+ * @param chars Characters of a string
+ * @return Header
+ */
+xmd_string* xmd_string_of(const char* chars) {
+    return (xmd_string*)(chars - offsetof(xmd_string, data));
+}
@@ -0,0 +1,27 @@
+/**
+ * @file xmd_string_release.c
+ * @brief Drop a reference to a string
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_string.h"
+#include "../../../../include/allocator.h"
+#include "../../../../include/platform.h"
+
+/**
+ * @brief Drop a reference to a string, freeing it with the last one
+ * @param chars Characters of a string, or NULL
+ */
+void xmd_string_release(const char* chars) {
+    if (!chars) {
+        return;
+    }
+    xmd_string* string = xmd_string_of(chars);
+    if (XMD_ATOMIC_LOAD(&string->ref_count) == XMD_STRING_EMBEDDED) {
+        // Released together with its owner
+        return;
+    }
+    if (XMD_ATOMIC_DECREMENT(&string->ref_count) == 0) {
+        xmd_free(string);
+    }
+}
@@ -0,0 +1,30 @@
+/**
+ * @file xmd_string_share.c
+ * @brief Take another reference to a string
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_string.h"
+#include "../../../../include/platform.h"
+
+/**
+ * @brief Take another reference to a string
+ * @param chars Characters of a string
+ * @return The same characters, or a new copy if the string is embedded;
+ *         NULL on failure
+ */
+char* xmd_string_share(const char* chars) {
+    if (!chars) {
+        return NULL;
+    }
+    xmd_string* string = xmd_string_of(chars);
+    if (XMD_ATOMIC_LOAD(&string->ref_count) == XMD_STRING_EMBEDDED) {
+        char* copy = xmd_string_from(chars, string->length);
+        if (copy) {
+            xmd_string_of(copy)->hash = XMD_ATOMIC_LOAD(&string->hash);
+        }
+        return copy;
+    }
+    XMD_ATOMIC_INCREMENT(&string->ref_count);
+    return string->data;
+}
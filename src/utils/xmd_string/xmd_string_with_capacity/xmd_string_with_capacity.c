@@ -0,0 +1,29 @@
+/**
+ * @file xmd_string_with_capacity.c
+ * @brief Create an empty string with reserved capacity
+ * @author XMD Team
+ */
+
+#include "../../../../include/xmd_string.h"
+#include "../../../../include/allocator.h"
+
+/**
+ * @brief Create an empty string with room to grow
+ * @param capacity Bytes to reserve for characters
+ * @return Characters of the new string (one reference) or NULL on failure
+ */
+char* xmd_string_with_capacity(size_t capacity) {
+    if (capacity > SIZE_MAX - sizeof(xmd_string) - 1) {
+        return NULL;
+    }
+    xmd_string* string = xmd_malloc_tagged(XMD_STRING_SIZE(capacity), XMD_ALLOC_STRING);
+    if (!string) {
+        return NULL;
+    }
+    string->ref_count = 1;
+    string->length = 0;
+    string->capacity = capacity;
+    string->hash = 0;
+    string->data[0] = '\0';
+    return string->data;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file xmd_strndup.c
+ * @brief Bounded string duplication
+ * @author XMD Team
+ */
+
+#include "../../../include/allocator_internal.h"
+
+/**
+ * @brief Duplicate at most n bytes of a string
+ * @param str String to duplicate
+ * @param n Maximum bytes to copy
+ * @return NUL-terminated copy or NULL on failure or NULL input
+ */
+char* xmd_strndup(const char* str, size_t n) {
+    if (!str) {
+        return NULL;
+    }
+    
+    size_t len = 0;
+    while (len < n && str[len] != '\0') {
+        len++;
+    }
+    
+    char* copy = xmd_malloc_tagged(len + 1, XMD_ALLOC_STRING);
+    if (copy) {
+        memcpy(copy, str, len);
+        copy[len] = '\0';
+    }
+    return copy;
+}
@@ -13,6 +13,7 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/xmd_string.h"
 
 /**
  * @brief Add item to array variable
@@ -27,14 +28,34 @@ bool variable_array_add(variable* array_var, variable* item) {
     
     variable_array* array = array_var->value.array_value;
     
+    // Scalars stay packed while the array holds only their type
+    bool packable = array->kind == VAR_ARRAY_BOXED ? array->count == 0 : true;
+    switch (item->type) {
+        case VAR_NUMBER:
+            if (packable && (array->kind == VAR_ARRAY_BOXED || array->kind == VAR_ARRAY_NUMBERS)) {
+                return variable_array_add_number(array_var, item->value.number_value);
+            }
+            break;
+        case VAR_STRING:
+            if (packable && (array->kind == VAR_ARRAY_BOXED || array->kind == VAR_ARRAY_STRINGS)) {
+                return variable_array_add_string(array_var, item->value.string_value,
+                                                 xmd_string_length(item->value.string_value));
+            }
+            break;
+        case VAR_BOOLEAN:
+            if (packable && (array->kind == VAR_ARRAY_BOXED || array->kind == VAR_ARRAY_BOOLEANS)) {
+                return variable_array_add_boolean(array_var, item->value.boolean_value);
+            }
+            break;
+        default:
+            break;
+    }
+    if (!variable_array_box(array_var)) return false;
+    
     // Resize if needed
-    if (array->count >= array->capacity) {
-        size_t new_capacity = array->capacity == 0 ? 4 : array->capacity * 2;
-        variable** new_items = realloc(array->items, new_capacity * sizeof(variable*));
-        if (!new_items) return false;
-        
-        array->items = new_items;
-        array->capacity = new_capacity;
+    if (array->count >= array->capacity &&
+        !variable_array_reserve(array, array->capacity == 0 ? 4 : array->capacity * 2)) {
+        return false;
     }
     
     array->items[array->count++] = variable_ref(item);
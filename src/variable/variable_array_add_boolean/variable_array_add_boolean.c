@@ -0,0 +1,44 @@
+/**
+ * @file variable_array_add_boolean.c
+ * @brief Variable system implementation - packed boolean append
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Append a boolean to an array variable without boxing it
+ *
+ * An empty array becomes a booleans array; an array holding anything
+ * else receives a boxed boolean.
+ *
+ * @param array_var Array variable
+ * @param value Boolean to add
+ * @return true on success, false on failure
+ */
+bool variable_array_add_boolean(variable* array_var, bool value) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return false;
+    }
+    
+    variable_array* array = array_var->value.array_value;
+    if (array->kind != VAR_ARRAY_BOOLEANS &&
+        (array->count > 0 || !variable_array_set_kind(array, VAR_ARRAY_BOOLEANS))) {
+        variable* item = variable_create_boolean(value);
+        bool added = item && variable_array_add(array_var, item);
+        variable_unref(item);
+        return added;
+    }
+    
+    if (array->count >= array->capacity && !variable_array_reserve(array, array->capacity * 2)) {
+        return false;
+    }
+    uint64_t bit = (uint64_t)1 << (array->count % 64);
+    if (value) {
+        array->packed.bits[array->count / 64] |= bit;
+    } else {
+        array->packed.bits[array->count / 64] &= ~bit;
+    }
+    array->count++;
+    return true;
+}
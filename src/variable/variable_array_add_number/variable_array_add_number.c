@@ -0,0 +1,38 @@
+/**
+ * @file variable_array_add_number.c
+ * @brief Variable system implementation - packed number append
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Append a number to an array variable without boxing it
+ *
+ * An empty array becomes a numbers array; an array holding anything
+ * else receives a boxed number.
+ *
+ * @param array_var Array variable
+ * @param value Number to add
+ * @return true on success, false on failure
+ */
+bool variable_array_add_number(variable* array_var, double value) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return false;
+    }
+    
+    variable_array* array = array_var->value.array_value;
+    if (array->kind != VAR_ARRAY_NUMBERS &&
+        (array->count > 0 || !variable_array_set_kind(array, VAR_ARRAY_NUMBERS))) {
+        variable* item = variable_create_number(value);
+        bool added = item && variable_array_add(array_var, item);
+        variable_unref(item);
+        return added;
+    }
+    
+    if (array->count >= array->capacity && !variable_array_reserve(array, array->capacity * 2)) {
+        return false;
+    }
+    array->packed.numbers[array->count++] = value;
+    return true;
+}
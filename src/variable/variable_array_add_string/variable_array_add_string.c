@@ -0,0 +1,58 @@
+/**
+ * @file variable_array_add_string.c
+ * @brief Variable system implementation - packed string append
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Append a string to an array variable without boxing it
+ *
+ * An empty array becomes a strings array; an array holding anything
+ * else receives a boxed string.
+ *
+ * @param array_var Array variable
+ * @param value Bytes to copy (need not be terminated)
+ * @param length Number of bytes
+ * @return true on success, false on failure
+ */
+bool variable_array_add_string(variable* array_var, const char* value, size_t length) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return false;
+    }
+    
+    variable_array* array = array_var->value.array_value;
+    if (array->kind != VAR_ARRAY_STRINGS &&
+        (array->count > 0 || !variable_array_set_kind(array, VAR_ARRAY_STRINGS))) {
+        variable* item = variable_create_string_length(value, length);
+        bool added = item && variable_array_add(array_var, item);
+        variable_unref(item);
+        return added;
+    }
+    
+    if (array->count >= array->capacity && !variable_array_reserve(array, array->capacity * 2)) {
+        return false;
+    }
+    
+    size_t start = array->packed.strings.offsets[array->count];
+    size_t end = start + length + 1;
+    if (end > array->packed.strings.text_capacity) {
+        size_t capacity = array->packed.strings.text_capacity > 0 ? array->packed.strings.text_capacity * 2 : 64;
+        while (capacity < end) {
+            capacity *= 2;
+        }
+        char* text = xmd_realloc_tagged(array->packed.strings.text, capacity, XMD_ALLOC_STRING);
+        if (!text) return false;
+        array->packed.strings.text = text;
+        array->packed.strings.text_capacity = capacity;
+    }
+    
+    if (length > 0) {
+        memcpy(array->packed.strings.text + start, value, length);
+    }
+    array->packed.strings.text[start + length] = '\0';
+    array->packed.strings.offsets[++array->count] = end;
+    return true;
+}
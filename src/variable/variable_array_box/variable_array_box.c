@@ -0,0 +1,60 @@
+/**
+ * @file variable_array_box.c
+ * @brief Variable system implementation - packed array boxing
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Convert a packed array to variable pointers
+ *
+ * Items already boxed by variable_array_get are kept, so pointers handed
+ * out earlier stay valid.
+ *
+ * @param array_var Array variable
+ * @return true on success (or if already boxed), false on failure
+ */
+bool variable_array_box(variable* array_var) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return false;
+    }
+    
+    variable_array* array = array_var->value.array_value;
+    if (array->kind == VAR_ARRAY_BOXED) {
+        return true;
+    }
+    
+    if (!array->items && array->capacity > 0) {
+        array->items = xmd_calloc_tagged(array->capacity, sizeof(variable*), XMD_ALLOC_VARIABLE);
+        if (!array->items) return false;
+    }
+    for (size_t i = 0; i < array->count; i++) {
+        if (!array->items[i]) {
+            array->items[i] = variable_array_box_item(array, i);
+            if (!array->items[i]) return false;
+        }
+    }
+    
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS:
+            xmd_free(array->packed.numbers);
+            break;
+        case VAR_ARRAY_BOOLEANS:
+            xmd_free(array->packed.bits);
+            break;
+        case VAR_ARRAY_STRINGS:
+            xmd_free(array->packed.strings.offsets);
+            xmd_free(array->packed.strings.text);
+            break;
+        case VAR_ARRAY_SOURCE:
+            xmd_free(array->packed.source.positions);
+            variable_source_release(array->packed.source.source);
+            break;
+        default:
+            break;
+    }
+    array->kind = VAR_ARRAY_BOXED;
+    return true;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file variable_array_box_item.c
+ * @brief Variable system implementation - packed item boxing
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Box one item of a packed array into a new variable
+ * @param array Packed array
+ * @param index Item index (must be in range)
+ * @return New variable or NULL on failure
+ */
+variable* variable_array_box_item(const variable_array* array, size_t index) {
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS:
+            return variable_create_number(array->packed.numbers[index]);
+        case VAR_ARRAY_BOOLEANS:
+            return variable_create_boolean((array->packed.bits[index / 64] >> (index % 64)) & 1);
+        case VAR_ARRAY_RANGE:
+            return variable_create_number(array->packed.range.start + (double)index * array->packed.range.step);
+        case VAR_ARRAY_STRINGS: {
+            const size_t* offsets = array->packed.strings.offsets;
+            return variable_create_string_length(array->packed.strings.text + offsets[index],
+                                                 offsets[index + 1] - offsets[index] - 1);
+        }
+        case VAR_ARRAY_SOURCE:
+            return array->packed.source.source->build(array->packed.source.source,
+                                                      array->packed.source.positions[index]);
+        default:
+            return variable_ref(array->items[index]);
+    }
+}
@@ -0,0 +1,46 @@
+/**
+ * @file variable_array_defer.c
+ * @brief Variable system implementation - lazily built array items
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Append an item built from a source when first read
+ * @param array_var Array variable
+ * @param source Source of the item (a reference is taken)
+ * @param position Position of the item in source
+ * @return true on success, false on failure
+ */
+bool variable_array_defer(variable* array_var, variable_source* source, uint64_t position) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value || !source) {
+        return false;
+    }
+    
+    variable_array* array = array_var->value.array_value;
+    if (array->kind != VAR_ARRAY_SOURCE) {
+        if (array->kind != VAR_ARRAY_BOXED || array->count != 0) {
+            return false;
+        }
+        size_t capacity = array->capacity > 0 ? array->capacity : 4;
+        uint64_t* positions = xmd_malloc_tagged(capacity * sizeof(uint64_t), XMD_ALLOC_VARIABLE);
+        if (!positions) return false;
+        // Items are boxed into a fresh table on first access, as for packed arrays
+        xmd_free(array->items);
+        array->items = NULL;
+        array->capacity = capacity;
+        array->kind = VAR_ARRAY_SOURCE;
+        array->packed.source.source = variable_source_ref(source);
+        array->packed.source.positions = positions;
+    } else if (array->packed.source.source != source) {
+        return false;
+    }
+    
+    if (array->count >= array->capacity && !variable_array_reserve(array, array->capacity * 2)) {
+        return false;
+    }
+    array->packed.source.positions[array->count++] = position;
+    return true;
+}
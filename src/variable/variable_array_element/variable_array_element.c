@@ -0,0 +1,31 @@
+/**
+ * @file variable_array_element.c
+ * @brief Variable system implementation - array item reference
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Get a new reference to an array item
+ * @param array_var Array variable
+ * @param index Item index
+ * @return New reference (caller must unref) or NULL if not found/invalid
+ */
+variable* variable_array_element(const variable* array_var, size_t index) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return NULL;
+    }
+    
+    const variable_array* array = array_var->value.array_value;
+    if (index >= array->count) return NULL;
+    
+    if (array->items && array->items[index]) {
+        return variable_ref(array->items[index]);
+    }
+    if (array->kind == VAR_ARRAY_SOURCE) {
+        // Building from a source costs more than keeping the item
+        return variable_ref(variable_array_get(array_var, index));
+    }
+    return array->kind == VAR_ARRAY_BOXED ? NULL : variable_array_box_item(array, index);
+}
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free array structure and all its items
@@ -16,11 +17,32 @@
 void variable_array_free(variable_array* array) {
     if (!array) return;
     
-    // Unref all items
-    for (size_t i = 0; i < array->count; i++) {
-        variable_unref(array->items[i]);
+    // Unref all items (a packed array boxes only the items it was asked for)
+    if (array->items) {
+        for (size_t i = 0; i < array->count; i++) {
+            variable_unref(array->items[i]);
+        }
     }
     
-    free(array->items);
-    free(array);
-}
\ No newline at end of file
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS:
+            xmd_free(array->packed.numbers);
+            break;
+        case VAR_ARRAY_BOOLEANS:
+            xmd_free(array->packed.bits);
+            break;
+        case VAR_ARRAY_STRINGS:
+            xmd_free(array->packed.strings.offsets);
+            xmd_free(array->packed.strings.text);
+            break;
+        case VAR_ARRAY_SOURCE:
+            xmd_free(array->packed.source.positions);
+            variable_source_release(array->packed.source.source);
+            break;
+        default:
+            break;
+    }
+    
+    xmd_free(array->items);
+    xmd_free(array);
+}
@@ -13,6 +13,7 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Get item from array variable by index
@@ -28,5 +29,16 @@ variable* variable_array_get(const variable* array_var, size_t index) {
     variable_array* array = array_var->value.array_value;
     if (index >= array->count) return NULL;
     
+    if (array->kind != VAR_ARRAY_BOXED) {
+        // Box a packed item on first access; the box lives with the array
+        if (!array->items) {
+            array->items = xmd_calloc_tagged(array->capacity, sizeof(variable*), XMD_ALLOC_VARIABLE);
+            if (!array->items) return NULL;
+        }
+        if (!array->items[index]) {
+            array->items[index] = variable_array_box_item(array, index);
+        }
+    }
+    
     return array->items[index];
 }
@@ -0,0 +1,70 @@
+/**
+ * @file variable_array_reserve.c
+ * @brief Variable system implementation - array storage growth
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Make room for more items in an array's current storage
+ *
+ * Grows the packed storage of a packed array along with its boxed items,
+ * if any were boxed yet.
+ *
+ * @param array Array to grow
+ * @param capacity Item count the storage must hold
+ * @return true on success, false on failure
+ */
+bool variable_array_reserve(variable_array* array, size_t capacity) {
+    if (capacity <= array->capacity) {
+        return true;
+    }
+    
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS: {
+            double* numbers = xmd_realloc_tagged(array->packed.numbers, capacity * sizeof(double),
+                                                 XMD_ALLOC_VARIABLE);
+            if (!numbers) return false;
+            array->packed.numbers = numbers;
+            break;
+        }
+        case VAR_ARRAY_BOOLEANS: {
+            uint64_t* bits = xmd_realloc_tagged(array->packed.bits, ((capacity + 63) / 64) * sizeof(uint64_t),
+                                                XMD_ALLOC_VARIABLE);
+            if (!bits) return false;
+            array->packed.bits = bits;
+            break;
+        }
+        case VAR_ARRAY_STRINGS: {
+            size_t* offsets = xmd_realloc_tagged(array->packed.strings.offsets, (capacity + 1) * sizeof(size_t),
+                                                 XMD_ALLOC_VARIABLE);
+            if (!offsets) return false;
+            array->packed.strings.offsets = offsets;
+            break;
+        }
+        case VAR_ARRAY_SOURCE: {
+            uint64_t* positions = xmd_realloc_tagged(array->packed.source.positions, capacity * sizeof(uint64_t),
+                                                     XMD_ALLOC_VARIABLE);
+            if (!positions) return false;
+            array->packed.source.positions = positions;
+            break;
+        }
+        default:
+            break;
+    }
+    
+    if (array->kind == VAR_ARRAY_BOXED || array->items) {
+        variable** items = xmd_realloc_tagged(array->items, capacity * sizeof(variable*), XMD_ALLOC_VARIABLE);
+        if (!items) return false;
+        if (array->kind != VAR_ARRAY_BOXED) {
+            // Items past the old capacity have not been boxed
+            memset(items + array->capacity, 0, (capacity - array->capacity) * sizeof(variable*));
+        }
+        array->items = items;
+    }
+    
+    array->capacity = capacity;
+    return true;
+}
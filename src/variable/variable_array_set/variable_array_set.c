@@ -29,6 +29,30 @@ bool variable_array_set(variable* array_var, size_t index, variable* item) {
     variable_array* array = array_var->value.array_value;
     if (index >= array->count) return false;
     
+    if (array->kind != VAR_ARRAY_BOXED) {
+        // Numbers and booleans of the array's type are replaced in place
+        if (item && item->type == VAR_NUMBER && array->kind == VAR_ARRAY_NUMBERS) {
+            array->packed.numbers[index] = item->value.number_value;
+        } else if (item && item->type == VAR_BOOLEAN && array->kind == VAR_ARRAY_BOOLEANS) {
+            uint64_t bit = (uint64_t)1 << (index % 64);
+            if (item->value.boolean_value) {
+                array->packed.bits[index / 64] |= bit;
+            } else {
+                array->packed.bits[index / 64] &= ~bit;
+            }
+        } else if (!variable_array_box(array_var)) {
+            return false;
+        }
+    }
+    if (array->kind != VAR_ARRAY_BOXED) {
+        // Drop the stale box, if the replaced item had one
+        if (array->items) {
+            variable_unref(array->items[index]);
+            array->items[index] = NULL;
+        }
+        return true;
+    }
+    
     variable_unref(array->items[index]);
     array->items[index] = variable_ref(item);
     return true;
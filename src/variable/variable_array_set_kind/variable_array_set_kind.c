@@ -0,0 +1,51 @@
+/**
+ * @file variable_array_set_kind.c
+ * @brief Variable system implementation - packed array storage selection
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Switch an empty array to the storage for a scalar type
+ *
+ * Slots reserved for variable pointers are traded for the same number
+ * of packed slots.
+ *
+ * @param array Empty array
+ * @param kind Storage to use
+ * @return true on success, false on failure
+ */
+bool variable_array_set_kind(variable_array* array, variable_array_kind kind) {
+    if (array->count != 0 || array->kind != VAR_ARRAY_BOXED) {
+        return false;
+    }
+    
+    size_t capacity = array->capacity > 0 ? array->capacity : 4;
+    switch (kind) {
+        case VAR_ARRAY_NUMBERS:
+            array->packed.numbers = xmd_malloc_tagged(capacity * sizeof(double), XMD_ALLOC_VARIABLE);
+            if (!array->packed.numbers) return false;
+            break;
+        case VAR_ARRAY_BOOLEANS:
+            array->packed.bits = xmd_malloc_tagged(((capacity + 63) / 64) * sizeof(uint64_t), XMD_ALLOC_VARIABLE);
+            if (!array->packed.bits) return false;
+            break;
+        case VAR_ARRAY_STRINGS:
+            array->packed.strings.offsets = xmd_malloc_tagged((capacity + 1) * sizeof(size_t), XMD_ALLOC_VARIABLE);
+            if (!array->packed.strings.offsets) return false;
+            array->packed.strings.offsets[0] = 0;
+            array->packed.strings.text = NULL;
+            array->packed.strings.text_capacity = 0;
+            break;
+        default:
+            return true;
+    }
+    
+    xmd_free(array->items);
+    array->items = NULL;
+    array->capacity = capacity;
+    array->kind = kind;
+    return true;
+}
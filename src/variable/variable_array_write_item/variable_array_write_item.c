@@ -0,0 +1,48 @@
+/**
+ * @file variable_array_write_item.c
+ * @brief Variable system implementation - array item output
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Append an array item's string form to an output sink
+ *
+ * Packed items are written straight from their storage.
+ *
+ * @param sink Output sink
+ * @param array_var Array variable
+ * @param index Item index
+ * @return true on success, false if the sink has failed or the index is invalid
+ */
+bool variable_array_write_item(xmd_sink* sink, const variable* array_var, size_t index) {
+    if (!array_var || array_var->type != VAR_ARRAY || !array_var->value.array_value) {
+        return false;
+    }
+    
+    const variable_array* array = array_var->value.array_value;
+    if (index >= array->count) return false;
+    
+    switch (array->kind) {
+        case VAR_ARRAY_NUMBERS:
+        case VAR_ARRAY_RANGE: {
+            char buffer[XMD_NUMBER_BUFFER_SIZE];
+            double value = array->kind == VAR_ARRAY_NUMBERS ? array->packed.numbers[index]
+                : array->packed.range.start + (double)index * array->packed.range.step;
+            size_t length = xmd_format_number(value, buffer);
+            return xmd_sink_append(sink, buffer, length);
+        }
+        case VAR_ARRAY_BOOLEANS:
+            return xmd_sink_append_string(sink, (array->packed.bits[index / 64] >> (index % 64)) & 1 ? "true" : "false");
+        case VAR_ARRAY_STRINGS: {
+            const size_t* offsets = array->packed.strings.offsets;
+            return xmd_sink_append(sink, array->packed.strings.text + offsets[index],
+                                   offsets[index + 1] - offsets[index] - 1);
+        }
+        case VAR_ARRAY_SOURCE:
+            return variable_write_to(sink, variable_array_get(array_var, index));
+        default:
+            return variable_write_to(sink, array->items[index]);
+    }
+}
@@ -14,6 +14,7 @@
 #include <stdbool.h>
 #include <math.h>
 #include "../../../include/variable.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Get variable type
@@ -55,7 +56,7 @@ variable* variable_convert(variable* var, variable_type target_type) {
             char* str = variable_to_string(var);
             if (!str) return NULL;
             variable* result = variable_create_string(str);
-            free(str);
+            xmd_free(str);
             return result;
         }
         
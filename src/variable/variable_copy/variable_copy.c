@@ -27,7 +27,7 @@ variable* variable_copy(const variable* var) {
         case VAR_NUMBER:
             return variable_create_number(var->value.number_value);
         case VAR_STRING:
-            return variable_create_string(var->value.string_value);
+            return variable_create_string_shared(var->value.string_value);
         case VAR_ARRAY: {
             // Deep copy array
             variable* new_array = variable_create_array();
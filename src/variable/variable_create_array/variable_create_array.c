@@ -13,27 +13,29 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new array variable
  * @return New empty array variable or NULL on failure
  */
 variable* variable_create_array(void) {
-    variable* var = malloc(sizeof(variable));
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
     if (var == NULL) {
         return NULL;
     }
     
     var->type = VAR_ARRAY;
-    var->value.array_value = malloc(sizeof(variable_array));
+    var->value.array_value = xmd_malloc_tagged(sizeof(variable_array), XMD_ALLOC_VARIABLE);
     if (!var->value.array_value) {
-        free(var);
+        xmd_free(var);
         return NULL;
     }
     
     var->value.array_value->items = NULL;
     var->value.array_value->count = 0;
     var->value.array_value->capacity = 0;
+    var->value.array_value->kind = VAR_ARRAY_BOXED;
     var->ref_count = 1;
     
     return var;
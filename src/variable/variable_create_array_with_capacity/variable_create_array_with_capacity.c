@@ -0,0 +1,37 @@
+/**
+ * @file variable_create_array_with_capacity.c
+ * @brief Variable system implementation - pre-sized array creation
+ * @author XMD Team
+ *
+ * Lets callers that know the element count up front avoid regrowth.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "../../../include/variable_internal.h"
+#include "../../../include/utils.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create an empty array variable with pre-allocated capacity
+ * @param capacity Number of item slots to reserve
+ * @return New empty array variable or NULL on failure
+ */
+variable* variable_create_array_with_capacity(size_t capacity) {
+    variable* var = variable_create_array();
+    if (var == NULL || capacity == 0) {
+        return var;
+    }
+    
+    var->value.array_value->items = xmd_malloc_tagged(capacity * sizeof(variable*), XMD_ALLOC_VARIABLE);
+    if (!var->value.array_value->items) {
+        variable_unref(var);
+        return NULL;
+    }
+    var->value.array_value->capacity = capacity;
+    
+    return var;
+}
@@ -13,6 +13,7 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new boolean variable
@@ -20,7 +21,7 @@
  * @return New boolean variable or NULL on failure
  */
 variable* variable_create_boolean(bool value) {
-    variable* var = malloc(sizeof(variable));
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
     if (var == NULL) {
         return NULL;
     }
@@ -13,13 +13,14 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new null variable
  * @return New null variable or NULL on failure
  */
 variable* variable_create_null(void) {
-    variable* var = malloc(sizeof(variable));
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
     if (var == NULL) {
         return NULL;
     }
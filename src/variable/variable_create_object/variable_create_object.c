@@ -13,27 +13,30 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create a new object variable
  * @return New empty object variable or NULL on failure
  */
 variable* variable_create_object(void) {
-    variable* var = malloc(sizeof(variable));
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
     if (var == NULL) {
         return NULL;
     }
     
     var->type = VAR_OBJECT;
-    var->value.object_value = malloc(sizeof(variable_object));
+    var->value.object_value = xmd_malloc_tagged(sizeof(variable_object), XMD_ALLOC_VARIABLE);
     if (!var->value.object_value) {
-        free(var);
+        xmd_free(var);
         return NULL;
     }
     
     var->value.object_value->pairs = NULL;
     var->value.object_value->count = 0;
     var->value.object_value->capacity = 0;
+    var->value.object_value->source = NULL;
+    var->value.object_value->positions = NULL;
     var->ref_count = 1;
     
     return var;
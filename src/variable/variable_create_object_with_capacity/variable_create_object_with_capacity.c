@@ -0,0 +1,37 @@
+/**
+ * @file variable_create_object_with_capacity.c
+ * @brief Variable system implementation - pre-sized object creation
+ * @author XMD Team
+ *
+ * Lets callers that know the key count up front avoid regrowth.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "../../../include/variable_internal.h"
+#include "../../../include/utils.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create an empty object variable with pre-allocated capacity
+ * @param capacity Number of key-value slots to reserve
+ * @return New empty object variable or NULL on failure
+ */
+variable* variable_create_object_with_capacity(size_t capacity) {
+    variable* var = variable_create_object();
+    if (var == NULL || capacity == 0) {
+        return var;
+    }
+    
+    var->value.object_value->pairs = xmd_malloc_tagged(capacity * sizeof(variable_object_pair), XMD_ALLOC_VARIABLE);
+    if (!var->value.object_value->pairs) {
+        variable_unref(var);
+        return NULL;
+    }
+    var->value.object_value->capacity = capacity;
+    
+    return var;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file variable_create_range.c
+ * @brief Variable system implementation - numeric range creation
+ * @author XMD Team
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create an array variable holding a numeric range
+ *
+ * Only the first item and the step are stored; item i is start + i * step.
+ *
+ * @param start First item
+ * @param end Last item, included if the range reaches it exactly
+ * @param step Difference between consecutive items
+ * @return New array variable or NULL on failure or invalid step
+ */
+variable* variable_create_range(double start, double end, double step) {
+    if (step == 0 || !isfinite(start) || !isfinite(end) || !isfinite(step)) {
+        return NULL;
+    }
+    
+    // Items that fit between the bounds; the slack absorbs rounding in
+    // fractional steps such as 0..1 step 0.1
+    double span = (end - start) / step;
+    size_t count = 0;
+    if (span >= 0) {
+        double whole = floor(span + 1e-9) + 1;
+        count = whole < (double)SIZE_MAX ? (size_t)whole : SIZE_MAX;
+    }
+    
+    variable* var = variable_create_array();
+    if (!var) {
+        return NULL;
+    }
+    variable_array* array = var->value.array_value;
+    array->kind = VAR_ARRAY_RANGE;
+    array->count = count;
+    array->capacity = count;
+    array->packed.range.start = start;
+    array->packed.range.step = step;
+    return var;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file variable_create_string_length.c
+ * @brief Variable system implementation - string creation from bytes
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/xmd_string.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create a string variable from bytes
+ *
+ * A short string is embedded after the variable, so the variable and its
+ * characters take one allocation; a longer one gets its own shareable
+ * block.
+ *
+ * @param value Bytes to copy (need not be terminated)
+ * @param length Number of bytes
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_length(const char* value, size_t length) {
+    if (value == NULL) {
+        length = 0;
+    }
+    
+    if (length <= XMD_STRING_INLINE_MAX) {
+        variable* var = xmd_malloc_tagged(sizeof(variable) + XMD_STRING_SIZE(length), XMD_ALLOC_VARIABLE);
+        if (var == NULL) {
+            return NULL;
+        }
+        var->type = VAR_STRING;
+        var->ref_count = 1;
+        var->value.string_value = xmd_string_embed(var + 1, value, length);
+        return var;
+    }
+    
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
+    if (var == NULL) {
+        return NULL;
+    }
+    var->type = VAR_STRING;
+    var->ref_count = 1;
+    var->value.string_value = xmd_string_from(value, length);
+    if (var->value.string_value == NULL) {
+        xmd_free(var);
+        return NULL;
+    }
+    return var;
+}
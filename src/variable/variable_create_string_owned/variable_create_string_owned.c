@@ -0,0 +1,27 @@
+/**
+ * @file variable_create_string_owned.c
+ * @brief Variable system implementation - string creation from a heap buffer
+ * @author XMD Team
+ *
+ * Used by parsers that already hold a freshly decoded heap string. The
+ * characters move into string storage and the buffer is released.
+ */
+
+#include <string.h>
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create a string variable that takes ownership of a heap buffer
+ * @param value Heap-allocated NUL-terminated string (always released)
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_owned(char* value) {
+    if (value == NULL) {
+        return variable_create_string(NULL);
+    }
+    
+    variable* var = variable_create_string_length(value, strlen(value));
+    xmd_free(value);
+    return var;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file variable_create_string_shared.c
+ * @brief Variable system implementation - string sharing
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/xmd_string.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Create a string variable sharing an existing string
+ *
+ * Short strings are copied into the variable instead, which costs no
+ * more than allocating the variable alone.
+ *
+ * @param chars Characters of an xmd_string (a reference is taken)
+ * @return New string variable or NULL on failure
+ */
+variable* variable_create_string_shared(const char* chars) {
+    if (chars == NULL) {
+        return variable_create_string_length(NULL, 0);
+    }
+    
+    size_t length = xmd_string_length(chars);
+    if (length <= XMD_STRING_INLINE_MAX) {
+        return variable_create_string_length(chars, length);
+    }
+    
+    variable* var = xmd_malloc_tagged(sizeof(variable), XMD_ALLOC_VARIABLE);
+    if (var == NULL) {
+        return NULL;
+    }
+    var->type = VAR_STRING;
+    var->ref_count = 1;
+    var->value.string_value = xmd_string_share(chars);
+    return var;
+}
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include "../../../include/variable.h"
+#include "../../../include/xmd_string.h"
 
 /**
  * @brief Check if two variables are equal
@@ -47,7 +48,11 @@ bool variable_equals(const variable* a, const variable* b) {
             if (!a->value.string_value || !b->value.string_value) {
                 return false;
             }
-            return strcmp(a->value.string_value, b->value.string_value) == 0;
+            if (xmd_string_length(a->value.string_value) != xmd_string_length(b->value.string_value)) {
+                return false;
+            }
+            return memcmp(a->value.string_value, b->value.string_value,
+                          xmd_string_length(a->value.string_value)) == 0;
             
         case VAR_ARRAY:
             // For now, array comparison is by reference
@@ -0,0 +1,96 @@
+/**
+ * @file variable_object_dedupe_keys.c
+ * @brief Variable system implementation - duplicate key collapsing
+ * @author XMD Team
+ *
+ * Parsers append pairs directly and call this once per object, instead of
+ * paying a linear key lookup on every insert.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../../include/variable.h"
+#include "../../../include/allocator.h"
+
+/* Objects up to this size are checked pairwise */
+#define DEDUPE_LINEAR_LIMIT 16
+
+/**
+ * @brief Collapse duplicate keys after bulk insertion
+ * @param object_var Object variable
+ * @return true on success, false on failure
+ */
+bool variable_object_dedupe_keys(variable* object_var) {
+    if (!object_var || object_var->type != VAR_OBJECT || !object_var->value.object_value) {
+        return false;
+    }
+    
+    variable_object* obj = object_var->value.object_value;
+    if (obj->count < 2) {
+        return true;
+    }
+    
+    uint32_t* slots = NULL;
+    size_t mask = 0;
+    if (obj->count > DEDUPE_LINEAR_LIMIT) {
+        size_t size = 32;
+        while (size < obj->count * 2) size *= 2;
+        slots = xmd_calloc(size, sizeof(uint32_t));
+        if (!slots) {
+            return false;
+        }
+        mask = size - 1;
+    }
+    
+    size_t kept = 0;
+    for (size_t i = 0; i < obj->count; i++) {
+        variable_object_pair pair = obj->pairs[i];
+        size_t existing = SIZE_MAX;
+        size_t slot = 0;
+        
+        if (!slots) {
+            for (size_t j = 0; j < kept; j++) {
+                if (strcmp(obj->pairs[j].key, pair.key) == 0) {
+                    existing = j;
+                    break;
+                }
+            }
+        } else {
+            size_t h = 2166136261u;
+            for (const char* p = pair.key; *p; p++) {
+                h = (h ^ (unsigned char)*p) * 16777619u;
+            }
+            for (slot = h & mask; slots[slot] != 0; slot = (slot + 1) & mask) {
+                if (strcmp(obj->pairs[slots[slot] - 1].key, pair.key) == 0) {
+                    existing = slots[slot] - 1;
+                    break;
+                }
+            }
+        }
+        
+        if (existing != SIZE_MAX) {
+            xmd_free(pair.key);
+            variable_unref(obj->pairs[existing].value);
+            obj->pairs[existing].value = pair.value;
+            if (obj->positions) {
+                obj->positions[existing] = obj->positions[i];
+            }
+        } else {
+            obj->pairs[kept] = pair;
+            if (obj->positions) {
+                obj->positions[kept] = obj->positions[i];
+            }
+            if (slots) {
+                slots[slot] = (uint32_t)(kept + 1);
+            }
+            kept++;
+        }
+    }
+    
+    obj->count = kept;
+    xmd_free(slots);
+    return true;
+}
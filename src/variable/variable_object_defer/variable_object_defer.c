@@ -0,0 +1,55 @@
+/**
+ * @file variable_object_defer.c
+ * @brief Variable system implementation - lazily built object values
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Append a pair whose value is built from a source when first read
+ * @param object_var Object variable
+ * @param source Source of the value (a reference is taken)
+ * @param key Key (ownership is taken, freed on failure)
+ * @param position Position of the value in source
+ * @return true on success, false on failure
+ */
+bool variable_object_defer(variable* object_var, variable_source* source, char* key, uint64_t position) {
+    if (!object_var || object_var->type != VAR_OBJECT || !object_var->value.object_value ||
+        !source || !key) {
+        xmd_free(key);
+        return false;
+    }
+    
+    variable_object* obj = object_var->value.object_value;
+    if (obj->source != source && (obj->source || obj->count != 0)) {
+        xmd_free(key);
+        return false;
+    }
+    
+    if (obj->count >= obj->capacity || !obj->positions) {
+        size_t new_capacity = obj->count < obj->capacity ? obj->capacity
+            : obj->capacity == 0 ? 8 : obj->capacity * 2;
+        variable_object_pair* pairs = xmd_realloc_tagged(obj->pairs, new_capacity * sizeof(variable_object_pair),
+                                                         XMD_ALLOC_VARIABLE);
+        if (pairs) obj->pairs = pairs;
+        uint64_t* positions = xmd_realloc_tagged(obj->positions, new_capacity * sizeof(uint64_t),
+                                                 XMD_ALLOC_VARIABLE);
+        if (positions) obj->positions = positions;
+        if (!pairs || !positions) {
+            xmd_free(key);
+            return false;
+        }
+        obj->capacity = new_capacity;
+    }
+    if (!obj->source) {
+        obj->source = variable_source_ref(source);
+    }
+    
+    obj->pairs[obj->count].key = key;
+    obj->pairs[obj->count].value = NULL;
+    obj->positions[obj->count] = position;
+    obj->count++;
+    return true;
+}
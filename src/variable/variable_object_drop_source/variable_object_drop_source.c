@@ -0,0 +1,19 @@
+/**
+ * @file variable_object_drop_source.c
+ * @brief Variable system implementation - detach an object from its source
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Release an object's source and value positions
+ * @param object Object
+ */
+void variable_object_drop_source(variable_object* object) {
+    variable_source_release(object->source);
+    object->source = NULL;
+    xmd_free(object->positions);
+    object->positions = NULL;
+}
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Free object structure and all its pairs
@@ -18,10 +19,11 @@ void variable_object_free(variable_object* object) {
     
     // Free all pairs
     for (size_t i = 0; i < object->count; i++) {
-        free(object->pairs[i].key);
+        xmd_free(object->pairs[i].key);
         variable_unref(object->pairs[i].value);
     }
     
-    free(object->pairs);
-    free(object);
+    xmd_free(object->pairs);
+    variable_object_drop_source(object);
+    xmd_free(object);
 }
\ No newline at end of file
@@ -27,5 +27,11 @@ variable* variable_object_get(const variable* object_var, const char* key) {
     size_t index = variable_object_find_key(object_var, key);
     
     if (index == SIZE_MAX) return NULL;
-    return object_var->value.object_value->pairs[index].value;
+    
+    variable_object* obj = object_var->value.object_value;
+    if (!obj->pairs[index].value && obj->source) {
+        // Build a lazily loaded value on first access; it stays with the object
+        obj->pairs[index].value = obj->source->build(obj->source, obj->positions[index]);
+    }
+    return obj->pairs[index].value;
 }
\ No newline at end of file
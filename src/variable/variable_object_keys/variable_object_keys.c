@@ -15,6 +15,7 @@
 #include <math.h>
 #include "../../../include/variable_internal.h"
 #include "../../../include/utils.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Get all object keys
@@ -33,20 +34,20 @@ char** variable_object_keys(const variable* object_var, size_t* count) {
     
     if (object->count == 0) return NULL;
     
-    char** keys = malloc(object->count * sizeof(char*));
+    char** keys = xmd_malloc(object->count * sizeof(char*));
     if (!keys) {
         *count = 0;
         return NULL;
     }
     
     for (size_t i = 0; i < object->count; i++) {
-        keys[i] = strdup(object->pairs[i].key);
+        keys[i] = xmd_strdup(object->pairs[i].key);
         if (!keys[i]) {
             // Cleanup on failure
             for (size_t j = 0; j < i; j++) {
-                free(keys[j]);
+                xmd_free(keys[j]);
             }
-            free(keys);
+            xmd_free(keys);
             *count = 0;
             return NULL;
         }
@@ -12,6 +12,7 @@
 #include <limits.h>
 #include "../../../include/variable.h"
 #include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Remove property from object variable
@@ -25,12 +26,15 @@ bool variable_object_remove(variable* object_var, const char* key) {
     }
     
     variable_object* object = object_var->value.object_value;
+    if (!variable_object_settle(object)) {
+        return false;
+    }
     size_t index = variable_object_find_key(object_var, key);
     
     if (index == SIZE_MAX) return false;
     
     // Free the pair
-    free(object->pairs[index].key);
+    xmd_free(object->pairs[index].key);
     variable_unref(object->pairs[index].value);
     
     // Move last pair to this position
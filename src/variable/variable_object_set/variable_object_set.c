@@ -14,6 +14,8 @@
 #include <limits.h>
 #include <stdbool.h>
 #include "../../../include/variable.h"
+#include "../../../include/variable_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Set property in object variable
@@ -28,7 +30,7 @@ bool variable_object_set(variable* object_var, const char* key, variable* value)
     }
     
     variable_object* obj = object_var->value.object_value;
-    if (!obj) {
+    if (!obj || !variable_object_settle(obj)) {
         return false;
     }
     
@@ -44,8 +46,8 @@ bool variable_object_set(variable* object_var, const char* key, variable* value)
     // Add new key-value pair
     if (obj->count >= obj->capacity) {
         size_t new_capacity = obj->capacity == 0 ? 8 : obj->capacity * 2;
-        variable_object_pair* new_pairs = realloc(obj->pairs, 
-                                                 new_capacity * sizeof(variable_object_pair));
+        variable_object_pair* new_pairs = xmd_realloc_tagged(obj->pairs, 
+                                                 new_capacity * sizeof(variable_object_pair), XMD_ALLOC_VARIABLE);
         if (!new_pairs) {
             return false;
         }
@@ -53,7 +55,7 @@ bool variable_object_set(variable* object_var, const char* key, variable* value)
         obj->capacity = new_capacity;
     }
     
-    obj->pairs[obj->count].key = strdup(key);
+    obj->pairs[obj->count].key = xmd_strdup(key);
     if (!obj->pairs[obj->count].key) {
         return false;
     }
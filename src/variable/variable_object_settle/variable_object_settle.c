@@ -0,0 +1,33 @@
+/**
+ * @file variable_object_settle.c
+ * @brief Variable system implementation - finish a lazily built object
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Build every value an object has not built yet and drop its source
+ *
+ * Values are built one level deep: a container value keeps drawing from
+ * the source on its own.
+ *
+ * @param object Object
+ * @return true on success, false if a value could not be built
+ */
+bool variable_object_settle(variable_object* object) {
+    if (!object->source) {
+        return true;
+    }
+    
+    for (size_t i = 0; i < object->count; i++) {
+        if (!object->pairs[i].value) {
+            object->pairs[i].value = object->source->build(object->source, object->positions[i]);
+            if (!object->pairs[i].value) {
+                return false;
+            }
+        }
+    }
+    variable_object_drop_source(object);
+    return true;
+}
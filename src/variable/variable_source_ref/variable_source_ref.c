@@ -0,0 +1,19 @@
+/**
+ * @file variable_source_ref.c
+ * @brief Variable system implementation - source reference counting
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Take a reference to a variable source
+ * @param source Source (can be NULL)
+ * @return Same source for chaining
+ */
+variable_source* variable_source_ref(variable_source* source) {
+    if (source) {
+        source->ref_count++;
+    }
+    return source;
+}
@@ -0,0 +1,23 @@
+/**
+ * @file variable_source_release.c
+ * @brief Variable system implementation - source release
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+
+/**
+ * @brief Drop a reference to a variable source, destroying it with the last
+ * @param source Source (can be NULL)
+ */
+void variable_source_release(variable_source* source) {
+    if (!source) {
+        return;
+    }
+    if (source->ref_count > 0) {
+        source->ref_count--;
+    }
+    if (source->ref_count == 0) {
+        source->destroy(source);
+    }
+}
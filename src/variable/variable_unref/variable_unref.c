@@ -8,8 +8,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "../../../include/variable.h"
+#include "../../../include/variable_internal.h"
 #include "../../../include/flow.h"
+#include "../../../include/allocator.h"
+#include "../../../include/xmd_string.h"
 
 /**
  * @brief Decrement reference count and destroy if zero
@@ -28,27 +30,23 @@ void variable_unref(variable* var) {
         // Clean up based on type
         switch (var->type) {
             case VAR_STRING:
-                free(var->value.string_value);
+                // Embedded strings go with the variable itself
+                xmd_string_release(var->value.string_value);
                 break;
                 
             case VAR_ARRAY:
-                if (var->value.array_value) {
-                    for (size_t i = 0; i < var->value.array_value->count; i++) {
-                        variable_unref(var->value.array_value->items[i]);
-                    }
-                    free(var->value.array_value->items);
-                    free(var->value.array_value);
-                }
+                variable_array_free(var->value.array_value);
                 break;
                 
             case VAR_OBJECT:
                 if (var->value.object_value) {
                     for (size_t i = 0; i < var->value.object_value->count; i++) {
-                        free(var->value.object_value->pairs[i].key);
+                        xmd_free(var->value.object_value->pairs[i].key);
                         variable_unref(var->value.object_value->pairs[i].value);
                     }
-                    free(var->value.object_value->pairs);
-                    free(var->value.object_value);
+                    xmd_free(var->value.object_value->pairs);
+                    variable_object_drop_source(var->value.object_value);
+                    xmd_free(var->value.object_value);
                 }
                 break;
                 
@@ -57,6 +55,6 @@ void variable_unref(variable* var) {
                 break;
         }
         
-        free(var);
+        xmd_free(var);
     }
 }
\ No newline at end of file
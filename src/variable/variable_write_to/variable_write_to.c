@@ -0,0 +1,47 @@
+/**
+ * @file variable_write_to.c
+ * @brief Variable system implementation - stringification into a sink
+ * @author XMD Team
+ */
+
+#include "../../../include/variable_internal.h"
+#include "../../../include/xmd_string.h"
+
+/**
+ * @brief Append a variable's string form to an output sink
+ * @param sink Output sink
+ * @param var Variable (NULL writes nothing)
+ * @return true on success, false if the sink has failed
+ */
+bool variable_write_to(xmd_sink* sink, const variable* var) {
+    if (var == NULL) {
+        return sink != NULL && !sink->failed;
+    }
+    
+    switch (var->type) {
+        case VAR_NULL:
+            return xmd_sink_append(sink, "null", 4);
+        case VAR_BOOLEAN:
+            return var->value.boolean_value ? xmd_sink_append(sink, "true", 4)
+                                             : xmd_sink_append(sink, "false", 5);
+        case VAR_NUMBER: {
+            char buffer[XMD_NUMBER_BUFFER_SIZE];
+            size_t length = xmd_format_number(var->value.number_value, buffer);
+            return xmd_sink_append(sink, buffer, length);
+        }
+        case VAR_STRING:
+            if (var->value.string_value == NULL) {
+                return xmd_sink_append(sink, "", 0);
+            }
+            return xmd_sink_append(sink, var->value.string_value,
+                                   xmd_string_length(var->value.string_value));
+        case VAR_ARRAY:
+            // Simple array representation for now
+            return xmd_sink_append(sink, "[array]", 7);
+        case VAR_OBJECT:
+            // Simple object representation for now
+            return xmd_sink_append(sink, "[object]", 8);
+    }
+    
+    return xmd_sink_append(sink, "", 0);
+}
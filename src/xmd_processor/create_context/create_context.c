@@ -7,6 +7,7 @@
 
 #define _GNU_SOURCE
 #include "../../../include/xmd_processor_internal.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Create processor context
@@ -14,7 +15,7 @@
  * @return New processor context (caller must free) or NULL on error
  */
 processor_context* create_context(store* variables) {
-    processor_context* ctx = malloc(sizeof(processor_context));
+    processor_context* ctx = xmd_malloc(sizeof(processor_context));
     if (!ctx) return NULL;
     
     ctx->variables = variables;
@@ -66,11 +67,11 @@ void set_context_source_file(processor_context* ctx, const char* file_path) {
     
     // Free existing path if any
     if (ctx->source_file_path) {
-        free(ctx->source_file_path);
+        xmd_free(ctx->source_file_path);
     }
     
     // Set new path
-    ctx->source_file_path = file_path ? strdup(file_path) : NULL;
+    ctx->source_file_path = file_path ? xmd_strdup(file_path) : NULL;
 }
 
 /**
@@ -82,7 +83,7 @@ void destroy_context(processor_context* ctx) {
     
     // Free source file path if allocated
     if (ctx->source_file_path) {
-        free(ctx->source_file_path);
+        xmd_free(ctx->source_file_path);
     }
     
     // Destroy sandbox context if allocated
@@ -91,5 +92,5 @@ void destroy_context(processor_context* ctx) {
     }
     
     // Free the context itself
-    free(ctx);
+    xmd_free(ctx);
 }
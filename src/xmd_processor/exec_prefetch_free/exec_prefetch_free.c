@@ -0,0 +1,29 @@
+/**
+ * @file exec_prefetch_free.c
+ * @brief Free an exec prefetch table
+ * @author XMD Team
+ */
+
+#include "../../../include/xmd_processor_internal.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Free a prefetch table and any outputs that were not taken
+ * @param prefetch Prefetch table (may be NULL)
+ */
+void exec_prefetch_free(exec_prefetch* prefetch) {
+    if (!prefetch) {
+        return;
+    }
+
+    for (size_t i = 0; i < prefetch->count; i++) {
+        xmd_free(prefetch->commands[i]);
+        if (prefetch->outputs) {
+            xmd_free(prefetch->outputs[i]);
+        }
+    }
+    xmd_free(prefetch->offsets);
+    xmd_free(prefetch->commands);
+    xmd_free(prefetch->outputs);
+    xmd_free(prefetch);
+}
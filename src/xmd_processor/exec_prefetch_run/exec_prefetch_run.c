@@ -0,0 +1,135 @@
+/**
+ * @file exec_prefetch_run.c
+ * @brief Run prefetched exec commands on a bounded set of worker threads
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include "../../../include/xmd_processor_internal.h"
+#include "../../../include/platform.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Shared work queue for prefetch workers
+ */
+typedef struct {
+    exec_prefetch* prefetch;
+    size_t next;
+    xmd_mutex_t lock;
+} exec_prefetch_queue;
+
+/**
+ * @brief Execute one command, stripping a single trailing newline like exec()
+ * @param command Command to execute
+ * @return Captured output (caller must free) or NULL
+ */
+static char* run_command(const char* command) {
+    char* output = execute_command_dynamic(command, NULL);
+    if (output) {
+        size_t len = strlen(output);
+        if (len > 0 && output[len - 1] == '\n') {
+            output[len - 1] = '\0';
+        }
+    }
+    return output;
+}
+
+#ifndef XMD_PLATFORM_WINDOWS
+/**
+ * @brief Worker loop: claim the next command until the queue is drained
+ * @param arg Shared queue
+ * @return NULL
+ */
+static void* prefetch_worker(void* arg) {
+    exec_prefetch_queue* queue = arg;
+    for (;;) {
+        xmd_mutex_lock(&queue->lock);
+        size_t index = queue->next++;
+        xmd_mutex_unlock(&queue->lock);
+        if (index >= queue->prefetch->count) {
+            return NULL;
+        }
+        // Each slot is written by exactly one worker
+        queue->prefetch->outputs[index] = run_command(queue->prefetch->commands[index]);
+    }
+}
+#endif
+
+/**
+ * @brief Charge the render's heap budget for outputs made on worker threads
+ *
+ * Workers run without the render's budget, so their outputs are charged
+ * here, on the render thread, before the main pass takes and frees them.
+ * An output the budget cannot take is dropped uncharged; its directive
+ * then runs in the main pass, where the budget stops it.
+ *
+ * @param prefetch Prefetch table
+ */
+static void adopt_outputs(exec_prefetch* prefetch) {
+    for (size_t i = 0; i < prefetch->count; i++) {
+        char* output = prefetch->outputs[i];
+        if (output && !xmd_heap_budget_adopt(output, strlen(output) + 1)) {
+            xmd_heap_budget* budget = xmd_heap_budget_attach(NULL);
+            xmd_free(output);
+            xmd_heap_budget_attach(budget);
+            prefetch->outputs[i] = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Execute all collected commands with at most max_parallel in flight
+ *
+ * Outputs land in their directive's slot, so document order is preserved
+ * regardless of completion order. Slots left NULL fall back to sequential
+ * execution in the main pass.
+ *
+ * @param prefetch Prefetch table from exec_prefetch_scan
+ * @param max_parallel Maximum number of concurrent commands
+ */
+void exec_prefetch_run(exec_prefetch* prefetch, size_t max_parallel) {
+    if (!prefetch || prefetch->count == 0 || max_parallel < 2) {
+        return;
+    }
+
+    size_t worker_count = max_parallel < prefetch->count ? max_parallel : prefetch->count;
+
+#ifndef XMD_PLATFORM_WINDOWS
+    exec_prefetch_queue queue = { .prefetch = prefetch, .next = 0 };
+    if (xmd_mutex_init(&queue.lock) != 0) {
+        return;
+    }
+
+    xmd_thread_t* workers = xmd_malloc(worker_count * sizeof(xmd_thread_t));
+    if (!workers) {
+        xmd_mutex_destroy(&queue.lock);
+        return;
+    }
+
+    size_t started = 0;
+    for (; started < worker_count; started++) {
+        if (pthread_create(&workers[started], NULL, prefetch_worker, &queue) != 0) {
+            break;
+        }
+    }
+    if (started == 0) {
+        // No threads available: drain the queue on this thread, which is
+        // charged for the outputs below like the workers' are
+        xmd_heap_budget* budget = xmd_heap_budget_attach(NULL);
+        prefetch_worker(&queue);
+        xmd_heap_budget_attach(budget);
+    }
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    xmd_free(workers);
+    xmd_mutex_destroy(&queue.lock);
+    adopt_outputs(prefetch);
+#else
+    (void)worker_count;
+    for (size_t i = 0; i < prefetch->count; i++) {
+        prefetch->outputs[i] = run_command(prefetch->commands[i]);
+    }
+#endif
+}
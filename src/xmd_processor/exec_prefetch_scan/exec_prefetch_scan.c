@@ -0,0 +1,124 @@
+/**
+ * @file exec_prefetch_scan.c
+ * @brief Collect independent exec directives for concurrent execution
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include "../../../include/xmd_processor_internal.h"
+#include "../../../include/security.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
+
+/**
+ * @brief Check whether an exec command can run ahead of the main pass
+ * @param command Trimmed command text
+ * @return true if the command neither reads variables nor needs literal handling
+ */
+static bool is_independent_command(const char* command) {
+    if (!*command || *command == '"' || *command == '\'') {
+        return false;
+    }
+    // Variable references and escape sequences are resolved by the evaluator
+    if (strstr(command, "{{") || strchr(command, '\\')) {
+        return false;
+    }
+    return security_validate_command(command) == SECURITY_VALID;
+}
+
+/**
+ * @brief Scan preprocessed input for exec directives that can run concurrently
+ *
+ * Only execs outside if/for blocks are collected, so every prefetched command
+ * is one the sequential pass would run exactly once anyway.
+ *
+ * @param input Preprocessed XMD content
+ * @return Prefetch table (caller must free) or NULL if nothing qualifies
+ */
+exec_prefetch* exec_prefetch_scan(const char* input) {
+    if (!input) {
+        return NULL;
+    }
+
+    exec_prefetch* prefetch = xmd_calloc(1, sizeof(exec_prefetch));
+    if (!prefetch) {
+        return NULL;
+    }
+
+    size_t capacity = 0;
+    int if_depth = 0;
+    int for_depth = 0;
+    const char* ptr = input;
+    const char* comment_start;
+
+    while ((comment_start = strstr(ptr, "<!--")) != NULL) {
+        const char* comment_end = strstr(comment_start + 4, "-->");
+        if (!comment_end) {
+            break;
+        }
+        ptr = comment_end + 3;
+
+        const char* dir = comment_start + 4;
+        while (*dir == ' ' || *dir == '\t' || *dir == '\n') dir++;
+        if (strncmp(dir, "xmd:", 4) != 0) {
+            continue;
+        }
+        dir += 4;
+        while (*dir == ' ' || *dir == '\t') dir++;
+
+        if (strncmp(dir, "if ", 3) == 0) {
+            if_depth++;
+        } else if (strncmp(dir, "endif", 5) == 0) {
+            if (if_depth > 0) if_depth--;
+        } else if (strncmp(dir, "for ", 4) == 0) {
+            for_depth++;
+        } else if (strncmp(dir, "endfor", 6) == 0) {
+            if (for_depth > 0) for_depth--;
+        } else if (strncmp(dir, "exec ", 5) == 0 && if_depth == 0 && for_depth == 0) {
+            const char* cmd = dir + 5;
+            while (*cmd == ' ' || *cmd == '\t') cmd++;
+            size_t len = comment_end - cmd;
+            while (len > 0 && isspace((unsigned char)cmd[len - 1])) len--;
+
+            char* command = xmd_strndup(cmd, len);
+            if (!command) {
+                break;
+            }
+            if (!is_independent_command(command)) {
+                xmd_free(command);
+                continue;
+            }
+
+            if (prefetch->count == capacity) {
+                size_t new_capacity = capacity ? capacity * 2 : 8;
+                size_t* offsets = xmd_realloc(prefetch->offsets, new_capacity * sizeof(size_t));
+                if (offsets) prefetch->offsets = offsets;
+                char** commands = xmd_realloc(prefetch->commands, new_capacity * sizeof(char*));
+                if (commands) prefetch->commands = commands;
+                if (!offsets || !commands) {
+                    xmd_free(command);
+                    break;
+                }
+                capacity = new_capacity;
+            }
+            // Workers run the commands; the scan runs on the render thread
+            build_inputs_record_command(command);
+            prefetch->offsets[prefetch->count] = (size_t)(comment_start - input);
+            prefetch->commands[prefetch->count] = command;
+            prefetch->count++;
+        }
+    }
+
+    if (prefetch->count == 0) {
+        exec_prefetch_free(prefetch);
+        return NULL;
+    }
+
+    prefetch->outputs = xmd_calloc(prefetch->count, sizeof(char*));
+    if (!prefetch->outputs) {
+        exec_prefetch_free(prefetch);
+        return NULL;
+    }
+    return prefetch;
+}
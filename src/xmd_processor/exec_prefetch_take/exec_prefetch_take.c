@@ -0,0 +1,38 @@
+/**
+ * @file exec_prefetch_take.c
+ * @brief Claim the prefetched output for an exec directive
+ * @author XMD Team
+ */
+
+#include "../../../include/xmd_processor_internal.h"
+
+/**
+ * @brief Take ownership of the output prefetched for a directive
+ * @param prefetch Prefetch table (may be NULL)
+ * @param offset Offset of the directive's "<!--" in the scanned input
+ * @return Output (caller must free) or NULL if the directive was not prefetched
+ */
+char* exec_prefetch_take(exec_prefetch* prefetch, size_t offset) {
+    if (!prefetch) {
+        return NULL;
+    }
+
+    // Offsets are ascending, so binary search
+    size_t low = 0;
+    size_t high = prefetch->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (prefetch->offsets[mid] < offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low == prefetch->count || prefetch->offsets[low] != offset) {
+        return NULL;
+    }
+
+    char* output = prefetch->outputs[low];
+    prefetch->outputs[low] = NULL;
+    return output;
+}
@@ -9,6 +9,8 @@
 #include <stdio.h>
 #include <sys/wait.h>
 #include "../../../include/xmd_processor_internal.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Execute command and capture output
@@ -32,12 +34,14 @@ int execute_command(const char* command, char* output, size_t output_size) {
         return -1;
     }
     
+    build_inputs_record_command(command);
+    
     // Redirect stderr to stdout to capture error messages too
-    char* full_command = malloc(strlen(command) + 8); // +8 for " 2>&1" + null
+    char* full_command = xmd_malloc(strlen(command) + 8); // +8 for " 2>&1" + null
     sprintf(full_command, "%s 2>&1", command);
     
     FILE* pipe = popen(full_command, "r");
-    free(full_command);
+    xmd_free(full_command);
     if (!pipe) {
         snprintf(output, output_size, "[Error: Failed to execute command]");
         return -1;
@@ -45,7 +49,7 @@ int execute_command(const char* command, char* output, size_t output_size) {
     
     // Use dynamic buffer allocation for reading all output
     size_t buffer_capacity = 4096;  // Start with initial capacity
-    char* temp_buffer = malloc(buffer_capacity);
+    char* temp_buffer = xmd_malloc(buffer_capacity);
     if (!temp_buffer) {
         pclose(pipe);
         snprintf(output, output_size, "[Error: Memory allocation failed]");
@@ -59,9 +63,9 @@ int execute_command(const char* command, char* output, size_t output_size) {
         // Ensure we have space for the next chunk plus null terminator
         if (total_read + chunk_size + 1 > buffer_capacity) {
             buffer_capacity *= 2;
-            char* new_buffer = realloc(temp_buffer, buffer_capacity);
+            char* new_buffer = xmd_realloc(temp_buffer, buffer_capacity);
             if (!new_buffer) {
-                free(temp_buffer);
+                xmd_free(temp_buffer);
                 pclose(pipe);
                 snprintf(output, output_size, "[Error: Memory reallocation failed]");
                 return -1;
@@ -98,7 +102,7 @@ int execute_command(const char* command, char* output, size_t output_size) {
     output[copy_size] = '\0';
     
     // Clean up
-    free(temp_buffer);
+    xmd_free(temp_buffer);
     int status = pclose(pipe);
     
     return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
@@ -117,19 +121,20 @@ char* execute_command_dynamic(const char* command, int* exit_status) {
         return NULL;
     }
     
+    build_inputs_record_command(command);
     FILE* pipe = popen(command, "r");
     if (!pipe) {
         if (exit_status) *exit_status = -1;
-        return strdup("[Error: Failed to execute command]");
+        return xmd_strdup("[Error: Failed to execute command]");
     }
     
     // Start with a reasonable initial capacity and grow as needed
     size_t buffer_capacity = 8192;  // Start with 8KB
-    char* buffer = malloc(buffer_capacity);
+    char* buffer = xmd_malloc(buffer_capacity);
     if (!buffer) {
         pclose(pipe);
         if (exit_status) *exit_status = -1;
-        return strdup("[Error: Memory allocation failed]");
+        return xmd_strdup("[Error: Memory allocation failed]");
     }
     
     size_t total_read = 0;
@@ -139,12 +144,12 @@ char* execute_command_dynamic(const char* command, int* exit_status) {
         // Ensure we have space for the next chunk plus null terminator
         while (total_read + chunk_size + 1 > buffer_capacity) {
             buffer_capacity *= 2;
-            char* new_buffer = realloc(buffer, buffer_capacity);
+            char* new_buffer = xmd_realloc(buffer, buffer_capacity);
             if (!new_buffer) {
-                free(buffer);
+                xmd_free(buffer);
                 pclose(pipe);
                 if (exit_status) *exit_status = -1;
-                return strdup("[Error: Memory reallocation failed]");
+                return xmd_strdup("[Error: Memory reallocation failed]");
             }
             buffer = new_buffer;
         }
@@ -162,7 +167,7 @@ char* execute_command_dynamic(const char* command, int* exit_status) {
     
     // Shrink buffer to actual size needed (optional optimization)
     if (total_read + 1 < buffer_capacity / 2) {
-        char* final_buffer = realloc(buffer, total_read + 1);
+        char* final_buffer = xmd_realloc(buffer, total_read + 1);
         if (final_buffer) {
             buffer = final_buffer;
         }
@@ -9,6 +9,8 @@
 #include <stdio.h>
 #include <string.h>
 #include "../../../include/xmd_processor_internal.h"
+#include "../../../include/performance.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process exec directive
@@ -42,12 +44,14 @@ int process_exec(const char* args, processor_context* ctx, char* output, size_t
     // Check sandbox permissions before executing command
     if (ctx->sandbox_ctx && !sandbox_check_command_allowed(ctx->sandbox_ctx, expanded)) {
         snprintf(output, output_size, "[Error: Command blocked by sandbox security policy]");
-        free(expanded);
+        xmd_free(expanded);
         return -1;
     }
     
+    PERF_STAGE_BEGIN(PERF_STAGE_EXEC);
     int result = execute_command(expanded, output, output_size);
-    free(expanded);
+    PERF_STAGE_END(PERF_STAGE_EXEC);
+    xmd_free(expanded);
     return result;
 }
 
@@ -64,7 +68,7 @@ char* process_exec_dynamic(const char* args, processor_context* ctx) {
     }
     
     if (!should_execute_block(ctx)) {
-        return strdup("");  // Return empty string for consistency
+        return xmd_strdup("");  // Return empty string for consistency
     }
     
     // Substitute variables in command
@@ -75,11 +79,11 @@ char* process_exec_dynamic(const char* args, processor_context* ctx) {
     
     // Check sandbox permissions before executing command
     if (ctx->sandbox_ctx && !sandbox_check_command_allowed(ctx->sandbox_ctx, expanded)) {
-        free(expanded);
-        return strdup("[Error: Command blocked by sandbox security policy]");
+        xmd_free(expanded);
+        return xmd_strdup("[Error: Command blocked by sandbox security policy]");
     }
     
     char* result = execute_command_dynamic(expanded, NULL);
-    free(expanded);
+    xmd_free(expanded);
     return result;
 }
@@ -13,6 +13,9 @@
 #include "../../../include/xmd_processor_internal.h"
 #include "../../../include/ast_evaluator.h"
 #include "../../../include/sandbox.h"
+#include "../../../include/performance.h"
+#include "../../../include/build_cache.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process import directive
@@ -34,7 +37,7 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
     #endif
     
     // Parse filename from args (remove quotes if present)
-    char* filename = strdup(args);
+    char* filename = xmd_strdup(args);
     char* trimmed_filename = trim_whitespace(filename);
     
     // Remove quotes if present
@@ -52,26 +55,26 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
         FILE* test_file = fopen(trimmed_filename, "r");
         if (test_file) {
             fclose(test_file);
-            resolved_path = strdup(trimmed_filename);
+            resolved_path = xmd_strdup(trimmed_filename);
         } else {
             // Strategy 2: Use source_file_path for truly relative imports
             if (ctx->source_file_path) {
-                char* source_dir = strdup(ctx->source_file_path);
+                char* source_dir = xmd_strdup(ctx->source_file_path);
                 char* last_slash = strrchr(source_dir, '/');
                 if (last_slash) {
                     *last_slash = '\0'; // Remove filename, keep directory
                     
                     // Build resolved path: source_dir + "/" + trimmed_filename
                     size_t resolved_len = strlen(source_dir) + strlen(trimmed_filename) + 2;
-                    char* temp_path = malloc(resolved_len);
+                    char* temp_path = xmd_malloc(resolved_len);
                     if (temp_path) {
                         snprintf(temp_path, resolved_len, "%s/%s", source_dir, trimmed_filename);
                         // Normalize the path to resolve .. components
                         resolved_path = normalize_path(temp_path);
-                        free(temp_path);
+                        xmd_free(temp_path);
                     }
                 }
-                free(source_dir);
+                xmd_free(source_dir);
             }
         }
         
@@ -81,20 +84,20 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
             char* cwd = getcwd(NULL, 0);
             if (cwd) {
                 size_t resolved_len = strlen(cwd) + strlen(trimmed_filename) + 2;
-                resolved_path = malloc(resolved_len);
+                resolved_path = xmd_malloc(resolved_len);
                 if (resolved_path) {
                     snprintf(resolved_path, resolved_len, "%s/%s", cwd, trimmed_filename);
                     
                     // Check if file exists
                     FILE* test_file = fopen(resolved_path, "r");
                     if (!test_file) {
-                        free(resolved_path);
+                        xmd_free(resolved_path);
                         resolved_path = NULL;
                     } else {
                         fclose(test_file);
                     }
                 }
-                free(cwd);
+                free(cwd);  // allocated by libc, not xmd_malloc
             }
         }
         
@@ -111,7 +114,7 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
             
             for (int i = 0; common_paths[i] && !resolved_path; i++) {
                 size_t resolved_len = strlen(common_paths[i]) + strlen(trimmed_filename) + 1;
-                char* test_path = malloc(resolved_len);
+                char* test_path = xmd_malloc(resolved_len);
                 if (test_path) {
                     snprintf(test_path, resolved_len, "%s%s", common_paths[i], trimmed_filename);
                     
@@ -121,7 +124,7 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
                         fclose(test_file);
                         resolved_path = test_path; // File found!
                     } else {
-                        free(test_path);
+                        xmd_free(test_path);
                     }
                 }
             }
@@ -136,9 +139,11 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
     // Read and process the imported file
     FILE* file = fopen(import_path, "r");
     if (!file) {
+        // A build must notice when the missing file appears
+        build_inputs_record_file(import_path, NULL, 0);
         snprintf(output, output_size, "<!-- Error: Could not import file '%s' -->", import_path);
-        free(filename);
-        if (resolved_path) free(resolved_path);
+        xmd_free(filename);
+        if (resolved_path) xmd_free(resolved_path);
         return 0;
     }
     
@@ -146,8 +151,8 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
     if (ctx->source_file_path && strcmp(import_path, ctx->source_file_path) == 0) {
         snprintf(output, output_size, "<!-- Circular import detected: %s imports itself -->", import_path);
         fclose(file);
-        free(filename);
-        if (resolved_path) free(resolved_path);
+        xmd_free(filename);
+        if (resolved_path) xmd_free(resolved_path);
         return 0;
     }
     
@@ -156,31 +161,36 @@ int process_import(const char* args, processor_context* ctx, char* output, size_
     long file_size = ftell(file);
     fseek(file, 0, SEEK_SET);
     
-    char* file_content = malloc(file_size + 1);
+    char* file_content = xmd_malloc(file_size + 1);
     if (file_content) {
         size_t read_size = fread(file_content, 1, file_size, file);
         file_content[read_size] = '\0';
+        build_inputs_record_file(import_path, file_content, read_size);
         
         // Save current source file and set new one for nested imports
         char* prev_source_file = ctx->source_file_path;
-        ctx->source_file_path = strdup(import_path);
+        ctx->source_file_path = xmd_strdup(import_path);
         
-        // Process the imported content recursively
+        // Process the imported content recursively, profiling its
+        // directives as frames of the imported file
+        source_location import_origin = {1, 1, import_path};
+        source_location outer_origin = perf_hotspot_set_origin(xmd_active_profiler, import_origin);
         char* processed_content = ast_process_xmd_content(file_content, ctx->variables);
+        perf_hotspot_set_origin(xmd_active_profiler, outer_origin);
         
         // Restore previous source file
-        free(ctx->source_file_path);
+        xmd_free(ctx->source_file_path);
         ctx->source_file_path = prev_source_file;
         if (processed_content) {
             strncpy(output, processed_content, output_size - 1);
             output[output_size - 1] = '\0';
-            free(processed_content);
+            xmd_free(processed_content);
         }
-        free(file_content);
+        xmd_free(file_content);
     }
     
     fclose(file);
-    free(filename);
-    if (resolved_path) free(resolved_path);
+    xmd_free(filename);
+    if (resolved_path) xmd_free(resolved_path);
     return 0;
 }
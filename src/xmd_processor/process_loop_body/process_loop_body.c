@@ -10,6 +10,7 @@
 #include <string.h>
 #include "../../../include/xmd_processor_internal.h"
 #include "../../../include/loop.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process loop body content
@@ -41,7 +42,7 @@ int process_loop_body(const char* content, processor_context* ctx, LoopContext*
     
     // For now, just set the processed content as output
     // In a full implementation, this would append to a result buffer
-    free(processed_content);
+    xmd_free(processed_content);
     
     return LOOP_SUCCESS;
 }
\ No newline at end of file
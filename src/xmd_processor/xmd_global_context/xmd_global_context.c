@@ -9,6 +9,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include "../../../include/allocator.h"
 
 // Thread-local storage for current file path
 static __thread char* g_current_file_path = NULL;
@@ -19,11 +20,11 @@ static __thread char* g_current_file_path = NULL;
  */
 void xmd_set_current_file_path(const char* path) {
     if (g_current_file_path) {
-        free(g_current_file_path);
+        xmd_free(g_current_file_path);
         g_current_file_path = NULL;
     }
     if (path) {
-        g_current_file_path = strdup(path);
+        g_current_file_path = xmd_strdup(path);
     }
 }
 
@@ -40,7 +41,7 @@ const char* xmd_get_current_file_path(void) {
  */
 void xmd_clear_current_file_path(void) {
     if (g_current_file_path) {
-        free(g_current_file_path);
+        xmd_free(g_current_file_path);
         g_current_file_path = NULL;
     }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string.h>
 #include "../../../include/xmd.h"
 #include "../../../include/cli.h"
+#include "../../../include/allocator.h"
 
 /**
  * @brief Process file through XMD main API
@@ -23,11 +24,11 @@ xmd_result* xmd_process_file(xmd_processor* processor,
     // Read file content
     FILE* file = fopen(input_path, "r");
     if (!file) {
-        xmd_result* result = malloc(sizeof(xmd_result));
+        xmd_result* result = xmd_malloc(sizeof(xmd_result));
         if (result) {
             result->error_code = -1;
             result->output = NULL;
-            result->error_message = strdup("Failed to open file");
+            result->error_message = xmd_strdup("Failed to open file");
         }
         return result;
     }
@@ -39,17 +40,17 @@ xmd_result* xmd_process_file(xmd_processor* processor,
     
     if (size <= 0) {
         fclose(file);
-        xmd_result* result = malloc(sizeof(xmd_result));
+        xmd_result* result = xmd_malloc(sizeof(xmd_result));
         if (result) {
             result->error_code = -1;
             result->output = NULL;
-            result->error_message = strdup("Empty or invalid file");
+            result->error_message = xmd_strdup("Empty or invalid file");
         }
         return result;
     }
     
     // Read content
-    char* content = malloc(size + 1);
+    char* content = xmd_malloc(size + 1);
     if (!content) {
         fclose(file);
         return NULL;
@@ -61,7 +62,7 @@ xmd_result* xmd_process_file(xmd_processor* processor,
     
     // Process using string processor
     xmd_result* result = xmd_process_string(processor, content, read_size);
-    free(content);
+    xmd_free(content);
     
     return result;
 }
\ No newline at end of file
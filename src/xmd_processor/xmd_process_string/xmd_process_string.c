@@ -11,12 +11,19 @@
 #include "../../../include/xmd.h"
 #include "../../../include/cli.h"
 #include "../../../include/store.h"
+#include "../../../include/c_api_internal.h"
+#include "../../../include/ast_parse_cache.h"
+#include "../../../include/allocator.h"
 
 // Forward declaration for AST processor
 char* ast_process_xmd_content(const char* input, store* variables);
 
 /**
  * @brief Process string through XMD main API
+ *
+ * The render runs under a heap budget: result->memory_used_bytes is its
+ * peak live heap, and a render that would exceed the processor's memory
+ * limit fails with XMD_ERROR_OUT_OF_MEMORY and no output.
  */
 xmd_result* xmd_process_string(xmd_processor* processor, 
                                const char* input, 
@@ -26,27 +33,36 @@ xmd_result* xmd_process_string(xmd_processor* processor,
     }
     
     // Create result structure
-    xmd_result* result = malloc(sizeof(xmd_result));
+    xmd_result* result = xmd_calloc(1, sizeof(xmd_result));
     if (!result) {
         return NULL;
     }
     
-    // Initialize result
-    result->error_code = 0;
-    result->output = NULL;
-    result->error_message = NULL;
-    
     // Process content using AST processor
-    // Cast processor back to store* as that's how it's implemented
-    store* variables = (store*)processor;
-    char* output = ast_process_xmd_content(input, variables);
-    if (output) {
+    xmd_heap_budget budget;
+    xmd_heap_budget_init(&budget, processor->memory_limit_bytes);
+    xmd_heap_budget* previous = xmd_heap_budget_attach(&budget);
+    ast_parse_cache* previous_expressions = ast_parse_cache_attach(processor->expressions);
+    char* output = ast_process_xmd_content(input, processor->variables);
+    ast_parse_cache_attach(previous_expressions);
+    xmd_heap_budget_attach(previous);
+    result->memory_used_bytes = budget.peak_bytes;
+    
+    if (budget.exceeded) {
+        xmd_free(output);
+        char message[96];
+        snprintf(message, sizeof(message), "Render exceeded the memory limit of %llu MB",
+                 (unsigned long long)(processor->memory_limit_bytes / (1024 * 1024)));
+        result->error_code = XMD_ERROR_OUT_OF_MEMORY;
+        result->error_message = xmd_strdup(message);
+    } else if (output) {
         result->output = output;
+        result->output_length = strlen(output);
         result->error_code = 0;
     } else {
         result->error_code = -1;
-        result->error_message = strdup("Processing failed");
+        result->error_message = xmd_strdup("Processing failed");
     }
     
     return result;
-}
\ No newline at end of file
+}
@@ -0,0 +1,118 @@
+/**
+ * @file test_c_api_globals.c
+ * @brief Test shared global variables in the C API
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "../../include/c_api_internal.h"
+#include "../../include/variable.h"
+
+/**
+ * @brief Renders read globals in place and keep assignments local
+ */
+void test_globals_overlay() {
+    printf("Testing global variable overlay...\n");
+
+    xmd_context_internal* ctx = c_api_xmd_init(NULL);
+    assert(ctx != NULL);
+
+    assert(c_api_xmd_set_variable(ctx, "site", "docs") == 0);
+    variable* site = store_get(ctx->global_variables, "site");
+    assert(site != NULL && site->ref_count == 1);
+
+    variable* versions = variable_create_array();
+    variable* v1 = variable_create_string("1.0");
+    variable_array_add(versions, v1);
+    variable_unref(v1);
+    assert(c_api_xmd_set_global(ctx, "versions", versions) == 0);
+    assert(versions->ref_count == 2);
+
+    const char* shadow = "<!-- xmd:set site = \"local\" -->\nsite={{site}}\n";
+    const char* plain = "site={{site}}\n";
+    for (int i = 0; i < 3; i++) {
+        xmd_result* result = xmd_process_string_api(ctx, shadow, strlen(shadow));
+        assert(result != NULL && result->error_code == 0);
+        assert(strstr(result->output, "site=local") != NULL);
+        c_api_xmd_result_free(result);
+
+        // The previous render's assignment did not reach the globals
+        result = xmd_process_string_api(ctx, plain, strlen(plain));
+        assert(result != NULL && result->error_code == 0);
+        assert(strstr(result->output, "site=docs") != NULL);
+        c_api_xmd_result_free(result);
+    }
+
+    // Globals are untouched and still typed after rendering
+    assert(store_get(ctx->global_variables, "site") == site);
+    assert(strcmp(site->value.string_value, "docs") == 0);
+    assert(site->ref_count == 1);
+    assert(store_get(ctx->global_variables, "versions") == versions);
+    assert(versions->type == VAR_ARRAY);
+    assert(versions->ref_count == 2);
+
+    variable_unref(versions);
+    c_api_xmd_cleanup(ctx);
+
+    printf("✓ Global variable overlay test passed\n");
+}
+
+/**
+ * @brief Render a loop over the shared globals several times
+ */
+static void* render_globals(void* handle) {
+    const char* loop = "<!-- xmd:for v in versions -->[{{v}}]<!-- xmd:endfor -->{{site}}";
+    for (int i = 0; i < 200; i++) {
+        xmd_result* result = xmd_process_string_api(handle, loop, strlen(loop));
+        assert(result != NULL && result->error_code == 0);
+        assert(strcmp(result->output, "[1.0][2.0]docs") == 0);
+        c_api_xmd_result_free(result);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Threads sharing a context take turns instead of racing on its globals
+ */
+void test_globals_concurrent_renders() {
+    printf("Testing concurrent renders on one context...\n");
+
+    xmd_context_internal* ctx = c_api_xmd_init(NULL);
+    assert(ctx != NULL);
+    assert(c_api_xmd_set_variable(ctx, "site", "docs") == 0);
+    variable* versions = variable_create_array();
+    variable_array_add_string(versions, "1.0", 3);
+    variable_array_add_string(versions, "2.0", 3);
+    assert(c_api_xmd_set_global(ctx, "versions", versions) == 0);
+
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        assert(pthread_create(&threads[i], NULL, render_globals, ctx) == 0);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // Every reference the renders took was dropped again
+    assert(versions->ref_count == 2);
+    assert(store_get(ctx->global_variables, "site")->ref_count == 1);
+
+    variable_unref(versions);
+    c_api_xmd_cleanup(ctx);
+
+    printf("✓ Concurrent render test passed\n");
+}
+
+int main() {
+    printf("=== C API Globals Tests ===\n");
+
+    test_globals_overlay();
+    test_globals_concurrent_renders();
+
+    printf("\n✅ All C API globals tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file test_memory_limit.c
+ * @brief Test per-render heap accounting and the sandbox memory limit
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/c_api_internal.h"
+#include "../../include/allocator.h"
+
+/** Four nested loops over ten items: ten thousand rows of output */
+static const char* runaway =
+    "<!-- xmd:set items = [\"0\", \"1\", \"2\", \"3\", \"4\", \"5\", \"6\", \"7\", \"8\", \"9\"] -->\n"
+    "<!-- xmd:for a in items -->"
+    "<!-- xmd:for b in items -->"
+    "<!-- xmd:for c in items -->"
+    "<!-- xmd:for d in items -->"
+    "row {{a}}{{b}}{{c}}{{d}} ........................................................................\n"
+    "<!-- xmd:endfor -->"
+    "<!-- xmd:endfor -->"
+    "<!-- xmd:endfor -->"
+    "<!-- xmd:endfor -->\n";
+
+static const char* small = "<!-- xmd:set name = \"world\" -->\nhello {{name}}\n";
+
+/**
+ * @brief Create a configuration with a sandbox memory limit
+ * @param max_memory_mb Limit in MB
+ * @return Configuration
+ */
+static xmd_config* limited_config(uint32_t max_memory_mb) {
+    xmd_config* config = config_create();
+    assert(config != NULL);
+    config->sandbox = xmd_calloc(1, sizeof(xmd_sandbox_config));
+    assert(config->sandbox != NULL);
+    config->sandbox->max_memory_mb = max_memory_mb;
+    return config;
+}
+
+/**
+ * @brief The processor API reports peak heap and enforces the limit
+ */
+void test_processor_limit() {
+    printf("Testing processor memory limit...\n");
+
+    xmd_config* config = limited_config(1);
+    xmd_processor* processor = xmd_processor_create(config);
+    assert(processor != NULL);
+
+    xmd_result* result = xmd_process_string(processor, small, strlen(small));
+    assert(result != NULL && result->error_code == XMD_SUCCESS);
+    assert(strstr(result->output, "hello world") != NULL);
+    assert(result->output_length == strlen(result->output));
+    assert(result->memory_used_bytes > 0);
+    assert(result->memory_used_bytes < 1024 * 1024);
+    xmd_result_free(result);
+
+    result = xmd_process_string(processor, runaway, strlen(runaway));
+    assert(result != NULL && result->error_code == XMD_ERROR_OUT_OF_MEMORY);
+    assert(result->output == NULL);
+    assert(strstr(result->error_message, "1 MB") != NULL);
+    assert(result->memory_used_bytes <= 1024 * 1024 + 4096);
+    xmd_result_free(result);
+
+    // The next render starts from a fresh budget
+    result = xmd_process_string(processor, small, strlen(small));
+    assert(result != NULL && result->error_code == XMD_SUCCESS);
+    xmd_result_free(result);
+    assert(!xmd_heap_budget_exhausted());
+
+    xmd_processor_free(processor);
+
+    // Without a sandbox limit the same document renders in full
+    processor = xmd_processor_create(NULL);
+    assert(processor != NULL);
+    result = xmd_process_string(processor, runaway, strlen(runaway));
+    assert(result != NULL && result->error_code == XMD_SUCCESS);
+    assert(strstr(result->output, "row 9999") != NULL);
+    assert(result->memory_used_bytes > 1024 * 1024);
+    xmd_result_free(result);
+    xmd_processor_free(processor);
+    config_destroy(config);
+
+    printf("✓ Processor memory limit test passed\n");
+}
+
+/**
+ * @brief C API contexts apply their configuration's sandbox limit
+ */
+void test_context_limit() {
+    printf("Testing context memory limit...\n");
+
+    xmd_context_internal* ctx = c_api_xmd_init(NULL);
+    assert(ctx != NULL);
+    ctx->config->sandbox = xmd_calloc(1, sizeof(xmd_sandbox_config));
+    assert(ctx->config->sandbox != NULL);
+    ctx->config->sandbox->max_memory_mb = 1;
+
+    xmd_result* result = xmd_process_string_api(ctx, runaway, strlen(runaway));
+    assert(result != NULL && result->error_code == XMD_ERROR_OUT_OF_MEMORY);
+    assert(result->output == NULL);
+    c_api_xmd_result_free(result);
+
+    result = xmd_process_string_api(ctx, small, strlen(small));
+    assert(result != NULL && result->error_code == XMD_SUCCESS);
+    assert(result->memory_used_bytes > 0);
+    c_api_xmd_result_free(result);
+
+    c_api_xmd_cleanup(ctx);
+    printf("✓ Context memory limit test passed\n");
+}
+
+int main() {
+    printf("=== Memory Limit Tests ===\n");
+
+    test_processor_limit();
+    test_context_limit();
+
+    printf("\n✅ All memory limit tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file test_build_cache.c
+ * @brief Test the incremental build cache
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <utime.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "../../include/build_cache.h"
+#include "../../include/store.h"
+#include "../../include/allocator.h"
+
+#define ROOT "/tmp/xmd_test_build"
+
+/**
+ * @brief Write a file, replacing its content
+ */
+static void write_file(const char* path, const char* content) {
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs(content, file);
+    fclose(file);
+}
+
+/**
+ * @brief Read a whole small file
+ */
+static char* read_file(const char* path) {
+    static char buffer[4096];
+    FILE* file = fopen(path, "r");
+    assert(file != NULL);
+    size_t length = fread(buffer, 1, sizeof(buffer) - 1, file);
+    buffer[length] = '\0';
+    fclose(file);
+    return buffer;
+}
+
+/**
+ * @brief Backdate a file so a rewrite is visible in its modification time
+ */
+static void backdate(const char* path) {
+    struct utimbuf times = { 1000000, 1000000 };
+    assert(utime(path, &times) == 0);
+}
+
+static time_t mtime_of(const char* path) {
+    struct stat st;
+    assert(stat(path, &st) == 0);
+    return st.st_mtime;
+}
+
+/**
+ * @brief Import changes invalidate an entry; everything else is skipped
+ */
+void test_import_closure() {
+    printf("Testing import closure tracking...\n");
+
+    assert(system("rm -rf " ROOT " && mkdir -p " ROOT "/src") == 0);
+    write_file(ROOT "/src/part.txt", "Part A\n");
+    write_file(ROOT "/src/page.md", "<!-- xmd:set name = \"world\" -->\nhello {{name}}\n"
+                                    "<!-- xmd:import " ROOT "/src/part.txt -->\n");
+
+    store* variables = store_create();
+    build_cache* cache = build_cache_open(ROOT "/cache", 1);
+    assert(variables != NULL && cache != NULL);
+    const char* out = ROOT "/out/nested/page.md";
+
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_RENDERED);
+    assert(strstr(read_file(out), "hello world") && strstr(read_file(out), "Part A"));
+    // The document's own assignment stays in its scope
+    assert(store_get(variables, "name") == NULL);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_CACHED);
+
+    // Editing an import rebuilds the importer
+    write_file(ROOT "/src/part.txt", "Part B\n");
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_RENDERED);
+    assert(strstr(read_file(out), "Part B") != NULL);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_CACHED);
+
+    // So does editing or deleting the output, or changing the options
+    write_file(out, "tampered\n");
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_RENDERED);
+    remove(out);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_RENDERED);
+    build_cache_close(cache);
+    cache = build_cache_open(ROOT "/cache", 2);
+    assert(cache != NULL);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_UNCHANGED);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/page.md", out) == BUILD_FILE_CACHED);
+
+    build_cache_close(cache);
+    store_destroy(variables);
+    printf("✓ Import closure test passed\n");
+}
+
+/**
+ * @brief A missing import is a dependency too
+ */
+void test_missing_import() {
+    printf("Testing missing imports...\n");
+
+    store* variables = store_create();
+    build_cache* cache = build_cache_open(ROOT "/cache", 1);
+    assert(variables != NULL && cache != NULL);
+    const char* out = ROOT "/out/later.md";
+    remove(ROOT "/src/later.txt");
+    write_file(ROOT "/src/later.md", "before <!-- xmd:import " ROOT "/src/later.txt -->\n");
+
+    assert(build_cache_build_file(cache, variables, ROOT "/src/later.md", out) == BUILD_FILE_RENDERED);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/later.md", out) == BUILD_FILE_CACHED);
+    write_file(ROOT "/src/later.txt", "arrived\n");
+    assert(build_cache_build_file(cache, variables, ROOT "/src/later.md", out) == BUILD_FILE_RENDERED);
+    assert(strstr(read_file(out), "arrived") != NULL);
+
+    build_cache_close(cache);
+    store_destroy(variables);
+    printf("✓ Missing import test passed\n");
+}
+
+/**
+ * @brief Documents that run commands always render; equal outputs are not rewritten
+ */
+void test_volatile_and_unchanged() {
+    printf("Testing volatile documents and output elision...\n");
+
+    store* variables = store_create();
+    build_cache* cache = build_cache_open(ROOT "/cache", 1);
+    assert(variables != NULL && cache != NULL);
+    const char* out = ROOT "/out/exec.md";
+    write_file(ROOT "/src/exec.md", "x <!-- xmd:exec echo hi -->\n");
+
+    assert(build_cache_build_file(cache, variables, ROOT "/src/exec.md", out) == BUILD_FILE_RENDERED);
+    backdate(out);
+    assert(build_cache_build_file(cache, variables, ROOT "/src/exec.md", out) == BUILD_FILE_UNCHANGED);
+    assert(mtime_of(out) == 1000000);
+
+    // Without a cache every build renders, still without rewriting
+    out = ROOT "/out/plain.md";
+    write_file(ROOT "/src/plain.md", "plain text\n");
+    assert(build_cache_build_file(NULL, variables, ROOT "/src/plain.md", out) == BUILD_FILE_RENDERED);
+    backdate(out);
+    assert(build_cache_build_file(NULL, variables, ROOT "/src/plain.md", out) == BUILD_FILE_UNCHANGED);
+    assert(mtime_of(out) == 1000000);
+
+    bool written = true;
+    assert(build_write_output(out, "plain text\n", 11, &written) == 0 && !written);
+    assert(build_write_output(out, "new", 3, &written) == 0 && written);
+    assert(strcmp(read_file(out), "new") == 0);
+    assert(build_write_output(out, "now", 3, &written) == 0 && written);
+    assert(strcmp(read_file(out), "now") == 0);
+
+    // A source that cannot be read fails and drops its entry
+    assert(build_cache_build_file(cache, variables, ROOT "/src/none.md", out) == BUILD_FILE_FAILED);
+
+    build_cache_close(cache);
+    store_destroy(variables);
+    printf("✓ Volatile document and output elision test passed\n");
+}
+
+/**
+ * @brief A wave of writes flushes each directory once and leaves no temporaries
+ */
+void test_write_batch() {
+    printf("Testing batched output writes...\n");
+
+    assert(system("mkdir -p " ROOT "/wave/a " ROOT "/wave/b") == 0);
+    build_write_batch batch;
+    build_write_batch_init(&batch);
+    assert(build_write_batch_attach(&batch) == NULL);
+
+    assert(build_write_output(ROOT "/wave/a/one.md", "1", 1, NULL) == 0);
+    assert(build_write_output(ROOT "/wave/a/two.md", "2", 1, NULL) == 0);
+    assert(build_write_output(ROOT "/wave/b/three.md", "3", 1, NULL) == 0);
+    assert(build_write_output(ROOT "/wave/b/three.md", "3", 1, NULL) == 0);
+    assert(batch.files_written == 3 && batch.count == 2);
+    assert(strcmp(batch.directories[0], ROOT "/wave/a") == 0);
+
+    assert(build_write_batch_attach(NULL) == &batch);
+    assert(build_write_batch_flush(&batch) == 0);
+    assert(batch.count == 0 && batch.directories == NULL && batch.files_written == 0);
+    assert(strcmp(read_file(ROOT "/wave/b/three.md"), "3") == 0);
+
+    DIR* dir = opendir(ROOT "/wave/a");
+    assert(dir != NULL);
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        assert(strstr(entry->d_name, ".tmp") == NULL);
+    }
+    closedir(dir);
+
+    assert(system("rm -rf " ROOT) == 0);
+    printf("✓ Batched output write test passed\n");
+}
+
+/**
+ * @brief Replacing an output keeps its permissions and any symlink to it
+ */
+void test_write_keeps_file_attributes() {
+    printf("Testing output replacement attributes...\n");
+
+    assert(system("mkdir -p " ROOT "/attr") == 0);
+    const char* out = ROOT "/attr/script.sh";
+    write_file(out, "old");
+    assert(chmod(out, 0750) == 0);
+    bool written = false;
+    assert(build_write_output(out, "new", 3, &written) == 0 && written);
+    struct stat st;
+    assert(stat(out, &st) == 0 && (st.st_mode & 07777) == 0750);
+
+    // The link stays a link and its target receives the content
+    const char* link = ROOT "/attr/link.sh";
+    assert(symlink("script.sh", link) == 0);
+    assert(build_write_output(link, "linked", 6, &written) == 0 && written);
+    assert(lstat(link, &st) == 0 && S_ISLNK(st.st_mode));
+    assert(strcmp(read_file(out), "linked") == 0);
+    assert(stat(out, &st) == 0 && (st.st_mode & 07777) == 0750);
+
+    assert(system("rm -rf " ROOT) == 0);
+    printf("✓ Output replacement attribute test passed\n");
+}
+
+int main() {
+    printf("=== Build Cache Tests ===\n");
+
+    test_import_closure();
+    test_missing_import();
+    test_volatile_and_unchanged();
+    test_write_batch();
+    test_write_keeps_file_attributes();
+
+    printf("\n✅ All build cache tests passed!\n");
+    return 0;
+}
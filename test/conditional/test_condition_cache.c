@@ -0,0 +1,139 @@
+/**
+ * @file test_condition_cache.c
+ * @brief Test the parsed condition cache
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/ast_parse_cache.h"
+#include "../../include/ast_evaluator.h"
+#include "../../include/store.h"
+#include "../../include/variable.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Conditions in a loop body are parsed once per distinct text
+ */
+void test_loop_conditions() {
+    printf("Testing loop conditions...\n");
+
+    ast_parse_cache* cache = ast_parse_cache_create();
+    store* variables = store_create();
+    assert(cache != NULL && variables != NULL);
+    assert(ast_parse_cache_attach(cache) == NULL);
+
+    const char* input = "<!-- xmd:set items = [\"a\", \"b\", \"c\", \"d\"] -->\n"
+                        "<!-- xmd:for item in items -->\n"
+                        "<!-- xmd:if item == \"b\" -->\nmatched\n<!-- xmd:endif -->\n"
+                        "<!-- xmd:endfor -->\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    const char* match = strstr(output, "matched");
+    assert(match != NULL && strstr(match + 1, "matched") == NULL);
+    xmd_free(output);
+
+    // One parse, then three iterations served from the cache
+    assert(cache->count == 1);
+    assert(cache->misses == 1);
+    assert(cache->hits == 3);
+
+    // A second render through the same cache parses nothing
+    uint64_t misses = cache->misses;
+    output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    xmd_free(output);
+    assert(cache->misses == misses);
+
+    assert(ast_parse_cache_attach(NULL) == cache);
+    store_destroy(variables);
+    ast_parse_cache_destroy(cache);
+    printf("✓ Loop conditions test passed\n");
+}
+
+/**
+ * @brief The least recently used condition is evicted when full
+ */
+void test_eviction() {
+    printf("Testing eviction...\n");
+
+    ast_parse_cache* cache = ast_parse_cache_create();
+    assert(cache != NULL);
+    char text[64];
+    for (int i = 0; i < AST_PARSE_CACHE_CAPACITY; i++) {
+        snprintf(text, sizeof(text), "x == %d", i);
+        assert(ast_parse_cache_lookup(cache, text) != NULL);
+    }
+    assert(cache->count == AST_PARSE_CACHE_CAPACITY);
+
+    // Touch the oldest so the second oldest is evicted instead
+    assert(ast_parse_cache_lookup(cache, "x == 0") != NULL);
+    assert(cache->hits == 1);
+    assert(ast_parse_cache_lookup(cache, "x == new") != NULL);
+    assert(cache->count == AST_PARSE_CACHE_CAPACITY);
+
+    uint64_t misses = cache->misses;
+    assert(ast_parse_cache_lookup(cache, "x == 0") != NULL);
+    assert(cache->misses == misses);
+    assert(ast_parse_cache_lookup(cache, "x == 1") != NULL);
+    assert(cache->misses == misses + 1);
+
+    // Text that does not parse is remembered as such
+    misses = cache->misses;
+    assert(ast_parse_cache_lookup(cache, "") == NULL);
+    assert(ast_parse_cache_lookup(cache, "") == NULL);
+    assert(cache->misses == misses + 1);
+
+    ast_parse_cache_destroy(cache);
+    printf("✓ Eviction test passed\n");
+}
+
+/**
+ * @brief The shared evaluator is handed out to one evaluation at a time
+ */
+void test_evaluator_reuse() {
+    printf("Testing evaluator reuse...\n");
+
+    ast_parse_cache* cache = ast_parse_cache_create();
+    store* variables = store_create();
+    assert(cache != NULL && variables != NULL);
+    variable* mode = variable_create_string("fast");
+    store_set(variables, "mode", mode);
+    variable_unref(mode);
+
+    ast_parse_cache_attach(cache);
+    assert(ast_evaluate_condition("mode == \"fast\"", variables));
+    assert(!ast_evaluate_condition("mode == \"slow\"", variables));
+
+    // While the evaluator is taken, evaluation falls back to a private one
+    ast_evaluator* evaluator = ast_parse_cache_take_evaluator(cache, variables);
+    assert(evaluator != NULL);
+    assert(ast_parse_cache_take_evaluator(cache, variables) == NULL);
+    uint64_t lookups = cache->hits + cache->misses;
+    assert(ast_evaluate_condition("mode == \"fast\"", variables));
+    assert(cache->hits + cache->misses == lookups);
+    ast_parse_cache_release(cache);
+
+    assert(ast_evaluate_condition("mode == \"fast\"", variables));
+    assert(cache->hits + cache->misses == lookups + 1);
+    ast_parse_cache_attach(NULL);
+
+    store_destroy(variables);
+    ast_parse_cache_destroy(cache);
+    printf("✓ Evaluator reuse test passed\n");
+}
+
+int main() {
+    printf("=== Condition Cache Tests ===\n");
+
+    test_loop_conditions();
+    test_eviction();
+    test_evaluator_reuse();
+
+    printf("\n✅ All condition cache tests passed!\n");
+    return 0;
+}
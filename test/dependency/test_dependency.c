@@ -10,6 +10,8 @@
 #include <string.h>
 #include <assert.h>
 #include "../../include/dependency.h"
+#include "../../include/build_cache.h"
+#include "../../include/variable.h"
 
 /**
  * @brief Test dependency node creation and management
@@ -266,6 +268,11 @@ void test_circular_dependency_detection(void) {
     assert(cycle_length > 0);
     assert(cycle_path != NULL);
     
+    // Each module is followed by the one it depends on
+    assert(cycle_length == 4);
+    assert(strcmp(cycle_path[0], "A") == 0 && strcmp(cycle_path[1], "B") == 0);
+    assert(strcmp(cycle_path[2], "C") == 0 && strcmp(cycle_path[3], "A") == 0);
+    
     // Free cycle path
     for (size_t i = 0; i < cycle_length; i++) {
         free(cycle_path[i]);
@@ -324,6 +331,317 @@ void test_acyclic_dependency_graph(void) {
     printf("✓ Acyclic dependency graph tests passed\n");
 }
 
+/**
+ * @brief Test sorting and cycle checks on a graph of many modules
+ */
+void test_large_dependency_graph(void) {
+    printf("Testing large dependency graph...\n");
+    
+    // Module i depends on i - 1 and on i / 2: a deep chain with fan-in
+    enum { MODULE_COUNT = 50000 };
+    Module** modules = malloc(MODULE_COUNT * sizeof(Module*));
+    assert(modules != NULL);
+    DependencyGraph* graph = dependency_graph_new();
+    char name[32];
+    char dependency[32];
+    for (int i = 0; i < MODULE_COUNT; i++) {
+        snprintf(name, sizeof(name), "partial_%d", i);
+        modules[i] = module_new(name, "/partial.xmd");
+        assert(dependency_graph_add_module(graph, modules[i]) == MODULE_SUCCESS);
+    }
+    assert(dependency_graph_add_module(graph, modules[123]) == MODULE_ALREADY_LOADED);
+    for (int i = 1; i < MODULE_COUNT; i++) {
+        snprintf(name, sizeof(name), "partial_%d", i);
+        snprintf(dependency, sizeof(dependency), "partial_%d", i - 1);
+        assert(dependency_graph_add_dependency(graph, name, dependency) == MODULE_SUCCESS);
+        snprintf(dependency, sizeof(dependency), "partial_%d", i / 2);
+        assert(dependency_graph_add_dependency(graph, name, dependency) == MODULE_SUCCESS);
+    }
+    assert(dependency_graph_find_node(graph, "partial_4242")->module == modules[4242]);
+    assert(dependency_graph_find_node(graph, "partial_50000") == NULL);
+    
+    assert(dependency_graph_topological_sort(graph) == MODULE_SUCCESS);
+    assert(graph->load_order_count == MODULE_COUNT);
+    for (int i = 0; i < MODULE_COUNT; i++) {
+        snprintf(name, sizeof(name), "partial_%d", i);
+        assert(strcmp(graph->load_order[i], name) == 0);
+    }
+    
+    DependencyDetector* detector = dependency_detector_new(graph);
+    assert(dependency_check_circular(detector) == MODULE_SUCCESS);
+    
+    // Closing the chain makes every module part of one cycle
+    assert(dependency_graph_add_dependency(graph, "partial_0", "partial_49999") == MODULE_SUCCESS);
+    assert(dependency_check_circular(detector) == MODULE_CIRCULAR_DEPENDENCY);
+    assert(detector->cycle_path_count >= 3);
+    assert(strcmp(detector->cycle_path[0], detector->cycle_path[detector->cycle_path_count - 1]) == 0);
+    assert(dependency_check_circular_from(detector, "partial_7") == MODULE_CIRCULAR_DEPENDENCY);
+    assert(dependency_check_circular_from(detector, "missing") == MODULE_NOT_FOUND);
+    assert(dependency_graph_topological_sort(graph) == MODULE_CIRCULAR_DEPENDENCY);
+    
+    dependency_detector_free(detector);
+    dependency_graph_free(graph);
+    for (int i = 0; i < MODULE_COUNT; i++) {
+        module_free(modules[i]);
+    }
+    free(modules);
+    
+    printf("✓ Large dependency graph tests passed\n");
+}
+
+/**
+ * @brief Check that every dependency is ordered before its dependents
+ * @param graph Acyclic dependency graph
+ */
+static void assert_graph_ordered(DependencyGraph* graph) {
+    assert(graph->order_valid && graph->cycle_length == 0);
+    for (size_t i = 0; i < graph->node_count; i++) {
+        DependencyNode* node = graph->nodes[i];
+        assert(graph->order[node->order] == node);
+        for (size_t j = 0; j < node->child_count; j++) {
+            assert(node->order < node->children[j]->order);
+        }
+    }
+}
+
+/**
+ * @brief Test cycle detection as dependencies are added one by one
+ */
+void test_incremental_cycle_detection(void) {
+    printf("Testing incremental cycle detection...\n");
+    
+    // Module i may only depend on modules with a higher rank, so the
+    // graph stays acyclic while edges arrive in random order
+    enum { MODULE_COUNT = 2000, EDGE_COUNT = 20000 };
+    Module** modules = malloc(MODULE_COUNT * sizeof(Module*));
+    int* rank = malloc(MODULE_COUNT * sizeof(int));
+    assert(modules != NULL && rank != NULL);
+    DependencyGraph* graph = dependency_graph_new();
+    char name[32];
+    char dependency[32];
+    srand(49);
+    for (int i = 0; i < MODULE_COUNT; i++) {
+        snprintf(name, sizeof(name), "watch_%d", i);
+        modules[i] = module_new(name, "/watch.xmd");
+        assert(dependency_graph_add_module(graph, modules[i]) == MODULE_SUCCESS);
+        rank[i] = i;
+    }
+    for (int i = MODULE_COUNT - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int swap = rank[i];
+        rank[i] = rank[j];
+        rank[j] = swap;
+    }
+    int last_from = 0, last_to = 0;
+    for (int e = 0; e < EDGE_COUNT; e++) {
+        int a = rand() % MODULE_COUNT;
+        int b = rand() % MODULE_COUNT;
+        if (rank[a] == rank[b]) {
+            continue;
+        }
+        int from = rank[a] < rank[b] ? a : b;
+        int to = rank[a] < rank[b] ? b : a;
+        snprintf(name, sizeof(name), "watch_%d", from);
+        snprintf(dependency, sizeof(dependency), "watch_%d", to);
+        assert(dependency_graph_add_dependency(graph, name, dependency) == MODULE_SUCCESS);
+        last_from = from;
+        last_to = to;
+        if (e % 5000 == 0) {
+            assert_graph_ordered(graph);
+        }
+    }
+    assert_graph_ordered(graph);
+    
+    DependencyDetector* detector = dependency_detector_new(graph);
+    assert(dependency_check_circular(detector) == MODULE_SUCCESS);
+    assert(dependency_check_circular_from(detector, "watch_0") == MODULE_SUCCESS);
+    
+    // Reversing an existing dependency reports the cycle as the edge is added
+    snprintf(name, sizeof(name), "watch_%d", last_to);
+    snprintf(dependency, sizeof(dependency), "watch_%d", last_from);
+    assert(dependency_graph_add_dependency(graph, name, dependency) == MODULE_SUCCESS);
+    size_t cycle_length = graph->cycle_length;
+    assert(cycle_length >= 3);
+    assert(graph->cycle[0] == (size_t)last_from && graph->cycle[cycle_length - 1] == (size_t)last_from);
+    for (size_t i = 0; i + 1 < cycle_length; i++) {
+        // Each module is followed by one it depends on
+        DependencyNode* dependency_node = graph->nodes[graph->cycle[i + 1]];
+        bool found = false;
+        for (size_t j = 0; j < dependency_node->child_count; j++) {
+            found = found || dependency_node->children[j]->id == graph->cycle[i];
+        }
+        assert(found);
+    }
+    
+    assert(dependency_check_circular(detector) == MODULE_CIRCULAR_DEPENDENCY);
+    assert(detector->cycle_path_count == cycle_length);
+    snprintf(name, sizeof(name), "watch_%d", last_from);
+    assert(strcmp(detector->cycle_path[0], name) == 0);
+    
+    // Later edges leave the first cycle in place
+    assert(dependency_graph_add_dependency(graph, "watch_1", "watch_1") == MODULE_SUCCESS);
+    assert(graph->cycle_length == cycle_length);
+    dependency_detector_free(detector);
+    dependency_graph_free(graph);
+    
+    // A self-dependency is a cycle of one module
+    graph = dependency_graph_new();
+    dependency_graph_add_module(graph, modules[0]);
+    dependency_graph_add_dependency(graph, "watch_0", "watch_0");
+    detector = dependency_detector_new(graph);
+    assert(dependency_check_circular(detector) == MODULE_CIRCULAR_DEPENDENCY);
+    assert(detector->cycle_path_count == 2);
+    assert(strcmp(detector->cycle_path[0], "watch_0") == 0);
+    assert(strcmp(detector->cycle_path[1], "watch_0") == 0);
+    dependency_detector_free(detector);
+    dependency_graph_free(graph);
+    
+    for (int i = 0; i < MODULE_COUNT; i++) {
+        module_free(modules[i]);
+    }
+    free(modules);
+    free(rank);
+    
+    printf("✓ Incremental cycle detection tests passed\n");
+}
+
+/**
+ * @brief Compile step: export the module's number plus its dependencies' totals
+ * @param module Loaded module
+ * @param user_data Module registry
+ * @return ModuleResult
+ */
+static int compile_total(Module* module, void* user_data) {
+    ModuleRegistry* registry = user_data;
+    double total = atof(module->content);
+    for (size_t i = 0; i < module->dependency_count; i++) {
+        Module* dependency = module_registry_find(registry, module->dependencies[i]);
+        // Dependencies are always compiled first
+        variable* value = module_get_export(dependency, "total");
+        if (!dependency->loaded || !value) {
+            return MODULE_ERROR;
+        }
+        total += value->value.number_value;
+    }
+    variable* value = variable_create_number(total);
+    int result = module_export(module, "total", value);
+    variable_unref(value);
+    return result;
+}
+
+/**
+ * @brief Create a registry of module files forming a binary tree
+ *
+ * Module i holds the number i and depends on module (i - 1) / 2.
+ *
+ * @param directory Directory for the module files
+ * @param count Number of modules
+ * @return Registry
+ */
+static ModuleRegistry* create_tree_registry(const char* directory, int count) {
+    ModuleRegistry* registry = module_registry_new();
+    assert(registry != NULL);
+    char name[32];
+    char path[256];
+    for (int i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "tree_%d", i);
+        snprintf(path, sizeof(path), "%s/%s.xmd", directory, name);
+        FILE* file = fopen(path, "w");
+        assert(file != NULL);
+        fprintf(file, "%d", i);
+        fclose(file);
+        Module* module = module_new(name, path);
+        if (i > 0) {
+            snprintf(name, sizeof(name), "tree_%d", (i - 1) / 2);
+            module_add_dependency(module, name);
+        }
+        assert(module_registry_register(registry, module) == MODULE_SUCCESS);
+    }
+    return registry;
+}
+
+/**
+ * @brief Test loading and compiling modules in parallel over the graph
+ */
+void test_parallel_module_loading(void) {
+    printf("Testing parallel module loading...\n");
+    
+    enum { TREE_SIZE = 127 };
+    char directory[] = "/tmp/xmd_test_modules_XXXXXX";
+    assert(mkdtemp(directory) != NULL);
+    
+    // Results are the same for any number of workers
+    size_t workers[] = {1, 8};
+    for (size_t w = 0; w < 2; w++) {
+        ModuleRegistry* registry = create_tree_registry(directory, TREE_SIZE);
+        build_inputs inputs = {0};
+        build_inputs* previous = build_inputs_attach(&inputs);
+        assert(dependency_load_modules(registry, NULL, workers[w], compile_total, registry) == MODULE_SUCCESS);
+        build_inputs_attach(previous);
+        
+        for (int i = 0; i < TREE_SIZE; i++) {
+            double expected = 0;
+            for (int j = i; j > 0; j = (j - 1) / 2) {
+                expected += j;
+            }
+            Module* module = registry->modules[i];
+            assert(module->loaded && !module->loading);
+            assert(module_get_export(module, "total")->value.number_value == expected);
+            // Inputs are recorded in module order, whatever the load order
+            assert(strcmp(inputs.files[i].path, module->path) == 0);
+        }
+        assert(inputs.count == TREE_SIZE);
+        build_inputs_clear(&inputs);
+        
+        // Loaded modules are only compiled again
+        assert(dependency_load_modules(registry, NULL, workers[w], NULL, NULL) == MODULE_SUCCESS);
+        module_registry_free(registry);
+    }
+    
+    // A missing file fails its module and skips everything depending on it
+    ModuleRegistry* registry = create_tree_registry(directory, 7);
+    char path[256];
+    snprintf(path, sizeof(path), "%s/tree_1.xmd", directory);
+    remove(path);
+    assert(dependency_load_modules(registry, NULL, 4, compile_total, registry) == MODULE_NOT_FOUND);
+    assert(registry->modules[0]->loaded && registry->modules[2]->loaded);
+    assert(registry->modules[5]->loaded && registry->modules[6]->loaded);
+    assert(!registry->modules[1]->loaded);
+    assert(!registry->modules[3]->loaded && !registry->modules[4]->loaded);
+    module_registry_free(registry);
+    
+    // A cycle is reported before any module is read
+    registry = create_tree_registry(directory, 3);
+    module_add_dependency(registry->modules[0], "tree_2");
+    assert(dependency_load_modules(registry, NULL, 4, NULL, NULL) == MODULE_CIRCULAR_DEPENDENCY);
+    for (int i = 0; i < 3; i++) {
+        assert(!registry->modules[i]->loaded);
+    }
+    module_registry_free(registry);
+
+    // Loading one module reads only it and its dependencies
+    registry = create_tree_registry(directory, 15);
+    module_add_dependency(registry->modules[2], "tree_6");
+    assert(module_registry_load(registry, "tree_9") == MODULE_SUCCESS);
+    for (int i = 0; i < 15; i++) {
+        assert(registry->modules[i]->loaded == (i == 0 || i == 1 || i == 4 || i == 9));
+    }
+    assert(module_registry_load(registry, "tree_6") == MODULE_CIRCULAR_DEPENDENCY);
+    assert(module_registry_load(registry, "tree_99") == MODULE_NOT_FOUND);
+    module_add_dependency(registry->modules[0], "tree_9");
+    assert(module_registry_load(registry, "tree_3") == MODULE_CIRCULAR_DEPENDENCY);
+    assert(!registry->modules[3]->loaded);
+    module_registry_free(registry);
+
+    for (int i = 0; i < TREE_SIZE; i++) {
+        snprintf(path, sizeof(path), "%s/tree_%d.xmd", directory, i);
+        remove(path);
+    }
+    remove(directory);
+    
+    printf("✓ Parallel module loading tests passed\n");
+}
+
 /**
  * @brief Test dependency validation with module registry
  */
@@ -402,6 +720,9 @@ int main(void) {
     test_topological_sort();
     test_circular_dependency_detection();
     test_acyclic_dependency_graph();
+    test_large_dependency_graph();
+    test_incremental_cycle_detection();
+    test_parallel_module_loading();
     test_dependency_validation();
     test_dependency_edge_cases();
     
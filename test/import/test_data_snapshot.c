@@ -0,0 +1,334 @@
+/**
+ * @file test_data_snapshot.c
+ * @brief Test binary snapshots of imported data
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+#include <dirent.h>
+#include <utime.h>
+#include "../../include/data_snapshot.h"
+#include "../../include/json_parser.h"
+#include "../../include/yaml_parser.h"
+#include "../../include/config.h"
+#include "../../include/variable.h"
+
+extern variable* unified_data_converter_import_file(const char* file_path, char** error_message);
+
+static const char* SAMPLE =
+    "{\"name\": \"xmd\", \"version\": 2.5, \"ok\": true, \"none\": null,"
+    " \"items\": [1, \"two\", {\"three\": [3]}, []], \"empty\": {}, \"\": \"blank key\"}";
+
+/**
+ * @brief Structural equality (variable_equals compares containers by identity)
+ */
+static bool deep_equals(const variable* a, const variable* b) {
+    if (!a || !b || a->type != b->type) {
+        return false;
+    }
+    if (a->type == VAR_ARRAY) {
+        if (variable_array_size(a) != variable_array_size(b)) return false;
+        for (size_t i = 0; i < variable_array_size(a); i++) {
+            if (!deep_equals(variable_array_get(a, i), variable_array_get(b, i))) return false;
+        }
+        return true;
+    }
+    if (a->type == VAR_OBJECT) {
+        if (variable_object_size(a) != variable_object_size(b)) return false;
+        for (size_t i = 0; i < a->value.object_value->count; i++) {
+            // Values of lazily loaded objects are built through variable_object_get
+            const char* key = a->value.object_value->pairs[i].key;
+            if (strcmp(key, b->value.object_value->pairs[i].key) != 0 ||
+                !deep_equals(variable_object_get(a, key), variable_object_get(b, key))) return false;
+        }
+        return true;
+    }
+    return variable_equals(a, b);
+}
+
+/**
+ * @brief Round trip every value type and navigate paths in place
+ */
+void test_snapshot_round_trip() {
+    printf("Testing snapshot round trip...\n");
+
+    const char* path = "/tmp/xmd_test_snapshot.xsnap";
+    variable* source = json_parser_parse_string(SAMPLE);
+    assert(source != NULL);
+    data_snapshot_key key = data_snapshot_key_of(SAMPLE, strlen(SAMPLE), 1);
+    assert(key.hash == data_snapshot_hash(SAMPLE, strlen(SAMPLE), 1));
+    assert(key.check != key.hash && key.length == strlen(SAMPLE));
+    assert(data_snapshot_write(source, &key, path));
+
+    data_snapshot* snapshot = data_snapshot_open(path, &key);
+    assert(snapshot != NULL);
+    variable* root = data_snapshot_find(snapshot, "");
+    assert(root != NULL);
+    assert(deep_equals(root, source));
+    assert(variable_object_size(root) == 7);
+
+    variable* three = data_snapshot_find(snapshot, "items[2].three.0");
+    assert(three != NULL && three->value.number_value == 3.0);
+    variable* name = data_snapshot_find(snapshot, "name");
+    assert(strcmp(name->value.string_value, "xmd") == 0);
+    assert(data_snapshot_find(snapshot, "items.4") == NULL);
+    assert(data_snapshot_find(snapshot, "name.deeper") == NULL);
+    assert(data_snapshot_find(snapshot, "missing") == NULL);
+
+    // Containers are views that outlive the handle and build members on read
+    variable* items = data_snapshot_find(snapshot, "items");
+    assert(items != NULL && items->value.array_value->kind == VAR_ARRAY_SOURCE);
+    data_snapshot_close(snapshot);
+    assert(variable_array_size(items) == 4);
+    assert(strcmp(variable_array_get(items, 1)->value.string_value, "two") == 0);
+    assert(variable_object_size(variable_array_get(items, 2)) == 1);
+
+    variable_unref(items);
+    variable_unref(three);
+    variable_unref(name);
+    variable_unref(root);
+    variable_unref(source);
+
+    // A lazily loaded tree is written in full
+    const char* json_path = "/tmp/xmd_test_snapshot_lazy.json";
+    FILE* file = fopen(json_path, "w");
+    assert(file != NULL);
+    fputs(SAMPLE, file);
+    fclose(file);
+    variable* lazy = json_parser_parse_file_lazy(json_path);
+    assert(lazy != NULL && data_snapshot_write(lazy, &key, path));
+    snapshot = data_snapshot_open(path, &key);
+    root = data_snapshot_find(snapshot, "");
+    assert(deep_equals(root, lazy));
+    variable_unref(root);
+    variable_unref(lazy);
+    data_snapshot_close(snapshot);
+    remove(json_path);
+
+    // Any part of the key differing means the snapshot is for other content
+    data_snapshot_key other = key;
+    other.hash ^= 1;
+    assert(data_snapshot_open(path, &other) == NULL);
+    other = key;
+    other.check ^= 1;
+    assert(data_snapshot_open(path, &other) == NULL);
+    other = key;
+    other.length++;
+    assert(data_snapshot_open(path, &other) == NULL);
+    remove(path);
+
+    printf("✓ Snapshot round trip test passed\n");
+}
+
+/**
+ * @brief Read every member of a tree, building lazy ones
+ */
+static size_t walk(const variable* value) {
+    size_t nodes = 1;
+    if (value && value->type == VAR_ARRAY) {
+        for (size_t i = 0; i < variable_array_size(value); i++) {
+            nodes += walk(variable_array_get(value, i));
+        }
+    } else if (value && value->type == VAR_OBJECT) {
+        for (size_t i = 0; i < value->value.object_value->count; i++) {
+            nodes += walk(variable_object_get(value, value->value.object_value->pairs[i].key));
+        }
+    }
+    return nodes;
+}
+
+/**
+ * @brief Corrupted snapshots are rejected or fail lookups, never crash
+ */
+void test_snapshot_corruption() {
+    printf("Testing snapshot corruption...\n");
+
+    const char* path = "/tmp/xmd_test_snapshot_bad.xsnap";
+    data_snapshot_key key = { 42, 43, 44 };
+    variable* source = json_parser_parse_string(SAMPLE);
+    assert(data_snapshot_write(source, &key, path));
+    variable_unref(source);
+
+    FILE* file = fopen(path, "rb");
+    assert(file != NULL);
+    unsigned char original[4096];
+    size_t size = fread(original, 1, sizeof(original), file);
+    fclose(file);
+
+    srand(7);
+    for (int round = 0; round < 2000; round++) {
+        unsigned char copy[4096];
+        memcpy(copy, original, size);
+        size_t length = size;
+        if (round % 4 == 0) {
+            length = (size_t)rand() % size;
+        } else {
+            for (int flips = 0; flips < 3; flips++) {
+                copy[(size_t)rand() % size] ^= (unsigned char)(1u << (rand() % 8));
+            }
+        }
+        file = fopen(path, "wb");
+        fwrite(copy, 1, length, file);
+        fclose(file);
+
+        data_snapshot* snapshot = data_snapshot_open(path, &key);
+        if (snapshot) {
+            variable* root = data_snapshot_find(snapshot, "");
+            variable_unref(data_snapshot_find(snapshot, "items.2.three"));
+            data_snapshot_close(snapshot);
+            walk(root);
+            variable_unref(root);
+        }
+    }
+    remove(path);
+
+    printf("✓ Snapshot corruption test passed\n");
+}
+
+/**
+ * @brief Subtrees shared through YAML aliases are written and decoded once
+ */
+void test_snapshot_shared_subtrees() {
+    printf("Testing snapshot shared subtrees...\n");
+
+    // Eight levels of ten aliases: 10^8 leaves if expanded
+    char yaml[4096];
+    size_t used = (size_t)snprintf(yaml, sizeof(yaml), "l0: &l0 {v: 1}\n");
+    for (int level = 1; level <= 8; level++) {
+        used += (size_t)snprintf(yaml + used, sizeof(yaml) - used, "l%d: &l%d [", level, level);
+        for (int ref = 0; ref < 10; ref++) {
+            used += (size_t)snprintf(yaml + used, sizeof(yaml) - used, "%s*l%d", ref ? ", " : "", level - 1);
+        }
+        used += (size_t)snprintf(yaml + used, sizeof(yaml) - used, "]\n");
+    }
+    assert(used < sizeof(yaml));
+
+    const char* path = "/tmp/xmd_test_snapshot_shared.xsnap";
+    variable* source = yaml_parser_parse_string(yaml);
+    assert(source != NULL);
+    data_snapshot_key key = data_snapshot_key_of(yaml, used, 2);
+    assert(data_snapshot_write(source, &key, path));
+
+    FILE* file = fopen(path, "rb");
+    assert(file != NULL);
+    fseek(file, 0, SEEK_END);
+    assert(ftell(file) < 16384);
+    fclose(file);
+
+    data_snapshot* snapshot = data_snapshot_open(path, &key);
+    assert(snapshot != NULL);
+    variable* leaf = data_snapshot_find(snapshot, "l8.9.9.9.9.9.9.9.9.v");
+    assert(leaf != NULL && leaf->value.number_value == 1.0);
+    variable* root = data_snapshot_find(snapshot, "");
+    assert(root != NULL);
+    variable* top = variable_object_get(root, "l8");
+    assert(variable_array_size(top) == 10);
+    assert(variable_array_get(top, 0) == variable_array_get(top, 9));
+    assert(variable_array_get(top, 0) == variable_object_get(root, "l7"));
+
+    variable_unref(leaf);
+    variable_unref(root);
+    variable_unref(source);
+    data_snapshot_close(snapshot);
+    remove(path);
+
+    printf("✓ Snapshot shared subtrees test passed\n");
+}
+
+/**
+ * @brief Imports go through the cache when a cache directory is set
+ */
+void test_snapshot_import_cache() {
+    printf("Testing snapshot import cache...\n");
+
+    char cache_dir[] = "/tmp/xmd_snapshot_cache_XXXXXX";
+    assert(mkdtemp(cache_dir) != NULL);
+    const char* data_path = "/tmp/xmd_test_snapshot_data.json";
+    FILE* file = fopen(data_path, "w");
+    fputs(SAMPLE, file);
+    fclose(file);
+
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    assert(config != NULL);
+    config->paths.data_cache_dir = strdup(cache_dir);
+
+    variable* first = unified_data_converter_import_file(data_path, NULL);
+    assert(first != NULL);
+    char snapshot_path[512];
+    snprintf(snapshot_path, sizeof(snapshot_path), "%s/%016llx.xsnap", cache_dir,
+             (unsigned long long)data_snapshot_hash(SAMPLE, strlen(SAMPLE), 1));
+    assert(access(snapshot_path, F_OK) == 0);
+
+    variable* second = unified_data_converter_import_file(data_path, NULL);
+    assert(second != NULL && second != first);
+    assert(deep_equals(first, second));
+
+    // An unchanged file is served from its stamp without being read: bytes
+    // rewritten in place behind an unchanged size and mtime go unnoticed
+    struct utimbuf past = { time(NULL) - 10, time(NULL) - 10 };
+    assert(utime(data_path, &past) == 0);
+    variable_unref(unified_data_converter_import_file(data_path, NULL));
+    file = fopen(data_path, "r+");
+    fputs("{\"name\": \"XMD\"", file);
+    fclose(file);
+    assert(utime(data_path, &past) == 0);
+    variable* stamped = unified_data_converter_import_file(data_path, NULL);
+    assert(stamped != NULL && deep_equals(stamped, first));
+    variable_unref(stamped);
+
+    // A file changed in the second it was stamped is hashed again
+    file = fopen(data_path, "w");
+    fputs("{\"name\": 1}", file);
+    fclose(file);
+    variable_unref(unified_data_converter_import_file(data_path, NULL));
+    file = fopen(data_path, "w");
+    fputs("{\"name\": 2}", file);
+    fclose(file);
+    stamped = unified_data_converter_import_file(data_path, NULL);
+    assert(stamped != NULL && variable_object_get(stamped, "name")->value.number_value == 2.0);
+    variable_unref(stamped);
+
+    char* error = NULL;
+    file = fopen(data_path, "w");
+    fputs("{broken", file);
+    fclose(file);
+    assert(unified_data_converter_import_file(data_path, &error) == NULL);
+    assert(error != NULL);
+    free(error);
+
+    variable_unref(first);
+    variable_unref(second);
+    free(config->paths.data_cache_dir);
+    config->paths.data_cache_dir = NULL;
+    remove(data_path);
+    DIR* cache = opendir(cache_dir);
+    struct dirent* entry;
+    while ((entry = readdir(cache)) != NULL) {
+        if (entry->d_name[0] != '.') {
+            snprintf(snapshot_path, sizeof(snapshot_path), "%s/%s", cache_dir, entry->d_name);
+            remove(snapshot_path);
+        }
+    }
+    closedir(cache);
+    assert(rmdir(cache_dir) == 0);
+
+    printf("✓ Snapshot import cache test passed\n");
+}
+
+int main() {
+    printf("=== Data Snapshot Tests ===\n");
+
+    test_snapshot_round_trip();
+    test_snapshot_corruption();
+    test_snapshot_shared_subtrees();
+    test_snapshot_import_cache();
+
+    printf("\n✅ All data snapshot tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_loop_scope.c
+ * @brief Test variable scoping of for loop bodies
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/variable.h"
+#include "../../include/store.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Check a template's output against an empty store
+ * @param input Template
+ * @param expected Expected output
+ */
+static void expect(const char* input, const char* expected) {
+    store* variables = store_create();
+    assert(variables != NULL);
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    if (strcmp(output, expected) != 0) {
+        fprintf(stderr, "input:    %s\nexpected: %s\nactual:   %s\n", input, expected, output);
+        assert(0);
+    }
+    free(output);
+    store_destroy(variables);
+}
+
+/**
+ * @brief Assignments in a loop body update variables bound before the loop
+ */
+void test_loop_accumulation() {
+    printf("Testing loop accumulation...\n");
+
+    expect("<!-- xmd: set items = [\"a\", \"b\", \"c\"] -->"
+           "<!-- xmd: set result = \"\" -->"
+           "<!-- xmd: for it in items -->"
+           "<!-- xmd: set result = result + it -->"
+           "<!-- xmd: endfor -->"
+           "result={{result}}",
+           "result=abc");
+    expect("<!-- xmd: set items = [\"a\", \"b\", \"c\"] -->"
+           "<!-- xmd: set last = \"none\" -->"
+           "<!-- xmd: for it in items --><!-- xmd: set last = it --><!-- xmd: endfor -->"
+           "last={{last}}",
+           "last=c");
+
+    // Nested loops update the same binding
+    expect("<!-- xmd: set xs = [\"x\", \"y\"] --><!-- xmd: set ns = [\"1\", \"2\"] -->"
+           "<!-- xmd: set pairs = \"\" -->"
+           "<!-- xmd: for a in xs --><!-- xmd: for b in ns -->"
+           "<!-- xmd: set pairs = pairs + a + b -->"
+           "<!-- xmd: endfor --><!-- xmd: endfor -->"
+           "pairs={{pairs}}",
+           "pairs=x1x2y1y2");
+
+    printf("✓ Loop accumulation test passed\n");
+}
+
+/**
+ * @brief The loop variable and names first set in the body outlive the loop
+ */
+void test_loop_locals() {
+    printf("Testing loop locals...\n");
+
+    expect("<!-- xmd: set it = \"outer\" --><!-- xmd: set items = [\"a\", \"b\"] -->"
+           "<!-- xmd: for it in items --><!-- xmd: set fresh = it --><!-- xmd: endfor -->"
+           "it={{it}} fresh={{fresh}}",
+           "it=b fresh=b");
+
+    // A numeric loop variable keeps its last value too
+    expect("<!-- xmd: for n in 1..3 --><!-- xmd: endfor -->n={{n}}", "n=3");
+
+    printf("✓ Loop locals test passed\n");
+}
+
+int main() {
+    printf("=== Loop Scope Tests ===\n");
+
+    test_loop_accumulation();
+    test_loop_locals();
+
+    printf("\n✅ All loop scope tests passed!\n");
+    return 0;
+}
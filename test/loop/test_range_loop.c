@@ -0,0 +1,169 @@
+/**
+ * @file test_range_loop.c
+ * @brief Test lazy numeric ranges in loops and expressions
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/variable.h"
+#include "../../include/store.h"
+#include "../../include/config.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Render a template with an empty store
+ * @param input Template
+ * @return Output (caller frees)
+ */
+static char* render(const char* input) {
+    store* variables = store_create();
+    assert(variables != NULL);
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    store_destroy(variables);
+    return output;
+}
+
+/**
+ * @brief Check a template's output
+ * @param input Template
+ * @param expected Expected output
+ */
+static void expect(const char* input, const char* expected) {
+    char* output = render(input);
+    if (strcmp(output, expected) != 0) {
+        fprintf(stderr, "input:    %s\nexpected: %s\nactual:   %s\n", input, expected, output);
+        assert(0);
+    }
+    free(output);
+}
+
+/**
+ * @brief Ranges compute their items and become ordinary arrays when changed
+ */
+void test_range_storage() {
+    printf("Testing range storage...\n");
+
+    variable* range = variable_create_range(10, 1, -3);
+    assert(range != NULL && range->type == VAR_ARRAY);
+    assert(range->value.array_value->kind == VAR_ARRAY_RANGE);
+    assert(variable_array_size(range) == 4);
+    variable* last = variable_array_element(range, 3);
+    assert(last != NULL && last->type == VAR_NUMBER && last->value.number_value == 1);
+    variable_unref(last);
+    assert(variable_array_element(range, 4) == NULL);
+
+    // Fractional steps reach their end despite rounding
+    variable* fractions = variable_create_range(0, 1, 0.1);
+    assert(variable_array_size(fractions) == 11);
+    variable_unref(fractions);
+
+    // A step away from the end is empty, a zero step is invalid
+    variable* empty = variable_create_range(1, 5, -1);
+    assert(empty != NULL && variable_array_size(empty) == 0);
+    assert(variable_create_range(1, 5, 0) == NULL);
+
+    // Appending keeps the computed items
+    assert(variable_array_add_number(range, 99));
+    assert(range->value.array_value->kind == VAR_ARRAY_BOXED);
+    assert(variable_array_size(range) == 5);
+    assert(variable_array_get(range, 1)->value.number_value == 7);
+    assert(variable_array_get(range, 4)->value.number_value == 99);
+    assert(variable_array_add_number(empty, 3) && variable_array_size(empty) == 1);
+
+    variable_unref(range);
+    variable_unref(empty);
+    printf("✓ Range storage test passed\n");
+}
+
+/**
+ * @brief Range syntax in loops, assignments and join
+ */
+void test_range_render() {
+    printf("Testing range rendering...\n");
+
+    expect("<!-- xmd:for i in 1..5 -->{{i}} <!-- xmd:endfor -->", "1 2 3 4 5 ");
+    expect("<!-- xmd:for i in 5..1 -->{{i}}<!-- xmd:endfor -->", "54321");
+    expect("<!-- xmd:for i in 1 .. 3 -->{{i}}<!-- xmd:endfor -->", "123");
+    expect("<!-- xmd:for i in 0..10 step 3 -->{{i}},<!-- xmd:endfor -->", "0,3,6,9,");
+    expect("<!-- xmd:for i in 0..1 step 0.25 -->{{i}} <!-- xmd:endfor -->", "0 0.25 0.5 0.75 1 ");
+    expect("<!-- xmd:for i in 1..3 step -1 -->{{i}}<!-- xmd:endfor -->", "");
+    expect("<!-- xmd:set n = 4 --><!-- xmd:for i in 2..n -->{{i}}<!-- xmd:endfor -->", "234");
+
+    // The loop variable is a number usable in expressions and nested ranges
+    expect("<!-- xmd:for i in 1..3 --><!-- xmd:for j in 1..i -->{{j}}<!-- xmd:endfor -->;<!-- xmd:endfor -->",
+           "1;12;123;");
+    expect("<!-- xmd:for i in 1..3 -->{{(i * 2)}} <!-- xmd:endfor -->", "2 4 6 ");
+
+    // Ranges as values
+    expect("<!-- xmd:set r = 1..4 --><!-- xmd:for i in r -->[{{i}}]<!-- xmd:endfor -->{{join(r, \"-\")}}",
+           "[1][2][3][4]1-2-3-4");
+    expect("{{join(1..9 step 2, \" \")}}", "1 3 5 7 9");
+    printf("✓ Range rendering test passed\n");
+}
+
+/**
+ * @brief Ranges up to the loop limit allocate no items; longer ones are errors
+ */
+void test_range_limit() {
+    printf("Testing range iteration limit...\n");
+
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    assert(config != NULL);
+    size_t saved_limit = config->limits.max_loop_iterations;
+    config->limits.max_loop_iterations = 20000;
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&tracking) == 0);
+
+    char* output = render("<!-- xmd:for i in 1..20000 -->{{i}}\n<!-- xmd:endfor -->");
+
+    xmd_allocator_set(NULL);
+    // The counter is reused: variable allocations do not grow with the range
+    assert(stats.allocations[XMD_ALLOC_VARIABLE] < 100);
+    xmd_alloc_stats_destroy(&stats);
+
+    size_t lines = 0;
+    for (const char* p = output; *p; p++) {
+        lines += *p == '\n';
+    }
+    assert(lines == 20000);
+    assert(strncmp(output, "1\n2\n", 4) == 0);
+    assert(strstr(output, "\n20000\n") != NULL);
+    free(output);
+
+    // One item over the limit is reported, not silently cut short
+    output = render("a<!-- xmd:for i in 1..1000000000 -->{{i}}\n<!-- xmd:endfor -->b");
+    assert(strcmp(output, "a[Error: Range of 1000000000 items exceeds the loop limit of 20000 iterations]b") == 0);
+    free(output);
+    output = render("<!-- xmd:for i in 0..20000 -->{{i}}<!-- xmd:endfor -->");
+    assert(strncmp(output, "[Error: Range of 20001 items", 28) == 0);
+    free(output);
+
+    // Without a limit the range runs to its end
+    config->limits.max_loop_iterations = 0;
+    output = render("{{join(1..25000, \",\")}}");
+    size_t length = strlen(output);
+    assert(length > 6 && strcmp(output + length - 6, ",25000") == 0);
+    free(output);
+    config->limits.max_loop_iterations = saved_limit;
+    printf("✓ Range iteration limit test passed\n");
+}
+
+int main() {
+    printf("=== Range Loop Tests ===\n");
+
+    test_range_storage();
+    test_range_render();
+    test_range_limit();
+
+    printf("\n✅ All range loop tests passed!\n");
+    return 0;
+}
@@ -158,6 +158,23 @@ void test_module_registry(void) {
     found = module_registry_find(registry, "nonexistent");
     assert(found == NULL);
     
+    // IDs are registration positions
+    assert(module_registry_find_id(registry, "config") == 1);
+    assert(module_registry_find_id(registry, "nonexistent") == NAME_INDEX_NONE);
+    
+    // Lookups stay exact as the index grows
+    char name[32];
+    for (int i = 0; i < 20000; i++) {
+        snprintf(name, sizeof(name), "partial/%d", i);
+        assert(module_registry_register(registry, module_new(name, "/partial.xmd")) == MODULE_SUCCESS);
+    }
+    for (int i = 0; i < 20000; i += 7) {
+        snprintf(name, sizeof(name), "partial/%d", i);
+        size_t id = module_registry_find_id(registry, name);
+        assert(id == (size_t)i + 2 && strcmp(registry->modules[id]->name, name) == 0);
+    }
+    assert(module_registry_find(registry, "utils") == module1);
+    
     // Test duplicate registration
     Module* duplicate = module_new("utils", "/different/utils.xmd");
     result = module_registry_register(registry, duplicate);
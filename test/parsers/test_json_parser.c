@@ -0,0 +1,229 @@
+/**
+ * @file test_json_parser.c
+ * @brief Test native JSON parser
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/json_parser.h"
+#include "../../include/variable.h"
+
+/**
+ * @brief Scalars, arrays and nested objects
+ */
+void test_json_basic_values() {
+    printf("Testing JSON basic values...\n");
+
+    variable* root = json_parser_parse_string(
+        "{\"name\": \"Alice\", \"age\": 30, \"pi\": -3.25e0, \"ok\": true,"
+        " \"none\": null, \"tags\": [\"a\", \"b\", []], \"deep\": {\"x\": {}}}");
+    assert(root != NULL);
+    assert(root->type == VAR_OBJECT);
+    assert(variable_object_size(root) == 7);
+    assert(strcmp(variable_object_get(root, "name")->value.string_value, "Alice") == 0);
+    assert(variable_object_get(root, "age")->value.number_value == 30.0);
+    assert(variable_object_get(root, "pi")->value.number_value == -3.25);
+    assert(variable_object_get(root, "ok")->value.boolean_value == true);
+    assert(variable_object_get(root, "none")->type == VAR_NULL);
+
+    variable* tags = variable_object_get(root, "tags");
+    assert(tags->type == VAR_ARRAY);
+    assert(variable_array_size(tags) == 3);
+    assert(tags->value.array_value->capacity == 3);
+    assert(variable_array_size(variable_array_get(tags, 2)) == 0);
+
+    variable* deep = variable_object_get(root, "deep");
+    assert(variable_object_get(deep, "x")->type == VAR_OBJECT);
+    variable_unref(root);
+
+    variable* top = json_parser_parse_string("  [1, 2.5, 12345678901234567890]  ");
+    assert(top != NULL && variable_array_size(top) == 3);
+    assert(variable_array_get(top, 2)->value.number_value == 12345678901234567890.0);
+    variable_unref(top);
+
+    printf("✓ JSON basic values test passed\n");
+}
+
+/**
+ * @brief Escapes, unicode and quotes that cross 64-byte chunk boundaries
+ */
+void test_json_strings() {
+    printf("Testing JSON strings...\n");
+
+    variable* s = json_parser_parse_string("\"tab\\there \\\"q\\\" \\u00e9 \\ud83d\\ude00 \\\\\"");
+    assert(s != NULL && s->type == VAR_STRING);
+    assert(strcmp(s->value.string_value, "tab\there \"q\" \xc3\xa9 \xf0\x9f\x98\x80 \\") == 0);
+    variable_unref(s);
+
+    // Place escaped quotes and backslashes at every offset around a chunk edge
+    for (int pad = 50; pad < 80; pad++) {
+        char buf[256];
+        int n = snprintf(buf, sizeof(buf), "[\"%*s\\\\\", \"x\\\"{,}\"]", pad, "");
+        assert(n > 0);
+        variable* arr = json_parser_parse_string(buf);
+        assert(arr != NULL && variable_array_size(arr) == 2);
+        assert(strcmp(variable_array_get(arr, 1)->value.string_value, "x\"{,}") == 0);
+        variable_unref(arr);
+    }
+
+    // Buffer without a terminator
+    const char raw[] = { '[', '"', 'a', '"', ']', 'X' };
+    variable* arr = json_parser_parse_buffer(raw, 5);
+    assert(arr != NULL && variable_array_size(arr) == 1);
+    variable_unref(arr);
+
+    printf("✓ JSON strings test passed\n");
+}
+
+/**
+ * @brief Duplicate keys keep the last value in small and large objects
+ */
+void test_json_duplicate_keys() {
+    printf("Testing JSON duplicate keys...\n");
+
+    variable* small = json_parser_parse_string("{\"a\": 1, \"b\": 2, \"a\": 3}");
+    assert(small != NULL && variable_object_size(small) == 2);
+    assert(variable_object_get(small, "a")->value.number_value == 3.0);
+    variable_unref(small);
+
+    char buf[4096];
+    size_t pos = 0;
+    buf[pos++] = '{';
+    for (int i = 0; i < 100; i++) {
+        pos += (size_t)snprintf(buf + pos, sizeof(buf) - pos, "%s\"k%d\": %d", i ? ", " : "", i % 50, i);
+    }
+    buf[pos++] = '}';
+    buf[pos] = '\0';
+    variable* large = json_parser_parse_string(buf);
+    assert(large != NULL && variable_object_size(large) == 50);
+    assert(variable_object_get(large, "k7")->value.number_value == 57.0);
+    variable_unref(large);
+
+    printf("✓ JSON duplicate keys test passed\n");
+}
+
+/**
+ * @brief Malformed documents are rejected with an error message
+ */
+void test_json_errors() {
+    printf("Testing JSON errors...\n");
+
+    const char* invalid[] = {
+        "", "{", "[1,]", "{\"a\" 1}", "{\"a\": 1,}", "[1 2]", "\"open",
+        "tru", "01", "1.", "-", "[\"a\nb\"]", "\"\\x\"", "{} {}", "invalid json content",
+        "[1]]", "{\"a\": [}", NULL
+    };
+    for (int i = 0; invalid[i]; i++) {
+        variable* v = json_parser_parse_string(invalid[i]);
+        if (v) {
+            printf("  unexpectedly parsed: %s\n", invalid[i]);
+        }
+        assert(v == NULL);
+        assert(strstr(json_parser_get_error(), "offset") != NULL);
+    }
+
+    printf("✓ JSON errors test passed\n");
+}
+
+/**
+ * @brief A lazily loaded file builds only the members that are read
+ */
+void test_json_lazy_file() {
+    printf("Testing lazy JSON file loading...\n");
+
+    const char* path = "/tmp/xmd_test_lazy.json";
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("\xEF\xBB\xBF {\"big\": {\"nested\": [1, [2, {\"x\": \"}\"}], \"s\\\"q\"]},\n"
+          " \"skip\": \"text, with [brackets]\", \"n\": -1.5e2, \"flag\": false,\n"
+          " \"meta\": {\"version\": \"2.1\", \"tags\": [\"a\", \"b\", {\"k\": null}]},\n"
+          " \"esc\\u0061ped\": 7, \"dup\": 1, \"dup\": 2, \"bad\": [1, tru]}\n", file);
+    fclose(file);
+
+    variable* root = json_parser_parse_file_lazy(path);
+    assert(root != NULL && root->type == VAR_OBJECT);
+    assert(variable_object_size(root) == 8);
+    variable_object* members = root->value.object_value;
+    for (size_t i = 0; i < members->count; i++) {
+        assert(members->pairs[i].value == NULL);
+    }
+
+    variable* meta = variable_object_get(root, "meta");
+    variable* version = variable_object_get(meta, "version");
+    assert(version != NULL && strcmp(version->value.string_value, "2.1") == 0);
+    assert(variable_object_get(meta, "version") == version);
+    // Siblings of the path read stay unbuilt
+    assert(members->pairs[variable_object_find_key(root, "big")].value == NULL);
+    assert(variable_object_get(meta, "tags")->value.array_value->kind == VAR_ARRAY_SOURCE);
+
+    variable* tags = variable_object_get(meta, "tags");
+    assert(variable_array_size(tags) == 3);
+    assert(strcmp(variable_array_get(tags, 1)->value.string_value, "b") == 0);
+    assert(variable_object_get(variable_array_get(tags, 2), "k")->type == VAR_NULL);
+    assert(variable_object_get(root, "n")->value.number_value == -150.0);
+    assert(variable_object_get(root, "flag")->value.boolean_value == false);
+    assert(variable_object_get(root, "escaped")->value.number_value == 7.0);
+    assert(variable_object_get(root, "dup")->value.number_value == 2.0);
+    variable* nested = variable_object_get(variable_object_get(root, "big"), "nested");
+    variable* inner = variable_array_get(variable_array_get(nested, 1), 1);
+    assert(strcmp(variable_object_get(inner, "x")->value.string_value, "}") == 0);
+    assert(strcmp(variable_array_get(nested, 2)->value.string_value, "s\"q") == 0);
+
+    // A syntax error inside a value is found when it is read
+    variable* bad = variable_object_get(root, "bad");
+    assert(variable_array_get(bad, 0)->value.number_value == 1.0);
+    assert(variable_array_get(bad, 1) == NULL);
+
+    // Changing a lazy container builds its remaining members first
+    variable* extra = variable_create_number(3);
+    assert(variable_object_set(meta, "extra", extra));
+    assert(members->pairs[variable_object_find_key(root, "meta")].value == meta);
+    assert(meta->value.object_value->source == NULL);
+    assert(variable_array_add(tags, extra));
+    assert(tags->value.array_value->kind == VAR_ARRAY_BOXED && variable_array_size(tags) == 4);
+    assert(strcmp(variable_array_get(tags, 0)->value.string_value, "a") == 0);
+    variable_unref(extra);
+    assert(variable_object_remove(root, "skip") && variable_object_size(root) == 7);
+    assert(variable_object_get(root, "big") != NULL);
+
+    // Members keep the file alive after the root is released
+    variable_ref(nested);
+    variable_unref(root);
+    assert(variable_array_get(nested, 0)->value.number_value == 1.0);
+    variable_unref(nested);
+
+    file = fopen(path, "w");
+    fputs("[1, {\"a\": [2]}] x", file);
+    fclose(file);
+    assert(json_parser_parse_file_lazy(path) == NULL);
+    file = fopen(path, "w");
+    fputs("{\"a\": [1, 2}", file);
+    fclose(file);
+    assert(json_parser_parse_file_lazy(path) == NULL);
+    file = fopen(path, "w");
+    fputs(" 42 ", file);
+    fclose(file);
+    root = json_parser_parse_file_lazy(path);
+    assert(root != NULL && root->value.number_value == 42.0);
+    variable_unref(root);
+    assert(json_parser_parse_file_lazy("/nonexistent/data.json") == NULL);
+    remove(path);
+
+    printf("✓ Lazy JSON file loading test passed\n");
+}
+
+int main() {
+    printf("=== JSON Parser Tests ===\n");
+
+    test_json_basic_values();
+    test_json_strings();
+    test_json_duplicate_keys();
+    test_json_errors();
+    test_json_lazy_file();
+
+    printf("\n✅ All JSON parser tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_yaml_parser.c
+ * @brief Test libyaml event loader
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/yaml_parser.h"
+#include "../../include/variable.h"
+
+/**
+ * @brief Core schema scalar resolution
+ */
+void test_yaml_scalars() {
+    printf("Testing YAML scalars...\n");
+
+    variable* root = yaml_parser_parse_string(
+        "name: Alice\n"
+        "age: 30\n"
+        "pi: -3.25\n"
+        "hex: 0x1F\n"
+        "ok: true\n"
+        "off: False\n"
+        "none: ~\n"
+        "empty:\n"
+        "quoted: \"42\"\n"
+        "tagged: !!str 7\n");
+    assert(root != NULL);
+    assert(root->type == VAR_OBJECT);
+    assert(variable_object_size(root) == 10);
+    assert(strcmp(variable_object_get(root, "name")->value.string_value, "Alice") == 0);
+    assert(variable_object_get(root, "age")->value.number_value == 30.0);
+    assert(variable_object_get(root, "pi")->value.number_value == -3.25);
+    assert(variable_object_get(root, "hex")->value.number_value == 31.0);
+    assert(variable_object_get(root, "ok")->value.boolean_value == true);
+    assert(variable_object_get(root, "off")->value.boolean_value == false);
+    assert(variable_object_get(root, "none")->type == VAR_NULL);
+    assert(variable_object_get(root, "empty")->type == VAR_NULL);
+    assert(variable_object_get(root, "quoted")->type == VAR_STRING);
+    assert(strcmp(variable_object_get(root, "quoted")->value.string_value, "42") == 0);
+    assert(variable_object_get(root, "tagged")->type == VAR_STRING);
+    variable_unref(root);
+
+    printf("✓ YAML scalars test passed\n");
+}
+
+/**
+ * @brief Nested mappings and sequences, block and flow style
+ */
+void test_yaml_nesting() {
+    printf("Testing YAML nesting...\n");
+
+    variable* root = yaml_parser_parse_string(
+        "users:\n"
+        "  - name: a\n"
+        "    roles: [admin, dev]\n"
+        "  - name: b\n"
+        "    roles: []\n"
+        "settings: {depth: {level: 3}}\n");
+    assert(root != NULL);
+    variable* users = variable_object_get(root, "users");
+    assert(users->type == VAR_ARRAY);
+    assert(variable_array_size(users) == 2);
+    variable* first = variable_array_get(users, 0);
+    assert(strcmp(variable_object_get(first, "name")->value.string_value, "a") == 0);
+    variable* roles = variable_object_get(first, "roles");
+    assert(variable_array_size(roles) == 2);
+    assert(strcmp(variable_array_get(roles, 1)->value.string_value, "dev") == 0);
+    assert(variable_array_size(variable_object_get(variable_array_get(users, 1), "roles")) == 0);
+    variable* depth = variable_object_get(variable_object_get(root, "settings"), "depth");
+    assert(variable_object_get(depth, "level")->value.number_value == 3.0);
+    variable_unref(root);
+
+    // Top-level sequence and scalar documents
+    root = yaml_parser_parse_string("- 1\n- two\n");
+    assert(root != NULL && root->type == VAR_ARRAY);
+    assert(variable_array_size(root) == 2);
+    variable_unref(root);
+
+    root = yaml_parser_parse_string("");
+    assert(root != NULL && root->type == VAR_NULL);
+    variable_unref(root);
+
+    printf("✓ YAML nesting test passed\n");
+}
+
+/**
+ * @brief Aliases share the anchored node instead of copying it
+ */
+void test_yaml_anchors() {
+    printf("Testing YAML anchors...\n");
+
+    variable* root = yaml_parser_parse_string(
+        "base: &defaults\n"
+        "  retries: 3\n"
+        "  hosts: [x, y]\n"
+        "dev: *defaults\n"
+        "prod: *defaults\n"
+        "label: &l hello\n"
+        "copy: *l\n");
+    assert(root != NULL);
+    variable* base = variable_object_get(root, "base");
+    assert(variable_object_get(root, "dev") == base);
+    assert(variable_object_get(root, "prod") == base);
+    assert(base->ref_count == 3);
+    assert(variable_object_get(root, "copy") == variable_object_get(root, "label"));
+    variable_unref(root);
+
+    assert(yaml_parser_parse_string("a: *missing\n") == NULL);
+    printf("  error: %s\n", yaml_parser_get_error());
+
+    printf("✓ YAML anchors test passed\n");
+}
+
+/**
+ * @brief Duplicate keys keep the first position and the last value
+ */
+void test_yaml_duplicate_keys() {
+    printf("Testing YAML duplicate keys...\n");
+
+    variable* root = yaml_parser_parse_string("a: 1\nb: 2\na: 3\n");
+    assert(root != NULL);
+    assert(variable_object_size(root) == 2);
+    assert(strcmp(root->value.object_value->pairs[0].key, "a") == 0);
+    assert(variable_object_get(root, "a")->value.number_value == 3.0);
+    variable_unref(root);
+
+    printf("✓ YAML duplicate keys test passed\n");
+}
+
+/**
+ * @brief Malformed input and file loading
+ */
+void test_yaml_errors_and_files() {
+    printf("Testing YAML errors and files...\n");
+
+    assert(yaml_parser_parse_string("a: [1, 2\n") == NULL);
+    assert(strstr(yaml_parser_get_error(), "line") != NULL);
+    assert(yaml_parser_parse_string("key: value\n  bad: indent\n") == NULL);
+    assert(yaml_parser_parse_file("/nonexistent/file.yaml") == NULL);
+
+    const char* path = "/tmp/xmd_test_yaml_parser.yaml";
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("list:\n", file);
+    for (int i = 0; i < 1000; i++) {
+        fprintf(file, "  - {id: %d, name: item%d}\n", i, i);
+    }
+    fclose(file);
+
+    variable* root = yaml_parser_parse_file(path);
+    assert(root != NULL);
+    variable* list = variable_object_get(root, "list");
+    assert(variable_array_size(list) == 1000);
+    assert(variable_object_get(variable_array_get(list, 999), "id")->value.number_value == 999.0);
+    variable_unref(root);
+    remove(path);
+
+    printf("✓ YAML errors and files test passed\n");
+}
+
+int main() {
+    printf("=== YAML Parser Tests ===\n");
+
+    test_yaml_scalars();
+    test_yaml_nesting();
+    test_yaml_anchors();
+    test_yaml_duplicate_keys();
+    test_yaml_errors_and_files();
+
+    printf("\n✅ All YAML parser tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file test_bench_compare.c
+ * @brief Test benchmark baselines and regression detection
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/performance.h"
+
+/**
+ * @brief Record a result whose samples are base, base + step, ...
+ * @param suite Benchmark suite
+ * @param name Test name
+ * @param base First sample
+ * @param step Sample spacing
+ * @param count Number of samples
+ */
+static void record_linear(benchmark_suite* suite, const char* name,
+                          uint64_t base, uint64_t step, uint32_t count) {
+    uint64_t* times = malloc(count * sizeof(uint64_t));
+    assert(times != NULL);
+    for (uint32_t i = 0; i < count; i++) {
+        times[count - 1 - i] = base + i * step;
+    }
+    assert(benchmark_record(suite, name, times, count) == 0);
+}
+
+/**
+ * @brief The rank test separates shifted samples from overlapping ones
+ */
+void test_mann_whitney() {
+    printf("Testing Mann-Whitney U test...\n");
+
+    uint64_t low[10], high[10], mixed[10], same[10];
+    for (int i = 0; i < 10; i++) {
+        low[i] = 100 + i;
+        high[i] = 200 + i;
+        mixed[i] = 100 + i + (i % 2);
+        same[i] = 500;
+    }
+
+    // Complete separation of 10 vs 10: z = 49.5 / sqrt(175)
+    double separated = benchmark_mann_whitney(low, 10, high, 10);
+    assert(separated > 0.0001 && separated < 0.0003);
+    assert(benchmark_mann_whitney(high, 10, low, 10) == separated);
+
+    assert(benchmark_mann_whitney(low, 10, mixed, 10) > 0.5);
+    assert(benchmark_mann_whitney(low, 10, low, 10) == 1.0);
+
+    // All values tied carries no information
+    assert(benchmark_mann_whitney(same, 10, same, 10) == 1.0);
+    assert(benchmark_mann_whitney(low, 0, high, 10) == 1.0);
+
+    printf("✓ Mann-Whitney U test passed\n");
+}
+
+/**
+ * @brief Verdicts need both a large shift and significance
+ */
+void test_compare_verdicts() {
+    printf("Testing baseline comparison...\n");
+
+    benchmark_suite* baseline = benchmark_suite_create("baseline");
+    benchmark_suite* current = benchmark_suite_create("current");
+    assert(baseline != NULL && current != NULL);
+
+    record_linear(baseline, "slower", 1000, 10, 20);
+    record_linear(baseline, "faster", 1000, 10, 20);
+    record_linear(baseline, "noisy", 1000, 10, 20);
+    record_linear(baseline, "small", 1000, 1, 20);
+
+    record_linear(current, "slower", 1500, 10, 20);
+    record_linear(current, "faster", 500, 10, 20);
+    record_linear(current, "noisy", 1005, 10, 20);
+    record_linear(current, "small", 1030, 1, 20);
+    record_linear(current, "added", 1000, 10, 20);
+
+    // Samples are kept sorted for later comparisons
+    assert(current->results[0].samples[0] == 1500);
+    assert(current->results[0].samples[19] == 1690);
+
+    benchmark_comparison* comparisons = NULL;
+    size_t count = benchmark_compare(baseline, current, 0.05, 0.01, &comparisons);
+    assert(count == 5 && comparisons != NULL);
+    assert(comparisons[0].verdict == BENCHMARK_REGRESSED);
+    assert(comparisons[0].change > 0.45 && comparisons[0].p_value < 0.01);
+    assert(comparisons[1].verdict == BENCHMARK_IMPROVED);
+    assert(comparisons[2].verdict == BENCHMARK_UNCHANGED);
+    // Significant, but within the threshold
+    assert(comparisons[3].p_value < 0.01);
+    assert(comparisons[3].verdict == BENCHMARK_UNCHANGED);
+    assert(comparisons[4].verdict == BENCHMARK_NEW);
+
+    char* report = benchmark_comparison_report(comparisons, count);
+    assert(report != NULL);
+    assert(strstr(report, "REGRESSED") != NULL);
+    assert(strstr(report, "Regressions: 1") != NULL);
+    free(report);
+    free(comparisons);
+
+    benchmark_suite_destroy(current);
+    benchmark_suite_destroy(baseline);
+    printf("✓ Baseline comparison test passed\n");
+}
+
+/**
+ * @brief Saved results load back with their samples
+ */
+void test_save_load() {
+    printf("Testing result save and load...\n");
+
+    const char* path = "/tmp/xmd_test_bench_baseline.json";
+    benchmark_suite* suite = benchmark_suite_create("saved \"suite\"");
+    assert(suite != NULL);
+    suite->warmup_iterations = 4;
+    record_linear(suite, "render", 2000, 7, 9);
+    suite->results[0].bytes_per_iteration = 4096;
+    assert(benchmark_save_json(suite, path) == 0);
+
+    benchmark_suite* loaded = benchmark_load_json(path);
+    assert(loaded != NULL);
+    assert(strcmp(loaded->suite_name, "saved \"suite\"") == 0);
+    assert(loaded->warmup_iterations == 4);
+    assert(loaded->result_count == 1);
+    const benchmark_result* original = &suite->results[0];
+    const benchmark_result* restored = &loaded->results[0];
+    assert(strcmp(restored->test_name, "render") == 0);
+    assert(restored->iterations == 9 && restored->samples != NULL);
+    assert(memcmp(restored->samples, original->samples, 9 * sizeof(uint64_t)) == 0);
+    assert(restored->median_time_ns == original->median_time_ns);
+    assert(restored->p99_time_ns == original->p99_time_ns);
+    assert(restored->bytes_per_iteration == 4096);
+
+    benchmark_comparison* comparisons = NULL;
+    assert(benchmark_compare(loaded, suite, 0.05, 0.01, &comparisons) == 1);
+    assert(comparisons[0].verdict == BENCHMARK_UNCHANGED);
+    free(comparisons);
+    benchmark_suite_destroy(loaded);
+
+    // Results without samples keep their statistics but cannot be tested
+    FILE* file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("{\"suite\":\"old\",\"results\":[{\"name\":\"render\",\"iterations\":9,"
+          "\"median_ns\":2028,\"min_ns\":2000}]}", file);
+    fclose(file);
+    loaded = benchmark_load_json(path);
+    assert(loaded != NULL && loaded->result_count == 1);
+    assert(loaded->results[0].samples == NULL);
+    assert(loaded->results[0].median_time_ns == 2028);
+    assert(benchmark_compare(loaded, suite, 0.05, 0.01, &comparisons) == 1);
+    assert(comparisons[0].verdict == BENCHMARK_INCONCLUSIVE);
+    free(comparisons);
+    benchmark_suite_destroy(loaded);
+
+    file = fopen(path, "w");
+    assert(file != NULL);
+    fputs("[1, 2, 3]", file);
+    fclose(file);
+    assert(benchmark_load_json(path) == NULL);
+    remove(path);
+    assert(benchmark_load_json(path) == NULL);
+
+    benchmark_suite_destroy(suite);
+    printf("✓ Result save and load test passed\n");
+}
+
+int main() {
+    printf("=== Benchmark Comparison Tests ===\n");
+
+    test_mann_whitney();
+    test_compare_verdicts();
+    test_save_load();
+
+    printf("\n✅ All benchmark comparison tests passed!\n");
+    return 0;
+}
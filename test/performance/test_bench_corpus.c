@@ -0,0 +1,120 @@
+/**
+ * @file test_bench_corpus.c
+ * @brief Test the macro-benchmark corpus and percentile reporting
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/performance.h"
+#include "../../include/bench_corpus.h"
+
+/**
+ * @brief Percentiles use the nearest-rank method
+ */
+void test_percentiles() {
+    printf("Testing latency percentiles...\n");
+
+    uint64_t times[100];
+    for (int i = 0; i < 100; i++) {
+        times[i] = (uint64_t)(100 - i);
+    }
+    benchmark_result result;
+    memset(&result, 0, sizeof(result));
+    calculate_stats(times, 100, &result);
+    assert(result.min_time_ns == 1 && result.max_time_ns == 100);
+    assert(result.p90_time_ns == 90);
+    assert(result.p99_time_ns == 99);
+
+    uint64_t few[3] = {30, 10, 20};
+    memset(&result, 0, sizeof(result));
+    calculate_stats(few, 3, &result);
+    assert(result.median_time_ns == 20);
+    assert(result.p90_time_ns == 30 && result.p99_time_ns == 30);
+
+    printf("✓ Latency percentile test passed\n");
+}
+
+/**
+ * @brief A small corpus generates every case and each one renders
+ */
+void test_corpus_cases() {
+    printf("Testing benchmark corpus...\n");
+
+    bench_corpus* corpus = bench_corpus_create(NULL, 0.02);
+    assert(corpus != NULL);
+    assert(corpus->case_count == BENCH_CORPUS_CASE_COUNT);
+
+    const char* expected[] = {"prose", "variables", "nested_loops",
+                              "import_fanout", "json_import", "exec_stub"};
+    for (size_t i = 0; i < corpus->case_count; i++) {
+        bench_case* bench = &corpus->cases[i];
+        bool known = false;
+        for (size_t j = 0; j < BENCH_CORPUS_CASE_COUNT; j++) {
+            known = known || strcmp(bench->name, expected[j]) == 0;
+        }
+        assert(known);
+        assert(bench->bytes > 0);
+        assert(bench_corpus_run_case(bench) == 0);
+    }
+
+    char* dir = strdup(corpus->dir);
+    assert(dir != NULL);
+    bench_corpus_destroy(corpus);
+
+    // Temporary corpora are removed with their files
+    FILE* gone = fopen(dir, "r");
+    assert(gone == NULL);
+    free(dir);
+
+    printf("✓ Benchmark corpus test passed\n");
+}
+
+/**
+ * @brief Suite results serialize to JSON with warmup and percentiles
+ */
+void test_suite_json() {
+    printf("Testing benchmark JSON output...\n");
+
+    bench_corpus* corpus = bench_corpus_create(NULL, 0.02);
+    benchmark_suite* suite = benchmark_suite_create("corpus \"small\"");
+    assert(corpus != NULL && suite != NULL);
+    assert(suite->warmup_iterations == 1);
+    suite->warmup_iterations = 0;
+
+    bench_case* prose = &corpus->cases[0];
+    assert(benchmark_run_throughput(suite, prose->name, bench_corpus_run_case,
+                                    prose, 3, prose->bytes) == 0);
+    assert(suite->result_count == 1);
+    const benchmark_result* result = &suite->results[0];
+    assert(result->iterations == 3);
+    assert(result->min_time_ns <= result->p90_time_ns);
+    assert(result->p90_time_ns <= result->p99_time_ns);
+    assert(result->p99_time_ns <= result->max_time_ns);
+
+    char* json = benchmark_generate_json(suite);
+    assert(json != NULL);
+    assert(strstr(json, "\"suite\":\"corpus \\\"small\\\"\"") != NULL);
+    assert(strstr(json, "\"warmup\":0") != NULL);
+    assert(strstr(json, "\"name\":\"prose\"") != NULL);
+    assert(strstr(json, "\"p90_ns\":") != NULL);
+    assert(strstr(json, "\"p99_ns\":") != NULL);
+    free(json);
+
+    benchmark_suite_destroy(suite);
+    bench_corpus_destroy(corpus);
+    printf("✓ Benchmark JSON output test passed\n");
+}
+
+int main() {
+    printf("=== Benchmark Corpus Tests ===\n");
+
+    test_percentiles();
+    test_corpus_cases();
+    test_suite_json();
+
+    printf("\n✅ All benchmark corpus tests passed!\n");
+    return 0;
+}
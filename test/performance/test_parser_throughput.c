@@ -0,0 +1,90 @@
+/**
+ * @file test_parser_throughput.c
+ * @brief Parse throughput benchmarks for JSON and YAML data imports
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/performance.h"
+#include "../../include/json_parser.h"
+#include "../../include/yaml_parser.h"
+#include "../../include/variable.h"
+
+#define RECORD_COUNT 2000
+
+/**
+ * @brief Build a document of RECORD_COUNT records
+ * @param yaml Emit YAML instead of JSON
+ * @return Allocated document text
+ */
+static char* build_document(int yaml) {
+    size_t capacity = RECORD_COUNT * 128 + 64;
+    char* text = malloc(capacity);
+    assert(text != NULL);
+    size_t pos = (size_t)snprintf(text, capacity, yaml ? "records:\n" : "{\"records\": [");
+    for (int i = 0; i < RECORD_COUNT; i++) {
+        if (yaml) {
+            pos += (size_t)snprintf(text + pos, capacity - pos,
+                "  - {id: %d, name: \"record %d\", score: %d.5, active: true}\n", i, i, i);
+        } else {
+            pos += (size_t)snprintf(text + pos, capacity - pos,
+                "%s{\"id\": %d, \"name\": \"record %d\", \"score\": %d.5, \"active\": true}",
+                i ? ", " : "", i, i, i);
+        }
+    }
+    if (!yaml) {
+        snprintf(text + pos, capacity - pos, "]}");
+    }
+    return text;
+}
+
+static int parse_json(void* data) {
+    variable* root = json_parser_parse_string((const char*)data);
+    if (!root) {
+        return -1;
+    }
+    variable_unref(root);
+    return 0;
+}
+
+static int parse_yaml(void* data) {
+    variable* root = yaml_parser_parse_string((const char*)data);
+    if (!root) {
+        return -1;
+    }
+    variable_unref(root);
+    return 0;
+}
+
+int main() {
+    printf("=== Parser Throughput Benchmarks ===\n");
+
+    benchmark_suite* suite = benchmark_suite_create("Data import parsing");
+    assert(suite != NULL);
+
+    char* json = build_document(0);
+    assert(benchmark_run_throughput(suite, "json_records", parse_json, json, 20, strlen(json)) == 0);
+    assert(suite->results[0].throughput_mb_per_sec > 0.0);
+
+    char* yaml = build_document(1);
+    if (parse_yaml(yaml) == 0) {
+        assert(benchmark_run_throughput(suite, "yaml_records", parse_yaml, yaml, 20, strlen(yaml)) == 0);
+    } else {
+        printf("YAML benchmark skipped: %s\n", yaml_parser_get_error());
+    }
+
+    char* report = benchmark_generate_report(suite);
+    assert(report != NULL);
+    printf("%s\n", report);
+
+    free(report);
+    free(json);
+    free(yaml);
+    benchmark_suite_destroy(suite);
+
+    printf("✅ Parser throughput benchmarks passed!\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file test_profiler_hotspots.c
+ * @brief Test per-directive hot-spot profiling
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/performance.h"
+#include "../../include/store.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Find a recorded directive by position and keyword
+ * @param profiler Profiler instance
+ * @param line Directive line
+ * @param label Directive keyword
+ * @return Entry or NULL
+ */
+static const perf_hotspot* find_hotspot(const perf_profiler* profiler, size_t line, const char* label) {
+    for (size_t i = 0; i < profiler->hotspot_count; i++) {
+        const perf_hotspot* entry = &profiler->hotspots[i];
+        if (entry->location.line == line && strcmp(entry->label, label) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Nested frames split self and inclusive cost
+ */
+void test_frame_accounting() {
+    printf("Testing directive frame accounting...\n");
+
+    perf_profiler* profiler = perf_profiler_create();
+    assert(profiler != NULL);
+    source_location outer = {3, 1, "page.md"};
+    source_location inner = {4, 5, "page.md"};
+
+    // Nothing is recorded unless directive profiling is enabled
+    assert(perf_profiler_start(profiler) == 0);
+    assert(!perf_hotspot_enter(profiler, &outer, "for"));
+
+    profiler->hotspots_enabled = true;
+    for (int pass = 0; pass < 2; pass++) {
+        assert(perf_hotspot_enter(profiler, &outer, "for"));
+        perf_profiler_record_alloc(profiler, 24);
+        for (int i = 0; i < 3; i++) {
+            assert(perf_hotspot_enter(profiler, &inner, "exec"));
+            perf_profiler_record_alloc(profiler, 24);
+            perf_profiler_record_alloc(profiler, 24);
+            perf_hotspot_exit(profiler, 10);
+        }
+        perf_hotspot_exit(profiler, 30);
+    }
+    assert(perf_profiler_stop(profiler) == 0);
+
+    // Repeated passes aggregate into one entry per call path
+    assert(profiler->hotspot_count == 2);
+    const perf_hotspot* loop = find_hotspot(profiler, 3, "for");
+    const perf_hotspot* body = find_hotspot(profiler, 4, "exec");
+    assert(loop != NULL && body != NULL);
+    assert(body->parent == (size_t)(loop - profiler->hotspots));
+    assert(loop->calls == 2 && body->calls == 6);
+    assert(loop->allocations == 2 && body->allocations == 12);
+    assert(loop->output_bytes == 60 && body->output_bytes == 60);
+    assert(loop->self_ns + body->total_ns == loop->total_ns);
+    assert(body->self_ns == body->total_ns);
+    assert(strcmp(body->location.filename, "page.md") == 0);
+
+    // Restarting drops the previous session's entries
+    assert(perf_profiler_start(profiler) == 0);
+    assert(profiler->hotspot_count == 0);
+    perf_profiler_stop(profiler);
+
+    perf_profiler_destroy(profiler);
+    printf("✓ Directive frame accounting test passed\n");
+}
+
+/**
+ * @brief Nested content is located relative to its origin
+ */
+void test_origin_mapping() {
+    printf("Testing nested content locations...\n");
+
+    perf_profiler* profiler = perf_profiler_create();
+    assert(profiler != NULL);
+
+    source_location top = perf_hotspot_locate(profiler, 7, 3, "page.md");
+    assert(top.line == 7 && top.column == 3 && strcmp(top.filename, "page.md") == 0);
+
+    source_location body = {5, 20, "page.md"};
+    source_location previous = perf_hotspot_set_origin(profiler, body);
+    assert(previous.line == 0);
+    source_location first = perf_hotspot_locate(profiler, 1, 4, "ignored.md");
+    assert(first.line == 5 && first.column == 23 && strcmp(first.filename, "page.md") == 0);
+    source_location later = perf_hotspot_locate(profiler, 3, 4, "ignored.md");
+    assert(later.line == 7 && later.column == 4);
+
+    perf_hotspot_set_origin(profiler, previous);
+    assert(profiler->hotspot_origin.line == 0);
+
+    perf_profiler_destroy(profiler);
+    printf("✓ Nested content location test passed\n");
+}
+
+/**
+ * @brief Rendering attributes loop bodies to their own lines
+ */
+void test_render_hotspots() {
+    printf("Testing render hot spots...\n");
+
+    // Heap traffic reaches the profiler through the stats allocator
+    xmd_alloc_stats heap;
+    assert(xmd_alloc_stats_init(&heap) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&heap);
+    assert(xmd_allocator_set(&tracking) == 0);
+
+    store* variables = store_create();
+    perf_profiler* profiler = perf_profiler_create();
+    assert(variables != NULL && profiler != NULL);
+    profiler->hotspots_enabled = true;
+    assert(perf_profiler_start(profiler) == 0);
+    perf_profiler_attach(profiler);
+
+    const char* input = "<!-- xmd:set items = [\"a\", \"b\", \"c\"] -->\n"
+                        "<!-- xmd:for item in items -->\n"
+                        "  <!-- xmd:set last = item -->row\n"
+                        "<!-- xmd:endfor -->\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    free(output);
+
+    perf_profiler_attach(NULL);
+    assert(perf_profiler_stop(profiler) == 0);
+
+    const perf_hotspot* set_items = find_hotspot(profiler, 1, "set");
+    const perf_hotspot* loop = find_hotspot(profiler, 2, "for");
+    const perf_hotspot* set_last = find_hotspot(profiler, 3, "set");
+    assert(set_items != NULL && loop != NULL && set_last != NULL);
+    assert(set_items->calls == 1 && set_items->allocations > 0);
+    assert(loop->calls == 1);
+    assert(set_last->calls == 3 && set_last->location.column == 3);
+    assert(set_last->parent == (size_t)(loop - profiler->hotspots));
+    assert(loop->output_bytes > 0);
+
+    char* table = perf_hotspot_report_table(profiler);
+    assert(table != NULL);
+    assert(strstr(table, "<input>:2:1 for") != NULL);
+    assert(strstr(table, "<input>:3:3 set") != NULL);
+    // Sorted by inclusive time: the loop encloses its body
+    assert(strstr(table, "2:1 for") < strstr(table, "3:3 set"));
+    free(table);
+
+    const char* folded_path = "/tmp/xmd_test_hotspots.folded";
+    assert(perf_hotspot_write_folded(profiler, folded_path) == 0);
+    FILE* folded = fopen(folded_path, "r");
+    assert(folded != NULL);
+    char line[256];
+    bool nested = false;
+    while (fgets(line, sizeof(line), folded)) {
+        if (strncmp(line, "<input>:2:1 for;<input>:3:3 set ", 32) == 0) {
+            nested = strtoull(line + 32, NULL, 10) > 0;
+        }
+    }
+    fclose(folded);
+    remove(folded_path);
+    assert(nested);
+
+    perf_profiler_destroy(profiler);
+    store_destroy(variables);
+    xmd_allocator_set(NULL);
+    xmd_alloc_stats_destroy(&heap);
+    printf("✓ Render hot spots test passed\n");
+}
+
+int main() {
+    printf("=== Profiler Hot Spot Tests ===\n");
+
+    test_frame_accounting();
+    test_origin_mapping();
+    test_render_hotspots();
+
+    printf("\n✅ All profiler hot spot tests passed!\n");
+    return 0;
+}
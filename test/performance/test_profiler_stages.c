@@ -0,0 +1,161 @@
+/**
+ * @file test_profiler_stages.c
+ * @brief Test per-stage profiling of the render pipeline
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/performance.h"
+#include "../../include/c_api_internal.h"
+
+/**
+ * @brief Read the "calls" count of a stage from a JSON report
+ * @param report Report text
+ * @param stage Stage name
+ * @return Call count, or -1 if the stage is missing
+ */
+static long stage_calls(const char* report, const char* stage) {
+    char key[64];
+    snprintf(key, sizeof(key), "\"%s\":{\"ns\":", stage);
+    const char* entry = strstr(report, key);
+    if (!entry) {
+        return -1;
+    }
+    const char* calls = strstr(entry, "\"calls\":");
+    return calls ? strtol(calls + 8, NULL, 10) : -1;
+}
+
+/**
+ * @brief Nested stages are charged exclusively and counted per entry
+ */
+void test_stage_nesting() {
+    printf("Testing exclusive stage timing...\n");
+
+    perf_profiler* profiler = perf_profiler_create();
+    assert(profiler != NULL);
+
+    // Stages are ignored until the profiler is started
+    perf_profiler_stage_begin(profiler, PERF_STAGE_SCAN);
+    perf_profiler_stage_end(profiler, PERF_STAGE_SCAN);
+    assert(profiler->metrics.stage_calls[PERF_STAGE_SCAN] == 0);
+
+    assert(perf_profiler_start(profiler) == 0);
+    perf_profiler_stage_begin(profiler, PERF_STAGE_SCAN);
+    for (int i = 0; i < 3; i++) {
+        perf_profiler_stage_begin(profiler, PERF_STAGE_EVALUATE);
+        perf_profiler_stage_begin(profiler, PERF_STAGE_LEX);
+        perf_profiler_stage_end(profiler, PERF_STAGE_LEX);
+        perf_profiler_stage_end(profiler, PERF_STAGE_EVALUATE);
+    }
+    // Left open on purpose: stop closes both remaining stages
+    perf_profiler_stage_begin(profiler, PERF_STAGE_FORMAT);
+    assert(perf_profiler_stop(profiler) == 0);
+
+    const perf_metrics* metrics = &profiler->metrics;
+    assert(profiler->stage_depth == 0);
+    assert(metrics->stage_calls[PERF_STAGE_SCAN] == 1);
+    assert(metrics->stage_calls[PERF_STAGE_EVALUATE] == 3);
+    assert(metrics->stage_calls[PERF_STAGE_LEX] == 3);
+    assert(metrics->stage_calls[PERF_STAGE_FORMAT] == 1);
+
+    uint64_t charged = 0;
+    for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+        charged += metrics->stage_time_ns[i];
+    }
+    assert(charged <= metrics->execution_time_ns);
+
+    perf_profiler_destroy(profiler);
+    printf("✓ Exclusive stage timing test passed\n");
+}
+
+/**
+ * @brief The JSON report names every stage and escapes the source
+ */
+void test_report_json() {
+    printf("Testing JSON profile report...\n");
+
+    perf_profiler* profiler = perf_profiler_create();
+    assert(profiler != NULL);
+    assert(perf_profiler_start(profiler) == 0);
+    perf_profiler_record_alloc(profiler, 24);
+    perf_profiler_record_cache_hit(profiler);
+    assert(perf_profiler_stop(profiler) == 0);
+
+    char* report = perf_profiler_report_json(profiler, "dir/\"odd\".md");
+    assert(report != NULL);
+    assert(report[0] == '{' && report[strlen(report) - 1] == '}');
+    assert(strstr(report, "\"file\":\"dir\\/\\\"odd\\\".md\"") != NULL);
+    for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+        assert(stage_calls(report, perf_stage_name((perf_stage)i)) == 0);
+    }
+    assert(strstr(report, "\"allocations\":1,") != NULL);
+    assert(strstr(report, "\"bytes_allocated\":24,") != NULL);
+    assert(strstr(report, "\"cache\":{\"hits\":1,\"misses\":0}") != NULL);
+    free(report);
+
+    report = perf_profiler_report_json(profiler, NULL);
+    assert(report != NULL && strstr(report, "\"file\":null") != NULL);
+    free(report);
+
+    perf_profiler_destroy(profiler);
+    printf("✓ JSON profile report test passed\n");
+}
+
+/**
+ * @brief Profiled C API renders report the stages they went through
+ */
+void test_c_api_profiling() {
+    printf("Testing C API render profiling...\n");
+
+    xmd_context_internal* ctx = c_api_xmd_init(NULL);
+    assert(ctx != NULL);
+    const char* input = "<!-- xmd:set count = 3 -->\n"
+                        "<!-- xmd:if count -->many<!-- xmd:endif -->\n"
+                        "count={{count}}\n";
+
+    // Nothing is recorded until profiling is enabled
+    xmd_result* result = xmd_process_string_api(ctx, input, strlen(input));
+    assert(result != NULL && result->error_code == 0);
+    c_api_xmd_result_free(result);
+    assert(c_api_xmd_get_profile(ctx) == NULL);
+
+    assert(c_api_xmd_set_profiling(ctx, true) == 0);
+    result = xmd_process_string_api(ctx, input, strlen(input));
+    assert(result != NULL && result->error_code == 0);
+    assert(strstr(result->output, "count=3") != NULL);
+    assert(result->processing_time_ms >= 0.0);
+    c_api_xmd_result_free(result);
+
+    const char* report = c_api_xmd_get_profile(ctx);
+    assert(report != NULL);
+    assert(stage_calls(report, "preprocess") == 1);
+    assert(stage_calls(report, "scan") == 1);
+    assert(stage_calls(report, "lex") > 0);
+    assert(stage_calls(report, "parse") > 0);
+    assert(stage_calls(report, "evaluate") > 0);
+    assert(stage_calls(report, "exec") == 0);
+    assert(strstr(report, "\"allocations\":") != NULL);
+
+    // The thread is detached again after the render
+    assert(xmd_active_profiler == NULL);
+
+    assert(c_api_xmd_set_profiling(ctx, false) == 0);
+    assert(ctx->profiler == NULL);
+    c_api_xmd_cleanup(ctx);
+
+    printf("✓ C API render profiling test passed\n");
+}
+
+int main() {
+    printf("=== Profiler Stage Tests ===\n");
+
+    test_stage_nesting();
+    test_report_json();
+    test_c_api_profiling();
+
+    printf("\n✅ All profiler stage tests passed!\n");
+    return 0;
+}
@@ -318,6 +318,53 @@ void test_edge_cases() {
     printf("✓ Edge case tests passed\n");
 }
 
+/**
+ * @brief Test parent-linked scope frames
+ */
+void test_scope_frames() {
+    printf("Testing scope frames...\n");
+    
+    store* global = store_create();
+    variable* outer = variable_create_string("outer");
+    store_set(global, "name", outer);
+    variable_unref(outer);
+    
+    store* frame = store_push_scope(global);
+    assert(frame != NULL);
+    assert(store_push_scope(NULL) == NULL);
+    
+    // Reads fall through, writes land in the frame
+    assert(store_get(frame, "name") == store_get(global, "name"));
+    variable* inner = variable_create_string("inner");
+    store_set(frame, "name", inner);
+    variable* item = variable_create_number(1);
+    store_set(frame, "item", item);
+    assert(store_get(frame, "name") == inner);
+    assert(strcmp(store_get(global, "name")->value.string_value, "outer") == 0);
+    assert(store_has(frame, "item") && !store_has(global, "item"));
+    assert(store_size(frame) == 2);
+    
+    // Nested frames see every enclosing scope
+    store* nested = store_push_scope(frame);
+    assert(store_get(nested, "item") == item);
+    assert(store_get(nested, "name") == inner);
+    assert(store_pop_scope(nested) == frame);
+    
+    // Removing from the frame uncovers the parent binding
+    assert(store_remove(frame, "name"));
+    assert(strcmp(store_get(frame, "name")->value.string_value, "outer") == 0);
+    
+    assert(store_pop_scope(frame) == global);
+    assert(item->ref_count == 1);
+    assert(store_get(global, "item") == NULL);
+    variable_unref(inner);
+    variable_unref(item);
+    
+    store_destroy(global);
+    
+    printf("✓ Scope frame tests passed\n");
+}
+
 /**
  * @brief Main test function
  */
@@ -331,6 +378,7 @@ int main() {
     test_store_keys();
     test_variable_overwriting();
     test_edge_cases();
+    test_scope_frames();
     
     printf("\n✅ All store tests passed!\n");
     return 0;
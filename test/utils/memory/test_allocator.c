@@ -0,0 +1,240 @@
+/**
+ * @file test_allocator.c
+ * @brief Unit tests for the pluggable allocator
+ *
+ * Renders through a registry allocator that knows every block it handed
+ * out, so any allocation that bypasses the xmd_malloc family, or any
+ * xmd_free of a foreign block, is detected.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include "../../../include/allocator.h"
+#include "../../../include/performance.h"
+#include "../../../include/store.h"
+#include "../../../include/config.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/** Open-addressing set of live blocks */
+#define REGISTRY_SLOTS (1u << 16)
+
+typedef struct {
+    void* slots[REGISTRY_SLOTS];
+    size_t live;
+    size_t foreign;
+    size_t calls[XMD_ALLOC_CATEGORY_COUNT];
+} registry;
+
+static char tombstone_marker;
+#define TOMBSTONE ((void*)&tombstone_marker)
+
+static size_t slot_of(const void* ptr) {
+    return (size_t)(((uintptr_t)ptr >> 4) * 2654435761u) & (REGISTRY_SLOTS - 1);
+}
+
+static void registry_add(registry* reg, void* ptr) {
+    size_t i = slot_of(ptr);
+    while (reg->slots[i] && reg->slots[i] != TOMBSTONE) {
+        i = (i + 1) & (REGISTRY_SLOTS - 1);
+    }
+    reg->slots[i] = ptr;
+    reg->live++;
+}
+
+static int registry_remove(registry* reg, void* ptr) {
+    size_t i = slot_of(ptr);
+    while (reg->slots[i]) {
+        if (reg->slots[i] == ptr) {
+            reg->slots[i] = TOMBSTONE;
+            reg->live--;
+            return 1;
+        }
+        i = (i + 1) & (REGISTRY_SLOTS - 1);
+    }
+    reg->foreign++;
+    return 0;
+}
+
+static void* registry_allocate(void* user_data, size_t size, xmd_alloc_category category) {
+    registry* reg = user_data;
+    void* ptr = malloc(size ? size : 1);
+    if (ptr) {
+        registry_add(reg, ptr);
+        reg->calls[category]++;
+    }
+    return ptr;
+}
+
+static void* registry_reallocate(void* user_data, void* ptr, size_t size, xmd_alloc_category category) {
+    registry* reg = user_data;
+    registry_remove(reg, ptr);
+    void* resized = realloc(ptr, size);
+    registry_add(reg, resized ? resized : ptr);
+    reg->calls[category]++;
+    return resized;
+}
+
+static void registry_deallocate(void* user_data, void* ptr) {
+    registry_remove(user_data, ptr);
+    free(ptr);
+}
+
+/**
+ * @brief A full render allocates and releases only through the allocator
+ */
+static void test_render_is_routed(void) {
+    registry* reg = calloc(1, sizeof(registry));
+    assert(reg != NULL);
+    xmd_allocator allocator = {registry_allocate, registry_reallocate, registry_deallocate, reg};
+    assert(xmd_allocator_set(&allocator) == 0);
+    assert(xmd_allocator_get() != NULL && xmd_allocator_get()->user_data == reg);
+
+    store* variables = store_create();
+    assert(variables != NULL);
+    const char* input = "<!-- xmd:set items = [\"a\", \"b\", \"c\"] -->\n"
+                        "<!-- xmd:set title = \"List\" -->\n"
+                        "# {{title}}\n"
+                        "<!-- xmd:for item in items -->\n"
+                        "- {{item}}\n"
+                        "<!-- xmd:endfor -->\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    assert(strstr(output, "# List") != NULL && strstr(output, "- c") != NULL);
+    xmd_free(output);
+    store_destroy(variables);
+    // Release the lazily created global configuration as well
+    xmd_internal_config_set_global(NULL);
+
+    xmd_allocator_set(NULL);
+    assert(xmd_allocator_get() == NULL);
+    assert(reg->foreign == 0);
+    assert(reg->live == 0);
+    assert(reg->calls[XMD_ALLOC_VARIABLE] > 0);
+    assert(reg->calls[XMD_ALLOC_STORE] > 0);
+    assert(reg->calls[XMD_ALLOC_STRING] > 0);
+    assert(reg->calls[XMD_ALLOC_AST] > 0);
+    free(reg);
+    printf("✓ test_render_is_routed\n");
+}
+
+/**
+ * @brief The stats allocator counts categories and feeds the profiler
+ */
+static void test_stats_allocator(void) {
+    // A block from before installation can still be released
+    char* early = xmd_malloc(64);
+    assert(early != NULL);
+
+    perf_profiler* profiler = perf_profiler_create();
+    assert(profiler != NULL && perf_profiler_start(profiler) == 0);
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&tracking) == 0);
+    perf_profiler_attach(profiler);
+
+    char* name = xmd_strdup("allocator");
+    void* block = xmd_calloc_tagged(16, 64, XMD_ALLOC_AST);
+    assert(name != NULL && block != NULL);
+    assert(((unsigned char*)block)[1023] == 0);
+    block = xmd_realloc_tagged(block, 4096, XMD_ALLOC_AST);
+    assert(block != NULL);
+    assert(stats.allocations[XMD_ALLOC_STRING] == 1);
+    assert(stats.allocations[XMD_ALLOC_AST] == 2);
+    assert(stats.bytes[XMD_ALLOC_AST] >= 1024 + 4096);
+    assert(stats.live_bytes >= 4096 + 10);
+    uint64_t peak = stats.peak_live_bytes;
+
+    xmd_free(block);
+    xmd_free(name);
+    xmd_free(early);
+    assert(stats.deallocations == 3);
+    assert(stats.live_bytes == 0);
+    assert(stats.peak_live_bytes == peak);
+
+    perf_profiler_attach(NULL);
+    xmd_allocator_set(NULL);
+    xmd_alloc_stats_destroy(&stats);
+
+    assert(perf_profiler_stop(profiler) == 0);
+    assert(profiler->metrics.allocations == 3);
+    assert(profiler->metrics.deallocations == 4);
+    assert(profiler->metrics.memory_peak_bytes >= 4096);
+    perf_profiler_destroy(profiler);
+    assert(strcmp(xmd_alloc_category_name(XMD_ALLOC_TOKEN), "token") == 0);
+    printf("✓ test_stats_allocator\n");
+}
+
+/**
+ * @brief A heap budget tracks live bytes and refuses growth past its limit
+ */
+static void test_heap_budget(void) {
+    char* early = xmd_malloc(256);
+    assert(early != NULL);
+
+    xmd_heap_budget budget;
+    xmd_heap_budget_init(&budget, 4096);
+    assert(xmd_heap_budget_attach(&budget) == NULL);
+
+    char* first = xmd_malloc(1000);
+    assert(first != NULL);
+    assert(budget.live_bytes >= 1000 && budget.live_bytes < 4096);
+    assert(xmd_malloc(8192) == NULL);
+    assert(budget.exceeded && xmd_heap_budget_exhausted());
+
+    // A refused resize leaves the block intact
+    memset(first, 'x', 1000);
+    assert(xmd_realloc(first, 8192) == NULL);
+    assert(first[999] == 'x');
+    first = xmd_realloc(first, 2000);
+    assert(first != NULL && first[999] == 'x');
+    uint64_t peak = budget.peak_bytes;
+    assert(peak >= 2000);
+
+    // Blocks from before the budget never take it below zero
+    xmd_free(first);
+    xmd_free(early);
+    assert(budget.live_bytes == 0);
+    assert(budget.peak_bytes == peak);
+
+    assert(xmd_heap_budget_attach(NULL) == &budget);
+    assert(!xmd_heap_budget_exhausted());
+    printf("✓ test_heap_budget\n");
+}
+
+/**
+ * @brief The wrappers keep their libc contracts
+ */
+static void test_libc_contract(void) {
+    xmd_allocator incomplete = {registry_allocate, NULL, registry_deallocate, NULL};
+    assert(xmd_allocator_set(&incomplete) == -1);
+    assert(xmd_allocator_get() == NULL);
+
+    assert(xmd_calloc(SIZE_MAX / 2, 4) == NULL);
+    assert(xmd_strdup(NULL) == NULL);
+    char* prefix = xmd_strndup("allocator", 5);
+    assert(prefix != NULL && strcmp(prefix, "alloc") == 0);
+    xmd_free(prefix);
+    char* whole = xmd_strndup("abc", 10);
+    assert(whole != NULL && strcmp(whole, "abc") == 0);
+    assert(xmd_realloc(whole, 0) == NULL);
+    xmd_free(NULL);
+    printf("✓ test_libc_contract\n");
+}
+
+int main(void) {
+    printf("Running allocator tests...\n");
+
+    test_render_is_routed();
+    test_stats_allocator();
+    test_heap_budget();
+    test_libc_contract();
+
+    printf("All allocator tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file test_xmd_string.c
+ * @brief Unit tests for reference-counted strings
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "../../../include/xmd_string.h"
+#include "../../../include/variable.h"
+#include "../../../include/store.h"
+#include "../../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Strings carry their length and hash and share on reference
+ */
+static void test_sharing(void) {
+    char* text = xmd_string_dup("shared string value");
+    assert(text != NULL && strcmp(text, "shared string value") == 0);
+    assert(xmd_string_length(text) == 19);
+    uint64_t hash = xmd_string_hash(text);
+    assert(hash != 0 && hash == xmd_string_hash(text));
+
+    char* other = xmd_string_share(text);
+    assert(other == text);
+    assert(xmd_string_of(text)->ref_count == 2);
+    xmd_string_release(other);
+    assert(xmd_string_of(text)->ref_count == 1);
+
+    // Appending to a shared string leaves the other holder's copy intact
+    char* holder = xmd_string_share(text);
+    char* longer = xmd_string_append(text, "!", 1);
+    assert(longer != holder);
+    assert(strcmp(holder, "shared string value") == 0);
+    assert(strcmp(longer, "shared string value!") == 0);
+    assert(xmd_string_length(longer) == 20);
+    assert(xmd_string_hash(longer) != hash);
+    xmd_string_release(holder);
+    xmd_string_release(longer);
+
+    char* bytes = xmd_string_from("abcdef", 3);
+    assert(strcmp(bytes, "abc") == 0 && xmd_string_length(bytes) == 3);
+    xmd_string_release(bytes);
+    xmd_string_release(NULL);
+    printf("✓ test_sharing\n");
+}
+
+/**
+ * @brief Share, hash and release one string from a thread
+ */
+static void* share_repeatedly(void* text) {
+    for (int i = 0; i < 100000; i++) {
+        char* copy = xmd_string_share(text);
+        assert(xmd_string_hash(copy) != 0);
+        xmd_string_release(copy);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Threads sharing one string keep its count and hash consistent
+ */
+static void test_sharing_across_threads(void) {
+    char* text = xmd_string_dup("shared between threads");
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        assert(pthread_create(&threads[i], NULL, share_repeatedly, text) == 0);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    assert(xmd_string_of(text)->ref_count == 1);
+    xmd_string_release(text);
+    printf("✓ test_sharing_across_threads\n");
+}
+
+/**
+ * @brief Repeated appends to a sole owner grow in place geometrically
+ */
+static void test_append_amortized(void) {
+    char* text = xmd_string_with_capacity(0);
+    assert(text != NULL);
+    size_t moves = 0;
+    for (int i = 0; i < 10000; i++) {
+        char* grown = xmd_string_append(text, "xy", 2);
+        assert(grown != NULL);
+        if (grown != text) {
+            moves++;
+        }
+        text = grown;
+    }
+    assert(xmd_string_length(text) == 20000);
+    assert(text[0] == 'x' && text[19999] == 'y' && text[20000] == '\0');
+    // Capacity doubles, so the block moves at most a logarithmic number of times
+    assert(moves < 20);
+
+    // Appending part of the string to itself survives reallocation
+    size_t length = xmd_string_length(text);
+    text = xmd_string_append(text, text, length);
+    assert(text != NULL && xmd_string_length(text) == 2 * length);
+    assert(text[length] == 'x' && text[2 * length - 1] == 'y');
+    xmd_string_release(text);
+
+    // Copying a shared string sizes the copy from its length, not its spare room
+    text = xmd_string_append(xmd_string_with_capacity(1000), "ab", 2);
+    assert(text != NULL && xmd_string_of(text)->capacity >= 1000);
+    char* copy = xmd_string_append(xmd_string_share(text), "c", 1);
+    assert(copy != NULL && copy != text && strcmp(copy, "abc") == 0);
+    assert(xmd_string_of(copy)->capacity < 1000);
+    xmd_string_release(copy);
+    xmd_string_release(text);
+    printf("✓ test_append_amortized\n");
+}
+
+/**
+ * @brief Variables embed short strings and share long ones
+ */
+static void test_variables(void) {
+    variable* small = variable_create_string("short");
+    assert(small != NULL);
+    assert(xmd_string_of(small->value.string_value)->ref_count == XMD_STRING_EMBEDDED);
+    assert(xmd_string_length(small->value.string_value) == 5);
+
+    variable* copy = variable_copy(small);
+    assert(copy != NULL && copy->value.string_value != small->value.string_value);
+    assert(variable_equals(small, copy));
+    variable_unref(copy);
+
+    const char* long_text = "a string too long to be stored inside its variable";
+    variable* large = variable_create_string(long_text);
+    assert(large != NULL);
+    assert(xmd_string_of(large->value.string_value)->ref_count == 1);
+    copy = variable_copy(large);
+    assert(copy != NULL && copy->value.string_value == large->value.string_value);
+    assert(xmd_string_of(large->value.string_value)->ref_count == 2);
+    variable_unref(large);
+    assert(strcmp(copy->value.string_value, long_text) == 0);
+    variable_unref(copy);
+
+    variable* bytes = variable_create_string_length("key: value", 3);
+    assert(bytes != NULL && strcmp(bytes->value.string_value, "key") == 0);
+    assert(!variable_equals(bytes, small));
+    variable_unref(bytes);
+
+    char* text = variable_to_string(small);
+    assert(text != NULL && strcmp(text, "short") == 0);
+    xmd_free(text);
+    variable_unref(small);
+    printf("✓ test_variables\n");
+}
+
+/**
+ * @brief String concatenation with += renders the full result
+ */
+static void test_render_append(void) {
+    store* variables = store_create();
+    assert(variables != NULL);
+    const char* input = "<!-- xmd:set text = \"\" -->\n"
+                        "<!-- xmd:script\n"
+                        "text += \"start-\"\n"
+                        "text += \"abcdefghijklmnopqrstuvwxyz\"\n"
+                        "text += \"-end\"\n"
+                        "-->\n"
+                        "[{{text}}]\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    assert(strstr(output, "[start-abcdefghijklmnopqrstuvwxyz-end]") != NULL);
+    xmd_free(output);
+
+    // The variable's string was grown in place with spare capacity
+    variable* text = store_get(variables, "text");
+    assert(text != NULL && xmd_string_length(text->value.string_value) == 36);
+    assert(xmd_string_of(text->value.string_value)->ref_count == 1);
+    assert(xmd_string_of(text->value.string_value)->capacity > 36);
+    store_destroy(variables);
+    printf("✓ test_render_append\n");
+}
+
+/**
+ * @brief += in a loop grows an accumulator bound before the loop in place
+ */
+static void test_render_append_in_loop(void) {
+    char input[16384];
+    size_t used = (size_t)snprintf(input, sizeof(input), "<!-- xmd:set items = [");
+    for (int i = 0; i < 2000; i++) {
+        used += (size_t)snprintf(input + used, sizeof(input) - used, "%s\"ab\"", i ? ", " : "");
+    }
+    used += (size_t)snprintf(input + used, sizeof(input) - used,
+                             "] -->\n<!-- xmd:set text = \"\" -->\n"
+                             "<!-- xmd:for item in items --><!-- xmd:set text += item --><!-- xmd:endfor -->\n"
+                             "{{text}}\n");
+    assert(used < sizeof(input));
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator allocator = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&allocator) == 0);
+
+    store* variables = store_create();
+    assert(variables != NULL);
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    variable* text = store_get(variables, "text");
+    assert(text != NULL && xmd_string_length(text->value.string_value) == 4000);
+    assert(strstr(output, text->value.string_value) != NULL);
+    xmd_free(output);
+    store_destroy(variables);
+
+    // Copying the accumulator on every iteration would allocate over 8 MB
+    uint64_t string_bytes = stats.bytes[XMD_ALLOC_STRING];
+    xmd_allocator_set(NULL);
+    xmd_alloc_stats_destroy(&stats);
+    assert(string_bytes < 4 * 1024 * 1024);
+    printf("✓ test_render_append_in_loop\n");
+}
+
+int main(void) {
+    printf("Running xmd_string tests...\n");
+
+    test_sharing();
+    test_sharing_across_threads();
+    test_append_amortized();
+    test_variables();
+    test_render_append();
+    test_render_append_in_loop();
+
+    printf("All xmd_string tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file test_expression_cache.c
+ * @brief Test parsed-expression caching for {{expression}} substitution
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/ast_parse_cache.h"
+#include "../../include/store.h"
+#include "../../include/variable.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+extern char* ast_substitute_variables(const char* text, store* variables);
+
+/**
+ * @brief A placeholder in a loop body is parsed once
+ */
+void test_loop_placeholders() {
+    printf("Testing loop placeholders...\n");
+
+    ast_parse_cache* cache = ast_parse_cache_create();
+    store* variables = store_create();
+    assert(cache != NULL && variables != NULL);
+    ast_parse_cache_attach(cache);
+
+    const char* input = "<!-- xmd:set items = [\"a\", \"b\", \"c\"] -->\n"
+                        "<!-- xmd:for item in items -->\n"
+                        "- {{ item + \"!\" }} {{item}}\n"
+                        "<!-- xmd:endfor -->\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    assert(strstr(output, "- a! a") != NULL);
+    assert(strstr(output, "- c! c") != NULL);
+    xmd_free(output);
+
+    // Only the expression is parsed; plain variables are looked up directly
+    assert(cache->count == 1);
+    assert(cache->misses == 1);
+    assert(cache->hits == 2);
+
+    ast_parse_cache_attach(NULL);
+    store_destroy(variables);
+    ast_parse_cache_destroy(cache);
+    printf("✓ Loop placeholders test passed\n");
+}
+
+/**
+ * @brief Substitution gives the same text with and without a cache
+ */
+void test_substitution() {
+    printf("Testing substitution...\n");
+
+    store* variables = store_create();
+    assert(variables != NULL);
+    variable* name = variable_create_string("world");
+    store_set(variables, "name", name);
+    variable_unref(name);
+
+    // Names longer than the on-stack copy still resolve
+    char long_name[300];
+    memset(long_name, 'v', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = '\0';
+    variable* long_value = variable_create_string("long");
+    store_set(variables, long_name, long_value);
+    variable_unref(long_value);
+
+    char text[512];
+    snprintf(text, sizeof(text), "[{{ name }}] [{{name + \"!\"}}] [{{ missing }}] [{{ %s }}] {{open",
+             long_name);
+    const char* expected = "[world] [world!] [] [long] {{open";
+
+    char* uncached = ast_substitute_variables(text, variables);
+    assert(uncached != NULL && strcmp(uncached, expected) == 0);
+
+    ast_parse_cache* cache = ast_parse_cache_create();
+    assert(cache != NULL);
+    ast_parse_cache_attach(cache);
+    for (int i = 0; i < 2; i++) {
+        char* cached = ast_substitute_variables(text, variables);
+        assert(cached != NULL && strcmp(cached, uncached) == 0);
+        xmd_free(cached);
+    }
+    assert(cache->misses == 1 && cache->hits == 1);
+    ast_parse_cache_attach(NULL);
+
+    xmd_free(uncached);
+    ast_parse_cache_destroy(cache);
+    store_destroy(variables);
+    printf("✓ Substitution test passed\n");
+}
+
+int main() {
+    printf("=== Expression Cache Tests ===\n");
+
+    test_loop_placeholders();
+    test_substitution();
+
+    printf("\n✅ All expression cache tests passed!\n");
+    return 0;
+}
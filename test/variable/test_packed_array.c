@@ -0,0 +1,200 @@
+/**
+ * @file test_packed_array.c
+ * @brief Test packed storage for arrays of one scalar type
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/variable.h"
+#include "../../include/store.h"
+#include "../../include/json_parser.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Arrays of one scalar type stay packed and box items on access
+ */
+void test_packed_storage() {
+    printf("Testing packed storage...\n");
+
+    variable* numbers = variable_create_array();
+    for (int i = 0; i < 100; i++) {
+        assert(variable_array_add_number(numbers, i * 0.5));
+    }
+    variable_array* storage = numbers->value.array_value;
+    assert(storage->kind == VAR_ARRAY_NUMBERS);
+    assert(variable_array_size(numbers) == 100);
+    assert(storage->items == NULL);
+
+    // References do not keep a box in the array
+    variable* element = variable_array_element(numbers, 7);
+    assert(element != NULL && element->type == VAR_NUMBER && element->value.number_value == 3.5);
+    variable_unref(element);
+    assert(storage->items == NULL);
+
+    // Borrowed items are boxed once and stay put
+    variable* first = variable_array_get(numbers, 3);
+    assert(first != NULL && first->value.number_value == 1.5);
+    assert(variable_array_get(numbers, 3) == first);
+    assert(variable_array_get(numbers, 100) == NULL);
+
+    // Numbers replace in place; the stale box is dropped
+    variable* replacement = variable_create_number(-1);
+    assert(variable_array_set(numbers, 5, replacement));
+    variable_unref(replacement);
+    assert(storage->kind == VAR_ARRAY_NUMBERS);
+    assert(variable_array_get(numbers, 5)->value.number_value == -1);
+
+    // Another type boxes the array, keeping boxes handed out earlier
+    variable* text = variable_create_string("mixed");
+    assert(variable_array_add(numbers, text));
+    variable_unref(text);
+    assert(storage->kind == VAR_ARRAY_BOXED);
+    assert(variable_array_get(numbers, 3) == first);
+    assert(variable_array_get(numbers, 99)->value.number_value == 49.5);
+    assert(strcmp(variable_array_get(numbers, 100)->value.string_value, "mixed") == 0);
+    variable_unref(numbers);
+
+    variable* strings = variable_create_array();
+    assert(variable_array_add_string(strings, "alpha", 5));
+    assert(variable_array_add_string(strings, "", 0));
+    assert(variable_array_add_string(strings, "gamma-delta", 5));
+    variable* owned = variable_create_string("a string long enough to live outside its variable");
+    assert(variable_array_add(strings, owned));
+    variable_unref(owned);
+    assert(strings->value.array_value->kind == VAR_ARRAY_STRINGS);
+    assert(strcmp(variable_array_get(strings, 1)->value.string_value, "") == 0);
+    assert(strcmp(variable_array_get(strings, 2)->value.string_value, "gamma") == 0);
+    assert(strncmp(variable_array_get(strings, 3)->value.string_value, "a string long", 13) == 0);
+
+    xmd_sink sink;
+    assert(xmd_sink_init(&sink, 0));
+    for (size_t i = 0; i < 3; i++) {
+        assert(variable_array_write_item(&sink, strings, i));
+    }
+    assert(strcmp(sink.data, "alphagamma") == 0);
+    assert(!variable_array_write_item(&sink, strings, 4));
+    xmd_sink_free(&sink);
+
+    // Strings are not replaced in place
+    variable* number = variable_create_number(2);
+    assert(variable_array_set(strings, 0, number));
+    variable_unref(number);
+    assert(strings->value.array_value->kind == VAR_ARRAY_BOXED);
+    assert(variable_array_get(strings, 0)->value.number_value == 2);
+    variable_unref(strings);
+
+    variable* flags = variable_create_array();
+    for (int i = 0; i < 130; i++) {
+        assert(variable_array_add_boolean(flags, i % 3 == 0));
+    }
+    assert(flags->value.array_value->kind == VAR_ARRAY_BOOLEANS);
+    for (int i = 0; i < 130; i++) {
+        variable* flag = variable_array_element(flags, i);
+        assert(flag->type == VAR_BOOLEAN && flag->value.boolean_value == (i % 3 == 0));
+        variable_unref(flag);
+    }
+    assert(variable_to_boolean(flags));
+    variable_unref(flags);
+
+    printf("✓ Packed storage test passed\n");
+}
+
+/**
+ * @brief A large numeric JSON array costs a handful of allocations
+ */
+void test_json_numbers() {
+    printf("Testing packed JSON arrays...\n");
+
+    size_t count = 100000;
+    char* json = malloc(count * 8 + 3);
+    assert(json != NULL);
+    size_t length = 0;
+    json[length++] = '[';
+    for (size_t i = 0; i < count; i++) {
+        length += (size_t)sprintf(json + length, i > 0 ? ",%zu.5" : "%zu.5", i % 1000);
+    }
+    json[length++] = ']';
+    json[length] = '\0';
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&tracking) == 0);
+    variable* array = json_parser_parse_string(json);
+    xmd_allocator_set(NULL);
+
+    assert(array != NULL && variable_array_size(array) == count);
+    assert(array->value.array_value->kind == VAR_ARRAY_NUMBERS);
+    assert(stats.allocations[XMD_ALLOC_VARIABLE] < 10);
+    variable* last = variable_array_element(array, count - 1);
+    assert(last->value.number_value == 999.5);
+    variable_unref(last);
+    variable_unref(array);
+    xmd_alloc_stats_destroy(&stats);
+    free(json);
+
+    // Mixed arrays still box every item
+    variable* mixed = json_parser_parse_string("[1, \"two\", true, null, [3]]");
+    assert(mixed != NULL && mixed->value.array_value->kind == VAR_ARRAY_BOXED);
+    assert(variable_array_get(mixed, 0)->value.number_value == 1);
+    assert(strcmp(variable_array_get(mixed, 1)->value.string_value, "two") == 0);
+    assert(variable_array_get(mixed, 2)->value.boolean_value);
+    assert(variable_array_get(mixed, 3)->type == VAR_NULL);
+    assert(variable_array_size(variable_array_get(mixed, 4)) == 1);
+    variable_unref(mixed);
+
+    printf("✓ Packed JSON arrays test passed\n");
+}
+
+/**
+ * @brief Loops, join and indexing read packed arrays directly
+ */
+void test_render_packed() {
+    printf("Testing packed arrays in templates...\n");
+
+    store* variables = store_create();
+    variable* numbers = variable_create_array();
+    variable* words = variable_create_array();
+    for (int i = 0; i < 4; i++) {
+        variable_array_add_number(numbers, i * 1.5);
+    }
+    variable_array_add_string(words, "red", 3);
+    variable_array_add_string(words, "green", 5);
+    store_set(variables, "numbers", numbers);
+    store_set(variables, "words", words);
+
+    const char* input = "<!-- xmd:for n in numbers -->[{{n}}]<!-- xmd:endfor -->\n"
+                        "{{join(numbers, \"+\")}} {{join(words, \"/\")}}\n"
+                        "<!-- xmd:set second = words[1] -->{{second}}\n";
+    char* output = ast_process_xmd_content(input, variables);
+    assert(output != NULL);
+    assert(strstr(output, "[0][1.5][3][4.5]") != NULL);
+    assert(strstr(output, "0+1.5+3+4.5 red/green") != NULL);
+    assert(strstr(output, "green\n") != NULL);
+    xmd_free(output);
+
+    // Rendering boxed nothing into the arrays
+    assert(numbers->value.array_value->kind == VAR_ARRAY_NUMBERS && numbers->value.array_value->items == NULL);
+    assert(words->value.array_value->kind == VAR_ARRAY_STRINGS && words->value.array_value->items == NULL);
+    variable_unref(numbers);
+    variable_unref(words);
+    store_destroy(variables);
+
+    printf("✓ Packed arrays in templates test passed\n");
+}
+
+int main() {
+    printf("=== Packed Array Tests ===\n");
+
+    test_packed_storage();
+    test_json_numbers();
+    test_render_packed();
+
+    printf("\n✅ All packed array tests passed!\n");
+    return 0;
+}
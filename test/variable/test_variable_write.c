@@ -0,0 +1,219 @@
+/**
+ * @file test_variable_write.c
+ * @brief Test stringification into output sinks and number formatting
+ * @author XMD Team
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include "../../include/variable.h"
+#include "../../include/store.h"
+#include "../../include/template.h"
+#include "../../include/utils.h"
+#include "../../include/allocator.h"
+
+extern char* ast_process_xmd_content(const char* input, store* variables);
+
+/**
+ * @brief Format a number and compare with the expected text
+ * @param value Number
+ * @param expected Expected text
+ */
+static void expect_number(double value, const char* expected) {
+    char buffer[XMD_NUMBER_BUFFER_SIZE];
+    size_t length = xmd_format_number(value, buffer);
+    if (strcmp(buffer, expected) != 0) {
+        fprintf(stderr, "formatted %.17g as %s, expected %s\n", value, buffer, expected);
+        assert(0);
+    }
+    assert(length == strlen(expected));
+}
+
+/**
+ * @brief Numbers print as the shortest text that reads back exactly
+ */
+void test_number_format() {
+    printf("Testing number formatting...\n");
+
+    expect_number(0, "0");
+    expect_number(-0.0, "-0");
+    expect_number(42, "42");
+    expect_number(-17, "-17");
+    expect_number(3000000000.0, "3000000000");
+    expect_number(999999999999999.0, "999999999999999");
+    expect_number(1e15, "1e+15");
+    expect_number(0.1, "0.1");
+    expect_number(2.5, "2.5");
+    expect_number(-3.75, "-3.75");
+    expect_number(0.005, "0.005");
+    expect_number(123456.789, "123456.789");
+    expect_number(0.1 + 0.2, "0.30000000000000004");
+    expect_number(1.0 / 3.0, "0.3333333333333333");
+    expect_number(1e-5, "1e-05");
+    expect_number(1e300, "1e+300");
+    expect_number(NAN, "NaN");
+    expect_number(INFINITY, "Infinity");
+    expect_number(-INFINITY, "-Infinity");
+
+    // Every finite value reads back exactly
+    srand(7);
+    char buffer[XMD_NUMBER_BUFFER_SIZE];
+    for (int i = 0; i < 100000; i++) {
+        double value = (rand() - RAND_MAX / 2) / (double)(rand() + 1);
+        if (i % 3 == 0) {
+            value *= pow(10, rand() % 40 - 20);
+        }
+        xmd_format_number(value, buffer);
+        assert(strtod(buffer, NULL) == value);
+    }
+    printf("✓ Number formatting test passed\n");
+}
+
+/**
+ * @brief Writing a variable to a sink matches variable_to_string and allocates nothing
+ */
+void test_write_to() {
+    printf("Testing variable_write_to...\n");
+
+    variable* values[] = {
+        variable_create_null(),
+        variable_create_boolean(true),
+        variable_create_boolean(false),
+        variable_create_number(1.5),
+        variable_create_number(-12),
+        variable_create_string("text"),
+        variable_create_string("a longer string that is not embedded in the variable"),
+        variable_create_array(),
+        variable_create_object(),
+    };
+    size_t count = sizeof(values) / sizeof(values[0]);
+
+    xmd_sink sink;
+    assert(xmd_sink_init(&sink, 4096));
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&tracking) == 0);
+    for (size_t i = 0; i < count; i++) {
+        assert(values[i] != NULL);
+        assert(variable_write_to(&sink, values[i]));
+        assert(variable_write_to(&sink, NULL));
+    }
+    xmd_allocator_set(NULL);
+    uint64_t allocations = 0;
+    for (int c = 0; c < XMD_ALLOC_CATEGORY_COUNT; c++) {
+        allocations += stats.allocations[c];
+    }
+    assert(allocations == 0);
+    xmd_alloc_stats_destroy(&stats);
+
+    // The sink holds exactly what variable_to_string gives
+    xmd_sink expected;
+    assert(xmd_sink_init(&expected, 0));
+    for (size_t i = 0; i < count; i++) {
+        char* text = variable_to_string(values[i]);
+        assert(text != NULL);
+        assert(xmd_sink_append_string(&expected, text));
+        xmd_free(text);
+        variable_unref(values[i]);
+    }
+    assert(sink.length == expected.length);
+    assert(strcmp(sink.data, expected.data) == 0);
+    assert(strncmp(sink.data, "nulltruefalse1.5-12text", 23) == 0);
+    xmd_sink_free(&expected);
+
+    char* text = xmd_sink_finish(&sink);
+    assert(text != NULL && strstr(text, "[array][object]") != NULL);
+    assert(sink.data == NULL);
+    xmd_free(text);
+    printf("✓ variable_write_to test passed\n");
+}
+
+/**
+ * @brief Template interpolation allocates only its result
+ */
+void test_template_allocations() {
+    printf("Testing template allocations...\n");
+
+    store* variables = store_create();
+    assert(variables != NULL);
+    variable* name = variable_create_string("world");
+    variable* count = variable_create_number(3);
+    store_set(variables, "name", name);
+    store_set(variables, "count", count);
+    variable_unref(name);
+    variable_unref(count);
+    template_context* ctx = template_context_create(variables);
+    assert(ctx != NULL);
+
+    char input[4096] = "";
+    for (int i = 0; i < 50; i++) {
+        strcat(input, "{{ name }}:{{count}} ");
+    }
+    strcat(input, "{{missing}}");
+
+    xmd_alloc_stats stats;
+    assert(xmd_alloc_stats_init(&stats) == 0);
+    xmd_allocator tracking = xmd_alloc_stats_allocator(&stats);
+    assert(xmd_allocator_set(&tracking) == 0);
+    char* output = template_process(ctx, input);
+    xmd_allocator_set(NULL);
+
+    assert(output != NULL);
+    assert(strncmp(output, "world:3 world:3 ", 16) == 0);
+    assert(strstr(output, "{{missing}}") != NULL);
+    uint64_t allocations = 0;
+    for (int c = 0; c < XMD_ALLOC_CATEGORY_COUNT; c++) {
+        allocations += stats.allocations[c];
+    }
+    assert(allocations == 1);
+    xmd_free(output);
+    xmd_alloc_stats_destroy(&stats);
+
+    template_context_destroy(ctx);
+    store_destroy(variables);
+    printf("✓ Template allocations test passed\n");
+}
+
+/**
+ * @brief A rendered number prints the same whether or not it went through a variable
+ */
+void test_rendered_numbers() {
+    printf("Testing rendered numbers...\n");
+
+    store* variables = store_create();
+    assert(variables != NULL);
+    char* output = ast_process_xmd_content(
+        "{{0.1 + 0.2}}|<!-- xmd: set a = 0.1 + 0.2 -->{{a}}|"
+        "<!-- xmd: set third = 1 / 3 -->{{third}}|"
+        "<!-- xmd: set big = 12345678901234 -->{{big}}|"
+        "<!-- xmd: set xs = [1.5, 2, 0.1] -->{{join(xs, \",\")}}|"
+        "{{1 / 0}}|<!-- xmd: set n = 0 / 0 -->{{n}}",
+        variables);
+    assert(output != NULL);
+    const char* expected = "0.30000000000000004|0.30000000000000004|0.3333333333333333|"
+                           "12345678901234|1.5,2,0.1|Infinity|NaN";
+    if (strcmp(output, expected) != 0) {
+        fprintf(stderr, "expected: %s\nactual:   %s\n", expected, output);
+        assert(0);
+    }
+    xmd_free(output);
+    store_destroy(variables);
+    printf("✓ Rendered numbers test passed\n");
+}
+
+int main() {
+    printf("=== Variable Write Tests ===\n");
+
+    test_number_format();
+    test_write_to();
+    test_template_allocations();
+    test_rendered_numbers();
+
+    printf("\n✅ All variable write tests passed!\n");
+    return 0;
+}
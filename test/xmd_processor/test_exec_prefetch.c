@@ -0,0 +1,143 @@
+/**
+ * @file test_exec_prefetch.c
+ * @brief Test concurrent execution of independent exec directives
+ * @author XMD Team
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../include/xmd_processor_internal.h"
+#include "../../include/config.h"
+#include "../../include/store.h"
+#include "../../include/allocator.h"
+
+static const char* doc =
+    "A\n"
+    "<!-- xmd:exec echo one -->\n"
+    "<!-- xmd:set x = \"v\" -->\n"
+    "<!-- xmd:exec echo {{x}} -->\n"
+    "<!-- xmd:exec echo two -->\n"
+    "<!-- xmd:if x == \"v\" -->\n"
+    "<!-- xmd:exec echo cond -->\n"
+    "<!-- xmd:endif -->\n"
+    "<!-- xmd:exec echo three -->\n"
+    "B\n";
+
+/**
+ * @brief Only unconditional, variable-free execs are collected
+ */
+void test_scan_selects_independent_execs() {
+    printf("Testing exec prefetch scan...\n");
+
+    exec_prefetch* prefetch = exec_prefetch_scan(doc);
+    assert(prefetch != NULL);
+    assert(prefetch->count == 3);
+    assert(strcmp(prefetch->commands[0], "echo one") == 0);
+    assert(strcmp(prefetch->commands[1], "echo two") == 0);
+    assert(strcmp(prefetch->commands[2], "echo three") == 0);
+    assert(prefetch->offsets[0] < prefetch->offsets[1]);
+    assert(prefetch->offsets[1] < prefetch->offsets[2]);
+    exec_prefetch_free(prefetch);
+
+    assert(exec_prefetch_scan("no directives here") == NULL);
+
+    printf("✓ Exec prefetch scan test passed\n");
+}
+
+/**
+ * @brief Outputs are stored per directive and taken exactly once
+ */
+void test_run_and_take() {
+    printf("Testing exec prefetch run/take...\n");
+
+    exec_prefetch* prefetch = exec_prefetch_scan(doc);
+    assert(prefetch != NULL);
+    exec_prefetch_run(prefetch, 4);
+
+    char* out = exec_prefetch_take(prefetch, prefetch->offsets[1]);
+    assert(out != NULL);
+    assert(strcmp(out, "two") == 0);
+    free(out);
+    assert(exec_prefetch_take(prefetch, prefetch->offsets[1]) == NULL);
+    assert(exec_prefetch_take(prefetch, prefetch->offsets[0] + 1) == NULL);
+
+    exec_prefetch_free(prefetch);
+    printf("✓ Exec prefetch run/take test passed\n");
+}
+
+/**
+ * @brief Parallel rendering matches sequential rendering byte for byte
+ */
+void test_parallel_matches_sequential() {
+    printf("Testing parallel exec output order...\n");
+
+    xmd_internal_config* config = xmd_internal_config_get_global();
+    assert(config != NULL);
+
+    config->limits.max_parallel_exec = 1;
+    store* vars = store_create();
+    char* sequential = ast_process_xmd_content(doc, vars);
+    store_destroy(vars);
+
+    config->limits.max_parallel_exec = 4;
+    vars = store_create();
+    char* parallel = ast_process_xmd_content(doc, vars);
+    store_destroy(vars);
+    config->limits.max_parallel_exec = 1;
+
+    assert(sequential != NULL && parallel != NULL);
+    assert(strcmp(sequential, parallel) == 0);
+    assert(strstr(parallel, "one") < strstr(parallel, "two"));
+    assert(strstr(parallel, "two") < strstr(parallel, "three"));
+
+    free(sequential);
+    free(parallel);
+    printf("✓ Parallel exec output order test passed\n");
+}
+
+/**
+ * @brief Outputs made on worker threads are charged to the render's budget
+ */
+void test_outputs_charged_to_budget() {
+    printf("Testing exec prefetch heap budget...\n");
+
+    xmd_heap_budget budget;
+    xmd_heap_budget_init(&budget, 0);
+    xmd_heap_budget* previous = xmd_heap_budget_attach(&budget);
+    exec_prefetch* prefetch = exec_prefetch_scan(doc);
+    assert(prefetch != NULL);
+    uint64_t scanned = budget.live_bytes;
+    exec_prefetch_run(prefetch, 4);
+    assert(budget.live_bytes >= scanned + strlen("one two three") + 2);
+    exec_prefetch_free(prefetch);
+    assert(budget.live_bytes == 0);
+
+    // Outputs past the limit are dropped and left to the main pass
+    prefetch = exec_prefetch_scan(doc);
+    assert(prefetch != NULL);
+    budget.limit_bytes = budget.live_bytes + 1;
+    exec_prefetch_run(prefetch, 4);
+    assert(budget.exceeded);
+    assert(exec_prefetch_take(prefetch, prefetch->offsets[0]) == NULL);
+    budget.limit_bytes = 0;
+    exec_prefetch_free(prefetch);
+    assert(budget.live_bytes == 0);
+    xmd_heap_budget_attach(previous);
+
+    printf("✓ Exec prefetch heap budget test passed\n");
+}
+
+int main() {
+    printf("=== Exec Prefetch Tests ===\n");
+
+    test_scan_selects_independent_execs();
+    test_run_and_take();
+    test_parallel_matches_sequential();
+    test_outputs_charged_to_budget();
+
+    printf("\n✅ All exec prefetch tests passed!\n");
+    return 0;
+}